@@ -0,0 +1,197 @@
+#include "Commands/Animation/BuildAnimStateMachineCommand.h"
+#include "Animation/AnimBlueprint.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+
+FBuildAnimStateMachineCommand::FBuildAnimStateMachineCommand(IAnimationBlueprintService& InService)
+    : Service(InService)
+{
+}
+
+FString FBuildAnimStateMachineCommand::Execute(const FString& Parameters)
+{
+    FString AnimBlueprintName, Error;
+    FAnimStateMachineBuildParams Params;
+    if (!ParseParameters(Parameters, AnimBlueprintName, Params, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    UAnimBlueprint* AnimBlueprint = Service.FindAnimBlueprint(AnimBlueprintName);
+    if (!AnimBlueprint)
+    {
+        return CreateErrorResponse(FString::Printf(TEXT("Animation Blueprint '%s' not found"), *AnimBlueprintName));
+    }
+
+    FAnimStateMachineBuildResult Result;
+    if (!Service.BuildStateMachine(AnimBlueprint, Params, Result, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    return CreateSuccessResponse(Params, Result);
+}
+
+FString FBuildAnimStateMachineCommand::GetCommandName() const
+{
+    return TEXT("build_anim_state_machine");
+}
+
+bool FBuildAnimStateMachineCommand::ValidateParams(const FString& Parameters) const
+{
+    FString AnimBlueprintName, Error;
+    FAnimStateMachineBuildParams Params;
+    return ParseParameters(Parameters, AnimBlueprintName, Params, Error);
+}
+
+bool FBuildAnimStateMachineCommand::ParseParameters(const FString& JsonString, FString& OutAnimBlueprintName, FAnimStateMachineBuildParams& OutParams, FString& OutError)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    if (!JsonObject->TryGetStringField(TEXT("anim_blueprint_name"), OutAnimBlueprintName) || OutAnimBlueprintName.IsEmpty())
+    {
+        OutError = TEXT("Missing required 'anim_blueprint_name' parameter");
+        return false;
+    }
+
+    OutParams = FAnimStateMachineBuildParams();
+    if (!JsonObject->TryGetStringField(TEXT("state_machine_name"), OutParams.StateMachineName) || OutParams.StateMachineName.IsEmpty())
+    {
+        OutError = TEXT("Missing required 'state_machine_name' parameter");
+        return false;
+    }
+
+    JsonObject->TryGetStringField(TEXT("entry_state"), OutParams.EntryStateName);
+    JsonObject->TryGetBoolField(TEXT("create_if_missing"), OutParams.bCreateIfMissing);
+    JsonObject->TryGetBoolField(TEXT("compile"), OutParams.bCompile);
+
+    const TArray<TSharedPtr<FJsonValue>>* StatesArray = nullptr;
+    if (JsonObject->TryGetArrayField(TEXT("states"), StatesArray))
+    {
+        for (int32 Index = 0; Index < StatesArray->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonObject>* StateObj = nullptr;
+            if (!(*StatesArray)[Index]->TryGetObject(StateObj))
+            {
+                OutError = FString::Printf(TEXT("State %d is not an object"), Index);
+                return false;
+            }
+
+            FAnimStateParams& State = OutParams.States.AddDefaulted_GetRef();
+            if (!(*StateObj)->TryGetStringField(TEXT("state_name"), State.StateName) || State.StateName.IsEmpty())
+            {
+                OutError = FString::Printf(TEXT("State %d is missing 'state_name'"), Index);
+                return false;
+            }
+
+            (*StateObj)->TryGetStringField(TEXT("animation_asset_path"), State.AnimationAssetPath);
+            (*StateObj)->TryGetBoolField(TEXT("is_default_state"), State.bIsDefaultState);
+
+            double PosX = 0.0, PosY = 0.0;
+            (*StateObj)->TryGetNumberField(TEXT("node_position_x"), PosX);
+            (*StateObj)->TryGetNumberField(TEXT("node_position_y"), PosY);
+            State.NodePosition = FVector2D(PosX, PosY);
+        }
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* TransitionsArray = nullptr;
+    if (JsonObject->TryGetArrayField(TEXT("transitions"), TransitionsArray))
+    {
+        for (int32 Index = 0; Index < TransitionsArray->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonObject>* TransitionObj = nullptr;
+            if (!(*TransitionsArray)[Index]->TryGetObject(TransitionObj))
+            {
+                OutError = FString::Printf(TEXT("Transition %d is not an object"), Index);
+                return false;
+            }
+
+            FAnimTransitionParams& Transition = OutParams.Transitions.AddDefaulted_GetRef();
+            if (!(*TransitionObj)->TryGetStringField(TEXT("from_state"), Transition.FromStateName) ||
+                !(*TransitionObj)->TryGetStringField(TEXT("to_state"), Transition.ToStateName))
+            {
+                OutError = FString::Printf(TEXT("Transition %d is missing 'from_state' or 'to_state'"), Index);
+                return false;
+            }
+
+            (*TransitionObj)->TryGetStringField(TEXT("transition_rule_type"), Transition.TransitionRuleType);
+            (*TransitionObj)->TryGetStringField(TEXT("condition_variable"), Transition.ConditionVariableName);
+
+            double BlendDuration = Transition.BlendDuration;
+            if ((*TransitionObj)->TryGetNumberField(TEXT("blend_duration"), BlendDuration))
+            {
+                Transition.BlendDuration = static_cast<float>(BlendDuration);
+            }
+        }
+    }
+
+    if (OutParams.States.Num() == 0 && OutParams.Transitions.Num() == 0 && OutParams.EntryStateName.IsEmpty())
+    {
+        OutError = TEXT("Nothing to build: provide 'states', 'transitions' or 'entry_state'");
+        return false;
+    }
+
+    return true;
+}
+
+FString FBuildAnimStateMachineCommand::CreateSuccessResponse(const FAnimStateMachineBuildParams& Params, const FAnimStateMachineBuildResult& Result) const
+{
+    TArray<TSharedPtr<FJsonValue>> FailedArray;
+    for (const FAnimStateMachineBuildItemError& ItemError : Result.ItemErrors)
+    {
+        TSharedPtr<FJsonObject> FailedObj = MakeShared<FJsonObject>();
+        FailedObj->SetStringField(TEXT("kind"), ItemError.Kind);
+        if (ItemError.Kind == TEXT("state") && Params.States.IsValidIndex(ItemError.Index))
+        {
+            FailedObj->SetNumberField(TEXT("index"), ItemError.Index);
+            FailedObj->SetStringField(TEXT("state_name"), Params.States[ItemError.Index].StateName);
+        }
+        else if (ItemError.Kind == TEXT("transition") && Params.Transitions.IsValidIndex(ItemError.Index))
+        {
+            FailedObj->SetNumberField(TEXT("index"), ItemError.Index);
+            FailedObj->SetStringField(TEXT("from_state"), Params.Transitions[ItemError.Index].FromStateName);
+            FailedObj->SetStringField(TEXT("to_state"), Params.Transitions[ItemError.Index].ToStateName);
+        }
+        FailedObj->SetStringField(TEXT("error"), ItemError.Error);
+        FailedArray.Add(MakeShared<FJsonValueObject>(FailedObj));
+    }
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetStringField(TEXT("state_machine"), Params.StateMachineName);
+    ResponseObj->SetStringField(TEXT("message"), FString::Printf(TEXT("Built state machine '%s': %d/%d states, %d/%d transitions"),
+        *Params.StateMachineName, Result.NumStatesAdded, Params.States.Num(), Result.NumTransitionsAdded, Params.Transitions.Num()));
+    ResponseObj->SetBoolField(TEXT("created_state_machine"), Result.bCreatedStateMachine);
+    ResponseObj->SetNumberField(TEXT("states_added"), Result.NumStatesAdded);
+    ResponseObj->SetNumberField(TEXT("transitions_added"), Result.NumTransitionsAdded);
+    ResponseObj->SetArrayField(TEXT("failed"), FailedArray);
+    ResponseObj->SetBoolField(TEXT("compiled"), Result.bCompiled);
+    if (!Result.CompileError.IsEmpty())
+    {
+        ResponseObj->SetStringField(TEXT("compile_error"), Result.CompileError);
+    }
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+FString FBuildAnimStateMachineCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), false);
+    ResponseObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
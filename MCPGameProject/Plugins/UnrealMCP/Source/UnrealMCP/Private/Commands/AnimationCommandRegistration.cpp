@@ -5,6 +5,7 @@
 #include "Commands/Animation/CreateAnimStateMachineCommand.h"
 #include "Commands/Animation/AddAnimStateCommand.h"
 #include "Commands/Animation/AddAnimTransitionCommand.h"
+#include "Commands/Animation/BuildAnimStateMachineCommand.h"
 #include "Commands/Animation/AddAnimVariableCommand.h"
 #include "Commands/Animation/GetAnimBlueprintMetadataCommand.h"
 #include "Commands/Animation/ConfigureAnimSlotCommand.h"
@@ -27,6 +28,7 @@ void FAnimationCommandRegistration::RegisterAllAnimationCommands()
     RegisterCreateAnimStateMachineCommand();
     RegisterAddAnimStateCommand();
     RegisterAddAnimTransitionCommand();
+    RegisterBuildAnimStateMachineCommand();
     RegisterAddAnimVariableCommand();
     RegisterGetAnimBlueprintMetadataCommand();
     RegisterConfigureAnimSlotCommand();
@@ -87,6 +89,12 @@ void FAnimationCommandRegistration::RegisterAddAnimTransitionCommand()
     RegisterAndTrackCommand(Command);
 }
 
+void FAnimationCommandRegistration::RegisterBuildAnimStateMachineCommand()
+{
+    TSharedPtr<FBuildAnimStateMachineCommand> Command = MakeShared<FBuildAnimStateMachineCommand>(FAnimationBlueprintService::Get());
+    RegisterAndTrackCommand(Command);
+}
+
 void FAnimationCommandRegistration::RegisterAddAnimVariableCommand()
 {
     TSharedPtr<FAddAnimVariableCommand> Command = MakeShared<FAddAnimVariableCommand>(FAnimationBlueprintService::Get());
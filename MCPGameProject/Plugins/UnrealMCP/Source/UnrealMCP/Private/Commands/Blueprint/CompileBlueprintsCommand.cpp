@@ -0,0 +1,159 @@
+#include "Commands/Blueprint/CompileBlueprintsCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Engine/Blueprint.h"
+
+namespace
+{
+    constexpr int32 MaxBlueprintsPerBatch = 500;
+
+    FString SerializeCompileResponse(const TSharedRef<FJsonObject>& ResponseObj)
+    {
+        FString OutputString;
+        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+        FJsonSerializer::Serialize(ResponseObj, Writer);
+        return OutputString;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> ToJsonStrings(const TArray<FString>& Strings)
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        Values.Reserve(Strings.Num());
+        for (const FString& String : Strings)
+        {
+            Values.Add(MakeShared<FJsonValueString>(String));
+        }
+        return Values;
+    }
+}
+
+FCompileBlueprintsCommand::FCompileBlueprintsCommand(IBlueprintService& InBlueprintService)
+    : BlueprintService(InBlueprintService)
+{
+}
+
+FString FCompileBlueprintsCommand::Execute(const FString& Parameters)
+{
+    TArray<FString> BlueprintNames;
+    bool bSkipUpToDate = true;
+    FString ParseError;
+
+    if (!ParseParameters(Parameters, BlueprintNames, bSkipUpToDate, ParseError))
+    {
+        TSharedRef<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+        ErrorObj->SetBoolField(TEXT("success"), false);
+        ErrorObj->SetStringField(TEXT("error"), ParseError);
+        return SerializeCompileResponse(ErrorObj);
+    }
+
+    // Missing Blueprints are reported per entry; the rest of the batch still compiles
+    TArray<TPair<FString, UBlueprint*>> Targets;
+    Targets.Reserve(BlueprintNames.Num());
+    for (const FString& BlueprintName : BlueprintNames)
+    {
+        Targets.Emplace(BlueprintName, BlueprintService.FindBlueprint(BlueprintName));
+    }
+
+    FBlueprintBatchCompileResult Batch;
+    const bool bAllSucceeded = BlueprintService.CompileBlueprints(Targets, bSkipUpToDate, Batch);
+
+    TArray<TSharedPtr<FJsonValue>> ResultValues;
+    TArray<FString> FailedNames;
+    for (const FBlueprintCompileResult& Result : Batch.Results)
+    {
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("blueprint_name"), Result.BlueprintName);
+        ResultObj->SetStringField(TEXT("status"), Result.Status);
+        ResultObj->SetBoolField(TEXT("skipped"), Result.bSkipped);
+        if (Result.Errors.Num() > 0)
+        {
+            ResultObj->SetArrayField(TEXT("errors"), ToJsonStrings(Result.Errors));
+            if (!Result.bSkipped)
+            {
+                FailedNames.Add(Result.BlueprintName);
+            }
+        }
+        if (Result.Warnings.Num() > 0)
+        {
+            ResultObj->SetArrayField(TEXT("warnings"), ToJsonStrings(Result.Warnings));
+        }
+        ResultValues.Add(MakeShared<FJsonValueObject>(ResultObj));
+    }
+
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), bAllSucceeded);
+    if (!bAllSucceeded)
+    {
+        ResponseObj->SetStringField(TEXT("error"), FString::Printf(TEXT("%d Blueprint(s) failed to compile: %s"),
+            Batch.NumFailed, *FString::Join(FailedNames, TEXT(", "))));
+    }
+    ResponseObj->SetNumberField(TEXT("compiled"), Batch.NumCompiled);
+    ResponseObj->SetNumberField(TEXT("skipped"), Batch.NumSkipped);
+    ResponseObj->SetNumberField(TEXT("failed"), Batch.NumFailed);
+    ResponseObj->SetNumberField(TEXT("queue_ms"), Batch.QueueMs);
+    ResponseObj->SetNumberField(TEXT("compile_ms"), Batch.CompileMs);
+    ResponseObj->SetNumberField(TEXT("collect_ms"), Batch.CollectMs);
+    ResponseObj->SetArrayField(TEXT("dependents_recompiled"), ToJsonStrings(Batch.DependentsRecompiled));
+    ResponseObj->SetArrayField(TEXT("results"), ResultValues);
+    return SerializeCompileResponse(ResponseObj);
+}
+
+FString FCompileBlueprintsCommand::GetCommandName() const
+{
+    return TEXT("compile_blueprints");
+}
+
+bool FCompileBlueprintsCommand::ValidateParams(const FString& Parameters) const
+{
+    TArray<FString> BlueprintNames;
+    bool bSkipUpToDate;
+    FString ParseError;
+    return ParseParameters(Parameters, BlueprintNames, bSkipUpToDate, ParseError);
+}
+
+bool FCompileBlueprintsCommand::ParseParameters(const FString& JsonString, TArray<FString>& OutBlueprintNames, bool& bOutSkipUpToDate, FString& OutError)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* NameValues = nullptr;
+    if (!JsonObject->TryGetArrayField(TEXT("blueprint_names"), NameValues))
+    {
+        OutError = TEXT("Missing required 'blueprint_names' parameter");
+        return false;
+    }
+
+    OutBlueprintNames.Reset();
+    for (const TSharedPtr<FJsonValue>& Value : *NameValues)
+    {
+        FString BlueprintName;
+        if (!Value.IsValid() || !Value->TryGetString(BlueprintName) || BlueprintName.IsEmpty())
+        {
+            OutError = TEXT("'blueprint_names' must contain non-empty strings");
+            return false;
+        }
+        OutBlueprintNames.AddUnique(BlueprintName);
+    }
+
+    if (OutBlueprintNames.Num() == 0)
+    {
+        OutError = TEXT("'blueprint_names' is empty");
+        return false;
+    }
+    if (OutBlueprintNames.Num() > MaxBlueprintsPerBatch)
+    {
+        OutError = FString::Printf(TEXT("At most %d Blueprints can be compiled per call"), MaxBlueprintsPerBatch);
+        return false;
+    }
+
+    bOutSkipUpToDate = true;
+    JsonObject->TryGetBoolField(TEXT("skip_up_to_date"), bOutSkipUpToDate);
+    return true;
+}
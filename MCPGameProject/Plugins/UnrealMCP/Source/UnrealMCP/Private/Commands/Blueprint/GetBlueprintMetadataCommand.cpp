@@ -1,6 +1,7 @@
 #include "Commands/Blueprint/GetBlueprintMetadataCommand.h"
 #include "Engine/Blueprint.h"
 #include "Services/AssetDiscoveryService.h"
+#include "Services/MetadataResponseCache.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -29,8 +30,10 @@ FString FGetBlueprintMetadataCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(FString::Printf(TEXT("Blueprint '%s' not found"), *BlueprintName));
     }
 
-    TSharedPtr<FJsonObject> Metadata = BuildMetadata(Blueprint, Fields, Filter);
-    return CreateSuccessResponse(Metadata);
+    return FMetadataResponseCache::Get().Serve(GetCommandName(), Parameters, Blueprint, [&]()
+    {
+        return CreateSuccessResponse(BuildMetadata(Blueprint, Fields, Filter));
+    });
 }
 
 FString FGetBlueprintMetadataCommand::GetCommandName() const
@@ -228,17 +231,12 @@ TSharedPtr<FJsonObject> FGetBlueprintMetadataCommand::BuildMetadata(UBlueprint*
     return Metadata;
 }
 
-FString FGetBlueprintMetadataCommand::CreateSuccessResponse(const TSharedPtr<FJsonObject>& Metadata) const
+TSharedPtr<FJsonObject> FGetBlueprintMetadataCommand::CreateSuccessResponse(const TSharedPtr<FJsonObject>& Metadata) const
 {
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
     ResponseObj->SetBoolField(TEXT("success"), true);
     ResponseObj->SetObjectField(TEXT("metadata"), Metadata);
-
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
-
-    return OutputString;
+    return ResponseObj;
 }
 
 FString FGetBlueprintMetadataCommand::CreateErrorResponse(const FString& ErrorMessage) const
@@ -0,0 +1,251 @@
+#include "Commands/Editor/BulkImportCommand.h"
+#include "Services/BulkImportService.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Dom/JsonObject.h"
+#include "Misc/Paths.h"
+#include "ObjectTools.h"
+
+namespace
+{
+/** import_static_mesh options forwarded untouched for mesh items */
+const TCHAR* const MeshOptionKeys[] = {
+	TEXT("import_materials"),
+	TEXT("auto_generate_collision"),
+	TEXT("vertex_color_import_option"),
+	TEXT("vertex_override_color")
+};
+
+constexpr int32 MaxBulkImportFiles = 2000;
+
+FString SerializeBulkImportResponse(const TSharedRef<FJsonObject>& Response)
+{
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(Response, Writer);
+	return OutputString;
+}
+
+FString CreateBulkImportError(const FString& ErrorMessage)
+{
+	TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+	Response->SetBoolField(TEXT("success"), false);
+	Response->SetStringField(TEXT("error"), ErrorMessage);
+	return SerializeBulkImportResponse(Response);
+}
+
+/** Same normalization as import_texture: everything lands under /Game */
+FString NormalizeFolderPath(const FString& FolderPath)
+{
+	if (FolderPath.StartsWith(TEXT("/Game")))
+	{
+		return FolderPath;
+	}
+	return FolderPath.StartsWith(TEXT("/")) ? TEXT("/Game") + FolderPath : TEXT("/Game/") + FolderPath;
+}
+
+bool ParseTypeName(const FString& TypeName, EBulkImportAssetType& OutType)
+{
+	if (TypeName == TEXT("static_mesh") || TypeName == TEXT("mesh"))
+	{
+		OutType = EBulkImportAssetType::StaticMesh;
+		return true;
+	}
+	if (TypeName == TEXT("texture"))
+	{
+		OutType = EBulkImportAssetType::Texture;
+		return true;
+	}
+	if (TypeName == TEXT("sound"))
+	{
+		OutType = EBulkImportAssetType::Sound;
+		return true;
+	}
+	return false;
+}
+}
+
+FBulkImportCommand::FBulkImportCommand(TSharedRef<IBulkImportBackend> InBackend)
+	: Backend(InBackend)
+{
+}
+
+FString FBulkImportCommand::GetCommandName() const
+{
+	return TEXT("bulk_import");
+}
+
+bool FBulkImportCommand::ValidateParams(const FString& Parameters) const
+{
+	TArray<FBulkImportItem> Items;
+	FBulkImportJobOptions Options;
+	FString Error;
+	return ParseParameters(Parameters, Items, Options, Error);
+}
+
+FString FBulkImportCommand::Execute(const FString& Parameters)
+{
+	TArray<FBulkImportItem> Items;
+	FBulkImportJobOptions Options;
+	FString Error;
+	if (!ParseParameters(Parameters, Items, Options, Error))
+	{
+		return CreateBulkImportError(Error);
+	}
+
+	const int32 ItemCount = Items.Num();
+	const FString JobId = FBulkImportService::Get().StartJob(MoveTemp(Items), Options, Backend);
+
+	TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+	Response->SetBoolField(TEXT("success"), true);
+	Response->SetStringField(TEXT("job_id"), JobId);
+	Response->SetNumberField(TEXT("item_count"), ItemCount);
+	Response->SetNumberField(TEXT("frame_budget_ms"), Options.FrameBudgetMs);
+	Response->SetNumberField(TEXT("max_concurrent_reads"), Options.MaxConcurrentReads);
+	Response->SetStringField(TEXT("message"), FString::Printf(
+		TEXT("Queued %d file(s) for import. Poll get_bulk_import_status with job_id '%s'."), ItemCount, *JobId));
+	return SerializeBulkImportResponse(Response);
+}
+
+bool FBulkImportCommand::ParseParameters(const FString& JsonString, TArray<FBulkImportItem>& OutItems, FBulkImportJobOptions& OutOptions, FString& OutError)
+{
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		OutError = TEXT("Failed to parse JSON parameters");
+		return false;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* Files = nullptr;
+	if (!JsonObject->TryGetArrayField(TEXT("files"), Files) || Files->Num() == 0)
+	{
+		OutError = TEXT("Missing required parameter: files (non-empty array)");
+		return false;
+	}
+	if (Files->Num() > MaxBulkImportFiles)
+	{
+		OutError = FString::Printf(TEXT("Too many files: %d (max %d per job)"), Files->Num(), MaxBulkImportFiles);
+		return false;
+	}
+
+	double FrameBudgetMs = OutOptions.FrameBudgetMs;
+	JsonObject->TryGetNumberField(TEXT("frame_budget_ms"), FrameBudgetMs);
+	OutOptions.FrameBudgetMs = FMath::Clamp(FrameBudgetMs, 1.0, 100.0);
+
+	int32 MaxConcurrentReads = OutOptions.MaxConcurrentReads;
+	JsonObject->TryGetNumberField(TEXT("max_concurrent_reads"), MaxConcurrentReads);
+	OutOptions.MaxConcurrentReads = FMath::Clamp(MaxConcurrentReads, 1, 16);
+
+	FString DefaultFolderPath;
+	JsonObject->TryGetStringField(TEXT("folder_path"), DefaultFolderPath);
+
+	OutItems.Reset(Files->Num());
+	TSet<FString> Destinations;
+	for (int32 Index = 0; Index < Files->Num(); ++Index)
+	{
+		const TSharedPtr<FJsonValue>& Entry = (*Files)[Index];
+
+		// Plain paths use the top-level settings; objects may override any of them
+		TSharedPtr<FJsonObject> EntryObject;
+		const TSharedPtr<FJsonObject>* EntryObjectPtr = nullptr;
+		FString SourceFilePath;
+		if (Entry->TryGetObject(EntryObjectPtr))
+		{
+			EntryObject = *EntryObjectPtr;
+			EntryObject->TryGetStringField(TEXT("source_file_path"), SourceFilePath);
+		}
+		else
+		{
+			Entry->TryGetString(SourceFilePath);
+			EntryObject = MakeShared<FJsonObject>();
+		}
+
+		if (SourceFilePath.IsEmpty())
+		{
+			OutError = FString::Printf(TEXT("files[%d]: missing source_file_path"), Index);
+			return false;
+		}
+
+		FBulkImportItem& Item = OutItems.AddDefaulted_GetRef();
+		Item.SourceFilePath = SourceFilePath;
+
+		FString TypeName;
+		if (EntryObject->TryGetStringField(TEXT("type"), TypeName) && !TypeName.IsEmpty())
+		{
+			if (!ParseTypeName(TypeName.ToLower(), Item.Type))
+			{
+				OutError = FString::Printf(TEXT("files[%d]: unknown type '%s'. Use static_mesh, texture or sound"), Index, *TypeName);
+				return false;
+			}
+		}
+		else if (!FBulkImportItem::ResolveType(FPaths::GetExtension(SourceFilePath), Item.Type))
+		{
+			OutError = FString::Printf(TEXT("files[%d]: unsupported file type: %s"), Index, *SourceFilePath);
+			return false;
+		}
+
+		if (!EntryObject->TryGetStringField(TEXT("asset_name"), Item.AssetName) || Item.AssetName.IsEmpty())
+		{
+			Item.AssetName = ObjectTools::SanitizeObjectName(FPaths::GetBaseFilename(SourceFilePath));
+		}
+
+		FString FolderPath;
+		if (!EntryObject->TryGetStringField(TEXT("folder_path"), FolderPath) || FolderPath.IsEmpty())
+		{
+			FolderPath = DefaultFolderPath.IsEmpty() ? FBulkImportItem::DefaultFolder(Item.Type) : DefaultFolderPath;
+		}
+		Item.FolderPath = NormalizeFolderPath(FolderPath);
+
+		// Multi-mesh FBX files name their own outputs, so only single-asset types can collide
+		if (Item.Type != EBulkImportAssetType::StaticMesh)
+		{
+			const FString Destination = Item.FolderPath / Item.AssetName;
+			if (Destinations.Contains(Destination))
+			{
+				OutError = FString::Printf(TEXT("files[%d]: destination %s is used by an earlier file"), Index, *Destination);
+				return false;
+			}
+			Destinations.Add(Destination);
+		}
+
+		auto GetString = [&](const TCHAR* Field, FString& Out)
+		{
+			if (!EntryObject->TryGetStringField(Field, Out))
+			{
+				JsonObject->TryGetStringField(Field, Out);
+			}
+		};
+		auto GetBool = [&](const TCHAR* Field, bool& Out)
+		{
+			if (!EntryObject->TryGetBoolField(Field, Out))
+			{
+				JsonObject->TryGetBoolField(Field, Out);
+			}
+		};
+
+		if (Item.Type == EBulkImportAssetType::Texture)
+		{
+			GetString(TEXT("compression_settings"), Item.CompressionSettings);
+			GetBool(TEXT("srgb"), Item.bSRGB);
+			GetBool(TEXT("preserve_alpha"), Item.bPreserveAlpha);
+		}
+		else if (Item.Type == EBulkImportAssetType::StaticMesh)
+		{
+			Item.MeshOptions = MakeShared<FJsonObject>();
+			for (const TCHAR* Key : MeshOptionKeys)
+			{
+				if (TSharedPtr<FJsonValue> Value = EntryObject->TryGetField(Key))
+				{
+					Item.MeshOptions->SetField(Key, Value);
+				}
+				else if (TSharedPtr<FJsonValue> DefaultValue = JsonObject->TryGetField(Key))
+				{
+					Item.MeshOptions->SetField(Key, DefaultValue);
+				}
+			}
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,62 @@
+#include "Commands/Editor/CancelJobCommand.h"
+#include "Services/MCPJobService.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Dom/JsonObject.h"
+
+namespace
+{
+FString SerializeCancelJobResponse(const TSharedRef<FJsonObject>& Response)
+{
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(Response, Writer);
+	return OutputString;
+}
+
+bool ParseCancelParams(const FString& Parameters, FString& OutJobId, FString& OutError)
+{
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		OutError = TEXT("Failed to parse JSON parameters");
+		return false;
+	}
+	if (!JsonObject->TryGetStringField(TEXT("job_id"), OutJobId) || OutJobId.IsEmpty())
+	{
+		OutError = TEXT("Missing required parameter: job_id");
+		return false;
+	}
+	return true;
+}
+}
+
+FString FCancelJobCommand::GetCommandName() const
+{
+	return TEXT("cancel_job");
+}
+
+bool FCancelJobCommand::ValidateParams(const FString& Parameters) const
+{
+	FString JobId, Error;
+	return ParseCancelParams(Parameters, JobId, Error);
+}
+
+FString FCancelJobCommand::Execute(const FString& Parameters)
+{
+	FString JobId, Error;
+	TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+	if (!ParseCancelParams(Parameters, JobId, Error) || !FMCPJobService::Get().Cancel(JobId, Error))
+	{
+		Response->SetBoolField(TEXT("success"), false);
+		Response->SetStringField(TEXT("error"), Error);
+		return SerializeCancelJobResponse(Response);
+	}
+
+	Response->SetBoolField(TEXT("success"), true);
+	Response->SetStringField(TEXT("job_id"), JobId);
+	Response->SetStringField(TEXT("state"), FMCPJobSnapshot::StateToString(EMCPJobState::Cancelled));
+	Response->SetStringField(TEXT("message"), FString::Printf(TEXT("Cancellation requested for %s"), *JobId));
+	return SerializeCancelJobResponse(Response);
+}
@@ -0,0 +1,135 @@
+#include "Commands/Editor/GetBulkImportStatusCommand.h"
+#include "Services/BulkImportService.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Dom/JsonObject.h"
+
+namespace
+{
+FString SerializeBulkImportStatus(const TSharedRef<FJsonObject>& Response)
+{
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(Response, Writer);
+	return OutputString;
+}
+
+const TCHAR* ItemStateToString(EBulkImportItemState State)
+{
+	switch (State)
+	{
+	case EBulkImportItemState::Queued: return TEXT("queued");
+	case EBulkImportItemState::Reading: return TEXT("reading");
+	case EBulkImportItemState::Ready: return TEXT("ready");
+	case EBulkImportItemState::Importing: return TEXT("importing");
+	case EBulkImportItemState::Succeeded: return TEXT("succeeded");
+	default: return TEXT("failed");
+	}
+}
+
+bool ParseStatusParams(const FString& Parameters, FString& OutJobId, bool& OutIncludeItems, FString& OutError)
+{
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		OutError = TEXT("Failed to parse JSON parameters");
+		return false;
+	}
+	if (!JsonObject->TryGetStringField(TEXT("job_id"), OutJobId) || OutJobId.IsEmpty())
+	{
+		OutError = TEXT("Missing required parameter: job_id");
+		return false;
+	}
+	OutIncludeItems = true;
+	JsonObject->TryGetBoolField(TEXT("include_items"), OutIncludeItems);
+	return true;
+}
+}
+
+FString FGetBulkImportStatusCommand::GetCommandName() const
+{
+	return TEXT("get_bulk_import_status");
+}
+
+bool FGetBulkImportStatusCommand::ValidateParams(const FString& Parameters) const
+{
+	FString JobId, Error;
+	bool bIncludeItems = true;
+	return ParseStatusParams(Parameters, JobId, bIncludeItems, Error);
+}
+
+FString FGetBulkImportStatusCommand::Execute(const FString& Parameters)
+{
+	FString JobId, Error;
+	bool bIncludeItems = true;
+	TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+	if (!ParseStatusParams(Parameters, JobId, bIncludeItems, Error))
+	{
+		Response->SetBoolField(TEXT("success"), false);
+		Response->SetStringField(TEXT("error"), Error);
+		return SerializeBulkImportStatus(Response);
+	}
+
+	FBulkImportJobStatus Status;
+	if (!FBulkImportService::Get().GetJobStatus(JobId, Status, bIncludeItems))
+	{
+		Response->SetBoolField(TEXT("success"), false);
+		Response->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown bulk import job: %s"), *JobId));
+		return SerializeBulkImportStatus(Response);
+	}
+
+	const int32 Total = Status.Total;
+	const int32 Succeeded = Status.Count(EBulkImportItemState::Succeeded);
+	const int32 Failed = Status.Count(EBulkImportItemState::Failed);
+	const int32 PendingCompiles = FBulkImportService::Get().GetNumPendingCompiles();
+
+	Response->SetBoolField(TEXT("success"), true);
+	Response->SetStringField(TEXT("job_id"), Status.JobId);
+	Response->SetStringField(TEXT("state"), Status.bComplete ? TEXT("completed") : TEXT("running"));
+	Response->SetNumberField(TEXT("total"), Total);
+	Response->SetNumberField(TEXT("queued"), Status.Count(EBulkImportItemState::Queued));
+	Response->SetNumberField(TEXT("reading"), Status.Count(EBulkImportItemState::Reading));
+	Response->SetNumberField(TEXT("ready"), Status.Count(EBulkImportItemState::Ready));
+	Response->SetNumberField(TEXT("succeeded"), Succeeded);
+	Response->SetNumberField(TEXT("failed"), Failed);
+	Response->SetNumberField(TEXT("elapsed_ms"), Status.ElapsedMs);
+	Response->SetNumberField(TEXT("read_ms_total"), Status.ReadMs);
+	Response->SetNumberField(TEXT("import_ms_total"), Status.ImportMs);
+	Response->SetNumberField(TEXT("game_thread_slices"), Status.Ticks);
+	Response->SetNumberField(TEXT("pending_compiles"), PendingCompiles);
+
+	if (bIncludeItems)
+	{
+		TArray<TSharedPtr<FJsonValue>> ItemsJson;
+		ItemsJson.Reserve(Status.Items.Num());
+		for (const FBulkImportItemStatus& ItemStatus : Status.Items)
+		{
+			TSharedPtr<FJsonObject> ItemJson = MakeShared<FJsonObject>();
+			ItemJson->SetStringField(TEXT("source_file_path"), ItemStatus.Item.SourceFilePath);
+			ItemJson->SetStringField(TEXT("type"), FBulkImportItem::TypeToString(ItemStatus.Item.Type));
+			ItemJson->SetStringField(TEXT("state"), ItemStateToString(ItemStatus.State));
+
+			TArray<TSharedPtr<FJsonValue>> PathsJson;
+			for (const FString& Path : ItemStatus.AssetPaths)
+			{
+				PathsJson.Add(MakeShared<FJsonValueString>(Path));
+			}
+			ItemJson->SetArrayField(TEXT("asset_paths"), PathsJson);
+
+			if (!ItemStatus.Error.IsEmpty())
+			{
+				ItemJson->SetStringField(TEXT("error"), ItemStatus.Error);
+			}
+			ItemJson->SetNumberField(TEXT("read_ms"), ItemStatus.ReadMs);
+			ItemJson->SetNumberField(TEXT("import_ms"), ItemStatus.ImportMs);
+			ItemsJson.Add(MakeShared<FJsonValueObject>(ItemJson));
+		}
+		Response->SetArrayField(TEXT("items"), ItemsJson);
+	}
+
+	Response->SetStringField(TEXT("message"), Status.bComplete
+		? FString::Printf(TEXT("Imported %d of %d file(s), %d failed; %d asset build(s) still compiling"), Succeeded, Total, Failed, PendingCompiles)
+		: FString::Printf(TEXT("%d of %d file(s) done"), Succeeded + Failed, Total));
+	return SerializeBulkImportStatus(Response);
+}
@@ -0,0 +1,117 @@
+#include "Commands/Editor/GetFrameTelemetryCommand.h"
+
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Services/FrameTelemetry.h"
+
+namespace
+{
+FString SerializeTelemetryResponse(const TSharedRef<FJsonObject>& Result)
+{
+	FString Output;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	FJsonSerializer::Serialize(Result, Writer);
+	return Output;
+}
+
+TSharedPtr<FJsonObject> BuildChannelPayload(const FFrameTelemetryChannelStats& Stats)
+{
+	TSharedPtr<FJsonObject> Channel = MakeShared<FJsonObject>();
+	Channel->SetNumberField(TEXT("p50"), Stats.P50);
+	Channel->SetNumberField(TEXT("p95"), Stats.P95);
+	Channel->SetNumberField(TEXT("p99"), Stats.P99);
+	Channel->SetNumberField(TEXT("max"), Stats.Max);
+	Channel->SetNumberField(TEXT("avg"), Stats.Average);
+	return Channel;
+}
+}
+
+FString FGetFrameTelemetryCommand::Execute(const FString& Parameters)
+{
+	TSharedPtr<FJsonObject> Request;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters.IsEmpty() ? TEXT("{}") : Parameters);
+	if (!FJsonSerializer::Deserialize(Reader, Request) || !Request.IsValid())
+	{
+		const TSharedRef<FJsonObject> ErrorResult = MakeShared<FJsonObject>();
+		ErrorResult->SetBoolField(TEXT("success"), false);
+		ErrorResult->SetStringField(TEXT("error"), TEXT("Parameters must be a JSON object"));
+		return SerializeTelemetryResponse(ErrorResult);
+	}
+
+	FFrameTelemetryQuery Query;
+	Request->TryGetNumberField(TEXT("window_seconds"), Query.WindowSeconds);
+	Request->TryGetNumberField(TEXT("hitch_threshold_ms"), Query.HitchThresholdMs);
+	Request->TryGetNumberField(TEXT("max_hitches"), Query.MaxHitches);
+	Request->TryGetNumberField(TEXT("histogram_bucket_ms"), Query.HistogramBucketMs);
+	Request->TryGetNumberField(TEXT("histogram_buckets"), Query.HistogramBuckets);
+	Query.MaxHitches = FMath::Clamp(Query.MaxHitches, 0, 200);
+	Query.HistogramBuckets = FMath::Clamp(Query.HistogramBuckets, 1, 200);
+
+	const FFrameTelemetry& Telemetry = FFrameTelemetry::Get();
+	const double Now = FPlatformTime::Seconds();
+	const FFrameTelemetryReport Report = Telemetry.BuildReport(Query, Now);
+
+	const TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetNumberField(TEXT("sample_count"), Report.SampleCount);
+	Result->SetNumberField(TEXT("window_seconds"), Report.WindowSeconds);
+	Result->SetNumberField(TEXT("ring_capacity"), Telemetry.GetRing().GetCapacity());
+	Result->SetNumberField(TEXT("frames_recorded"), static_cast<double>(Telemetry.GetRing().GetTotalPushed()));
+
+	Result->SetObjectField(TEXT("frame_ms"), BuildChannelPayload(Report.FrameMs));
+	Result->SetObjectField(TEXT("game_thread_ms"), BuildChannelPayload(Report.GameThreadMs));
+	Result->SetObjectField(TEXT("render_thread_ms"), BuildChannelPayload(Report.RenderThreadMs));
+	Result->SetObjectField(TEXT("rhi_thread_ms"), BuildChannelPayload(Report.RHIThreadMs));
+	Result->SetObjectField(TEXT("gpu_ms"), BuildChannelPayload(Report.GPUMs));
+	Result->SetObjectField(TEXT("draw_calls"), BuildChannelPayload(Report.DrawCalls));
+	Result->SetObjectField(TEXT("primitives"), BuildChannelPayload(Report.Primitives));
+
+	Result->SetNumberField(TEXT("hitch_threshold_ms"), Report.HitchThresholdMs);
+	Result->SetNumberField(TEXT("hitch_count"), Report.HitchCount);
+	TArray<TSharedPtr<FJsonValue>> HitchArray;
+	for (const FFrameTelemetryHitch& Hitch : Report.Hitches)
+	{
+		TSharedPtr<FJsonObject> HitchObj = MakeShared<FJsonObject>();
+		HitchObj->SetNumberField(TEXT("frame_number"), static_cast<double>(Hitch.Sample.FrameNumber));
+		HitchObj->SetNumberField(TEXT("seconds_ago"), Now - Hitch.Sample.TimestampSeconds);
+		HitchObj->SetNumberField(TEXT("frame_ms"), Hitch.Sample.FrameMs);
+		HitchObj->SetNumberField(TEXT("game_thread_ms"), Hitch.Sample.GameThreadMs);
+		HitchObj->SetNumberField(TEXT("render_thread_ms"), Hitch.Sample.RenderThreadMs);
+		HitchObj->SetNumberField(TEXT("rhi_thread_ms"), Hitch.Sample.RHIThreadMs);
+		HitchObj->SetNumberField(TEXT("gpu_ms"), Hitch.Sample.GPUMs);
+		HitchObj->SetNumberField(TEXT("draw_calls"), Hitch.Sample.DrawCalls);
+		HitchObj->SetStringField(TEXT("bound_by"), Hitch.BoundBy);
+		HitchArray.Add(MakeShared<FJsonValueObject>(HitchObj));
+	}
+	Result->SetArrayField(TEXT("hitches"), HitchArray);
+
+	TSharedPtr<FJsonObject> Histogram = MakeShared<FJsonObject>();
+	Histogram->SetNumberField(TEXT("bucket_ms"), Report.HistogramBucketMs);
+	TArray<TSharedPtr<FJsonValue>> Counts;
+	for (int32 Count : Report.Histogram)
+	{
+		Counts.Add(MakeShared<FJsonValueNumber>(Count));
+	}
+	Histogram->SetArrayField(TEXT("counts"), Counts);
+	Result->SetObjectField(TEXT("histogram"), Histogram);
+
+	Result->SetStringField(TEXT("message"), FString::Printf(
+		TEXT("%d frames over %.1fs | frame p50 %.2fms p99 %.2fms max %.2fms | %d hitches >= %.1fms"),
+		Report.SampleCount, Report.WindowSeconds,
+		Report.FrameMs.P50, Report.FrameMs.P99, Report.FrameMs.Max,
+		Report.HitchCount, Report.HitchThresholdMs));
+
+	return SerializeTelemetryResponse(Result);
+}
+
+FString FGetFrameTelemetryCommand::GetCommandName() const
+{
+	return TEXT("get_frame_telemetry");
+}
+
+bool FGetFrameTelemetryCommand::ValidateParams(const FString& Parameters) const
+{
+	return true; // All params optional
+}
@@ -0,0 +1,91 @@
+#include "Commands/Editor/GetJobStatusCommand.h"
+#include "Services/MCPJobService.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Dom/JsonObject.h"
+
+namespace
+{
+FString SerializeJobStatus(const TSharedRef<FJsonObject>& Response)
+{
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(Response, Writer);
+	return OutputString;
+}
+
+bool ParseJobId(const FString& Parameters, FString& OutJobId, FString& OutError)
+{
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		OutError = TEXT("Failed to parse JSON parameters");
+		return false;
+	}
+	if (!JsonObject->TryGetStringField(TEXT("job_id"), OutJobId) || OutJobId.IsEmpty())
+	{
+		OutError = TEXT("Missing required parameter: job_id");
+		return false;
+	}
+	return true;
+}
+}
+
+FString FGetJobStatusCommand::GetCommandName() const
+{
+	return TEXT("get_job_status");
+}
+
+bool FGetJobStatusCommand::ValidateParams(const FString& Parameters) const
+{
+	FString JobId, Error;
+	return ParseJobId(Parameters, JobId, Error);
+}
+
+FString FGetJobStatusCommand::Execute(const FString& Parameters)
+{
+	FString JobId, Error;
+	TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+	if (!ParseJobId(Parameters, JobId, Error))
+	{
+		Response->SetBoolField(TEXT("success"), false);
+		Response->SetStringField(TEXT("error"), Error);
+		return SerializeJobStatus(Response);
+	}
+
+	FMCPJobSnapshot Job;
+	if (!FMCPJobService::Get().GetJob(JobId, Job))
+	{
+		Response->SetBoolField(TEXT("success"), false);
+		Response->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown job: %s"), *JobId));
+		return SerializeJobStatus(Response);
+	}
+
+	Response->SetBoolField(TEXT("success"), true);
+	Response->SetStringField(TEXT("job_id"), Job.JobId);
+	Response->SetStringField(TEXT("command"), Job.CommandName);
+	Response->SetStringField(TEXT("state"), FMCPJobSnapshot::StateToString(Job.State));
+	if (Job.Progress >= 0.0f)
+	{
+		Response->SetNumberField(TEXT("progress"), Job.Progress);
+	}
+	if (!Job.ProgressMessage.IsEmpty())
+	{
+		Response->SetStringField(TEXT("progress_message"), Job.ProgressMessage);
+	}
+	Response->SetNumberField(TEXT("elapsed_ms"), Job.ElapsedMs);
+	Response->SetBoolField(TEXT("cancel_requested"), Job.bCancelRequested);
+
+	// The stored response is the bridge envelope the command would have returned inline
+	if (!Job.Result.IsEmpty())
+	{
+		TSharedPtr<FJsonObject> ResultJson;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Job.Result);
+		if (FJsonSerializer::Deserialize(Reader, ResultJson) && ResultJson.IsValid())
+		{
+			Response->SetObjectField(TEXT("response"), ResultJson);
+		}
+	}
+	return SerializeJobStatus(Response);
+}
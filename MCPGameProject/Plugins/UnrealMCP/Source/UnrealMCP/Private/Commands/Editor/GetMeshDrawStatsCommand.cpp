@@ -2,239 +2,240 @@
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
-#include "Engine/Engine.h"
-#include "Editor.h"
-#include "HAL/FileManager.h"
-#include "Misc/FileHelper.h"
-#include "Misc/Paths.h"
+#include "Services/IMeshDrawStatsCaptureBackend.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
 
-FString FGetMeshDrawStatsCommand::GetCommandName() const
+namespace
 {
-	return TEXT("get_mesh_draw_stats");
+FString SerializeMeshDrawResponse(const TSharedRef<FJsonObject>& Result)
+{
+	FString Out;
+	TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&Out);
+	FJsonSerializer::Serialize(Result, W);
+	return Out;
 }
 
-bool FGetMeshDrawStatsCommand::ValidateParams(const FString& Parameters) const
+FString MakeMeshDrawError(const FString& Error)
 {
-	return true;
+	const TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), false);
+	Result->SetStringField(TEXT("error"), Error);
+	return SerializeMeshDrawResponse(Result);
 }
 
-FString FGetMeshDrawStatsCommand::Execute(const FString& Parameters)
+FString MakeMeshDrawPending(const FString& Message)
 {
-	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-
-	// Parse optional mesh_filter parameter
-	TSharedPtr<FJsonObject> Params;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
-	FJsonSerializer::Deserialize(Reader, Params);
+	const TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetBoolField(TEXT("stats_pending"), true);
+	Result->SetStringField(TEXT("message"), Message);
+	return SerializeMeshDrawResponse(Result);
+}
 
-	FString MeshFilter;
-	if (Params.IsValid())
+const TCHAR* GroupByToString(EMeshDrawStatsGroupBy GroupBy)
+{
+	switch (GroupBy)
 	{
-		Params->TryGetStringField(TEXT("mesh_filter"), MeshFilter);
+	case EMeshDrawStatsGroupBy::Resource: return TEXT("resource");
+	case EMeshDrawStatsGroupBy::Material: return TEXT("material");
+	case EMeshDrawStatsGroupBy::Pass: return TEXT("pass");
+	default: return TEXT("entry");
 	}
+}
+
+/** Read, parse, aggregate and serialize a capture. Runs on any thread. */
+FString BuildMeshDrawStatsResponse(FMeshDrawStatsCapture& Capture, const FMeshDrawStatsQuery& Query)
+{
+	const double StartTime = FPlatformTime::Seconds();
 
-	// Trigger dump: r.MeshDrawCommands.DumpStats requests stats collection
-	// for the next rendered frame, then writes CSV at end of that frame.
-	if (GEngine)
+	TArray64<uint8> Bytes;
+	FString Error;
+	if (!Capture.ReadBytes(Bytes, Error))
 	{
-		UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
-		GEngine->Exec(World, TEXT("r.MeshDrawCommands.DumpStats"));
+		return MakeMeshDrawError(Error);
 	}
 
-	// Find CSV files in Saved/Profiling/
-	FString ProfilingDir = FPaths::ProfilingDir();
-	TArray<FString> FoundFiles;
-	IFileManager::Get().FindFiles(
-		FoundFiles,
-		*FPaths::Combine(ProfilingDir, TEXT("MeshDrawCommandStats*.csv")),
-		true, false);
-
-	if (FoundFiles.Num() == 0)
+	FMeshDrawStatsTable Table;
+	if (!FMeshDrawStatsTable::Parse(Bytes, Table, Error))
 	{
-		// No CSV yet — stats collection was just requested
-		Result->SetBoolField(TEXT("success"), true);
-		Result->SetBoolField(TEXT("stats_pending"), true);
-		Result->SetStringField(TEXT("message"),
-			TEXT("Mesh draw stats dump requested. Call again after one rendered frame for data."));
-
-		FString Out;
-		TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&Out);
-		FJsonSerializer::Serialize(Result.ToSharedRef(), W);
-		return Out;
+		return MakeMeshDrawPending(FString::Printf(
+			TEXT("%s - stats not yet collected. Call again after one rendered frame."), *Error));
 	}
+	const double ParsedTime = FPlatformTime::Seconds();
 
-	// Sort to find most recent file
-	FoundFiles.Sort();
-	FString LatestCSV = FPaths::Combine(ProfilingDir, FoundFiles.Last());
+	const FMeshDrawStatsSummary Summary = AggregateMeshDrawStats(Table, Query);
+	const double AggregatedTime = FPlatformTime::Seconds();
 
-	// Parse CSV
-	FString CSVContent;
-	if (!FFileHelper::LoadFileToString(CSVContent, *LatestCSV))
+	TArray<TSharedPtr<FJsonValue>> JsonEntries;
+	JsonEntries.Reserve(Summary.Rows.Num());
+	for (const FMeshDrawStatsRow& Row : Summary.Rows)
 	{
-		Result->SetBoolField(TEXT("success"), false);
-		Result->SetStringField(TEXT("error"),
-			FString::Printf(TEXT("Failed to read CSV: %s"), *LatestCSV));
-
-		FString Out;
-		TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&Out);
-		FJsonSerializer::Serialize(Result.ToSharedRef(), W);
-		return Out;
+		TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+		if (!Row.Pass.IsEmpty())
+			Obj->SetStringField(TEXT("pass"), Row.Pass);
+		if (!Row.Resource.IsEmpty())
+			Obj->SetStringField(TEXT("resource"), Row.Resource);
+		if (!Row.Category.IsEmpty())
+			Obj->SetStringField(TEXT("category"), Row.Category);
+		if (!Row.Material.IsEmpty())
+			Obj->SetStringField(TEXT("material"), Row.Material);
+		Obj->SetNumberField(TEXT("visible_primitives"), (double)Row.VisiblePrimitives);
+		Obj->SetNumberField(TEXT("visible_vertices"), (double)Row.VisibleVertices);
+		Obj->SetNumberField(TEXT("visible_instances"), (double)Row.VisibleInstances);
+		if (Row.LODIndex >= 0)
+			Obj->SetNumberField(TEXT("lod_index"), Row.LODIndex);
+		else
+			Obj->SetNumberField(TEXT("entry_count"), Row.EntryCount);
+		Obj->SetNumberField(TEXT("total_instances"), (double)Row.TotalInstances);
+		Obj->SetNumberField(TEXT("total_primitives"), (double)Row.TotalPrimitives);
+		Obj->SetNumberField(TEXT("total_vertices"), (double)Row.TotalVertices);
+		JsonEntries.Add(MakeShared<FJsonValueObject>(Obj));
 	}
 
-	// CSV header (from UE 5.7 MeshDrawCommandStats.cpp):
-	// Pass, VisiblePrimitiveCount, VisibleVertices, VisibleInstances,
-	// Category, ResourceName, LODIndex, SegmentIndex, MaterialName,
-	// PrimitiveCount, VertexCount, TotalInstanceCount, TotalPrimitiveCount, TotalVertexCount
-	TArray<FString> Lines;
-	CSVContent.ParseIntoArrayLines(Lines);
+	const TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetArrayField(TEXT("entries"), JsonEntries);
+	Result->SetStringField(TEXT("group_by"), GroupByToString(Query.GroupBy));
+	Result->SetNumberField(TEXT("total_entries"), Summary.MatchedEntries);
+	Result->SetNumberField(TEXT("group_count"), Summary.GroupCount);
+	Result->SetNumberField(TEXT("shown_entries"), JsonEntries.Num());
+	Result->SetNumberField(TEXT("total_visible_primitives"), (double)Summary.TotalVisiblePrimitives);
+	Result->SetNumberField(TEXT("total_visible_vertices"), (double)Summary.TotalVisibleVertices);
+	Result->SetNumberField(TEXT("total_visible_instances"), (double)Summary.TotalVisibleInstances);
+	Result->SetNumberField(TEXT("parse_ms"), (ParsedTime - StartTime) * 1000.0);
+	Result->SetNumberField(TEXT("aggregate_ms"), (AggregatedTime - ParsedTime) * 1000.0);
 
-	if (Lines.Num() < 2)
-	{
-		Result->SetBoolField(TEXT("success"), true);
-		Result->SetBoolField(TEXT("stats_pending"), true);
-		Result->SetStringField(TEXT("message"),
-			TEXT("CSV is empty — stats not yet collected. Call again after one rendered frame."));
-
-		FString Out;
-		TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&Out);
-		FJsonSerializer::Serialize(Result.ToSharedRef(), W);
-		return Out;
-	}
+	if (!Query.MeshFilter.IsEmpty())
+		Result->SetStringField(TEXT("mesh_filter"), Query.MeshFilter);
 
-	// Parse header to find column indices dynamically
-	TArray<FString> Headers;
-	Lines[0].ParseIntoArray(Headers, TEXT(","), false);
-
-	auto FindCol = [&Headers](const FString& Name) -> int32 {
-		return Headers.IndexOfByPredicate([&Name](const FString& S) {
-			return S.TrimStartAndEnd().Equals(Name, ESearchCase::IgnoreCase);
-		});
-	};
-
-	int32 ColPass = FindCol(TEXT("Pass"));
-	int32 ColVisPrim = FindCol(TEXT("VisiblePrimitiveCount"));
-	int32 ColVisVert = FindCol(TEXT("VisibleVertices"));
-	int32 ColVisInst = FindCol(TEXT("VisibleInstances"));
-	int32 ColCategory = FindCol(TEXT("Category"));
-	int32 ColResource = FindCol(TEXT("ResourceName"));
-	int32 ColLOD = FindCol(TEXT("LODIndex"));
-	int32 ColSegment = FindCol(TEXT("SegmentIndex"));
-	int32 ColMaterial = FindCol(TEXT("MaterialName"));
-	int32 ColTotalInst = FindCol(TEXT("TotalInstanceCount"));
-	int32 ColTotalPrim = FindCol(TEXT("TotalPrimitiveCount"));
-	int32 ColTotalVert = FindCol(TEXT("TotalVertexCount"));
-
-	// Parse data rows
-	struct FEntry
-	{
-		FString Pass, Resource, Category, Material;
-		int64 VisiblePrimitives = 0, VisibleVertices = 0, VisibleInstances = 0;
-		int32 LODIndex = 0, SegmentIndex = 0;
-		int64 TotalInstances = 0, TotalPrimitives = 0, TotalVertices = 0;
-	};
-	TArray<FEntry> Entries;
-
-	auto GetCol = [](const TArray<FString>& Cols, int32 Idx) -> FString {
-		return (Idx >= 0 && Idx < Cols.Num()) ? Cols[Idx].TrimStartAndEnd() : TEXT("");
-	};
-	auto GetColInt = [&GetCol](const TArray<FString>& Cols, int32 Idx) -> int64 {
-		FString Val = GetCol(Cols, Idx);
-		return Val.IsEmpty() ? 0 : FCString::Atoi64(*Val);
-	};
-
-	for (int32 i = 1; i < Lines.Num(); ++i)
-	{
-		if (Lines[i].TrimStartAndEnd().IsEmpty()) continue;
+	Result->SetStringField(TEXT("message"), FString::Printf(
+		TEXT("%d entries in %d %s groups (%d shown), %lld visible primitives, %lld visible vertices, %lld visible instances"),
+		Summary.MatchedEntries, Summary.GroupCount, GroupByToString(Query.GroupBy), JsonEntries.Num(),
+		Summary.TotalVisiblePrimitives, Summary.TotalVisibleVertices, Summary.TotalVisibleInstances));
 
-		TArray<FString> Cols;
-		Lines[i].ParseIntoArray(Cols, TEXT(","), false);
-		if (Cols.Num() < 2) continue;
+	return SerializeMeshDrawResponse(Result);
+}
+}
 
-		FString Resource = GetCol(Cols, ColResource);
+FGetMeshDrawStatsCommand::FGetMeshDrawStatsCommand()
+	: FGetMeshDrawStatsCommand(CreateMeshDrawStatsCaptureBackend())
+{
+}
 
-		// Apply mesh filter
-		if (!MeshFilter.IsEmpty() &&
-			!Resource.Contains(MeshFilter, ESearchCase::IgnoreCase))
-		{
-			continue;
-		}
+FGetMeshDrawStatsCommand::FGetMeshDrawStatsCommand(TSharedRef<IMeshDrawStatsCaptureBackend> InBackend)
+	: Backend(MoveTemp(InBackend))
+{
+}
 
-		FEntry E;
-		E.Pass = GetCol(Cols, ColPass);
-		E.Resource = Resource;
-		E.Category = GetCol(Cols, ColCategory);
-		E.Material = GetCol(Cols, ColMaterial);
-		E.VisiblePrimitives = GetColInt(Cols, ColVisPrim);
-		E.VisibleVertices = GetColInt(Cols, ColVisVert);
-		E.VisibleInstances = GetColInt(Cols, ColVisInst);
-		E.LODIndex = (int32)GetColInt(Cols, ColLOD);
-		E.SegmentIndex = (int32)GetColInt(Cols, ColSegment);
-		E.TotalInstances = GetColInt(Cols, ColTotalInst);
-		E.TotalPrimitives = GetColInt(Cols, ColTotalPrim);
-		E.TotalVertices = GetColInt(Cols, ColTotalVert);
-		Entries.Add(MoveTemp(E));
-	}
+FString FGetMeshDrawStatsCommand::GetCommandName() const
+{
+	return TEXT("get_mesh_draw_stats");
+}
 
-	// Sort by visible primitives descending
-	Entries.Sort([](const FEntry& A, const FEntry& B) {
-		return A.VisiblePrimitives > B.VisiblePrimitives;
-	});
+bool FGetMeshDrawStatsCommand::ValidateParams(const FString& Parameters) const
+{
+	FMeshDrawStatsQuery Query;
+	double TimeoutSeconds = 0.0;
+	FString Error;
+	return ParseQuery(Parameters, Query, TimeoutSeconds, Error);
+}
 
-	// Build JSON (limit to top 100)
-	TArray<TSharedPtr<FJsonValue>> JsonEntries;
-	int32 Limit = FMath::Min(100, Entries.Num());
-	for (int32 i = 0; i < Limit; ++i)
+bool FGetMeshDrawStatsCommand::ParseQuery(const FString& Parameters, FMeshDrawStatsQuery& OutQuery, double& OutTimeoutSeconds, FString& OutError) const
+{
+	OutTimeoutSeconds = 5.0;
+
+	TSharedPtr<FJsonObject> Params;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+	if (!FJsonSerializer::Deserialize(Reader, Params) || !Params.IsValid())
 	{
-		const FEntry& E = Entries[i];
-		TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
-		Obj->SetStringField(TEXT("pass"), E.Pass);
-		Obj->SetStringField(TEXT("resource"), E.Resource);
-		Obj->SetStringField(TEXT("category"), E.Category);
-		if (!E.Material.IsEmpty())
-			Obj->SetStringField(TEXT("material"), E.Material);
-		Obj->SetNumberField(TEXT("visible_primitives"), (double)E.VisiblePrimitives);
-		Obj->SetNumberField(TEXT("visible_vertices"), (double)E.VisibleVertices);
-		Obj->SetNumberField(TEXT("visible_instances"), (double)E.VisibleInstances);
-		Obj->SetNumberField(TEXT("lod_index"), E.LODIndex);
-		Obj->SetNumberField(TEXT("total_instances"), (double)E.TotalInstances);
-		Obj->SetNumberField(TEXT("total_primitives"), (double)E.TotalPrimitives);
-		Obj->SetNumberField(TEXT("total_vertices"), (double)E.TotalVertices);
-		JsonEntries.Add(MakeShared<FJsonValueObject>(Obj));
+		// All parameters are optional
+		return true;
 	}
 
-	// Totals
-	int64 TotalVisPrim = 0, TotalVisVert = 0, TotalVisInst = 0;
-	for (const FEntry& E : Entries)
+	Params->TryGetStringField(TEXT("mesh_filter"), OutQuery.MeshFilter);
+	Params->TryGetNumberField(TEXT("top_n"), OutQuery.TopN);
+	OutQuery.TopN = FMath::Clamp(OutQuery.TopN, 1, 1000);
+	Params->TryGetNumberField(TEXT("timeout_seconds"), OutTimeoutSeconds);
+	OutTimeoutSeconds = FMath::Clamp(OutTimeoutSeconds, 0.5, 30.0);
+
+	FString GroupBy;
+	if (Params->TryGetStringField(TEXT("group_by"), GroupBy) && !GroupBy.IsEmpty())
 	{
-		TotalVisPrim += E.VisiblePrimitives;
-		TotalVisVert += E.VisibleVertices;
-		TotalVisInst += E.VisibleInstances;
+		if (GroupBy.Equals(TEXT("entry"), ESearchCase::IgnoreCase))
+			OutQuery.GroupBy = EMeshDrawStatsGroupBy::Entry;
+		else if (GroupBy.Equals(TEXT("resource"), ESearchCase::IgnoreCase))
+			OutQuery.GroupBy = EMeshDrawStatsGroupBy::Resource;
+		else if (GroupBy.Equals(TEXT("material"), ESearchCase::IgnoreCase))
+			OutQuery.GroupBy = EMeshDrawStatsGroupBy::Material;
+		else if (GroupBy.Equals(TEXT("pass"), ESearchCase::IgnoreCase))
+			OutQuery.GroupBy = EMeshDrawStatsGroupBy::Pass;
+		else
+		{
+			OutError = FString::Printf(TEXT("Invalid group_by '%s'. Use entry, resource, material or pass"), *GroupBy);
+			return false;
+		}
 	}
+	return true;
+}
 
-	Result->SetBoolField(TEXT("success"), true);
-	Result->SetArrayField(TEXT("entries"), JsonEntries);
-	Result->SetNumberField(TEXT("total_entries"), Entries.Num());
-	Result->SetNumberField(TEXT("shown_entries"), JsonEntries.Num());
-	Result->SetNumberField(TEXT("total_visible_primitives"), (double)TotalVisPrim);
-	Result->SetNumberField(TEXT("total_visible_vertices"), (double)TotalVisVert);
-	Result->SetNumberField(TEXT("total_visible_instances"), (double)TotalVisInst);
-	Result->SetStringField(TEXT("csv_file"), LatestCSV);
+FString FGetMeshDrawStatsCommand::Execute(const FString& Parameters)
+{
+	FMeshDrawStatsQuery Query;
+	double TimeoutSeconds = 0.0;
+	FString Error;
+	if (!ParseQuery(Parameters, Query, TimeoutSeconds, Error))
+	{
+		return MakeMeshDrawError(Error);
+	}
 
-	if (!MeshFilter.IsEmpty())
-		Result->SetStringField(TEXT("mesh_filter"), MeshFilter);
+	TSharedPtr<FMeshDrawStatsCapture> Capture = Backend->TryTakeCapture();
+	if (!Capture.IsValid())
+	{
+		Backend->RequestCapture();
+		return MakeMeshDrawPending(TEXT("Mesh draw stats dump requested. Call again after one rendered frame for data."));
+	}
 
-	Result->SetStringField(TEXT("message"), FString::Printf(
-		TEXT("%d entries (%d shown), %lld visible primitives, %lld visible vertices, %lld visible instances"),
-		Entries.Num(), JsonEntries.Num(), TotalVisPrim, TotalVisVert, TotalVisInst));
+	return BuildMeshDrawStatsResponse(*Capture, Query);
+}
 
-	// Clean up old CSV files (keep only the latest)
-	for (int32 i = 0; i < FoundFiles.Num() - 1; ++i)
+void FGetMeshDrawStatsCommand::ExecuteDeferred(const FString& Parameters, TFunction<void(const FString&)> OnComplete)
+{
+	FMeshDrawStatsQuery Query;
+	double TimeoutSeconds = 0.0;
+	FString Error;
+	if (!ParseQuery(Parameters, Query, TimeoutSeconds, Error))
 	{
-		IFileManager::Get().Delete(*FPaths::Combine(ProfilingDir, FoundFiles[i]));
+		OnComplete(MakeMeshDrawError(Error));
+		return;
 	}
 
-	FString Out;
-	TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&Out);
-	FJsonSerializer::Serialize(Result.ToSharedRef(), W);
-	return Out;
+	// Always capture a fresh frame; the ticker polls for it without blocking the game thread
+	Backend->RequestCapture();
+	const double Deadline = FPlatformTime::Seconds() + TimeoutSeconds;
+
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+		[Backend = Backend, Query, Deadline, OnComplete](float DeltaTime) -> bool
+		{
+			TSharedPtr<FMeshDrawStatsCapture> Capture = Backend->TryTakeCapture();
+			if (!Capture.IsValid())
+			{
+				if (FPlatformTime::Seconds() < Deadline)
+				{
+					return true;
+				}
+				OnComplete(MakeMeshDrawPending(TEXT("No frame was rendered before the timeout (is the viewport realtime?). Call again to pick up the capture once it lands.")));
+				return false;
+			}
+
+			AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Capture, Query, OnComplete]()
+			{
+				FString Response = BuildMeshDrawStatsResponse(*Capture, Query);
+				AsyncTask(ENamedThreads::GameThread, [Response = MoveTemp(Response), OnComplete]()
+				{
+					OnComplete(Response);
+				});
+			});
+			return false;
+		}));
 }
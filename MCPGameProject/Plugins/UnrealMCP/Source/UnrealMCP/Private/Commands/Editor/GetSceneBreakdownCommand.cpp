@@ -2,216 +2,141 @@
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
-#include "Engine/StaticMesh.h"
-#include "Components/StaticMeshComponent.h"
-#include "Components/InstancedStaticMeshComponent.h"
-#include "Components/HierarchicalInstancedStaticMeshComponent.h"
-#include "EngineUtils.h"
+#include "Services/SceneStatsCache.h"
+#include "Async/Async.h"
+#include "Editor.h"
 #include "LevelEditorViewport.h"
 
-FString FGetSceneBreakdownCommand::Execute(const FString& Parameters)
+namespace
+{
+FString SerializeSceneBreakdownResponse(const TSharedRef<FJsonObject>& Result)
+{
+	FString Out;
+	TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&Out);
+	FJsonSerializer::Serialize(Result, W);
+	return Out;
+}
+
+FString MakeSceneBreakdownError(const FString& Error)
 {
-	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), false);
+	Result->SetStringField(TEXT("error"), Error);
+	return SerializeSceneBreakdownResponse(Result);
+}
+}
 
+bool FGetSceneBreakdownCommand::PrepareRequest(const FString& Parameters, FRequest& OutRequest, TSharedPtr<const FSceneStatsSnapshot>& OutSnapshot,
+	TSharedPtr<const FSceneStatsBreakdown>& OutCachedBreakdown, FString& OutError) const
+{
 	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
 	if (!World)
 	{
-		Result->SetBoolField(TEXT("success"), false);
-		Result->SetStringField(TEXT("error"), TEXT("No editor world"));
-		FString Out;
-		TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&Out);
-		FJsonSerializer::Serialize(Result.ToSharedRef(), W);
-		return Out;
+		OutError = TEXT("No editor world");
+		return false;
 	}
 
 	// Parse optional filter
-	FString MeshFilter;
-	int32 MaxResults = 50;
+	bool bRefresh = false;
 	{
 		TSharedPtr<FJsonObject> Params;
 		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
 		if (FJsonSerializer::Deserialize(Reader, Params) && Params.IsValid())
 		{
-			Params->TryGetStringField(TEXT("mesh_filter"), MeshFilter);
-			Params->TryGetNumberField(TEXT("max_results"), MaxResults);
+			Params->TryGetStringField(TEXT("mesh_filter"), OutRequest.MeshFilter);
+			Params->TryGetNumberField(TEXT("max_results"), OutRequest.MaxResults);
+			Params->TryGetBoolField(TEXT("refresh"), bRefresh);
 		}
 	}
 
-	// Per-mesh aggregate
-	struct FLODInfo
-	{
-		int32 Tris = 0;
-		float ScreenSize = 0.0f;
-	};
-
-	struct FMeshStats
-	{
-		FString MeshPath;
-		FString MeshName;
-		int32 LOD0Tris = 0;
-		int32 LODCount = 0;
-		TArray<FLODInfo> LODs;
-		TArray<int32> InstancesPerLOD;  // How many instances render at each LOD
-		int32 InstancesCulled = 0;      // Beyond cull distance
-		int32 InstanceCount = 0;        // Total ISM/HISM instances
-		int32 ComponentCount = 0;
-		int32 ShadowCasters = 0;
-		int32 WPODisableDistance = 0;
-		float SphereRadius = 0.0f;
-		bool bHasNanite = false;
-		bool bIsISM = false;
-	};
-
 	// Get camera position for LOD calculation
-	FVector CameraLocation = FVector::ZeroVector;
-	bool bHasCamera = false;
+	if (GEditor && GEditor->GetActiveViewport())
 	{
-		FLevelEditorViewportClient* ViewportClient = nullptr;
-		if (GEditor && GEditor->GetActiveViewport())
-		{
-			ViewportClient = (FLevelEditorViewportClient*)GEditor->GetActiveViewport()->GetClient();
-		}
-		if (ViewportClient)
+		if (FLevelEditorViewportClient* ViewportClient = (FLevelEditorViewportClient*)GEditor->GetActiveViewport()->GetClient())
 		{
-			CameraLocation = ViewportClient->GetViewLocation();
-			bHasCamera = true;
+			OutRequest.CameraLocation = ViewportClient->GetViewLocation();
+			OutRequest.bHasCamera = true;
 		}
 	}
 
-	TMap<UStaticMesh*, FMeshStats> MeshMap;
-	int32 TotalComponents = 0;
-	int32 TotalActors = 0;
-
-	for (TActorIterator<AActor> It(World); It; ++It)
+	FSceneStatsCache& Cache = FSceneStatsCache::Get();
+	if (bRefresh)
 	{
-		AActor* Actor = *It;
-		if (!Actor) continue;
-
-		bool bActorCounted = false;
-
-		Actor->ForEachComponent<UStaticMeshComponent>(false, [&](UStaticMeshComponent* SMC)
-		{
-			if (!SMC || !SMC->IsRegistered()) return;
-
-			UStaticMesh* Mesh = SMC->GetStaticMesh();
-			if (!Mesh) return;
-
-			if (!bActorCounted) { ++TotalActors; bActorCounted = true; }
-			++TotalComponents;
-
-			FMeshStats& Stats = MeshMap.FindOrAdd(Mesh);
-			if (Stats.MeshPath.IsEmpty())
-			{
-				Stats.MeshPath = Mesh->GetPathName();
-				Stats.MeshName = Mesh->GetName();
-				Stats.LOD0Tris = Mesh->GetNumTriangles(0);
-				Stats.LODCount = Mesh->GetNumLODs();
-
-				FStaticMeshRenderData* RD = Mesh->GetRenderData();
-				Stats.bHasNanite = RD && RD->HasValidNaniteData();
-
-				// Collect per-LOD info
-				if (RD)
-				{
-					for (int32 LODIdx = 0; LODIdx < RD->LODResources.Num(); ++LODIdx)
-					{
-						FLODInfo LODInfo;
-						LODInfo.Tris = Mesh->GetNumTriangles(LODIdx);
-						if (Mesh->GetNumSourceModels() > LODIdx)
-						{
-							LODInfo.ScreenSize = Mesh->GetSourceModel(LODIdx).ScreenSize.Default;
-						}
-						Stats.LODs.Add(LODInfo);
-					}
-				}
-			}
-
-			// Get WPO disable distance from component
-			Stats.WPODisableDistance = SMC->WorldPositionOffsetDisableDistance;
-			Stats.SphereRadius = Mesh->GetBounds().SphereRadius;
-
-			// ISM/HISM
-			if (UInstancedStaticMeshComponent* ISM = Cast<UInstancedStaticMeshComponent>(SMC))
-			{
-				int32 Count = ISM->GetInstanceCount();
-				Stats.InstanceCount += Count;
-				Stats.bIsISM = true;
-				Stats.ComponentCount++;
-				if (SMC->CastShadow) Stats.ShadowCasters++;
-
-				// Count instances per LOD based on distance from camera
-				if (bHasCamera && Stats.LODs.Num() > 0)
-				{
-					// Ensure InstancesPerLOD array is sized
-					while (Stats.InstancesPerLOD.Num() < Stats.LODs.Num())
-					{
-						Stats.InstancesPerLOD.Add(0);
-					}
-
-					float MeshRadius = Stats.SphereRadius;
-					int32 CullDist = (int32)SMC->LDMaxDrawDistance;
+		// Escape hatch for edits made without any editor notification
+		Cache.Reset();
+	}
 
-					for (int32 InstIdx = 0; InstIdx < Count; ++InstIdx)
-					{
-						FTransform InstanceTransform;
-						if (!ISM->GetInstanceTransform(InstIdx, InstanceTransform, true))
-							continue;
+	OutSnapshot = Cache.Update(World);
+	OutCachedBreakdown = Cache.FindBreakdown(*OutSnapshot, OutRequest.CameraLocation, OutRequest.bHasCamera);
+	return true;
+}
 
-						float Dist = FVector::Dist(CameraLocation, InstanceTransform.GetLocation());
+FString FGetSceneBreakdownCommand::Execute(const FString& Parameters)
+{
+	FRequest Request;
+	TSharedPtr<const FSceneStatsSnapshot> Snapshot;
+	TSharedPtr<const FSceneStatsBreakdown> Breakdown;
+	FString Error;
+	if (!PrepareRequest(Parameters, Request, Snapshot, Breakdown, Error))
+	{
+		return MakeSceneBreakdownError(Error);
+	}
 
-						// Check cull distance
-						if (CullDist > 0 && Dist > (float)CullDist)
-						{
-							Stats.InstancesCulled++;
-							continue;
-						}
+	if (Breakdown.IsValid())
+	{
+		return SerializeBreakdown(*Breakdown, Request, true);
+	}
 
-						// Approximate screen size: radius / distance
-						// UE uses a more complex formula but this gives reasonable LOD bucketing
-						float ApproxScreenSize = (Dist > 1.0f) ? (MeshRadius / Dist) : 1.0f;
+	TSharedRef<const FSceneStatsBreakdown> Fresh = FSceneStatsCache::Aggregate(*Snapshot, Request.CameraLocation, Request.bHasCamera);
+	FSceneStatsCache::Get().StoreBreakdown(Fresh);
+	return SerializeBreakdown(*Fresh, Request, false);
+}
 
-						// Find which LOD this maps to (screen sizes are in descending order)
-						int32 LODIndex = 0;
-						for (int32 L = 1; L < Stats.LODs.Num(); ++L)
-						{
-							if (ApproxScreenSize < Stats.LODs[L - 1].ScreenSize && Stats.LODs[L].ScreenSize > 0)
-							{
-								LODIndex = L;
-							}
-						}
-						Stats.InstancesPerLOD[LODIndex]++;
-					}
-				}
-			}
-			else
-			{
-				// Regular static mesh — counts as 1 instance
-				Stats.InstanceCount += 1;
-				Stats.ComponentCount++;
-				if (SMC->CastShadow) Stats.ShadowCasters++;
-			}
-		});
+void FGetSceneBreakdownCommand::ExecuteDeferred(const FString& Parameters, TFunction<void(const FString&)> OnComplete)
+{
+	FRequest Request;
+	TSharedPtr<const FSceneStatsSnapshot> Snapshot;
+	TSharedPtr<const FSceneStatsBreakdown> Breakdown;
+	FString Error;
+	if (!PrepareRequest(Parameters, Request, Snapshot, Breakdown, Error))
+	{
+		OnComplete(MakeSceneBreakdownError(Error));
+		return;
 	}
 
-	// Sort by instance count * LOD0 tris (worst case cost indicator)
-	TArray<FMeshStats> Sorted;
-	for (auto& Pair : MeshMap)
+	if (Breakdown.IsValid())
 	{
-		Sorted.Add(Pair.Value);
+		OnComplete(SerializeBreakdown(*Breakdown, Request, true));
+		return;
 	}
-	Sorted.Sort([](const FMeshStats& A, const FMeshStats& B)
+
+	// The snapshot is immutable, so LOD bucketing over every instance can run off the game thread
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Snapshot, Request, OnComplete]()
 	{
-		return (int64)A.InstanceCount * A.LOD0Tris > (int64)B.InstanceCount * B.LOD0Tris;
+		TSharedRef<const FSceneStatsBreakdown> Fresh = FSceneStatsCache::Aggregate(*Snapshot, Request.CameraLocation, Request.bHasCamera);
+		AsyncTask(ENamedThreads::GameThread, [Fresh, Request, OnComplete]()
+		{
+			FSceneStatsCache::Get().StoreBreakdown(Fresh);
+			OnComplete(SerializeBreakdown(*Fresh, Request, false));
+		});
 	});
+}
+
+FString FGetSceneBreakdownCommand::SerializeBreakdown(const FSceneStatsBreakdown& Breakdown, const FRequest& Request, bool bFromCache)
+{
+	TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
 
 	// Apply mesh_filter if provided
-	if (!MeshFilter.IsEmpty())
+	TArray<const FSceneStatsMeshBreakdown*> Sorted;
+	Sorted.Reserve(Breakdown.Meshes.Num());
+	for (const FSceneStatsMeshBreakdown& S : Breakdown.Meshes)
 	{
-		Sorted = Sorted.FilterByPredicate([&](const FMeshStats& S)
+		if (Request.MeshFilter.IsEmpty()
+			|| S.Info->MeshName.Contains(Request.MeshFilter, ESearchCase::IgnoreCase)
+			|| S.Info->MeshPath.Contains(Request.MeshFilter, ESearchCase::IgnoreCase))
 		{
-			return S.MeshName.Contains(MeshFilter, ESearchCase::IgnoreCase)
-				|| S.MeshPath.Contains(MeshFilter, ESearchCase::IgnoreCase);
-		});
+			Sorted.Add(&S);
+		}
 	}
 
 	// Build JSON
@@ -219,32 +144,33 @@ FString FGetSceneBreakdownCommand::Execute(const FString& Parameters)
 	int32 GrandTotalShadowCasters = 0;
 
 	TArray<TSharedPtr<FJsonValue>> MeshArray;
-	for (int32 i = 0; i < FMath::Min(Sorted.Num(), MaxResults); ++i)
+	for (int32 i = 0; i < FMath::Min(Sorted.Num(), Request.MaxResults); ++i)
 	{
-		const FMeshStats& S = Sorted[i];
+		const FSceneStatsMeshBreakdown& S = *Sorted[i];
+		const FSceneStatsMeshInfo& Info = *S.Info;
 		TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
-		Obj->SetStringField(TEXT("mesh"), S.MeshName);
-		Obj->SetStringField(TEXT("path"), S.MeshPath);
+		Obj->SetStringField(TEXT("mesh"), Info.MeshName);
+		Obj->SetStringField(TEXT("path"), Info.MeshPath);
 		Obj->SetNumberField(TEXT("instances"), S.InstanceCount);
-		Obj->SetNumberField(TEXT("lod_count"), S.LODCount);
+		Obj->SetNumberField(TEXT("lod_count"), Info.LODCount);
 		Obj->SetNumberField(TEXT("components"), S.ComponentCount);
 		Obj->SetNumberField(TEXT("shadow_casters"), S.ShadowCasters);
 		Obj->SetNumberField(TEXT("wpo_disable_distance"), S.WPODisableDistance);
-		Obj->SetBoolField(TEXT("nanite"), S.bHasNanite);
+		Obj->SetBoolField(TEXT("nanite"), Info.bHasNanite);
 		Obj->SetBoolField(TEXT("instanced"), S.bIsISM);
 
 		// Per-LOD breakdown with instance counts
 		TArray<TSharedPtr<FJsonValue>> LODArray;
 		int64 EstimatedRenderedTris = 0;
-		for (int32 L = 0; L < S.LODs.Num(); ++L)
+		for (int32 L = 0; L < Info.LODTris.Num(); ++L)
 		{
 			TSharedPtr<FJsonObject> LODObj = MakeShared<FJsonObject>();
-			LODObj->SetNumberField(TEXT("tris"), S.LODs[L].Tris);
-			LODObj->SetNumberField(TEXT("screen_size"), S.LODs[L].ScreenSize);
+			LODObj->SetNumberField(TEXT("tris"), Info.LODTris[L]);
+			LODObj->SetNumberField(TEXT("screen_size"), Info.LODScreenSizes[L]);
 			int32 InstAtLOD = (L < S.InstancesPerLOD.Num()) ? S.InstancesPerLOD[L] : 0;
 			LODObj->SetNumberField(TEXT("instances"), InstAtLOD);
-			LODObj->SetNumberField(TEXT("total_tris"), (int64)InstAtLOD * S.LODs[L].Tris);
-			EstimatedRenderedTris += (int64)InstAtLOD * S.LODs[L].Tris;
+			LODObj->SetNumberField(TEXT("total_tris"), (int64)InstAtLOD * Info.LODTris[L]);
+			EstimatedRenderedTris += (int64)InstAtLOD * Info.LODTris[L];
 			LODArray.Add(MakeShared<FJsonValueObject>(LODObj));
 		}
 		Obj->SetArrayField(TEXT("lods"), LODArray);
@@ -261,20 +187,23 @@ FString FGetSceneBreakdownCommand::Execute(const FString& Parameters)
 	Result->SetArrayField(TEXT("meshes"), MeshArray);
 	Result->SetNumberField(TEXT("unique_meshes"), Sorted.Num());
 	Result->SetNumberField(TEXT("total_instances"), GrandTotalInstances);
-	Result->SetNumberField(TEXT("total_components"), TotalComponents);
-	Result->SetNumberField(TEXT("total_actors"), TotalActors);
+	Result->SetNumberField(TEXT("total_components"), Breakdown.TotalComponents);
+	Result->SetNumberField(TEXT("total_actors"), Breakdown.TotalActors);
 	Result->SetNumberField(TEXT("total_shadow_casters"), GrandTotalShadowCasters);
 
+	TSharedPtr<FJsonObject> CacheObj = MakeShared<FJsonObject>();
+	CacheObj->SetNumberField(TEXT("generation"), (double)Breakdown.Generation);
+	CacheObj->SetBoolField(TEXT("reused"), bFromCache);
+	CacheObj->SetNumberField(TEXT("aggregate_ms"), Breakdown.AggregateMs);
+	Result->SetObjectField(TEXT("cache"), CacheObj);
+
 	// Summary
 	FString Summary = FString::Printf(
 		TEXT("%d unique meshes, %d instances, %d shadow casters"),
 		Sorted.Num(), GrandTotalInstances, GrandTotalShadowCasters);
 	Result->SetStringField(TEXT("message"), Summary);
 
-	FString Out;
-	TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&Out);
-	FJsonSerializer::Serialize(Result.ToSharedRef(), W);
-	return Out;
+	return SerializeSceneBreakdownResponse(Result);
 }
 
 FString FGetSceneBreakdownCommand::GetCommandName() const { return TEXT("get_scene_breakdown"); }
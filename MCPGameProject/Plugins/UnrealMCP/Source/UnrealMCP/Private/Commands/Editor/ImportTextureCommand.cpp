@@ -8,6 +8,27 @@
 #include "Misc/FileHelper.h"
 #include "UObject/Package.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "IImageWrapperModule.h"
+#include "Modules/ModuleManager.h"
+#include "Utils/TextureProcessingUtils.h"
+
+namespace
+{
+	const TCHAR* const SupportedTextureExtensions[] = { TEXT("png"), TEXT("tga"), TEXT("tif"), TEXT("tiff"), TEXT("jpg"), TEXT("jpeg"), TEXT("exr"), TEXT("hdr"), TEXT("bmp") };
+
+	bool IsSupportedTextureExtension(const FString& Extension)
+	{
+		for (const TCHAR* Supported : SupportedTextureExtensions)
+		{
+			if (Extension == Supported)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+}
 
 FString FImportTextureCommand::GetCommandName() const
 {
@@ -18,31 +39,36 @@ bool FImportTextureCommand::ValidateParams(const FString& Parameters) const
 {
 	FString SourceFilePath, AssetName, FolderPath, CompressionSettings, Error;
 	bool bSRGB, bPreserveAlpha;
-	return ParseParameters(Parameters, SourceFilePath, AssetName, FolderPath, CompressionSettings, bSRGB, bPreserveAlpha, Error);
+	FImportTextureProcessing Processing;
+	return ParseParameters(Parameters, SourceFilePath, AssetName, FolderPath, CompressionSettings, bSRGB, bPreserveAlpha, Processing, Error);
 }
 
 FString FImportTextureCommand::Execute(const FString& Parameters)
 {
 	FString SourceFilePath, AssetName, FolderPath, CompressionSettings, Error;
 	bool bSRGB, bPreserveAlpha;
-	if (!ParseParameters(Parameters, SourceFilePath, AssetName, FolderPath, CompressionSettings, bSRGB, bPreserveAlpha, Error))
+	FImportTextureProcessing Processing;
+	if (!ParseParameters(Parameters, SourceFilePath, AssetName, FolderPath, CompressionSettings, bSRGB, bPreserveAlpha, Processing, Error))
 	{
 		return CreateErrorResponse(Error);
 	}
 
-	// Validate source file exists
-	if (!FPaths::FileExists(SourceFilePath))
+	// Validate every source file (the atlas sources replace source_file_path)
+	const TArray<FString> SourceFiles = Processing.AtlasSources.Num() > 0 ? Processing.AtlasSources : TArray<FString>{ SourceFilePath };
+	for (const FString& SourceFile : SourceFiles)
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Source file does not exist: %s"), *SourceFilePath));
-	}
+		if (!FPaths::FileExists(SourceFile))
+		{
+			return CreateErrorResponse(FString::Printf(TEXT("Source file does not exist: %s"), *SourceFile));
+		}
 
-	// Validate file extension
-	FString Extension = FPaths::GetExtension(SourceFilePath).ToLower();
-	TArray<FString> SupportedExtensions = { TEXT("png"), TEXT("tga"), TEXT("tif"), TEXT("tiff"), TEXT("jpg"), TEXT("jpeg"), TEXT("exr"), TEXT("hdr"), TEXT("bmp") };
-	if (!SupportedExtensions.Contains(Extension))
-	{
-		return CreateErrorResponse(FString::Printf(TEXT("Unsupported texture format: %s. Supported: png, tga, tif, jpg, jpeg, exr, hdr, bmp"), *Extension));
+		const FString SourceExtension = FPaths::GetExtension(SourceFile).ToLower();
+		if (!IsSupportedTextureExtension(SourceExtension))
+		{
+			return CreateErrorResponse(FString::Printf(TEXT("Unsupported texture format: %s. Supported: png, tga, tif, jpg, jpeg, exr, hdr, bmp"), *SourceExtension));
+		}
 	}
+	FString Extension = FPaths::GetExtension(SourceFilePath).ToLower();
 
 	// Normalize destination path
 	FString DestinationPath = FolderPath;
@@ -58,23 +84,6 @@ FString FImportTextureCommand::Execute(const FString& Parameters)
 		}
 	}
 
-	// Create package for the asset
-	FString PackagePath = DestinationPath / AssetName;
-	UPackage* Package = CreatePackage(*PackagePath);
-	if (!Package)
-	{
-		return CreateErrorResponse(FString::Printf(TEXT("Failed to create package: %s"), *PackagePath));
-	}
-	Package->FullyLoad();
-
-	// Create and configure the texture factory
-	UTextureFactory* TextureFactory = NewObject<UTextureFactory>();
-	TextureFactory->AddToRoot();
-
-	// Configure for automated import (suppress dialogs)
-	TextureFactory->SuppressImportOverwriteDialog();
-	TextureFactory->NoAlpha = !bPreserveAlpha;
-
 	// Parse compression settings
 	TextureCompressionSettings CompressionEnum = TC_Default;
 	if (CompressionSettings == TEXT("Normalmap"))
@@ -99,6 +108,28 @@ FString FImportTextureCommand::Execute(const FString& Parameters)
 	}
 	// else TC_Default
 
+	if (Processing.RequiresDecode())
+	{
+		return ExecuteProcessed(SourceFilePath, AssetName, DestinationPath, CompressionEnum, bSRGB, bPreserveAlpha, Processing);
+	}
+
+	// Create package for the asset
+	FString PackagePath = DestinationPath / AssetName;
+	UPackage* Package = CreatePackage(*PackagePath);
+	if (!Package)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Failed to create package: %s"), *PackagePath));
+	}
+	Package->FullyLoad();
+
+	// Create and configure the texture factory
+	UTextureFactory* TextureFactory = NewObject<UTextureFactory>();
+	TextureFactory->AddToRoot();
+
+	// Configure for automated import (suppress dialogs)
+	TextureFactory->SuppressImportOverwriteDialog();
+	TextureFactory->NoAlpha = !bPreserveAlpha;
+
 	// Read file data into memory
 	TArray<uint8> FileData;
 	if (!FFileHelper::LoadFileToArray(FileData, *SourceFilePath))
@@ -142,6 +173,12 @@ FString FImportTextureCommand::Execute(const FString& Parameters)
 			ImportedTexture->SRGB = false;
 		}
 
+		if (Processing.bPreserveAlphaCoverage)
+		{
+			ImportedTexture->bDoScaleMipsForAlphaCoverage = true;
+			ImportedTexture->AlphaCoverageThresholds = FVector4(0.0f, 0.0f, 0.0f, Processing.AlphaThreshold);
+		}
+
 		ImportedTexture->UpdateResource();
 		ImportedTexture->PostEditChange();
 	}
@@ -181,6 +218,182 @@ FString FImportTextureCommand::Execute(const FString& Parameters)
 	return CreateSuccessResponse(PackagePath, AssetName, SizeX, SizeY, bHasAlpha);
 }
 
+FString FImportTextureCommand::ExecuteProcessed(
+	const FString& SourceFilePath,
+	const FString& AssetName,
+	const FString& DestinationPath,
+	TextureCompressionSettings Compression,
+	bool bSRGB,
+	bool bPreserveAlpha,
+	const FImportTextureProcessing& Processing) const
+{
+	const double StartTime = FPlatformTime::Seconds();
+	const bool bAtlas = Processing.AtlasSources.Num() > 0;
+	const TArray<FString> SourceFiles = bAtlas ? Processing.AtlasSources : TArray<FString>{ SourceFilePath };
+
+	// Read and decode every source in parallel, straight into memory
+	IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+	TArray<FImage> Decoded;
+	Decoded.SetNum(SourceFiles.Num());
+	TArray<FString> DecodeErrors;
+	DecodeErrors.SetNum(SourceFiles.Num());
+	ParallelFor(SourceFiles.Num(), [&](int32 Index)
+	{
+		TArray64<uint8> FileData;
+		if (!FFileHelper::LoadFileToArray(FileData, *SourceFiles[Index]))
+		{
+			DecodeErrors[Index] = FString::Printf(TEXT("Failed to read source file: %s"), *SourceFiles[Index]);
+		}
+		else if (!ImageWrapperModule.DecompressImage(FileData.GetData(), FileData.Num(), Decoded[Index]))
+		{
+			DecodeErrors[Index] = FString::Printf(TEXT("Failed to decode image: %s"), *SourceFiles[Index]);
+		}
+	});
+	for (const FString& DecodeError : DecodeErrors)
+	{
+		if (!DecodeError.IsEmpty())
+		{
+			return CreateErrorResponse(DecodeError);
+		}
+	}
+	const double DecodedTime = FPlatformTime::Seconds();
+
+	FTextureProcessingSettings Settings;
+	Settings.AlphaThreshold = Processing.AlphaThreshold;
+
+	FImage Image;
+	FTextureAtlasLayout Layout;
+	TArray<FIntRect> Cells;
+	if (bAtlas)
+	{
+		Layout.Columns = Processing.AtlasColumns;
+		Layout.Rows = Processing.AtlasRows;
+		Layout.Width = Processing.AtlasWidth;
+		Layout.Height = Processing.AtlasHeight;
+
+		FString AtlasError;
+		if (!FTextureProcessingUtils::PackAtlas(Decoded, Layout, Settings, Image, Cells, AtlasError))
+		{
+			return CreateErrorResponse(AtlasError);
+		}
+	}
+	else if (ERawImageFormat::IsHDR(Decoded[0].Format))
+	{
+		return CreateErrorResponse(TEXT("mip_flood requires an 8-bit source image; HDR/float sources are not supported"));
+	}
+	else
+	{
+		Decoded[0].CopyTo(Image, ERawImageFormat::BGRA8, EGammaSpace::sRGB);
+	}
+	Decoded.Empty();
+
+	int64 FloodedTexels = 0;
+	if (Processing.bMipFlood)
+	{
+		FloodedTexels = FTextureProcessingUtils::MipFlood(Image, Settings);
+	}
+	const double AlphaCoverage = FTextureProcessingUtils::ComputeAlphaCoverage(Image, Settings);
+	const double ProcessedTime = FPlatformTime::Seconds();
+
+	// Write the processed pixels directly into the texture source
+	const FString PackagePath = DestinationPath / AssetName;
+	UPackage* Package = CreatePackage(*PackagePath);
+	if (!Package)
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Failed to create package: %s"), *PackagePath));
+	}
+	Package->FullyLoad();
+
+	bool bCreated = false;
+	FString WriteError;
+	UTexture2D* Texture = FTextureProcessingUtils::WriteTextureSource(Package, AssetName, Image, bAtlas ? FString() : SourceFilePath, bCreated, WriteError);
+	if (!Texture)
+	{
+		return CreateErrorResponse(WriteError);
+	}
+
+	Texture->CompressionSettings = Compression;
+	Texture->SRGB = bSRGB && Compression != TC_Normalmap && Compression != TC_Masks && Compression != TC_Grayscale;
+	Texture->CompressionNoAlpha = !bPreserveAlpha;
+	if (Processing.bPreserveAlphaCoverage)
+	{
+		Texture->bDoScaleMipsForAlphaCoverage = true;
+		Texture->AlphaCoverageThresholds = FVector4(0.0f, 0.0f, 0.0f, Processing.AlphaThreshold);
+	}
+	Texture->PostEditChange();
+
+	if (bCreated)
+	{
+		FAssetRegistryModule::AssetCreated(Texture);
+	}
+	Package->MarkPackageDirty();
+
+	const TSharedPtr<FJsonObject> ProcessingJson = MakeShared<FJsonObject>();
+	ProcessingJson->SetBoolField(TEXT("mip_flooded"), Processing.bMipFlood);
+	ProcessingJson->SetNumberField(TEXT("flooded_texels"), static_cast<double>(FloodedTexels));
+	ProcessingJson->SetNumberField(TEXT("alpha_threshold"), Processing.AlphaThreshold);
+	ProcessingJson->SetNumberField(TEXT("alpha_coverage"), AlphaCoverage);
+	ProcessingJson->SetNumberField(TEXT("decode_ms"), (DecodedTime - StartTime) * 1000.0);
+	ProcessingJson->SetNumberField(TEXT("process_ms"), (ProcessedTime - DecodedTime) * 1000.0);
+
+	if (bAtlas)
+	{
+		const TSharedPtr<FJsonObject> AtlasJson = MakeShared<FJsonObject>();
+		AtlasJson->SetNumberField(TEXT("columns"), Layout.Columns);
+		AtlasJson->SetNumberField(TEXT("rows"), Layout.Rows);
+		AtlasJson->SetNumberField(TEXT("cell_width"), Layout.Width / Layout.Columns);
+		AtlasJson->SetNumberField(TEXT("cell_height"), Layout.Height / Layout.Rows);
+
+		TArray<TSharedPtr<FJsonValue>> CellsJson;
+		for (int32 Index = 0; Index < Cells.Num(); ++Index)
+		{
+			const FIntRect& Cell = Cells[Index];
+			const TSharedPtr<FJsonObject> CellJson = MakeShared<FJsonObject>();
+			CellJson->SetStringField(TEXT("source"), SourceFiles[Index]);
+			CellJson->SetNumberField(TEXT("x"), Cell.Min.X);
+			CellJson->SetNumberField(TEXT("y"), Cell.Min.Y);
+			CellJson->SetNumberField(TEXT("width"), Cell.Width());
+			CellJson->SetNumberField(TEXT("height"), Cell.Height());
+
+			// UV rect for sampling this tile in a material: [u0, v0, u1, v1]
+			TArray<TSharedPtr<FJsonValue>> UVJson;
+			UVJson.Add(MakeShared<FJsonValueNumber>(double(Cell.Min.X) / Layout.Width));
+			UVJson.Add(MakeShared<FJsonValueNumber>(double(Cell.Min.Y) / Layout.Height));
+			UVJson.Add(MakeShared<FJsonValueNumber>(double(Cell.Max.X) / Layout.Width));
+			UVJson.Add(MakeShared<FJsonValueNumber>(double(Cell.Max.Y) / Layout.Height));
+			CellJson->SetArrayField(TEXT("uv"), UVJson);
+			CellsJson.Add(MakeShared<FJsonValueObject>(CellJson));
+		}
+		AtlasJson->SetArrayField(TEXT("cells"), CellsJson);
+		ProcessingJson->SetObjectField(TEXT("atlas"), AtlasJson);
+	}
+
+	const int32 SizeX = Texture->Source.GetSizeX();
+	const int32 SizeY = Texture->Source.GetSizeY();
+	const bool bHasAlpha = AlphaCoverage < 1.0;
+
+	UE_LOG(LogTemp, Log, TEXT("Imported processed texture '%s' (%dx%d, %s%s, coverage %.3f)"),
+		*PackagePath, SizeX, SizeY,
+		bAtlas ? TEXT("atlas") : TEXT("single"),
+		Processing.bMipFlood ? TEXT(", mip-flooded") : TEXT(""),
+		AlphaCoverage);
+
+	TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
+	Response->SetBoolField(TEXT("success"), true);
+	Response->SetStringField(TEXT("path"), PackagePath);
+	Response->SetStringField(TEXT("name"), AssetName);
+	Response->SetNumberField(TEXT("size_x"), SizeX);
+	Response->SetNumberField(TEXT("size_y"), SizeY);
+	Response->SetBoolField(TEXT("has_alpha"), bHasAlpha);
+	Response->SetObjectField(TEXT("processing"), ProcessingJson);
+	Response->SetStringField(TEXT("message"), FString::Printf(TEXT("Successfully imported processed texture as: %s (%dx%d, Alpha: %s)"), *PackagePath, SizeX, SizeY, bHasAlpha ? TEXT("Yes") : TEXT("No")));
+
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(Response.ToSharedRef(), Writer);
+	return OutputString;
+}
+
 bool FImportTextureCommand::ParseParameters(
 	const FString& JsonString,
 	FString& OutSourceFilePath,
@@ -189,6 +402,7 @@ bool FImportTextureCommand::ParseParameters(
 	FString& OutCompressionSettings,
 	bool& OutSRGB,
 	bool& OutPreserveAlpha,
+	FImportTextureProcessing& OutProcessing,
 	FString& OutError) const
 {
 	TSharedPtr<FJsonObject> JsonObject;
@@ -200,7 +414,23 @@ bool FImportTextureCommand::ParseParameters(
 		return false;
 	}
 
-	if (!JsonObject->TryGetStringField(TEXT("source_file_path"), OutSourceFilePath) || OutSourceFilePath.IsEmpty())
+	const TArray<TSharedPtr<FJsonValue>>* AtlasSources = nullptr;
+	if (JsonObject->TryGetArrayField(TEXT("atlas_sources"), AtlasSources))
+	{
+		for (const TSharedPtr<FJsonValue>& AtlasSource : *AtlasSources)
+		{
+			FString AtlasSourcePath;
+			if (!AtlasSource->TryGetString(AtlasSourcePath) || AtlasSourcePath.IsEmpty())
+			{
+				OutError = TEXT("atlas_sources must be an array of file paths");
+				return false;
+			}
+			OutProcessing.AtlasSources.Add(AtlasSourcePath);
+		}
+	}
+
+	if ((!JsonObject->TryGetStringField(TEXT("source_file_path"), OutSourceFilePath) || OutSourceFilePath.IsEmpty())
+		&& OutProcessing.AtlasSources.Num() == 0)
 	{
 		OutError = TEXT("Missing required parameter: source_file_path");
 		return false;
@@ -232,6 +462,18 @@ bool FImportTextureCommand::ParseParameters(
 		OutPreserveAlpha = true;
 	}
 
+	JsonObject->TryGetBoolField(TEXT("mip_flood"), OutProcessing.bMipFlood);
+	JsonObject->TryGetBoolField(TEXT("preserve_alpha_coverage"), OutProcessing.bPreserveAlphaCoverage);
+
+	double AlphaThreshold = OutProcessing.AlphaThreshold;
+	JsonObject->TryGetNumberField(TEXT("alpha_threshold"), AlphaThreshold);
+	OutProcessing.AlphaThreshold = static_cast<float>(FMath::Clamp(AlphaThreshold, 0.0, 1.0));
+
+	JsonObject->TryGetNumberField(TEXT("atlas_columns"), OutProcessing.AtlasColumns);
+	JsonObject->TryGetNumberField(TEXT("atlas_rows"), OutProcessing.AtlasRows);
+	JsonObject->TryGetNumberField(TEXT("atlas_width"), OutProcessing.AtlasWidth);
+	JsonObject->TryGetNumberField(TEXT("atlas_height"), OutProcessing.AtlasHeight);
+
 	return true;
 }
 
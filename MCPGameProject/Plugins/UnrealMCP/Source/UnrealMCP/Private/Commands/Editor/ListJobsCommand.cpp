@@ -0,0 +1,60 @@
+#include "Commands/Editor/ListJobsCommand.h"
+#include "Services/MCPJobService.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Dom/JsonObject.h"
+
+FString FListJobsCommand::GetCommandName() const
+{
+	return TEXT("list_jobs");
+}
+
+bool FListJobsCommand::ValidateParams(const FString& Parameters) const
+{
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+	return FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid();
+}
+
+FString FListJobsCommand::Execute(const FString& Parameters)
+{
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+	bool bRunningOnly = false;
+	if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
+	{
+		JsonObject->TryGetBoolField(TEXT("running_only"), bRunningOnly);
+	}
+
+	TArray<TSharedPtr<FJsonValue>> JobsJson;
+	int32 Running = 0;
+	for (const FMCPJobSnapshot& Job : FMCPJobService::Get().ListJobs())
+	{
+		Running += Job.State == EMCPJobState::Running ? 1 : 0;
+		if (bRunningOnly && Job.State != EMCPJobState::Running)
+		{
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> JobJson = MakeShared<FJsonObject>();
+		JobJson->SetStringField(TEXT("job_id"), Job.JobId);
+		JobJson->SetStringField(TEXT("command"), Job.CommandName);
+		JobJson->SetStringField(TEXT("state"), FMCPJobSnapshot::StateToString(Job.State));
+		if (Job.Progress >= 0.0f)
+		{
+			JobJson->SetNumberField(TEXT("progress"), Job.Progress);
+		}
+		JobJson->SetNumberField(TEXT("elapsed_ms"), Job.ElapsedMs);
+		JobsJson.Add(MakeShared<FJsonValueObject>(JobJson));
+	}
+
+	TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+	Response->SetBoolField(TEXT("success"), true);
+	Response->SetArrayField(TEXT("jobs"), JobsJson);
+	Response->SetNumberField(TEXT("running"), Running);
+
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(Response, Writer);
+	return OutputString;
+}
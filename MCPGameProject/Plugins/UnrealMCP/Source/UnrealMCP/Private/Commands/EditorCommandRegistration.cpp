@@ -17,7 +17,13 @@
 #include "Commands/Editor/CreateRenderTargetCommand.h"
 #include "Commands/Editor/ImportStaticMeshCommand.h"
 #include "Commands/Editor/ImportTextureCommand.h"
+#include "Commands/Editor/BulkImportCommand.h"
+#include "Commands/Editor/GetBulkImportStatusCommand.h"
+#include "Commands/Editor/GetJobStatusCommand.h"
+#include "Commands/Editor/CancelJobCommand.h"
+#include "Commands/Editor/ListJobsCommand.h"
 #include "Commands/Editor/GetPerformanceStatsCommand.h"
+#include "Commands/Editor/GetFrameTelemetryCommand.h"
 #include "Commands/Editor/ExecuteConsoleCommandCommand.h"
 #include "Commands/Editor/GetGPUStatsCommand.h"
 #include "Commands/Editor/GetSceneBreakdownCommand.h"
@@ -60,7 +66,16 @@ void FEditorCommandRegistration::RegisterAllCommands()
     // Register asset import commands
     RegisterAndTrackCommand(MakeShared<FImportStaticMeshCommand>());
     RegisterAndTrackCommand(MakeShared<FImportTextureCommand>());
+    RegisterAndTrackCommand(MakeShared<FBulkImportCommand>());
+    RegisterAndTrackCommand(MakeShared<FGetBulkImportStatusCommand>());
+
+    // Register long-running job commands (answered on the socket thread)
+    RegisterAndTrackCommand(MakeShared<FGetJobStatusCommand>());
+    RegisterAndTrackCommand(MakeShared<FCancelJobCommand>());
+    RegisterAndTrackCommand(MakeShared<FListJobsCommand>());
+
     RegisterAndTrackCommand(MakeShared<FGetPerformanceStatsCommand>());
+    RegisterAndTrackCommand(MakeShared<FGetFrameTelemetryCommand>());
     RegisterAndTrackCommand(MakeShared<FExecuteConsoleCommandCommand>());
     RegisterAndTrackCommand(MakeShared<FGetGPUStatsCommand>());
     RegisterAndTrackCommand(MakeShared<FGetSceneBreakdownCommand>());
@@ -0,0 +1,138 @@
+#include "Commands/Material/BatchSetMaterialInstancesParamsCommand.h"
+#include "Commands/Material/BatchSetMaterialParamsCommand.h"
+#include "Services/IMaterialService.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FBatchSetMaterialInstancesParamsCommand::FBatchSetMaterialInstancesParamsCommand(IMaterialService& InMaterialService)
+    : MaterialService(InMaterialService)
+{
+}
+
+FString FBatchSetMaterialInstancesParamsCommand::Execute(const FString& Parameters)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return CreateErrorResponse(TEXT("Invalid JSON parameters"));
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* InstancesArray;
+    if (!JsonObject->TryGetArrayField(TEXT("material_instances"), InstancesArray))
+    {
+        return CreateErrorResponse(TEXT("Missing 'material_instances' parameter"));
+    }
+
+    TArray<FString> InstancePaths;
+    InstancePaths.Reserve(InstancesArray->Num());
+    for (const TSharedPtr<FJsonValue>& Value : *InstancesArray)
+    {
+        if (!Value.IsValid() || Value->Type != EJson::String || Value->AsString().IsEmpty())
+        {
+            return CreateErrorResponse(TEXT("'material_instances' must be an array of asset path strings"));
+        }
+        InstancePaths.AddUnique(Value->AsString());
+    }
+    if (InstancePaths.IsEmpty())
+    {
+        return CreateErrorResponse(TEXT("'material_instances' must not be empty"));
+    }
+
+    FMaterialParameterBatch Batch;
+    FString Error;
+    if (!FBatchSetMaterialParamsCommand::ParseParameterMaps(JsonObject, Batch, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    TArray<FMaterialInstanceBatchResult> Results;
+    if (!MaterialService.BatchSetInstanceParameters(InstancePaths, Batch, Results, Error) && Results.IsEmpty())
+    {
+        // Failed before touching any instance (e.g. a texture could not be loaded)
+        return CreateErrorResponse(Error);
+    }
+
+    return CreateResponse(Results, Error);
+}
+
+bool FBatchSetMaterialInstancesParamsCommand::ValidateParams(const FString& Parameters) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* InstancesArray;
+    return JsonObject->TryGetArrayField(TEXT("material_instances"), InstancesArray) && InstancesArray->Num() > 0;
+}
+
+FString FBatchSetMaterialInstancesParamsCommand::CreateResponse(const TArray<FMaterialInstanceBatchResult>& Results, const FString& Error) const
+{
+    auto ToJsonArray = [](const TArray<FString>& Names)
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        for (const FString& Name : Names)
+        {
+            Values.Add(MakeShared<FJsonValueString>(Name));
+        }
+        return Values;
+    };
+
+    int32 FailedCount = 0;
+    bool bAnyApplied = false;
+    TArray<TSharedPtr<FJsonValue>> InstancesArray;
+    for (const FMaterialInstanceBatchResult& Result : Results)
+    {
+        TSharedPtr<FJsonObject> InstanceObj = MakeShared<FJsonObject>();
+        InstanceObj->SetStringField(TEXT("material_instance"), Result.InstancePath);
+        InstanceObj->SetBoolField(TEXT("success"), Result.bSuccess);
+        if (!Result.bSuccess)
+        {
+            InstanceObj->SetStringField(TEXT("error"), Result.Error);
+            ++FailedCount;
+        }
+        InstanceObj->SetArrayField(TEXT("scalar"), ToJsonArray(Result.AppliedScalars));
+        InstanceObj->SetArrayField(TEXT("vector"), ToJsonArray(Result.AppliedVectors));
+        InstanceObj->SetArrayField(TEXT("texture"), ToJsonArray(Result.AppliedTextures));
+        InstancesArray.Add(MakeShared<FJsonValueObject>(InstanceObj));
+
+        bAnyApplied |= !Result.AppliedScalars.IsEmpty() || !Result.AppliedVectors.IsEmpty() || !Result.AppliedTextures.IsEmpty();
+    }
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), FailedCount == 0);
+    if (FailedCount > 0)
+    {
+        ResponseObj->SetStringField(TEXT("error"), Error);
+        ResponseObj->SetBoolField(TEXT("partial_update"), bAnyApplied);
+    }
+    ResponseObj->SetArrayField(TEXT("instances"), InstancesArray);
+    ResponseObj->SetNumberField(TEXT("instance_count"), Results.Num());
+    ResponseObj->SetNumberField(TEXT("failed_count"), FailedCount);
+    ResponseObj->SetStringField(TEXT("message"), FString::Printf(TEXT("Updated %d of %d material instances"), Results.Num() - FailedCount, Results.Num()));
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+
+    return OutputString;
+}
+
+FString FBatchSetMaterialInstancesParamsCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetBoolField(TEXT("success"), false);
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+
+    return OutputString;
+}
@@ -25,15 +25,72 @@ FString FBatchSetMaterialParamsCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(TEXT("Missing 'material_instance' parameter"));
     }
 
+    FMaterialParameterBatch Batch;
+    FString Error;
+    if (!ParseParameterMaps(JsonObject, Batch, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
     TArray<FString> SetScalarParams;
     TArray<FString> SetVectorParams;
     TArray<FString> SetTextureParams;
     TArray<FString> Failures;
-    TArray<TPair<FString, float>> ScalarValues;
-    TArray<TPair<FString, FLinearColor>> VectorValues;
-    TArray<TPair<FString, FString>> TextureValues;
-    FString Error;
 
+    // Validation is complete before the first mutation. Setter failures can still
+    // produce a partial update, so error responses include the exact applied names.
+    for (const TPair<FString, float>& Pair : Batch.ScalarParameters)
+    {
+        Error.Reset();
+        if (MaterialService.SetScalarParameter(MaterialPath, Pair.Key, Pair.Value, Error))
+        {
+            SetScalarParams.Add(Pair.Key);
+        }
+        else
+        {
+            Failures.Add(FString::Printf(TEXT("scalar %s: %s"), *Pair.Key, *Error));
+        }
+    }
+    for (const TPair<FString, FLinearColor>& Pair : Batch.VectorParameters)
+    {
+        Error.Reset();
+        if (MaterialService.SetVectorParameter(MaterialPath, Pair.Key, Pair.Value, Error))
+        {
+            SetVectorParams.Add(Pair.Key);
+        }
+        else
+        {
+            Failures.Add(FString::Printf(TEXT("vector %s: %s"), *Pair.Key, *Error));
+        }
+    }
+    for (const TPair<FString, FString>& Pair : Batch.TextureParameters)
+    {
+        Error.Reset();
+        if (MaterialService.SetTextureParameter(MaterialPath, Pair.Key, Pair.Value, Error))
+        {
+            SetTextureParams.Add(Pair.Key);
+        }
+        else
+        {
+            Failures.Add(FString::Printf(TEXT("texture %s: %s"), *Pair.Key, *Error));
+        }
+    }
+
+    if (!Failures.IsEmpty())
+    {
+        return CreateErrorResponse(
+            FString::Join(Failures, TEXT("; ")),
+            &MaterialPath,
+            &SetScalarParams,
+            &SetVectorParams,
+            &SetTextureParams);
+    }
+
+    return CreateSuccessResponse(MaterialPath, SetScalarParams, SetVectorParams, SetTextureParams);
+}
+
+bool FBatchSetMaterialParamsCommand::ParseParameterMaps(const TSharedPtr<FJsonObject>& JsonObject, FMaterialParameterBatch& OutBatch, FString& OutError)
+{
     bool bHasParameterObject = false;
     for (const TCHAR* FieldName : {TEXT("scalar_params"), TEXT("vector_params"), TEXT("texture_params")})
     {
@@ -44,12 +101,14 @@ FString FBatchSetMaterialParamsCommand::Execute(const FString& Parameters)
         bHasParameterObject = true;
         if (JsonObject->Values[FieldName]->Type != EJson::Object)
         {
-            return CreateErrorResponse(FString::Printf(TEXT("'%s' must be a JSON object"), FieldName));
+            OutError = FString::Printf(TEXT("'%s' must be a JSON object"), FieldName);
+            return false;
         }
     }
     if (!bHasParameterObject)
     {
-        return CreateErrorResponse(TEXT("At least one of scalar_params, vector_params, or texture_params is required"));
+        OutError = TEXT("At least one of scalar_params, vector_params, or texture_params is required");
+        return false;
     }
 
     // Process scalar parameters
@@ -61,9 +120,10 @@ FString FBatchSetMaterialParamsCommand::Execute(const FString& Parameters)
             const FString Key = FString(Pair.Key.ToView());
             if (Pair.Value->Type != EJson::Number)
             {
-                return CreateErrorResponse(FString::Printf(TEXT("scalar_params.%s must be a number"), *Key));
+                OutError = FString::Printf(TEXT("scalar_params.%s must be a number"), *Key);
+                return false;
             }
-            ScalarValues.Emplace(Key, static_cast<float>(Pair.Value->AsNumber()));
+            OutBatch.ScalarParameters.Emplace(Key, static_cast<float>(Pair.Value->AsNumber()));
         }
     }
 
@@ -81,7 +141,8 @@ FString FBatchSetMaterialParamsCommand::Execute(const FString& Parameters)
                 {
                     if (Component->Type != EJson::Number)
                     {
-                        return CreateErrorResponse(FString::Printf(TEXT("vector_params.%s components must be numbers"), *Key));
+                        OutError = FString::Printf(TEXT("vector_params.%s components must be numbers"), *Key);
+                        return false;
                     }
                 }
                 FLinearColor Color;
@@ -90,11 +151,12 @@ FString FBatchSetMaterialParamsCommand::Execute(const FString& Parameters)
                 Color.B = static_cast<float>((*ColorArray)[2]->AsNumber());
                 Color.A = ColorArray->Num() >= 4 ? static_cast<float>((*ColorArray)[3]->AsNumber()) : 1.0f;
 
-                VectorValues.Emplace(Key, Color);
+                OutBatch.VectorParameters.Emplace(Key, Color);
             }
             else
             {
-                return CreateErrorResponse(FString::Printf(TEXT("vector_params.%s must be an array with 3 or 4 numbers"), *Key));
+                OutError = FString::Printf(TEXT("vector_params.%s must be an array with 3 or 4 numbers"), *Key);
+                return false;
             }
         }
     }
@@ -108,62 +170,14 @@ FString FBatchSetMaterialParamsCommand::Execute(const FString& Parameters)
             const FString Key = FString(Pair.Key.ToView());
             if (Pair.Value->Type != EJson::String)
             {
-                return CreateErrorResponse(FString::Printf(TEXT("texture_params.%s must be an asset path string"), *Key));
+                OutError = FString::Printf(TEXT("texture_params.%s must be an asset path string"), *Key);
+                return false;
             }
-            TextureValues.Emplace(Key, Pair.Value->AsString());
+            OutBatch.TextureParameters.Emplace(Key, Pair.Value->AsString());
         }
     }
 
-    // Validation is complete before the first mutation. Setter failures can still
-    // produce a partial update, so error responses include the exact applied names.
-    for (const TPair<FString, float>& Pair : ScalarValues)
-    {
-        Error.Reset();
-        if (MaterialService.SetScalarParameter(MaterialPath, Pair.Key, Pair.Value, Error))
-        {
-            SetScalarParams.Add(Pair.Key);
-        }
-        else
-        {
-            Failures.Add(FString::Printf(TEXT("scalar %s: %s"), *Pair.Key, *Error));
-        }
-    }
-    for (const TPair<FString, FLinearColor>& Pair : VectorValues)
-    {
-        Error.Reset();
-        if (MaterialService.SetVectorParameter(MaterialPath, Pair.Key, Pair.Value, Error))
-        {
-            SetVectorParams.Add(Pair.Key);
-        }
-        else
-        {
-            Failures.Add(FString::Printf(TEXT("vector %s: %s"), *Pair.Key, *Error));
-        }
-    }
-    for (const TPair<FString, FString>& Pair : TextureValues)
-    {
-        Error.Reset();
-        if (MaterialService.SetTextureParameter(MaterialPath, Pair.Key, Pair.Value, Error))
-        {
-            SetTextureParams.Add(Pair.Key);
-        }
-        else
-        {
-            Failures.Add(FString::Printf(TEXT("texture %s: %s"), *Pair.Key, *Error));
-        }
-    }
-
-    if (!Failures.IsEmpty())
-    {
-        return CreateErrorResponse(
-            FString::Join(Failures, TEXT("; ")),
-            &MaterialPath,
-            &SetScalarParams,
-            &SetVectorParams,
-            &SetTextureParams);
-    }
-
-    return CreateSuccessResponse(MaterialPath, SetScalarParams, SetVectorParams, SetTextureParams);
+    return true;
 }
 
 bool FBatchSetMaterialParamsCommand::ValidateParams(const FString& Parameters) const
@@ -1,4 +1,7 @@
 #include "Commands/Material/GetMaterialMetadataCommand.h"
+#include "Services/MetadataResponseCache.h"
+#include "Materials/MaterialInstance.h"
+#include "Materials/MaterialInterface.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -19,20 +22,37 @@ FString FGetMaterialMetadataCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(Error);
     }
 
-    TSharedPtr<FJsonObject> Metadata;
-    TArray<FString>* FieldsPtr = Fields.Num() > 0 ? &Fields : nullptr;
-
-    if (!MaterialService.GetMaterialMetadata(MaterialPath, FieldsPtr, Metadata))
+    UMaterialInterface* Material = MaterialService.FindMaterial(MaterialPath);
+    if (!Material)
     {
         return CreateErrorResponse(FString::Printf(TEXT("Material not found: %s"), *MaterialPath));
     }
 
-    // Serialize the metadata JSON object
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(Metadata.ToSharedRef(), Writer);
+    // An instance reports blend mode, shading model and inherited parameters from its parent chain
+    TArray<const UObject*, TInlineAllocator<4>> Parents;
+    for (const UMaterialInstance* Instance = Cast<UMaterialInstance>(Material); Instance && Instance->Parent; Instance = Cast<UMaterialInstance>(Instance->Parent.Get()))
+    {
+        const UMaterialInterface* Parent = Instance->Parent.Get();
+        if (Parents.Contains(Parent))
+        {
+            break;
+        }
+        Parents.Add(Parent);
+    }
 
-    return OutputString;
+    return FMetadataResponseCache::Get().Serve(GetCommandName(), Parameters, Material, [&]()
+    {
+        TSharedPtr<FJsonObject> Metadata;
+        TArray<FString>* FieldsPtr = Fields.Num() > 0 ? &Fields : nullptr;
+
+        if (!MaterialService.GetMaterialMetadata(MaterialPath, FieldsPtr, Metadata) || !Metadata.IsValid())
+        {
+            Metadata = MakeShared<FJsonObject>();
+            Metadata->SetBoolField(TEXT("success"), false);
+            Metadata->SetStringField(TEXT("error"), FString::Printf(TEXT("Material not found: %s"), *MaterialPath));
+        }
+        return Metadata;
+    }, Parents);
 }
 
 FString FGetMaterialMetadataCommand::GetCommandName() const
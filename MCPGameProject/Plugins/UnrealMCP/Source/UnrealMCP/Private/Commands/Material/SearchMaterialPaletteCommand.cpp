@@ -2,7 +2,7 @@
 #include "Materials/MaterialExpression.h"
 #include "Materials/MaterialFunction.h"
 #include "AssetRegistry/AssetRegistryModule.h"
-#include "UObject/UObjectIterator.h"
+#include "Services/ReflectionCatalog.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
 #include "Serialization/JsonSerializer.h"
@@ -52,18 +52,12 @@ FString FSearchMaterialPaletteCommand::Execute(const FString& Parameters)
     if (TypeFilter.Equals(TEXT("All"), ESearchCase::IgnoreCase) ||
         TypeFilter.Equals(TEXT("Expression"), ESearchCase::IgnoreCase))
     {
-        // Iterate all UMaterialExpression-derived classes
-        for (TObjectIterator<UClass> It; It; ++It)
+        // Iterate all UMaterialExpression-derived classes (abstract/deprecated skipped by the catalog)
+        for (UClass* Class : FReflectionCatalog::Get().GetDerivedClasses(UMaterialExpression::StaticClass(), CLASS_Abstract | CLASS_Deprecated))
         {
-            UClass* Class = *It;
-
-            // Skip abstract, deprecated, private classes
-            if (Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated))
-                continue;
+            // Skip private classes
             if (Class->HasMetaData(TEXT("Private")))
                 continue;
-            if (!Class->IsChildOf(UMaterialExpression::StaticClass()))
-                continue;
 
             // Get display name (remove "MaterialExpression" prefix)
             FString DisplayName;
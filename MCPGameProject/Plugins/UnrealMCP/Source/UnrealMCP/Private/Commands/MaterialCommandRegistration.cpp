@@ -16,6 +16,7 @@
 #include "Commands/Material/SetMaterialTextureParamCommand.h"
 #include "Commands/Material/DuplicateMaterialInstanceCommand.h"
 #include "Commands/Material/BatchSetMaterialParamsCommand.h"
+#include "Commands/Material/BatchSetMaterialInstancesParamsCommand.h"
 #include "Commands/Material/GetMaterialInstanceMetadataCommand.h"
 #include "Commands/Material/GetMaterialParametersCommand.h"
 
@@ -55,6 +56,7 @@ void FMaterialCommandRegistration::RegisterAllCommands()
     RegisterAndTrackCommand(MakeShared<FSetMaterialTextureParamCommand>(MaterialService));
     RegisterAndTrackCommand(MakeShared<FDuplicateMaterialInstanceCommand>(MaterialService));
     RegisterAndTrackCommand(MakeShared<FBatchSetMaterialParamsCommand>(MaterialService));
+    RegisterAndTrackCommand(MakeShared<FBatchSetMaterialInstancesParamsCommand>(MaterialService));
     RegisterAndTrackCommand(MakeShared<FGetMaterialInstanceMetadataCommand>(MaterialService));
     RegisterAndTrackCommand(MakeShared<FGetMaterialParametersCommand>(MaterialService));
 
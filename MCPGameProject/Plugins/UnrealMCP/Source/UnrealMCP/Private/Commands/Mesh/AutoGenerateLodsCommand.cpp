@@ -2,125 +2,109 @@
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
-#include "Engine/StaticMesh.h"
-#include "StaticMeshEditorSubsystem.h"
-#include "UObject/SavePackage.h"
+#include "Services/LodGenerationService.h"
+
+namespace
+{
+FString SerializeAutoGenerateLodsResponse(const TSharedRef<FJsonObject>& Response)
+{
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(Response, Writer);
+	return OutputString;
+}
+}
+
+FAutoGenerateLodsCommand::FAutoGenerateLodsCommand(TSharedRef<ILodGenerationBackend> InBackend)
+	: Backend(InBackend)
+{
+}
 
 FString FAutoGenerateLodsCommand::Execute(const FString& Parameters)
 {
-	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
-	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	TArray<FLodGenerationRequest> Requests;
+	FLodGenerationJobOptions Options;
+	FString Error;
+	TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+	if (!ParseParameters(Parameters, Requests, Options, Error))
 	{
-		TSharedPtr<FJsonObject> E = MakeShared<FJsonObject>(); E->SetBoolField(TEXT("success"), false);
-		E->SetStringField(TEXT("error"), TEXT("Invalid JSON"));
-		FString O; TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&O);
-		FJsonSerializer::Serialize(E.ToSharedRef(), W); return O;
+		Response->SetBoolField(TEXT("success"), false);
+		Response->SetStringField(TEXT("error"), Error);
+		return SerializeAutoGenerateLodsResponse(Response);
 	}
 
-	FString MeshPath;
-	int32 TargetLodCount = 3;
-	JsonObject->TryGetStringField(TEXT("mesh_path"), MeshPath);
-	JsonObject->TryGetNumberField(TEXT("target_lod_count"), TargetLodCount);
+	const int32 MeshCount = Requests.Num();
+	const int32 LodCount = Requests[0].LodCount;
+	const FString JobId = FLodGenerationService::Get().StartJob(MoveTemp(Requests), Options, Backend);
 
-	if (MeshPath.IsEmpty())
+	Response->SetBoolField(TEXT("success"), true);
+	Response->SetStringField(TEXT("job_id"), JobId);
+	Response->SetNumberField(TEXT("mesh_count"), MeshCount);
+	Response->SetNumberField(TEXT("target_lod_count"), LodCount);
+	Response->SetStringField(TEXT("message"), FString::Printf(
+		TEXT("Queued %d LOD(s) for %d mesh(es). Poll get_lod_job_status with job_id '%s'."), LodCount, MeshCount, *JobId));
+	return SerializeAutoGenerateLodsResponse(Response);
+}
+
+bool FAutoGenerateLodsCommand::ParseParameters(const FString& JsonString, TArray<FLodGenerationRequest>& OutRequests, FLodGenerationJobOptions& OutOptions, FString& OutError)
+{
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
 	{
-		TSharedPtr<FJsonObject> E = MakeShared<FJsonObject>(); E->SetBoolField(TEXT("success"), false);
-		E->SetStringField(TEXT("error"), TEXT("Missing mesh_path"));
-		FString O; TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&O);
-		FJsonSerializer::Serialize(E.ToSharedRef(), W); return O;
+		OutError = TEXT("Invalid JSON");
+		return false;
 	}
 
-	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
-	if (!Mesh)
+	TArray<FString> MeshPaths;
+	bool bSave = true;
+	if (!FLodGenerationService::ParseJobTargets(*JsonObject, MeshPaths, OutOptions, bSave, OutError))
 	{
-		TSharedPtr<FJsonObject> E = MakeShared<FJsonObject>(); E->SetBoolField(TEXT("success"), false);
-		E->SetStringField(TEXT("error"), FString::Printf(TEXT("Mesh not found: %s"), *MeshPath));
-		FString O; TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&O);
-		FJsonSerializer::Serialize(E.ToSharedRef(), W); return O;
+		return false;
 	}
 
-	// Parse reduction percentages or generate defaults
+	// Reduction percentages include LOD0 and default to evenly distributed
 	TArray<float> ReductionPercentages;
 	const TArray<TSharedPtr<FJsonValue>>* RedArray;
 	if (JsonObject->TryGetArrayField(TEXT("reduction_percentages"), RedArray))
 	{
 		for (const auto& Val : *RedArray)
 		{
-			ReductionPercentages.Add((float)Val->AsNumber());
-		}
-	}
-	else
-	{
-		// Default: evenly distributed
-		for (int32 i = 0; i < TargetLodCount; ++i)
-		{
-			float Pct = 1.0f - ((float)i / (float)TargetLodCount);
-			ReductionPercentages.Add(FMath::Max(0.05f, Pct));
+			const float Pct = (float)Val->AsNumber();
+			if (Pct <= 0.0f || Pct > 1.0f)
+			{
+				OutError = TEXT("reduction_percentages must be in (0, 1]");
+				return false;
+			}
+			ReductionPercentages.Add(Pct);
 		}
 	}
 
-	// Build reduction options
-	UStaticMeshEditorSubsystem* Subsystem = GEditor->GetEditorSubsystem<UStaticMeshEditorSubsystem>();
-	if (!Subsystem)
-	{
-		TSharedPtr<FJsonObject> E = MakeShared<FJsonObject>(); E->SetBoolField(TEXT("success"), false);
-		E->SetStringField(TEXT("error"), TEXT("StaticMeshEditorSubsystem not available"));
-		FString O; TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&O);
-		FJsonSerializer::Serialize(E.ToSharedRef(), W); return O;
-	}
-
-	// Use SetLods with reduction options
-	FStaticMeshReductionOptions Options;
-	Options.bAutoComputeLODScreenSize = true;
-
-	for (int32 i = 0; i < TargetLodCount; ++i)
+	int32 TargetLodCount = ReductionPercentages.Num() > 0 ? ReductionPercentages.Num() : 3;
+	JsonObject->TryGetNumberField(TEXT("target_lod_count"), TargetLodCount);
+	if (TargetLodCount < 1 || TargetLodCount > 8)
 	{
-		FStaticMeshReductionSettings Settings;
-		Settings.PercentTriangles = (i < ReductionPercentages.Num()) ? ReductionPercentages[i] : 0.5f;
-		Settings.ScreenSize = 1.0f - ((float)i / (float)TargetLodCount);
-		Options.ReductionSettings.Add(Settings);
+		OutError = TEXT("Invalid target_lod_count (1-8)");
+		return false;
 	}
 
-	Subsystem->SetLods(Mesh, Options);
-
-	// Save
-	Mesh->MarkPackageDirty();
-	UPackage* Package = Mesh->GetOutermost();
-	FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs; SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Mesh, *Filename, SaveArgs);
-
-	// Build result with per-LOD stats
-	TArray<TSharedPtr<FJsonValue>> LodArray;
-	for (int32 i = 0; i < Mesh->GetNumLODs(); ++i)
+	OutRequests.Reset(MeshPaths.Num());
+	for (const FString& MeshPath : MeshPaths)
 	{
-		TSharedPtr<FJsonObject> LodObj = MakeShared<FJsonObject>();
-		LodObj->SetNumberField(TEXT("index"), i);
-		LodObj->SetNumberField(TEXT("vertices"), Mesh->GetNumVertices(i));
-		LodObj->SetNumberField(TEXT("triangles"), Mesh->GetNumTriangles(i));
-		LodArray.Add(MakeShared<FJsonValueObject>(LodObj));
+		FLodGenerationRequest& Request = OutRequests.AddDefaulted_GetRef();
+		Request.MeshPath = MeshPath;
+		Request.LodCount = TargetLodCount;
+		Request.PercentTriangles = ReductionPercentages;
+		Request.bSave = bSave;
 	}
-
-	UE_LOG(LogTemp, Log, TEXT("Auto-generated %d LODs for %s"), Mesh->GetNumLODs(), *MeshPath);
-
-	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-	Result->SetBoolField(TEXT("success"), true);
-	Result->SetNumberField(TEXT("lod_count"), Mesh->GetNumLODs());
-	Result->SetArrayField(TEXT("lods"), LodArray);
-	Result->SetStringField(TEXT("message"), FString::Printf(
-		TEXT("Generated %d LODs for %s"), Mesh->GetNumLODs(), *MeshPath));
-
-	FString OutputString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-	FJsonSerializer::Serialize(Result.ToSharedRef(), Writer);
-	return OutputString;
+	return true;
 }
 
 FString FAutoGenerateLodsCommand::GetCommandName() const { return TEXT("auto_generate_lods"); }
 bool FAutoGenerateLodsCommand::ValidateParams(const FString& Parameters) const
 {
-	TSharedPtr<FJsonObject> J; TSharedRef<TJsonReader<>> R = TJsonReaderFactory<>::Create(Parameters);
-	if (!FJsonSerializer::Deserialize(R, J)) return false;
-	FString P; return J->TryGetStringField(TEXT("mesh_path"), P);
+	TArray<FLodGenerationRequest> Requests;
+	FLodGenerationJobOptions Options;
+	FString Error;
+	return ParseParameters(Parameters, Requests, Options, Error);
 }
@@ -0,0 +1,159 @@
+#include "Commands/Mesh/GetLodJobStatusCommand.h"
+#include "Services/LodGenerationService.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Dom/JsonObject.h"
+
+namespace
+{
+FString SerializeLodJobStatus(const TSharedRef<FJsonObject>& Response)
+{
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(Response, Writer);
+	return OutputString;
+}
+
+const TCHAR* MeshStateToString(ELodGenerationState State)
+{
+	switch (State)
+	{
+	case ELodGenerationState::Queued: return TEXT("queued");
+	case ELodGenerationState::Reducing: return TEXT("reducing");
+	case ELodGenerationState::Reduced: return TEXT("reduced");
+	case ELodGenerationState::Building: return TEXT("building");
+	case ELodGenerationState::Succeeded: return TEXT("succeeded");
+	default: return TEXT("failed");
+	}
+}
+
+bool ParseStatusParams(const FString& Parameters, FString& OutJobId, bool& OutIncludeMeshes, FString& OutError)
+{
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		OutError = TEXT("Failed to parse JSON parameters");
+		return false;
+	}
+	if (!JsonObject->TryGetStringField(TEXT("job_id"), OutJobId) || OutJobId.IsEmpty())
+	{
+		OutError = TEXT("Missing required parameter: job_id");
+		return false;
+	}
+	OutIncludeMeshes = true;
+	JsonObject->TryGetBoolField(TEXT("include_meshes"), OutIncludeMeshes);
+	return true;
+}
+
+TSharedPtr<FJsonObject> MeshStatusToJson(const FLodGenerationMeshStatus& MeshStatus)
+{
+	TSharedPtr<FJsonObject> MeshJson = MakeShared<FJsonObject>();
+	MeshJson->SetStringField(TEXT("mesh_path"), MeshStatus.Request.MeshPath);
+	MeshJson->SetStringField(TEXT("state"), MeshStateToString(MeshStatus.State));
+	if (!MeshStatus.Error.IsEmpty())
+	{
+		MeshJson->SetStringField(TEXT("error"), MeshStatus.Error);
+	}
+	MeshJson->SetNumberField(TEXT("previous_lod_count"), MeshStatus.PreviousLodCount);
+	MeshJson->SetNumberField(TEXT("source_triangles"), MeshStatus.SourceTriangles);
+
+	TSharedPtr<FJsonObject> TimingsJson = MakeShared<FJsonObject>();
+	TimingsJson->SetNumberField(TEXT("prepare_ms"), MeshStatus.PrepareMs);
+	TimingsJson->SetNumberField(TEXT("reduce_ms"), MeshStatus.ReduceMs);
+	TimingsJson->SetNumberField(TEXT("commit_ms"), MeshStatus.CommitMs);
+	TimingsJson->SetNumberField(TEXT("build_ms"), MeshStatus.BuildMs);
+	TimingsJson->SetNumberField(TEXT("save_ms"), MeshStatus.FinalizeMs);
+	MeshJson->SetObjectField(TEXT("timings"), TimingsJson);
+
+	TArray<TSharedPtr<FJsonValue>> LodsJson;
+	for (const FLodGenerationLodStats& Lod : MeshStatus.Lods)
+	{
+		TSharedPtr<FJsonObject> LodJson = MakeShared<FJsonObject>();
+		LodJson->SetNumberField(TEXT("index"), Lod.LodIndex);
+		LodJson->SetBoolField(TEXT("generated"), Lod.bGenerated);
+		LodJson->SetNumberField(TEXT("percent_triangles"), Lod.PercentTriangles);
+		LodJson->SetNumberField(TEXT("triangles"), Lod.Triangles);
+		LodJson->SetNumberField(TEXT("vertices"), Lod.Vertices);
+		if (Lod.bGenerated)
+		{
+			LodJson->SetNumberField(TEXT("max_deviation"), Lod.MaxDeviation);
+		}
+		if (MeshStatus.State == ELodGenerationState::Succeeded)
+		{
+			LodJson->SetNumberField(TEXT("render_triangles"), Lod.RenderTriangles);
+			LodJson->SetNumberField(TEXT("render_vertices"), Lod.RenderVertices);
+		}
+		LodsJson.Add(MakeShared<FJsonValueObject>(LodJson));
+	}
+	MeshJson->SetArrayField(TEXT("lods"), LodsJson);
+	return MeshJson;
+}
+}
+
+FString FGetLodJobStatusCommand::GetCommandName() const
+{
+	return TEXT("get_lod_job_status");
+}
+
+bool FGetLodJobStatusCommand::ValidateParams(const FString& Parameters) const
+{
+	FString JobId, Error;
+	bool bIncludeMeshes = true;
+	return ParseStatusParams(Parameters, JobId, bIncludeMeshes, Error);
+}
+
+FString FGetLodJobStatusCommand::Execute(const FString& Parameters)
+{
+	FString JobId, Error;
+	bool bIncludeMeshes = true;
+	TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+	if (!ParseStatusParams(Parameters, JobId, bIncludeMeshes, Error))
+	{
+		Response->SetBoolField(TEXT("success"), false);
+		Response->SetStringField(TEXT("error"), Error);
+		return SerializeLodJobStatus(Response);
+	}
+
+	FLodGenerationJobStatus Status;
+	if (!FLodGenerationService::Get().GetJobStatus(JobId, Status, bIncludeMeshes))
+	{
+		Response->SetBoolField(TEXT("success"), false);
+		Response->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown LOD job: %s"), *JobId));
+		return SerializeLodJobStatus(Response);
+	}
+
+	const int32 Total = Status.Total;
+	const int32 Succeeded = Status.Count(ELodGenerationState::Succeeded);
+	const int32 Failed = Status.Count(ELodGenerationState::Failed);
+
+	Response->SetBoolField(TEXT("success"), true);
+	Response->SetStringField(TEXT("job_id"), Status.JobId);
+	Response->SetStringField(TEXT("state"), Status.bComplete ? TEXT("completed") : TEXT("running"));
+	Response->SetNumberField(TEXT("total"), Total);
+	Response->SetNumberField(TEXT("queued"), Status.Count(ELodGenerationState::Queued));
+	Response->SetNumberField(TEXT("reducing"), Status.Count(ELodGenerationState::Reducing) + Status.Count(ELodGenerationState::Reduced));
+	Response->SetNumberField(TEXT("building"), Status.Count(ELodGenerationState::Building));
+	Response->SetNumberField(TEXT("succeeded"), Succeeded);
+	Response->SetNumberField(TEXT("failed"), Failed);
+	Response->SetNumberField(TEXT("elapsed_ms"), Status.ElapsedMs);
+	Response->SetNumberField(TEXT("reduce_ms_total"), Status.ReduceMs);
+	Response->SetNumberField(TEXT("game_thread_ms_total"), Status.GameThreadMs);
+	Response->SetNumberField(TEXT("game_thread_slices"), Status.Ticks);
+
+	if (bIncludeMeshes)
+	{
+		TArray<TSharedPtr<FJsonValue>> MeshesJson;
+		MeshesJson.Reserve(Status.Meshes.Num());
+		for (const FLodGenerationMeshStatus& MeshStatus : Status.Meshes)
+		{
+			MeshesJson.Add(MakeShared<FJsonValueObject>(MeshStatusToJson(MeshStatus)));
+		}
+		Response->SetArrayField(TEXT("meshes"), MeshesJson);
+	}
+
+	Response->SetStringField(TEXT("message"), Status.bComplete
+		? FString::Printf(TEXT("Generated LODs for %d of %d mesh(es), %d failed"), Succeeded, Total, Failed)
+		: FString::Printf(TEXT("%d of %d mesh(es) done"), Succeeded + Failed, Total));
+	return SerializeLodJobStatus(Response);
+}
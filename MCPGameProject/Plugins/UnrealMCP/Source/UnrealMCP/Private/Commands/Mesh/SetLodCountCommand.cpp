@@ -2,72 +2,100 @@
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
-#include "Engine/StaticMesh.h"
-#include "UObject/SavePackage.h"
+#include "Services/LodGenerationService.h"
+
+namespace
+{
+FString SerializeSetLodCountResponse(const TSharedRef<FJsonObject>& Response)
+{
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(Response, Writer);
+	return OutputString;
+}
+}
+
+FSetLodCountCommand::FSetLodCountCommand(TSharedRef<ILodGenerationBackend> InBackend)
+	: Backend(InBackend)
+{
+}
 
 FString FSetLodCountCommand::Execute(const FString& Parameters)
 {
-	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
-	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	TArray<FLodGenerationRequest> Requests;
+	FLodGenerationJobOptions Options;
+	FString Error;
+	TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+	if (!ParseParameters(Parameters, Requests, Options, Error))
 	{
-		TSharedPtr<FJsonObject> E = MakeShared<FJsonObject>(); E->SetBoolField(TEXT("success"), false);
-		E->SetStringField(TEXT("error"), TEXT("Invalid JSON"));
-		FString O; TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&O);
-		FJsonSerializer::Serialize(E.ToSharedRef(), W); return O;
+		Response->SetBoolField(TEXT("success"), false);
+		Response->SetStringField(TEXT("error"), Error);
+		return SerializeSetLodCountResponse(Response);
 	}
 
-	FString MeshPath;
-	int32 LodCount = 1;
-	JsonObject->TryGetStringField(TEXT("mesh_path"), MeshPath);
-	JsonObject->TryGetNumberField(TEXT("lod_count"), LodCount);
+	const int32 MeshCount = Requests.Num();
+	const int32 LodCount = Requests[0].LodCount;
+	const FString JobId = FLodGenerationService::Get().StartJob(MoveTemp(Requests), Options, Backend);
+
+	Response->SetBoolField(TEXT("success"), true);
+	Response->SetStringField(TEXT("job_id"), JobId);
+	Response->SetNumberField(TEXT("mesh_count"), MeshCount);
+	Response->SetNumberField(TEXT("new_lod_count"), LodCount);
+	Response->SetStringField(TEXT("message"), FString::Printf(
+		TEXT("Queued LOD count %d for %d mesh(es). Poll get_lod_job_status with job_id '%s'."), LodCount, MeshCount, *JobId));
+	return SerializeSetLodCountResponse(Response);
+}
 
-	if (MeshPath.IsEmpty() || LodCount < 1 || LodCount > 8)
+bool FSetLodCountCommand::ParseParameters(const FString& JsonString, TArray<FLodGenerationRequest>& OutRequests, FLodGenerationJobOptions& OutOptions, FString& OutError)
+{
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
 	{
-		TSharedPtr<FJsonObject> E = MakeShared<FJsonObject>(); E->SetBoolField(TEXT("success"), false);
-		E->SetStringField(TEXT("error"), TEXT("Invalid mesh_path or lod_count (1-8)"));
-		FString O; TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&O);
-		FJsonSerializer::Serialize(E.ToSharedRef(), W); return O;
+		OutError = TEXT("Invalid JSON");
+		return false;
 	}
 
-	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
-	if (!Mesh)
+	TArray<FString> MeshPaths;
+	bool bSave = true;
+	if (!FLodGenerationService::ParseJobTargets(*JsonObject, MeshPaths, OutOptions, bSave, OutError))
 	{
-		TSharedPtr<FJsonObject> E = MakeShared<FJsonObject>(); E->SetBoolField(TEXT("success"), false);
-		E->SetStringField(TEXT("error"), FString::Printf(TEXT("Mesh not found: %s"), *MeshPath));
-		FString O; TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&O);
-		FJsonSerializer::Serialize(E.ToSharedRef(), W); return O;
+		return false;
 	}
 
-	int32 OldCount = Mesh->GetNumSourceModels();
-	Mesh->SetNumSourceModels(LodCount);
-	Mesh->PostEditChange();
-	Mesh->MarkPackageDirty();
-
-	// Save
-	UPackage* Package = Mesh->GetOutermost();
-	FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs; SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Mesh, *Filename, SaveArgs);
-
-	UE_LOG(LogTemp, Log, TEXT("Set LOD count on %s: %d → %d"), *MeshPath, OldCount, LodCount);
+	int32 LodCount = 0;
+	JsonObject->TryGetNumberField(TEXT("lod_count"), LodCount);
+	if (LodCount < 1 || LodCount > 8)
+	{
+		OutError = TEXT("Invalid mesh_path or lod_count (1-8)");
+		return false;
+	}
 
-	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-	Result->SetBoolField(TEXT("success"), true);
-	Result->SetNumberField(TEXT("old_lod_count"), OldCount);
-	Result->SetNumberField(TEXT("new_lod_count"), LodCount);
-	Result->SetStringField(TEXT("message"), FString::Printf(TEXT("LOD count set to %d (was %d)"), LodCount, OldCount));
+	// Added slots halve the triangle count per LOD, the engine's default for new source models
+	TArray<float> PercentTriangles;
+	for (int32 LodIndex = 0; LodIndex < LodCount; ++LodIndex)
+	{
+		PercentTriangles.Add(FMath::Pow(0.5f, (float)LodIndex));
+	}
 
-	FString OutputString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-	FJsonSerializer::Serialize(Result.ToSharedRef(), Writer);
-	return OutputString;
+	OutRequests.Reset(MeshPaths.Num());
+	for (const FString& MeshPath : MeshPaths)
+	{
+		FLodGenerationRequest& Request = OutRequests.AddDefaulted_GetRef();
+		Request.MeshPath = MeshPath;
+		Request.LodCount = LodCount;
+		Request.PercentTriangles = PercentTriangles;
+		Request.bKeepExistingLods = true;
+		Request.bSave = bSave;
+	}
+	return true;
 }
 
 FString FSetLodCountCommand::GetCommandName() const { return TEXT("set_lod_count"); }
 bool FSetLodCountCommand::ValidateParams(const FString& Parameters) const
 {
-	TSharedPtr<FJsonObject> J; TSharedRef<TJsonReader<>> R = TJsonReaderFactory<>::Create(Parameters);
-	if (!FJsonSerializer::Deserialize(R, J)) return false;
-	FString P; return J->TryGetStringField(TEXT("mesh_path"), P);
+	TArray<FLodGenerationRequest> Requests;
+	FLodGenerationJobOptions Options;
+	FString Error;
+	return ParseParameters(Parameters, Requests, Options, Error);
 }
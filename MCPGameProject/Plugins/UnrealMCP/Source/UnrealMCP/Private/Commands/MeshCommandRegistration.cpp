@@ -7,6 +7,7 @@
 #include "Commands/Mesh/SetLodScreenSizesCommand.h"
 #include "Commands/Mesh/AutoGenerateLodsCommand.h"
 #include "Commands/Mesh/SetMeshPropertiesCommand.h"
+#include "Commands/Mesh/GetLodJobStatusCommand.h"
 
 TArray<TSharedPtr<IUnrealMCPCommand>> FMeshCommandRegistration::RegisteredCommands;
 
@@ -20,6 +21,7 @@ void FMeshCommandRegistration::RegisterAllCommands()
 	RegisterAndTrackCommand(MakeShared<FSetLodScreenSizesCommand>());
 	RegisterAndTrackCommand(MakeShared<FAutoGenerateLodsCommand>());
 	RegisterAndTrackCommand(MakeShared<FSetMeshPropertiesCommand>());
+	RegisterAndTrackCommand(MakeShared<FGetLodJobStatusCommand>());
 
 	UE_LOG(LogTemp, Log, TEXT("Registered %d Mesh commands"), RegisteredCommands.Num());
 }
@@ -69,8 +69,9 @@ FString FGetNiagaraDiagnosticsCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(FString::Printf(TEXT("Failed to load Niagara System: %s"), *SystemPath));
     }
 
-    // Wait for compilation to complete
-    NiagaraSystem->WaitForCompilationComplete();
+    // Diagnostics need compiled scripts: start any queued compile now and wait for it
+    const FString CompileStatusBefore = NiagaraService.GetSystemCompileStatus(NiagaraSystem);
+    NiagaraService.FlushSystemCompile(NiagaraSystem, true);
 
     // Create view model - NOT data processing only, we need full stack for issues
     TSharedPtr<FNiagaraSystemViewModel> SystemViewModel = MakeShared<FNiagaraSystemViewModel>();
@@ -282,6 +283,7 @@ FString FGetNiagaraDiagnosticsCommand::Execute(const FString& Parameters)
     ResponseObj->SetBoolField(TEXT("success"), true);
     ResponseObj->SetStringField(TEXT("system"), NiagaraSystem->GetName());
     ResponseObj->SetStringField(TEXT("path"), FullPath);
+    ResponseObj->SetStringField(TEXT("compile_status_before"), CompileStatusBefore);
     ResponseObj->SetArrayField(TEXT("diagnostics"), DiagnosticsArray);
     ResponseObj->SetNumberField(TEXT("info_count"), InfoCount);
     ResponseObj->SetNumberField(TEXT("warning_count"), WarningCount);
@@ -1,4 +1,7 @@
 #include "Commands/Niagara/GetNiagaraSystemMetadataCommand.h"
+#include "Services/MetadataResponseCache.h"
+#include "NiagaraSystem.h"
+#include "NiagaraEmitter.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -24,17 +27,25 @@ FString FGetNiagaraSystemMetadataCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(TEXT("Missing 'system' parameter"));
     }
 
-    TSharedPtr<FJsonObject> ResultJson;
-    if (!NiagaraService.GetMetadata(SystemPath, nullptr, ResultJson))
+    // GetMetadata also accepts emitter assets; anything unresolved here is served uncached
+    const UObject* Asset = NiagaraService.FindSystem(SystemPath);
+    if (!Asset)
     {
-        return CreateErrorResponse(FString::Printf(TEXT("Failed to get metadata for system '%s'"), *SystemPath));
+        Asset = NiagaraService.FindEmitter(SystemPath);
     }
 
-    // Return the result JSON directly
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(ResultJson.ToSharedRef(), Writer);
-    return OutputString;
+    return FMetadataResponseCache::Get().Serve(GetCommandName(), Parameters, Asset, [&]()
+    {
+        TSharedPtr<FJsonObject> ResultJson;
+        if (!NiagaraService.GetMetadata(SystemPath, nullptr, ResultJson) || !ResultJson.IsValid())
+        {
+            ResultJson = MakeShared<FJsonObject>();
+            ResultJson->SetBoolField(TEXT("success"), false);
+            ResultJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to get metadata for system '%s'"), *SystemPath));
+        }
+        // Return the result JSON directly
+        return ResultJson;
+    });
 }
 
 bool FGetNiagaraSystemMetadataCommand::ValidateParams(const FString& Parameters) const
@@ -1,91 +1,245 @@
 #include "Commands/PCG/ExecutePCGGraphCommand.h"
+#include "Services/PCGGenerationBatch.h"
 #include "PCGComponent.h"
-#include "PCGSubsystem.h"
 #include "Editor.h"
 #include "Engine/World.h"
 #include "EngineUtils.h"
-#include "Utils/UnrealMCPCommonUtils.h"
+#include "UObject/UObjectIterator.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 
-FString FExecutePCGGraphCommand::Execute(const FString& Parameters)
+namespace
 {
-    FString ActorName;
-    bool bForce = true;
-    FString Error;
+constexpr int32 MaxPCGActorsPerCall = 64;
 
-    if (!ParseParameters(Parameters, ActorName, bForce, Error))
+FString SerializePCGResponse(const TSharedRef<FJsonObject>& ResponseObj)
+{
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj, Writer);
+    return OutputString;
+}
+
+bool MatchesActorName(const AActor& Actor, const FString& Name)
+{
+    return Actor.GetActorNameOrLabel().Equals(Name, ESearchCase::IgnoreCase) ||
+        Actor.GetName().Equals(Name, ESearchCase::IgnoreCase);
+}
+
+/**
+ * Resolve each requested actor to its PCG Component in one pass over the world's PCG components
+ * instead of scanning every actor per name. Only unresolved names fall back to an actor scan,
+ * to tell a missing actor apart from one without a PCG Component.
+ */
+bool ResolvePCGComponents(UWorld& World, const TArray<FString>& ActorNames, TArray<UPCGComponent*>& OutComponents, FString& OutError)
+{
+    OutComponents.SetNumZeroed(ActorNames.Num());
+    int32 Unresolved = ActorNames.Num();
+
+    for (TObjectIterator<UPCGComponent> It; It && Unresolved > 0; ++It)
     {
-        return CreateErrorResponse(Error);
+        AActor* Owner = It->GetOwner();
+        if (!Owner || Owner->GetWorld() != &World || It->IsTemplate())
+        {
+            continue;
+        }
+        for (int32 Index = 0; Index < ActorNames.Num(); ++Index)
+        {
+            if (!OutComponents[Index] && MatchesActorName(*Owner, ActorNames[Index]))
+            {
+                // Same component the single-actor path always used when an actor has several
+                OutComponents[Index] = Owner->FindComponentByClass<UPCGComponent>();
+                --Unresolved;
+            }
+        }
     }
 
-    // Get editor world
-    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
-    if (!World)
+    TArray<FString> Errors;
+    for (int32 Index = 0; Index < ActorNames.Num(); ++Index)
     {
-        return CreateErrorResponse(TEXT("Failed to get editor world"));
+        if (!OutComponents[Index])
+        {
+            bool bActorExists = false;
+            for (TActorIterator<AActor> It(&World); It && !bActorExists; ++It)
+            {
+                bActorExists = *It && MatchesActorName(**It, ActorNames[Index]);
+            }
+            Errors.Add(bActorExists
+                ? FString::Printf(TEXT("No PCG Component found on actor: %s"), *ActorNames[Index])
+                : FString::Printf(TEXT("Actor not found: %s"), *ActorNames[Index]));
+        }
+        else if (!OutComponents[Index]->GetGraph())
+        {
+            Errors.Add(FString::Printf(TEXT("PCG Component on '%s' has no graph assigned"), *ActorNames[Index]));
+        }
     }
 
-    // Find the actor by label or name
-    AActor* FoundActor = nullptr;
-    for (TActorIterator<AActor> It(World); It; ++It)
+    OutError = FString::Join(Errors, TEXT("; "));
+    return Errors.Num() == 0;
+}
+
+TSharedRef<FJsonObject> BuildBatchResponse(const FPCGGenerationBatch& Batch)
+{
+    TArray<TSharedPtr<FJsonValue>> ComponentValues;
+    TArray<FString> Errors;
+    int64 TotalPoints = 0;
+    for (const FPCGComponentGenerationResult& Result : Batch.GetResults())
     {
-        AActor* Actor = *It;
-        if (!Actor)
+        TSharedPtr<FJsonObject> ComponentObj = MakeShared<FJsonObject>();
+        ComponentObj->SetStringField(TEXT("actor"), Result.ActorLabel);
+        ComponentObj->SetStringField(TEXT("graph"), Result.GraphPath);
+        ComponentObj->SetStringField(TEXT("state"), FPCGComponentGenerationResult::StateToString(Result.State));
+        ComponentObj->SetNumberField(TEXT("generation_ms"), Result.GenerationMs);
+        ComponentObj->SetNumberField(TEXT("output_points"), Result.OutputPoints);
+        ComponentObj->SetNumberField(TEXT("output_data"), Result.OutputDataCount);
+        if (!Result.Error.IsEmpty())
         {
-            continue;
+            ComponentObj->SetStringField(TEXT("error"), Result.Error);
+            Errors.Add(FString::Printf(TEXT("%s: %s"), *Result.ActorLabel, *Result.Error));
         }
 
-        // Match by actor label (display name in editor) or by object name
-        FString ActorLabel = Actor->GetActorNameOrLabel();
-        FString ObjectName = Actor->GetName();
-
-        if (ActorLabel.Equals(ActorName, ESearchCase::IgnoreCase) ||
-            ObjectName.Equals(ActorName, ESearchCase::IgnoreCase))
+        TArray<TSharedPtr<FJsonValue>> NodeValues;
+        NodeValues.Reserve(Result.Nodes.Num());
+        for (const FPCGNodeExecutionStats& Node : Result.Nodes)
         {
-            FoundActor = Actor;
-            break;
+            TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+            NodeObj->SetStringField(TEXT("node_id"), Node.NodeName);
+            NodeObj->SetStringField(TEXT("title"), Node.NodeTitle);
+            NodeObj->SetNumberField(TEXT("executions"), Node.Executions);
+            NodeObj->SetNumberField(TEXT("execution_ms"), Node.ExecutionMs);
+            NodeObj->SetNumberField(TEXT("prepare_ms"), Node.PrepareMs);
+            NodeObj->SetNumberField(TEXT("output_points"), Node.OutputPoints);
+            NodeObj->SetNumberField(TEXT("output_data"), Node.OutputDataCount);
+            NodeValues.Add(MakeShared<FJsonValueObject>(NodeObj));
         }
+        if (NodeValues.Num() > 0)
+        {
+            ComponentObj->SetArrayField(TEXT("nodes"), NodeValues);
+        }
+
+        TotalPoints += Result.OutputPoints;
+        ComponentValues.Add(MakeShared<FJsonValueObject>(ComponentObj));
     }
 
-    if (!FoundActor)
+    const int32 Generated = Batch.Count(EPCGGenerationState::Generated);
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), Errors.Num() == 0);
+    if (Errors.Num() > 0)
     {
-        return CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
+        ResponseObj->SetStringField(TEXT("error"), FString::Join(Errors, TEXT("; ")));
     }
+    ResponseObj->SetStringField(TEXT("message"), FString::Printf(
+        TEXT("PCG generation finished on %d of %d component(s) in %.1f ms"),
+        Generated, Batch.GetResults().Num(), Batch.GetElapsedMs()));
+    ResponseObj->SetNumberField(TEXT("elapsed_ms"), Batch.GetElapsedMs());
+    ResponseObj->SetNumberField(TEXT("generated"), Generated);
+    ResponseObj->SetNumberField(TEXT("cancelled"), Batch.Count(EPCGGenerationState::Cancelled));
+    ResponseObj->SetNumberField(TEXT("failed"), Batch.Count(EPCGGenerationState::Failed));
+    ResponseObj->SetNumberField(TEXT("output_points"), static_cast<double>(TotalPoints));
+    ResponseObj->SetArrayField(TEXT("components"), ComponentValues);
+    return ResponseObj;
+}
+}
+
+FExecutePCGGraphCommand::FExecutePCGGraphCommand()
+    : Backend(CreatePCGGenerationBackend())
+{
+}
+
+FExecutePCGGraphCommand::FExecutePCGGraphCommand(TSharedRef<IPCGGenerationBackend> InBackend)
+    : Backend(MoveTemp(InBackend))
+{
+}
 
-    // Get the PCG Component from the actor
-    UPCGComponent* PCGComponent = FoundActor->FindComponentByClass<UPCGComponent>();
-    if (!PCGComponent)
+FString FExecutePCGGraphCommand::Execute(const FString& Parameters)
+{
+    FString Response;
+    StartGeneration(Parameters, /*bForceNoWait=*/true, [&Response](const FString& Result)
     {
-        return CreateErrorResponse(FString::Printf(
-            TEXT("No PCG Component found on actor: %s"), *ActorName));
+        Response = Result;
+    });
+    return Response;
+}
+
+void FExecutePCGGraphCommand::ExecuteDeferred(const FString& Parameters, TFunction<void(const FString&)> OnComplete)
+{
+    StartGeneration(Parameters, /*bForceNoWait=*/false, MoveTemp(OnComplete));
+}
+
+void FExecutePCGGraphCommand::ExecuteCancellable(const FString& Parameters, TFunction<void(const FString&)> OnComplete, FMCPCommandCancellation& Cancellation)
+{
+    StartGeneration(Parameters, /*bForceNoWait=*/false, MoveTemp(OnComplete), &Cancellation);
+}
+
+void FExecutePCGGraphCommand::StartGeneration(const FString& Parameters, bool bForceNoWait, TFunction<void(const FString&)> OnComplete,
+                                              FMCPCommandCancellation* Cancellation)
+{
+    TArray<FString> ActorNames;
+    FPCGGenerationOptions Options;
+    bool bWaitForCompletion = true;
+    FString Error;
+
+    if (!ParseParameters(Parameters, ActorNames, Options, bWaitForCompletion, Error))
+    {
+        OnComplete(CreateErrorResponse(Error));
+        return;
+    }
+
+    // Get editor world
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        OnComplete(CreateErrorResponse(TEXT("Failed to get editor world")));
+        return;
     }
 
-    // Check if the component has a graph assigned
-    if (!PCGComponent->GetGraph())
+    TArray<UPCGComponent*> Components;
+    if (!ResolvePCGComponents(*World, ActorNames, Components, Error))
     {
-        return CreateErrorResponse(FString::Printf(
-            TEXT("PCG Component on '%s' has no graph assigned"), *ActorName));
+        OnComplete(CreateErrorResponse(Error));
+        return;
     }
 
-    // Clean up previous generation first
-    PCGComponent->CleanupLocalImmediate(/*bRemoveComponents=*/true);
+    TSharedRef<FPCGGenerationBatch> Batch = MakeShared<FPCGGenerationBatch>(Components, Options, Backend);
+    if (bWaitForCompletion && !bForceNoWait)
+    {
+        Batch->Start([OnComplete = MoveTemp(OnComplete)](const FPCGGenerationBatch& Finished)
+        {
+            OnComplete(SerializePCGResponse(BuildBatchResponse(Finished)));
+        });
 
-    // Trigger generation
-    PCGComponent->GenerateLocal(bForce);
+        // Cancel releases the batch's tracked components and completes it, which answers the request
+        if (Cancellation && !Batch->IsComplete())
+        {
+            Cancellation->SetHandler([WeakBatch = TWeakPtr<FPCGGenerationBatch>(Batch)]()
+            {
+                if (TSharedPtr<FPCGGenerationBatch> PinnedBatch = WeakBatch.Pin())
+                {
+                    PinnedBatch->Cancel();
+                }
+            });
+        }
+        return;
+    }
 
-    // Check if generation was actually scheduled
-    bool bIsGenerating = PCGComponent->IsGenerating();
+    // Fire and forget: the batch keeps itself alive until generation completes
+    Batch->Start(nullptr);
 
-    FString ActorLabel = FoundActor->GetActorNameOrLabel();
-    FString Message = FString::Printf(
-        TEXT("PCG generation triggered on %s (force=%s, generating=%s)"),
-        *ActorLabel,
-        bForce ? TEXT("true") : TEXT("false"),
-        bIsGenerating ? TEXT("true") : TEXT("false"));
+    TArray<TSharedPtr<FJsonValue>> ActorValues;
+    for (const FPCGComponentGenerationResult& Result : Batch->GetResults())
+    {
+        ActorValues.Add(MakeShared<FJsonValueString>(Result.ActorLabel));
+    }
 
-    return CreateSuccessResponse(Message);
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetStringField(TEXT("message"), FString::Printf(
+        TEXT("PCG generation triggered on %d component(s) (force=%s)"),
+        Components.Num(), Options.bForce ? TEXT("true") : TEXT("false")));
+    ResponseObj->SetBoolField(TEXT("generating"), !Batch->IsComplete());
+    ResponseObj->SetArrayField(TEXT("actors"), ActorValues);
+    OnComplete(SerializePCGResponse(ResponseObj));
 }
 
 FString FExecutePCGGraphCommand::GetCommandName() const
@@ -95,14 +249,16 @@ FString FExecutePCGGraphCommand::GetCommandName() const
 
 bool FExecutePCGGraphCommand::ValidateParams(const FString& Parameters) const
 {
-    FString ActorName;
-    bool bForce;
+    TArray<FString> ActorNames;
+    FPCGGenerationOptions Options;
+    bool bWaitForCompletion;
     FString Error;
-    return ParseParameters(Parameters, ActorName, bForce, Error);
+    return ParseParameters(Parameters, ActorNames, Options, bWaitForCompletion, Error);
 }
 
-bool FExecutePCGGraphCommand::ParseParameters(const FString& JsonString, FString& OutActorName,
-                                               bool& OutForce, FString& OutError) const
+bool FExecutePCGGraphCommand::ParseParameters(const FString& JsonString, TArray<FString>& OutActorNames,
+                                               FPCGGenerationOptions& OutOptions, bool& bOutWaitForCompletion,
+                                               FString& OutError)
 {
     TSharedPtr<FJsonObject> JsonObject;
     TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
@@ -113,43 +269,55 @@ bool FExecutePCGGraphCommand::ParseParameters(const FString& JsonString, FString
         return false;
     }
 
-    if (!JsonObject->TryGetStringField(TEXT("actor_name"), OutActorName))
+    OutActorNames.Reset();
+    FString ActorName;
+    if (JsonObject->TryGetStringField(TEXT("actor_name"), ActorName) && !ActorName.IsEmpty())
+    {
+        OutActorNames.Add(ActorName);
+    }
+    const TArray<TSharedPtr<FJsonValue>>* ActorNameValues = nullptr;
+    if (JsonObject->TryGetArrayField(TEXT("actor_names"), ActorNameValues))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *ActorNameValues)
+        {
+            FString Name;
+            if (Value.IsValid() && Value->TryGetString(Name) && !Name.IsEmpty())
+            {
+                OutActorNames.AddUnique(Name);
+            }
+        }
+    }
+
+    if (OutActorNames.Num() == 0)
     {
         OutError = TEXT("Missing 'actor_name' parameter");
         return false;
     }
+    if (OutActorNames.Num() > MaxPCGActorsPerCall)
+    {
+        OutError = FString::Printf(TEXT("At most %d actors can be generated per call"), MaxPCGActorsPerCall);
+        return false;
+    }
 
     // Optional force parameter, defaults to true
-    if (!JsonObject->TryGetBoolField(TEXT("force"), OutForce))
+    OutOptions = FPCGGenerationOptions();
+    JsonObject->TryGetBoolField(TEXT("force"), OutOptions.bForce);
+    JsonObject->TryGetBoolField(TEXT("collect_node_stats"), OutOptions.bCollectNodeStats);
+    if (JsonObject->TryGetNumberField(TEXT("timeout_seconds"), OutOptions.TimeoutSeconds))
     {
-        OutForce = true;
+        OutOptions.TimeoutSeconds = FMath::Clamp(OutOptions.TimeoutSeconds, 1.0, 3600.0);
     }
 
-    return true;
-}
-
-FString FExecutePCGGraphCommand::CreateSuccessResponse(const FString& Message) const
-{
-    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
-    ResponseObj->SetBoolField(TEXT("success"), true);
-    ResponseObj->SetStringField(TEXT("message"), Message);
-
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    bOutWaitForCompletion = true;
+    JsonObject->TryGetBoolField(TEXT("wait_for_completion"), bOutWaitForCompletion);
 
-    return OutputString;
+    return true;
 }
 
 FString FExecutePCGGraphCommand::CreateErrorResponse(const FString& ErrorMessage) const
 {
-    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    TSharedRef<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
     ErrorObj->SetBoolField(TEXT("success"), false);
     ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
-
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
-
-    return OutputString;
+    return SerializePCGResponse(ErrorObj);
 }
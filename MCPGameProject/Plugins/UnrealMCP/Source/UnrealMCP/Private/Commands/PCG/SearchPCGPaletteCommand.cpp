@@ -1,7 +1,7 @@
 #include "Commands/PCG/SearchPCGPaletteCommand.h"
 #include "PCGSettings.h"
 #include "PCGCommon.h"
-#include "UObject/UObjectIterator.h"
+#include "Services/ReflectionCatalog.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
 #include "Serialization/JsonSerializer.h"
@@ -81,23 +81,9 @@ FString FSearchPCGPaletteCommand::Execute(const FString& Parameters)
 	TArray<FPCGPaletteEntry> MatchingEntries;
 	int32 TotalAvailable = 0;
 
-	// Iterate all UClass subclasses of UPCGSettings
-	for (TObjectIterator<UClass> It; It; ++It)
+	// Iterate all UPCGSettings subclasses (the base itself, abstract and deprecated classes excluded)
+	for (UClass* Class : FReflectionCatalog::Get().GetDerivedClasses(UPCGSettings::StaticClass(), CLASS_Abstract | CLASS_Deprecated))
 	{
-		UClass* Class = *It;
-
-		// Must be a child of UPCGSettings
-		if (!Class->IsChildOf(UPCGSettings::StaticClass()))
-			continue;
-
-		// Skip abstract and deprecated classes
-		if (Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated))
-			continue;
-
-		// Skip UPCGSettings itself
-		if (Class == UPCGSettings::StaticClass())
-			continue;
-
 		TotalAvailable++;
 
 		// Get class name
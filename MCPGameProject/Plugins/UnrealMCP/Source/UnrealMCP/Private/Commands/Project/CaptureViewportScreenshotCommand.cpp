@@ -5,14 +5,11 @@
 #include "EditorViewportClient.h"
 #include "Slate/SceneViewport.h"
 #include "UnrealClient.h"
-#include "ImageUtils.h"
-#include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "HAL/PlatformFileManager.h"
-#include "IImageWrapper.h"
-#include "IImageWrapperModule.h"
 #include "Modules/ModuleManager.h"
 #include "RenderingThread.h"
+#include "Services/ImageCaptureService.h"
 
 bool FCaptureViewportScreenshotCommand::ValidateParams(const FString& Parameters) const
 {
@@ -20,7 +17,46 @@ bool FCaptureViewportScreenshotCommand::ValidateParams(const FString& Parameters
 	return true;
 }
 
-FString FCaptureViewportScreenshotCommand::Execute(const FString& Parameters)
+namespace
+{
+	FString SerializeResponse(const TSharedPtr<FJsonObject>& Response)
+	{
+		FString OutputString;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+		FJsonSerializer::Serialize(Response.ToSharedRef(), Writer);
+		return OutputString;
+	}
+
+	FString MakeErrorResponse(const FString& ErrorMessage)
+	{
+		return SerializeResponse(FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage));
+	}
+
+	FString MakeSuccessResponse(const FString& OutputPath, const FImageCaptureResult& Result)
+	{
+		TSharedPtr<FJsonObject> ResponseData = MakeShared<FJsonObject>();
+		ResponseData->SetBoolField(TEXT("success"), true);
+		ResponseData->SetStringField(TEXT("file_path"), OutputPath);
+		ResponseData->SetStringField(TEXT("sha1"), Result.Sha1);
+		ResponseData->SetNumberField(TEXT("image_size_bytes"), Result.EncodedBytes.Num());
+		ResponseData->SetNumberField(TEXT("width"), Result.Width);
+		ResponseData->SetNumberField(TEXT("height"), Result.Height);
+		ResponseData->SetStringField(TEXT("message"), FString::Printf(TEXT("Screenshot saved to: %s"), *OutputPath));
+		return SerializeResponse(ResponseData);
+	}
+
+	FImageCaptureOptions MakeCaptureOptions(const FString& OutputPath)
+	{
+		FImageCaptureOptions Options;
+		Options.Format = TEXT("png");
+		Options.bForceOpaque = true;  // Scene alpha is not meaningful in a viewport capture
+		Options.OutputFilePath = OutputPath;
+		Options.bComputeHash = true;  // Lets the client verify the file it reads matches this capture
+		return Options;
+	}
+}
+
+bool FCaptureViewportScreenshotCommand::PrepareCapture(const FString& Parameters, FViewport*& OutViewport, FString& OutOutputPath, FString& OutError) const
 {
 	// Parse JSON parameters
 	TSharedPtr<FJsonObject> JsonObject;
@@ -53,7 +89,7 @@ FString FCaptureViewportScreenshotCommand::Execute(const FString& Parameters)
 	}
 
 	// Make sure path is absolute
-	OutputPath = FPaths::ConvertRelativePathToFull(OutputPath);
+	OutOutputPath = FPaths::ConvertRelativePathToFull(OutputPath);
 
 	// Get the level editor module
 	FLevelEditorModule& LevelEditorModule = FModuleManager::GetModuleChecked<FLevelEditorModule>("LevelEditor");
@@ -63,33 +99,24 @@ FString FCaptureViewportScreenshotCommand::Execute(const FString& Parameters)
 
 	if (!ActiveViewport.IsValid())
 	{
-		TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No active viewport found"));
-		FString OutputString;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-		FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
-		return OutputString;
+		OutError = TEXT("No active viewport found");
+		return false;
 	}
 
 	// Get the scene viewport (which is an FViewport)
 	FViewport* Viewport = ActiveViewport->GetSharedActiveViewport().Get();
 	if (!Viewport)
 	{
-		TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Could not access scene viewport"));
-		FString OutputString;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-		FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
-		return OutputString;
+		OutError = TEXT("Could not access scene viewport");
+		return false;
 	}
 
 	// Get viewport size
 	FIntPoint ViewportSize = Viewport->GetSizeXY();
 	if (ViewportSize.X <= 0 || ViewportSize.Y <= 0)
 	{
-		TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Invalid viewport size"));
-		FString OutputString;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-		FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
-		return OutputString;
+		OutError = TEXT("Invalid viewport size");
+		return false;
 	}
 
 	// Force-render a fresh frame before reading pixels. When the editor window is unfocused
@@ -100,85 +127,84 @@ FString FCaptureViewportScreenshotCommand::Execute(const FString& Parameters)
 	// 2026-06-11 — consecutive captures came back byte-identical despite camera moves).
 	// FViewport::Draw renders synchronously on the game thread, bypassing the throttle.
 	Viewport->Draw(/*bShouldPresent*/ true);
+
+	OutViewport = Viewport;
+	return true;
+}
+
+FString FCaptureViewportScreenshotCommand::Execute(const FString& Parameters)
+{
+	FViewport* Viewport = nullptr;
+	FString OutputPath;
+	FString Error;
+	if (!PrepareCapture(Parameters, Viewport, OutputPath, Error))
+	{
+		return MakeErrorResponse(Error);
+	}
 	FlushRenderingCommands();
 
 	// Use UE's proper screenshot function - this handles all the render target magic correctly
 	TArray<FColor> Bitmap;
 	if (!GetViewportScreenShot(Viewport, Bitmap))
 	{
-		TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to capture viewport screenshot"));
-		FString OutputString;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-		FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
-		return OutputString;
+		return MakeErrorResponse(TEXT("Failed to capture viewport screenshot"));
 	}
 
-	// Compress to PNG
-	IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
-	TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
-
-	if (!ImageWrapper.IsValid())
+	// Compress to PNG with forced opaque alpha and save to file
+	const FIntPoint ViewportSize = Viewport->GetSizeXY();
+	FImageCaptureResult Result;
+	FImageCaptureService::EncodePixels(Bitmap, ViewportSize.X, ViewportSize.Y, MakeCaptureOptions(OutputPath), Result);
+	if (!Result.bSuccess)
 	{
-		TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create image wrapper"));
-		FString OutputString;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-		FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
-		return OutputString;
+		return MakeErrorResponse(Result.Error);
 	}
 
-	// Convert FColor array to raw bytes with forced opaque alpha
-	TArray<uint8> RawData;
-	RawData.SetNum(Bitmap.Num() * 4);
-	for (int32 i = 0; i < Bitmap.Num(); i++)
+	return MakeSuccessResponse(OutputPath, Result);
+}
+
+void FCaptureViewportScreenshotCommand::ExecuteDeferred(const FString& Parameters, TFunction<void(const FString&)> OnComplete)
+{
+	FViewport* Viewport = nullptr;
+	FString OutputPath;
+	FString Error;
+	if (!PrepareCapture(Parameters, Viewport, OutputPath, Error))
 	{
-		RawData[i * 4 + 0] = Bitmap[i].B;
-		RawData[i * 4 + 1] = Bitmap[i].G;
-		RawData[i * 4 + 2] = Bitmap[i].R;
-		RawData[i * 4 + 3] = 255;  // Force fully opaque
+		OnComplete(MakeErrorResponse(Error));
+		return;
 	}
 
-	if (!ImageWrapper->SetRaw(RawData.GetData(), RawData.Num(), ViewportSize.X, ViewportSize.Y, ERGBFormat::BGRA, 8))
+	auto HandleResult = [OutputPath, OnComplete](FImageCaptureResult&& Result)
 	{
-		TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to set raw image data"));
-		FString OutputString;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-		FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
-		return OutputString;
-	}
+		if (!Result.bSuccess)
+		{
+			OnComplete(MakeErrorResponse(Result.Error));
+			return;
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("CaptureViewportScreenshot: %dx%d saved to %s in %.1f ms"),
+			Result.Width, Result.Height, *OutputPath, Result.ElapsedMs);
+		OnComplete(MakeSuccessResponse(OutputPath, Result));
+	};
 
-	// Get compressed PNG data
-	TArray64<uint8> CompressedData = ImageWrapper->GetCompressed(100);
-	if (CompressedData.Num() == 0)
+	// Editor viewports render into their own texture before Slate composites them; copy that
+	// asynchronously instead of flushing the render thread and reading the pixels back inline
+	const FImageCaptureOptions Options = MakeCaptureOptions(OutputPath);
+	if (FImageCaptureService::Get().ReadbackTexture(Viewport->GetRenderTargetTexture(), Options, HandleResult))
 	{
-		TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to compress image to PNG"));
-		FString OutputString;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-		FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
-		return OutputString;
+		return;
 	}
 
-	// Save to file
-	if (!FFileHelper::SaveArrayToFile(CompressedData, *OutputPath))
+	// No separate render target or a non-8-bit format (HDR output): read back inline,
+	// but still compress and write the file off the game thread
+	FlushRenderingCommands();
+
+	TArray<FColor> Bitmap;
+	if (!GetViewportScreenShot(Viewport, Bitmap))
 	{
-		TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(
-			FString::Printf(TEXT("Failed to save screenshot to: %s"), *OutputPath));
-		FString OutputString;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-		FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
-		return OutputString;
+		OnComplete(MakeErrorResponse(TEXT("Failed to capture viewport screenshot")));
+		return;
 	}
 
-	// Create success response
-	TSharedPtr<FJsonObject> ResponseData = MakeShared<FJsonObject>();
-	ResponseData->SetBoolField(TEXT("success"), true);
-	ResponseData->SetStringField(TEXT("file_path"), OutputPath);
-	ResponseData->SetNumberField(TEXT("width"), ViewportSize.X);
-	ResponseData->SetNumberField(TEXT("height"), ViewportSize.Y);
-	ResponseData->SetStringField(TEXT("message"), FString::Printf(TEXT("Screenshot saved to: %s"), *OutputPath));
-
-	// Convert response to JSON string
-	FString OutputString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-	FJsonSerializer::Serialize(ResponseData.ToSharedRef(), Writer);
-	return OutputString;
+	const FIntPoint ViewportSize = Viewport->GetSizeXY();
+	FImageCaptureService::Get().EncodeAsync(MoveTemp(Bitmap), ViewportSize.X, ViewportSize.Y, Options, HandleResult);
 }
@@ -0,0 +1,118 @@
+#include "Commands/Sound/AnalyzeSoundWavesCommand.h"
+#include "Services/ISoundService.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Dom/JsonObject.h"
+
+FAnalyzeSoundWavesCommand::FAnalyzeSoundWavesCommand(ISoundService& InSoundService)
+    : SoundService(InSoundService)
+{
+}
+
+FString FAnalyzeSoundWavesCommand::GetCommandName() const
+{
+    return TEXT("analyze_sound_waves");
+}
+
+bool FAnalyzeSoundWavesCommand::ValidateParams(const FString& Parameters) const
+{
+    TArray<FString> SoundWavePaths;
+    FString Error;
+    return ParseParameters(Parameters, SoundWavePaths, Error);
+}
+
+FString FAnalyzeSoundWavesCommand::Execute(const FString& Parameters)
+{
+    TArray<FString> SoundWavePaths;
+    FString Error;
+    if (!ParseParameters(Parameters, SoundWavePaths, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    const double StartSeconds = FPlatformTime::Seconds();
+    TArray<TSharedPtr<FJsonObject>> Results;
+    if (!SoundService.AnalyzeSoundWaves(SoundWavePaths, Results, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    int32 NumAnalyzed = 0;
+    int32 NumCached = 0;
+    TArray<TSharedPtr<FJsonValue>> ResultsArray;
+    for (const TSharedPtr<FJsonObject>& Result : Results)
+    {
+        NumAnalyzed += Result->GetBoolField(TEXT("success")) ? 1 : 0;
+        bool bCached = false;
+        NumCached += Result->TryGetBoolField(TEXT("cached"), bCached) && bCached ? 1 : 0;
+        ResultsArray.Add(MakeShared<FJsonValueObject>(Result));
+    }
+
+    TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
+    Response->SetBoolField(TEXT("success"), true);
+    Response->SetStringField(TEXT("message"), FString::Printf(TEXT("Analyzed %d/%d sound waves"), NumAnalyzed, SoundWavePaths.Num()));
+    Response->SetNumberField(TEXT("analyzed"), NumAnalyzed);
+    Response->SetNumberField(TEXT("failed"), SoundWavePaths.Num() - NumAnalyzed);
+    Response->SetNumberField(TEXT("cached"), NumCached);
+    Response->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+    Response->SetArrayField(TEXT("results"), ResultsArray);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Response.ToSharedRef(), Writer);
+
+    return OutputString;
+}
+
+bool FAnalyzeSoundWavesCommand::ParseParameters(const FString& JsonString, TArray<FString>& OutSoundWavePaths, FString& OutError)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Failed to parse JSON parameters");
+        return false;
+    }
+
+    OutSoundWavePaths.Reset();
+    FString SinglePath;
+    if (JsonObject->TryGetStringField(TEXT("sound_wave_path"), SinglePath) && !SinglePath.IsEmpty())
+    {
+        OutSoundWavePaths.Add(SinglePath);
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* PathsArray = nullptr;
+    if (JsonObject->TryGetArrayField(TEXT("sound_wave_paths"), PathsArray))
+    {
+        for (const TSharedPtr<FJsonValue>& PathValue : *PathsArray)
+        {
+            FString Path;
+            if (PathValue->TryGetString(Path) && !Path.IsEmpty())
+            {
+                OutSoundWavePaths.AddUnique(Path);
+            }
+        }
+    }
+
+    if (OutSoundWavePaths.Num() == 0)
+    {
+        OutError = TEXT("Missing required parameter: sound_wave_paths");
+        return false;
+    }
+
+    return true;
+}
+
+FString FAnalyzeSoundWavesCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
+    Response->SetBoolField(TEXT("success"), false);
+    Response->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Response.ToSharedRef(), Writer);
+
+    return OutputString;
+}
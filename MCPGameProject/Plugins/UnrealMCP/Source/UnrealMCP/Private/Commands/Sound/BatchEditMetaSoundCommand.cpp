@@ -0,0 +1,149 @@
+#include "Commands/Sound/BatchEditMetaSoundCommand.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Dom/JsonObject.h"
+
+FBatchEditMetaSoundCommand::FBatchEditMetaSoundCommand(ISoundService& InSoundService)
+    : SoundService(InSoundService)
+{
+}
+
+FString FBatchEditMetaSoundCommand::GetCommandName() const
+{
+    return TEXT("batch_edit_metasound");
+}
+
+bool FBatchEditMetaSoundCommand::ValidateParams(const FString& Parameters) const
+{
+    FString MetaSoundPath, Error;
+    TArray<FSoundGraphOperation> Operations;
+    return ParseParameters(Parameters, MetaSoundPath, Operations, Error);
+}
+
+FString FBatchEditMetaSoundCommand::Execute(const FString& Parameters)
+{
+    FString MetaSoundPath, Error;
+    TArray<FSoundGraphOperation> Operations;
+    if (!ParseParameters(Parameters, MetaSoundPath, Operations, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    TArray<FSoundGraphOperationResult> Results;
+    if (!SoundService.BatchEditMetaSound(MetaSoundPath, Operations, Results, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    return CreateSuccessResponse(Operations, Results);
+}
+
+bool FBatchEditMetaSoundCommand::ParseParameters(const FString& JsonString, FString& OutAssetPath, TArray<FSoundGraphOperation>& OutOperations, FString& OutError)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Failed to parse JSON parameters");
+        return false;
+    }
+
+    if (!JsonObject->TryGetStringField(TEXT("metasound_path"), OutAssetPath) || OutAssetPath.IsEmpty())
+    {
+        OutError = TEXT("Missing required parameter: metasound_path");
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* OperationsArray = nullptr;
+    if (!JsonObject->TryGetArrayField(TEXT("operations"), OperationsArray) || OperationsArray->Num() == 0)
+    {
+        OutError = TEXT("Missing required parameter: operations");
+        return false;
+    }
+
+    OutOperations.Reset(OperationsArray->Num());
+    for (int32 Index = 0; Index < OperationsArray->Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>* OperationObj = nullptr;
+        if (!(*OperationsArray)[Index]->TryGetObject(OperationObj))
+        {
+            OutError = FString::Printf(TEXT("Operation %d is not an object"), Index);
+            return false;
+        }
+
+        FSoundGraphOperation& Operation = OutOperations.AddDefaulted_GetRef();
+        (*OperationObj)->TryGetStringField(TEXT("op"), Operation.Op);
+        (*OperationObj)->TryGetStringField(TEXT("ref"), Operation.Ref);
+        (*OperationObj)->TryGetStringField(TEXT("node_class_name"), Operation.NodeClassName);
+        (*OperationObj)->TryGetStringField(TEXT("node_namespace"), Operation.NodeNamespace);
+        (*OperationObj)->TryGetStringField(TEXT("node_variant"), Operation.NodeVariant);
+        (*OperationObj)->TryGetNumberField(TEXT("pos_x"), Operation.PosX);
+        (*OperationObj)->TryGetNumberField(TEXT("pos_y"), Operation.PosY);
+        (*OperationObj)->TryGetStringField(TEXT("source_node_id"), Operation.SourceNode);
+        (*OperationObj)->TryGetStringField(TEXT("source_pin_name"), Operation.SourcePin);
+        (*OperationObj)->TryGetStringField(TEXT("target_node_id"), Operation.TargetNode);
+        (*OperationObj)->TryGetStringField(TEXT("target_pin_name"), Operation.TargetPin);
+        (*OperationObj)->TryGetStringField(TEXT("node_id"), Operation.NodeId);
+        (*OperationObj)->TryGetStringField(TEXT("input_name"), Operation.InputName);
+        Operation.Value = (*OperationObj)->TryGetField(TEXT("value"));
+        Operation.Op.ToLowerInline();
+    }
+
+    return true;
+}
+
+FString FBatchEditMetaSoundCommand::CreateSuccessResponse(const TArray<FSoundGraphOperation>& Operations, const TArray<FSoundGraphOperationResult>& Results) const
+{
+    int32 NumApplied = 0;
+    TArray<TSharedPtr<FJsonValue>> ResultsArray;
+    TSharedPtr<FJsonObject> NodeIdsByRef = MakeShared<FJsonObject>();
+    for (const FSoundGraphOperationResult& OpResult : Results)
+    {
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetNumberField(TEXT("index"), OpResult.Index);
+        ResultObj->SetStringField(TEXT("op"), Operations[OpResult.Index].Op);
+        ResultObj->SetBoolField(TEXT("success"), OpResult.bSuccess);
+        if (!OpResult.NodeId.IsEmpty())
+        {
+            ResultObj->SetStringField(TEXT("node_id"), OpResult.NodeId);
+            if (!Operations[OpResult.Index].Ref.IsEmpty())
+            {
+                NodeIdsByRef->SetStringField(Operations[OpResult.Index].Ref, OpResult.NodeId);
+            }
+        }
+        if (!OpResult.bSuccess)
+        {
+            ResultObj->SetStringField(TEXT("error"), OpResult.Error);
+        }
+        ResultsArray.Add(MakeShared<FJsonValueObject>(ResultObj));
+        NumApplied += OpResult.bSuccess ? 1 : 0;
+    }
+
+    TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
+    Response->SetBoolField(TEXT("success"), true);
+    Response->SetStringField(TEXT("message"), FString::Printf(TEXT("Applied %d/%d operations"), NumApplied, Operations.Num()));
+    Response->SetNumberField(TEXT("applied"), NumApplied);
+    Response->SetNumberField(TEXT("failed"), Operations.Num() - NumApplied);
+    Response->SetObjectField(TEXT("node_ids"), NodeIdsByRef);
+    Response->SetArrayField(TEXT("results"), ResultsArray);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Response.ToSharedRef(), Writer);
+
+    return OutputString;
+}
+
+FString FBatchEditMetaSoundCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
+    Response->SetBoolField(TEXT("success"), false);
+    Response->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Response.ToSharedRef(), Writer);
+
+    return OutputString;
+}
@@ -17,13 +17,15 @@ FString FGetSoundWaveMetadataCommand::GetCommandName() const
 bool FGetSoundWaveMetadataCommand::ValidateParams(const FString& Parameters) const
 {
     FString SoundWavePath, Error;
-    return ParseParameters(Parameters, SoundWavePath, Error);
+    bool bAnalyze = false;
+    return ParseParameters(Parameters, SoundWavePath, bAnalyze, Error);
 }
 
 FString FGetSoundWaveMetadataCommand::Execute(const FString& Parameters)
 {
     FString SoundWavePath, Error;
-    if (!ParseParameters(Parameters, SoundWavePath, Error))
+    bool bAnalyze = false;
+    if (!ParseParameters(Parameters, SoundWavePath, bAnalyze, Error))
     {
         return CreateErrorResponse(Error);
     }
@@ -34,10 +36,20 @@ FString FGetSoundWaveMetadataCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(Error);
     }
 
+    if (bAnalyze)
+    {
+        TArray<TSharedPtr<FJsonObject>> Analyses;
+        if (!SoundService.AnalyzeSoundWaves({ SoundWavePath }, Analyses, Error))
+        {
+            return CreateErrorResponse(Error);
+        }
+        Metadata->SetObjectField(TEXT("analysis"), Analyses[0]);
+    }
+
     return CreateSuccessResponse(Metadata);
 }
 
-bool FGetSoundWaveMetadataCommand::ParseParameters(const FString& JsonString, FString& OutSoundWavePath, FString& OutError) const
+bool FGetSoundWaveMetadataCommand::ParseParameters(const FString& JsonString, FString& OutSoundWavePath, bool& bOutAnalyze, FString& OutError) const
 {
     TSharedPtr<FJsonObject> JsonObject;
     TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
@@ -54,6 +66,9 @@ bool FGetSoundWaveMetadataCommand::ParseParameters(const FString& JsonString, FS
         return false;
     }
 
+    bOutAnalyze = false;
+    JsonObject->TryGetBoolField(TEXT("analyze"), bOutAnalyze);
+
     return true;
 }
 
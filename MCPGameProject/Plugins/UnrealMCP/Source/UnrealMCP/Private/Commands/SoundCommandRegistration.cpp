@@ -16,9 +16,11 @@
 #include "Commands/Sound/SetSoundCueNodePropertyCommand.h"
 #include "Commands/Sound/RemoveSoundCueNodeCommand.h"
 #include "Commands/Sound/CompileSoundCueCommand.h"
+#include "Commands/Sound/BatchEditSoundCueCommand.h"
 
 // Include Phase 1 Sound Wave property command
 #include "Commands/Sound/SetSoundWavePropertiesCommand.h"
+#include "Commands/Sound/AnalyzeSoundWavesCommand.h"
 
 // Include Phase 4 Sound Class and Sound Mix command headers
 #include "Commands/Sound/CreateSoundClassCommand.h"
@@ -35,6 +37,7 @@
 #include "Commands/Sound/AddMetaSoundOutputCommand.h"
 #include "Commands/Sound/CompileMetaSoundCommand.h"
 #include "Commands/Sound/SearchMetaSoundPaletteCommand.h"
+#include "Commands/Sound/BatchEditMetaSoundCommand.h"
 
 TArray<TSharedPtr<IUnrealMCPCommand>> FSoundCommandRegistration::RegisteredCommands;
 
@@ -51,6 +54,7 @@ void FSoundCommandRegistration::RegisterAllCommands()
     RegisterAndTrackCommand(MakeShared<FSpawnAmbientSoundCommand>(SoundService));
     RegisterAndTrackCommand(MakeShared<FCreateSoundAttenuationCommand>(SoundService));
     RegisterAndTrackCommand(MakeShared<FSetSoundWavePropertiesCommand>(SoundService));
+    RegisterAndTrackCommand(MakeShared<FAnalyzeSoundWavesCommand>(SoundService));
 
     // Register Phase 2: Sound Cue commands
     RegisterAndTrackCommand(MakeShared<FCreateSoundCueCommand>(SoundService));
@@ -60,6 +64,7 @@ void FSoundCommandRegistration::RegisterAllCommands()
     RegisterAndTrackCommand(MakeShared<FSetSoundCueNodePropertyCommand>(SoundService));
     RegisterAndTrackCommand(MakeShared<FRemoveSoundCueNodeCommand>(SoundService));
     RegisterAndTrackCommand(MakeShared<FCompileSoundCueCommand>(SoundService));
+    RegisterAndTrackCommand(MakeShared<FBatchEditSoundCueCommand>(SoundService));
 
     // Register Phase 3: MetaSound commands
     RegisterAndTrackCommand(MakeShared<FCreateMetaSoundSourceCommand>(SoundService));
@@ -71,6 +76,7 @@ void FSoundCommandRegistration::RegisterAllCommands()
     RegisterAndTrackCommand(MakeShared<FAddMetaSoundOutputCommand>(SoundService));
     RegisterAndTrackCommand(MakeShared<FCompileMetaSoundCommand>(SoundService));
     RegisterAndTrackCommand(MakeShared<FSearchMetaSoundPaletteCommand>(SoundService));
+    RegisterAndTrackCommand(MakeShared<FBatchEditMetaSoundCommand>(SoundService));
 
     // Register Phase 4: Sound Class and Sound Mix commands
     RegisterAndTrackCommand(MakeShared<FCreateSoundClassCommand>(SoundService));
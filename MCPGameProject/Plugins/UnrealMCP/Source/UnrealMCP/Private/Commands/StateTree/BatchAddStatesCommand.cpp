@@ -39,23 +39,51 @@ FString FBatchAddStatesCommand::Execute(const FString& Parameters)
         }
     }
 
+    ParamsObj->TryGetBoolField(TEXT("compile"), Params.bCompile);
+
     FString ValidationError;
     if (!Params.IsValid(ValidationError))
     {
         return CreateErrorResponse(ValidationError);
     }
 
+    FStateTreeBatchResult Result;
     FString Error;
-    if (!Service.BatchAddStates(Params, Error))
+    if (!Service.BatchAddStates(Params, Result, Error))
     {
+        if (Result.ItemErrors.Num() > 0)
+        {
+            Error = FString::Printf(TEXT("%s (first: %s)"), *Error, *Result.ItemErrors[0].Error);
+        }
         return CreateErrorResponse(Error);
     }
 
+    TArray<TSharedPtr<FJsonValue>> FailedArray;
+    for (const FStateTreeBatchItemError& ItemError : Result.ItemErrors)
+    {
+        TSharedPtr<FJsonObject> FailedObj = MakeShared<FJsonObject>();
+        FailedObj->SetNumberField(TEXT("index"), ItemError.Index);
+        if (Params.States.IsValidIndex(ItemError.Index))
+        {
+            FailedObj->SetStringField(TEXT("state_name"), Params.States[ItemError.Index].StateName);
+        }
+        FailedObj->SetStringField(TEXT("error"), ItemError.Error);
+        FailedArray.Add(MakeShared<FJsonValueObject>(FailedObj));
+    }
+
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
     ResponseObj->SetBoolField(TEXT("success"), true);
-    ResponseObj->SetStringField(TEXT("message"), FString::Printf(TEXT("Batch added %d states"),
-        Params.States.Num()));
-    ResponseObj->SetNumberField(TEXT("states_added"), Params.States.Num());
+    ResponseObj->SetStringField(TEXT("message"), FString::Printf(TEXT("Batch added %d/%d states"),
+        Result.NumApplied, Params.States.Num()));
+    ResponseObj->SetNumberField(TEXT("states_added"), Result.NumApplied);
+    ResponseObj->SetArrayField(TEXT("failed"), FailedArray);
+    ResponseObj->SetBoolField(TEXT("compiled"), Result.bCompiled);
+    ResponseObj->SetBoolField(TEXT("compile_skipped"), Result.CompileStats.bSkipped);
+    ResponseObj->SetNumberField(TEXT("compile_ms"), Result.CompileStats.CompileMs);
+    if (!Result.CompileError.IsEmpty())
+    {
+        ResponseObj->SetStringField(TEXT("compile_error"), Result.CompileError);
+    }
 
     FString OutputString;
     TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
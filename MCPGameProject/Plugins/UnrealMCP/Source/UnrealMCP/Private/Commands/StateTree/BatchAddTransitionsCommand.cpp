@@ -34,28 +34,58 @@ FString FBatchAddTransitionsCommand::Execute(const FString& Parameters)
                 (*TransObj)->TryGetStringField(TEXT("trigger"), TransDef.Trigger);
                 (*TransObj)->TryGetStringField(TEXT("transition_type"), TransDef.TransitionType);
                 (*TransObj)->TryGetStringField(TEXT("priority"), TransDef.Priority);
+                (*TransObj)->TryGetStringField(TEXT("event_tag"), TransDef.EventTag);
                 Params.Transitions.Add(TransDef);
             }
         }
     }
 
+    ParamsObj->TryGetBoolField(TEXT("compile"), Params.bCompile);
+
     FString ValidationError;
     if (!Params.IsValid(ValidationError))
     {
         return CreateErrorResponse(ValidationError);
     }
 
+    FStateTreeBatchResult Result;
     FString Error;
-    if (!Service.BatchAddTransitions(Params, Error))
+    if (!Service.BatchAddTransitions(Params, Result, Error))
     {
+        if (Result.ItemErrors.Num() > 0)
+        {
+            Error = FString::Printf(TEXT("%s (first: %s)"), *Error, *Result.ItemErrors[0].Error);
+        }
         return CreateErrorResponse(Error);
     }
 
+    TArray<TSharedPtr<FJsonValue>> FailedArray;
+    for (const FStateTreeBatchItemError& ItemError : Result.ItemErrors)
+    {
+        TSharedPtr<FJsonObject> FailedObj = MakeShared<FJsonObject>();
+        FailedObj->SetNumberField(TEXT("index"), ItemError.Index);
+        if (Params.Transitions.IsValidIndex(ItemError.Index))
+        {
+            FailedObj->SetStringField(TEXT("source_state_name"), Params.Transitions[ItemError.Index].SourceStateName);
+            FailedObj->SetStringField(TEXT("target_state_name"), Params.Transitions[ItemError.Index].TargetStateName);
+        }
+        FailedObj->SetStringField(TEXT("error"), ItemError.Error);
+        FailedArray.Add(MakeShared<FJsonValueObject>(FailedObj));
+    }
+
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
     ResponseObj->SetBoolField(TEXT("success"), true);
-    ResponseObj->SetStringField(TEXT("message"), FString::Printf(TEXT("Batch added %d transitions"),
-        Params.Transitions.Num()));
-    ResponseObj->SetNumberField(TEXT("transitions_added"), Params.Transitions.Num());
+    ResponseObj->SetStringField(TEXT("message"), FString::Printf(TEXT("Batch added %d/%d transitions"),
+        Result.NumApplied, Params.Transitions.Num()));
+    ResponseObj->SetNumberField(TEXT("transitions_added"), Result.NumApplied);
+    ResponseObj->SetArrayField(TEXT("failed"), FailedArray);
+    ResponseObj->SetBoolField(TEXT("compiled"), Result.bCompiled);
+    ResponseObj->SetBoolField(TEXT("compile_skipped"), Result.CompileStats.bSkipped);
+    ResponseObj->SetNumberField(TEXT("compile_ms"), Result.CompileStats.CompileMs);
+    if (!Result.CompileError.IsEmpty())
+    {
+        ResponseObj->SetStringField(TEXT("compile_error"), Result.CompileError);
+    }
 
     FString OutputString;
     TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
@@ -30,13 +30,17 @@ FString FCompileStateTreeCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(FString::Printf(TEXT("StateTree not found: '%s'"), *StateTreePath));
     }
 
+    bool bForce = false;
+    JsonObject->TryGetBoolField(TEXT("force"), bForce);
+
+    FStateTreeCompileStats Stats;
     FString CompileError;
-    if (!Service.CompileStateTree(StateTree, CompileError))
+    if (!Service.CompileStateTree(StateTree, bForce, Stats, CompileError))
     {
         return CreateErrorResponse(CompileError.IsEmpty() ? TEXT("Compilation failed") : CompileError);
     }
 
-    return CreateSuccessResponse(StateTree->GetName());
+    return CreateSuccessResponse(StateTree->GetName(), Stats);
 }
 
 FString FCompileStateTreeCommand::GetCommandName() const
@@ -58,12 +62,17 @@ bool FCompileStateTreeCommand::ValidateParams(const FString& Parameters) const
     return JsonObject->TryGetStringField(TEXT("state_tree_path"), StateTreePath);
 }
 
-FString FCompileStateTreeCommand::CreateSuccessResponse(const FString& StateTreeName) const
+FString FCompileStateTreeCommand::CreateSuccessResponse(const FString& StateTreeName, const FStateTreeCompileStats& Stats) const
 {
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
     ResponseObj->SetBoolField(TEXT("success"), true);
     ResponseObj->SetStringField(TEXT("state_tree_name"), StateTreeName);
-    ResponseObj->SetStringField(TEXT("message"), FString::Printf(TEXT("StateTree '%s' compiled successfully"), *StateTreeName));
+    ResponseObj->SetStringField(TEXT("message"), Stats.bSkipped
+        ? FString::Printf(TEXT("StateTree '%s' is up to date"), *StateTreeName)
+        : FString::Printf(TEXT("StateTree '%s' compiled successfully"), *StateTreeName));
+    ResponseObj->SetBoolField(TEXT("skipped"), Stats.bSkipped);
+    ResponseObj->SetNumberField(TEXT("compile_ms"), Stats.CompileMs);
+    ResponseObj->SetStringField(TEXT("editor_data_hash"), FString::Printf(TEXT("%08x"), Stats.EditorDataHash));
 
     FString OutputString;
     TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
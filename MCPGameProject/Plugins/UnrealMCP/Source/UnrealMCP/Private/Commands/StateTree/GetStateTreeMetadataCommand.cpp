@@ -1,5 +1,6 @@
 #include "Commands/StateTree/GetStateTreeMetadataCommand.h"
 #include "StateTree.h"
+#include "Services/MetadataResponseCache.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 
@@ -30,21 +31,22 @@ FString FGetStateTreeMetadataCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(FString::Printf(TEXT("StateTree not found: '%s'"), *StateTreePath));
     }
 
-    TSharedPtr<FJsonObject> MetadataObj;
-    if (!Service.GetStateTreeMetadata(StateTree, MetadataObj))
+    return FMetadataResponseCache::Get().Serve(GetCommandName(), Parameters, StateTree, [&]()
     {
-        return CreateErrorResponse(TEXT("Failed to retrieve metadata"));
-    }
-
-    // Wrap in success response
-    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
-    ResponseObj->SetBoolField(TEXT("success"), true);
-    ResponseObj->SetObjectField(TEXT("metadata"), MetadataObj);
+        TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+        TSharedPtr<FJsonObject> MetadataObj;
+        if (!Service.GetStateTreeMetadata(StateTree, MetadataObj))
+        {
+            ResponseObj->SetBoolField(TEXT("success"), false);
+            ResponseObj->SetStringField(TEXT("error"), TEXT("Failed to retrieve metadata"));
+            return ResponseObj;
+        }
 
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
-    return OutputString;
+        // Wrap in success response
+        ResponseObj->SetBoolField(TEXT("success"), true);
+        ResponseObj->SetObjectField(TEXT("metadata"), MetadataObj);
+        return ResponseObj;
+    });
 }
 
 FString FGetStateTreeMetadataCommand::GetCommandName() const
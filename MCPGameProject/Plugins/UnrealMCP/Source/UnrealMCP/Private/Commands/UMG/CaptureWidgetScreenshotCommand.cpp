@@ -5,9 +5,39 @@
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
+#include "Misc/Base64.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogCaptureWidgetScreenshotCommand, Log, All);
 
+namespace
+{
+	/**
+	 * Move a base64 screenshot produced by the synchronous service path into a file, so both
+	 * paths return the same shared-file response shape
+	 */
+	bool ConvertScreenshotToFile(const TSharedPtr<FJsonObject>& ScreenshotData, const FString& OutputPath)
+	{
+		TArray<uint8> ImageBytes;
+		if (!FBase64::Decode(ScreenshotData->GetStringField(TEXT("image_base64")), ImageBytes) ||
+			!FFileHelper::SaveArrayToFile(ImageBytes, *OutputPath))
+		{
+			return false;
+		}
+
+		FSHAHash Hash;
+		FSHA1::HashBuffer(ImageBytes.GetData(), ImageBytes.Num(), Hash.Hash);
+
+		ScreenshotData->RemoveField(TEXT("image_base64"));
+		ScreenshotData->SetStringField(TEXT("output_mode"), TEXT("file"));
+		ScreenshotData->SetStringField(TEXT("file_path"), OutputPath);
+		ScreenshotData->SetStringField(TEXT("sha1"), Hash.ToString().ToLower());
+		return true;
+	}
+}
+
 FCaptureWidgetScreenshotCommand::FCaptureWidgetScreenshotCommand(TSharedPtr<IUMGService> InUMGService)
 	: UMGService(InUMGService)
 {
@@ -41,6 +71,81 @@ FString FCaptureWidgetScreenshotCommand::Execute(const FString& Parameters)
 	return SerializeJsonResponse(Response);
 }
 
+void FCaptureWidgetScreenshotCommand::ExecuteDeferred(const FString& Parameters, TFunction<void(const FString&)> OnComplete)
+{
+	UE_LOG(LogCaptureWidgetScreenshotCommand, Log, TEXT("CaptureWidgetScreenshotCommand::ExecuteDeferred - Command execution started"));
+	UE_LOG(LogCaptureWidgetScreenshotCommand, Verbose, TEXT("Parameters: %s"), *Parameters);
+
+	FWidgetScreenshotParams ScreenshotParams;
+	FString ErrorResponse;
+	if (!PrepareRequest(Parameters, ScreenshotParams, ErrorResponse))
+	{
+		OnComplete(ErrorResponse);
+		return;
+	}
+
+	UE_LOG(LogCaptureWidgetScreenshotCommand, Log, TEXT("Capturing screenshot for widget '%s' at %dx%d"),
+		*ScreenshotParams.WidgetName, ScreenshotParams.Width, ScreenshotParams.Height);
+
+	// Delegate to service layer; the response is produced once readback and encoding finish
+	UMGService->CaptureWidgetScreenshotAsync(
+		ScreenshotParams.WidgetName,
+		ScreenshotParams.Width,
+		ScreenshotParams.Height,
+		ScreenshotParams.Format,
+		ScreenshotParams.OutputMode == TEXT("file") ? ScreenshotParams.OutputPath : FString(),
+		[this, ScreenshotParams, OnComplete = MoveTemp(OnComplete)](TSharedPtr<FJsonObject> ScreenshotData)
+		{
+			if (!ScreenshotData.IsValid())
+			{
+				UE_LOG(LogCaptureWidgetScreenshotCommand, Warning, TEXT("Service layer failed to capture widget screenshot"));
+				FMCPError Error = FMCPErrorHandler::CreateExecutionFailedError(
+					FString::Printf(TEXT("Failed to capture screenshot for widget '%s'"),
+						*ScreenshotParams.WidgetName));
+				OnComplete(SerializeErrorResponse(Error));
+				return;
+			}
+
+			UE_LOG(LogCaptureWidgetScreenshotCommand, Log, TEXT("Widget screenshot captured successfully"));
+			OnComplete(SerializeJsonResponse(CreateSuccessResponse(ScreenshotParams, ScreenshotData)));
+		});
+}
+
+bool FCaptureWidgetScreenshotCommand::PrepareRequest(const FString& Parameters, FWidgetScreenshotParams& OutParams, FString& OutErrorResponse) const
+{
+	// Parse JSON parameters
+	TSharedPtr<FJsonObject> JsonObject = ParseJsonParameters(Parameters);
+	if (!JsonObject.IsValid())
+	{
+		OutErrorResponse = SerializeErrorResponse(FMCPErrorHandler::CreateValidationFailedError(TEXT("Invalid JSON parameters")));
+		return false;
+	}
+
+	// Validate parameters
+	FString ValidationError;
+	if (!ValidateParamsInternal(JsonObject, ValidationError))
+	{
+		OutErrorResponse = SerializeErrorResponse(FMCPErrorHandler::CreateValidationFailedError(ValidationError));
+		return false;
+	}
+
+	// Validate service availability
+	if (!UMGService.IsValid())
+	{
+		UE_LOG(LogCaptureWidgetScreenshotCommand, Error, TEXT("UMG service is not available - dependency injection failed"));
+		OutErrorResponse = SerializeErrorResponse(FMCPErrorHandler::CreateInternalError(TEXT("UMG service is not available")));
+		return false;
+	}
+
+	if (!ExtractWidgetScreenshotParameters(JsonObject, OutParams))
+	{
+		OutErrorResponse = SerializeErrorResponse(FMCPErrorHandler::CreateValidationFailedError(TEXT("Failed to extract widget screenshot parameters")));
+		return false;
+	}
+
+	return true;
+}
+
 TSharedPtr<FJsonObject> FCaptureWidgetScreenshotCommand::ExecuteInternal(const TSharedPtr<FJsonObject>& Params)
 {
 	// Validate service availability
@@ -80,6 +185,13 @@ TSharedPtr<FJsonObject> FCaptureWidgetScreenshotCommand::ExecuteInternal(const T
 		return CreateErrorResponse(Error);
 	}
 
+	if (ScreenshotParams.OutputMode == TEXT("file") && !ConvertScreenshotToFile(ScreenshotData, ScreenshotParams.OutputPath))
+	{
+		FMCPError Error = FMCPErrorHandler::CreateExecutionFailedError(
+			FString::Printf(TEXT("Failed to save screenshot to: %s"), *ScreenshotParams.OutputPath));
+		return CreateErrorResponse(Error);
+	}
+
 	UE_LOG(LogCaptureWidgetScreenshotCommand, Log, TEXT("Widget screenshot captured successfully"));
 	return CreateSuccessResponse(ScreenshotParams, ScreenshotData);
 }
@@ -159,6 +271,17 @@ bool FCaptureWidgetScreenshotCommand::ValidateParamsInternal(const TSharedPtr<FJ
 		}
 	}
 
+	// Validate output_mode if provided
+	if (Params->HasField(TEXT("output_mode")))
+	{
+		FString OutputMode = Params->GetStringField(TEXT("output_mode"));
+		if (OutputMode != TEXT("base64") && OutputMode != TEXT("file"))
+		{
+			OutError = TEXT("output_mode must be 'base64' or 'file'");
+			return false;
+		}
+	}
+
 	return true;
 }
 
@@ -223,6 +346,25 @@ bool FCaptureWidgetScreenshotCommand::ExtractWidgetScreenshotParameters(const TS
 	// Extract format (optional, default "png")
 	OutParams.Format = Params->HasField(TEXT("format")) ? Params->GetStringField(TEXT("format")) : TEXT("png");
 
+	// Extract output mode (optional, default "base64")
+	OutParams.OutputMode = Params->HasField(TEXT("output_mode")) ? Params->GetStringField(TEXT("output_mode")) : TEXT("base64");
+
+	if (OutParams.OutputMode == TEXT("file"))
+	{
+		Params->TryGetStringField(TEXT("output_path"), OutParams.OutputPath);
+
+		// If no path specified, use default in Saved/Screenshots alongside viewport captures
+		if (OutParams.OutputPath.IsEmpty())
+		{
+			const FString Extension = (OutParams.Format == TEXT("png")) ? TEXT("png") : TEXT("jpg");
+			const FString Timestamp = FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
+			OutParams.OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Screenshots"), TEXT("MCP"),
+				FString::Printf(TEXT("Widget_%s_%s.%s"), *FPaths::GetBaseFilename(OutParams.WidgetName), *Timestamp, *Extension));
+		}
+
+		OutParams.OutputPath = FPaths::ConvertRelativePathToFull(OutParams.OutputPath);
+	}
+
 	return true;
 }
 
@@ -1,5 +1,6 @@
 #include "Commands/UMG/GetWidgetBlueprintMetadataCommand.h"
 #include "Services/UMG/IUMGService.h"
+#include "Services/MetadataResponseCache.h"
 #include "WidgetBlueprint.h"
 #include "Blueprint/WidgetTree.h"
 #include "EditorAssetLibrary.h"
@@ -49,13 +50,26 @@ FString FGetWidgetBlueprintMetadataCommand::Execute(const FString& Parameters)
 		return OutputString;
 	}
 
-	// Execute and return result
-	TSharedPtr<FJsonObject> Response = ExecuteInternal(JsonObject);
+	// Find the widget blueprint with retry mechanism
+	const FString WidgetName = JsonObject->GetStringField(TEXT("widget_name"));
+	TArray<FString> AttemptedPaths;
+	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprintWithRetry(WidgetName, AttemptedPaths);
+
+	if (!WidgetBlueprint)
+	{
+		FString AttemptedPathsStr = FString::Join(AttemptedPaths, TEXT(", "));
+		TSharedPtr<FJsonObject> ErrorResponse = CreateErrorResponse(FString::Printf(TEXT("Widget blueprint '%s' not found. Tried paths: [%s]. Note: If the asset exists but this error persists, the asset may not be fully loaded in the editor - try saving all assets and retrying."), *WidgetName, *AttemptedPathsStr));
+		FString OutputString;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+		FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
+		return OutputString;
+	}
 
-	FString OutputString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-	FJsonSerializer::Serialize(Response.ToSharedRef(), Writer);
-	return OutputString;
+	// Execute and return result, or the cached response while the widget is unchanged
+	return FMetadataResponseCache::Get().Serve(GetCommandName(), Parameters, WidgetBlueprint, [&]()
+	{
+		return ExecuteInternal(JsonObject, WidgetBlueprint);
+	});
 }
 
 bool FGetWidgetBlueprintMetadataCommand::ValidateParams(const FString& Parameters) const
@@ -97,7 +111,7 @@ bool FGetWidgetBlueprintMetadataCommand::ValidateParamsInternal(const TSharedPtr
 	return true;
 }
 
-TSharedPtr<FJsonObject> FGetWidgetBlueprintMetadataCommand::ExecuteInternal(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FGetWidgetBlueprintMetadataCommand::ExecuteInternal(const TSharedPtr<FJsonObject>& Params, UWidgetBlueprint* WidgetBlueprint)
 {
 	FString WidgetName = Params->GetStringField(TEXT("widget_name"));
 
@@ -132,16 +146,6 @@ TSharedPtr<FJsonObject> FGetWidgetBlueprintMetadataCommand::ExecuteInternal(cons
 		ContainerName = Params->GetStringField(TEXT("container_name"));
 	}
 
-	// Find the widget blueprint with retry mechanism
-	TArray<FString> AttemptedPaths;
-	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprintWithRetry(WidgetName, AttemptedPaths);
-
-	if (!WidgetBlueprint)
-	{
-		FString AttemptedPathsStr = FString::Join(AttemptedPaths, TEXT(", "));
-		return CreateErrorResponse(FString::Printf(TEXT("Widget blueprint '%s' not found. Tried paths: [%s]. Note: If the asset exists but this error persists, the asset may not be fully loaded in the editor - try saving all assets and retrying."), *WidgetName, *AttemptedPathsStr));
-	}
-
 	if (!WidgetBlueprint->WidgetTree)
 	{
 		return CreateErrorResponse(FString::Printf(TEXT("Widget blueprint '%s' has no widget tree"), *WidgetName));
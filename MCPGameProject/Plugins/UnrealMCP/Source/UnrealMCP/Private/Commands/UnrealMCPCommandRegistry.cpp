@@ -62,10 +62,59 @@ bool FUnrealMCPCommandRegistry::UnregisterCommand(const FString& CommandName)
 }
 
 FString FUnrealMCPCommandRegistry::ExecuteCommand(const FString& CommandName, const FString& Parameters)
+{
+    FString Result;
+    DispatchCommand(CommandName, Parameters, [&Result, &CommandName, &Parameters](IUnrealMCPCommand& Command)
+    {
+        Result = Command.Execute(Parameters);
+        UE_LOG(LogTemp, Verbose, TEXT("FUnrealMCPCommandRegistry::ExecuteCommand: Successfully executed command '%s'"), *CommandName);
+    },
+    [&Result](const FString& ErrorResponse)
+    {
+        Result = ErrorResponse;
+    });
+    return Result;
+}
+
+void FUnrealMCPCommandRegistry::ExecuteCommandDeferred(const FString& CommandName, const FString& Parameters, TFunction<void(const FString&)> OnComplete,
+                                                       TSharedPtr<FMCPCommandCancellation> Cancellation)
+{
+    if (!Cancellation.IsValid())
+    {
+        Cancellation = MakeShared<FMCPCommandCancellation>();
+    }
+    
+    // An exception or a cancellation may race the command's own result,
+    // so make sure the caller only ever hears back once
+    TSharedRef<bool> bCompleted = MakeShared<bool>(false);
+    TFunction<void(const FString&)> CompleteOnce = [bCompleted, Cancellation, OnComplete = MoveTemp(OnComplete)](const FString& Result)
+    {
+        if (!*bCompleted)
+        {
+            *bCompleted = true;
+            Cancellation->SetHandler(nullptr);
+            OnComplete(Result);
+        }
+    };
+    
+    DispatchCommand(CommandName, Parameters, [this, &CompleteOnce, &Parameters, &Cancellation](IUnrealMCPCommand& Command)
+    {
+        // Commands with work that can be stopped replace this with their own handler
+        Cancellation->SetHandler([this, CompleteOnce]()
+        {
+            CompleteOnce(CreateErrorResponse(TEXT("Cancelled while running; its result will be discarded")));
+        });
+        Command.ExecuteCancellable(Parameters, CompleteOnce, *Cancellation);
+    },
+    CompleteOnce);
+}
+
+void FUnrealMCPCommandRegistry::DispatchCommand(const FString& CommandName, const FString& Parameters, TFunctionRef<void(IUnrealMCPCommand&)> Run, TFunctionRef<void(const FString&)> OnError)
 {
     if (CommandName.IsEmpty())
     {
-        return CreateErrorResponse(TEXT("Empty command name"));
+        OnError(CreateErrorResponse(TEXT("Empty command name")));
+        return;
     }
     
     TSharedPtr<IUnrealMCPCommand> Command;
@@ -74,7 +123,8 @@ FString FUnrealMCPCommandRegistry::ExecuteCommand(const FString& CommandName, co
         TSharedPtr<IUnrealMCPCommand>* CommandPtr = RegisteredCommands.Find(CommandName);
         if (!CommandPtr || !CommandPtr->IsValid())
         {
-            return CreateErrorResponse(FString::Printf(TEXT("Command '%s' not found"), *CommandName));
+            OnError(CreateErrorResponse(FString::Printf(TEXT("Command '%s' not found"), *CommandName)));
+            return;
         }
         Command = *CommandPtr;
     }
@@ -82,27 +132,26 @@ FString FUnrealMCPCommandRegistry::ExecuteCommand(const FString& CommandName, co
     // Validate parameters before execution
     if (!Command->ValidateParams(Parameters))
     {
-        return CreateErrorResponse(FString::Printf(TEXT("Invalid parameters for command '%s'"), *CommandName));
+        OnError(CreateErrorResponse(FString::Printf(TEXT("Invalid parameters for command '%s'"), *CommandName)));
+        return;
     }
     
     // Execute the command
     try
     {
-        FString Result = Command->Execute(Parameters);
-        UE_LOG(LogTemp, Verbose, TEXT("FUnrealMCPCommandRegistry::ExecuteCommand: Successfully executed command '%s'"), *CommandName);
-        return Result;
+        Run(*Command);
     }
     catch (const std::exception& e)
     {
         FString ErrorMessage = FString::Printf(TEXT("Exception during command execution: %s"), ANSI_TO_TCHAR(e.what()));
-        UE_LOG(LogTemp, Error, TEXT("FUnrealMCPCommandRegistry::ExecuteCommand: %s"), *ErrorMessage);
-        return CreateErrorResponse(ErrorMessage);
+        UE_LOG(LogTemp, Error, TEXT("FUnrealMCPCommandRegistry::DispatchCommand: '%s': %s"), *CommandName, *ErrorMessage);
+        OnError(CreateErrorResponse(ErrorMessage));
     }
     catch (...)
     {
         FString ErrorMessage = TEXT("Unknown exception during command execution");
-        UE_LOG(LogTemp, Error, TEXT("FUnrealMCPCommandRegistry::ExecuteCommand: %s"), *ErrorMessage);
-        return CreateErrorResponse(ErrorMessage);
+        UE_LOG(LogTemp, Error, TEXT("FUnrealMCPCommandRegistry::DispatchCommand: '%s': %s"), *CommandName, *ErrorMessage);
+        OnError(CreateErrorResponse(ErrorMessage));
     }
 }
 
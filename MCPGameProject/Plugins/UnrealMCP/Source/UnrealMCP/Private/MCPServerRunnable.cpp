@@ -188,9 +188,14 @@ FString ProcessClientRequest(UUnrealMCPBridge* Bridge, const FString& ReceivedTe
 		Params = *ParamsPtr;
 	}
 
+	// Envelope options: "async" returns a job handle at once, "wait_seconds" bounds the inline wait
+	FMCPDispatchOptions Options;
+	JsonObject->TryGetBoolField(TEXT("async"), Options.bAsync);
+	JsonObject->TryGetNumberField(TEXT("wait_seconds"), Options.InlineWaitSeconds);
+
 	UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Executing command: %s"), *CommandType);
 	const double ExecuteStartTime = FPlatformTime::Seconds();
-	const FString Response = Bridge->ExecuteCommand(CommandType, Params);
+	const FString Response = Bridge->ExecuteCommand(CommandType, Params, Options);
 	UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Command '%s' completed in %.3f seconds"), *CommandType, FPlatformTime::Seconds() - ExecuteStartTime);
 	return Response;
 }
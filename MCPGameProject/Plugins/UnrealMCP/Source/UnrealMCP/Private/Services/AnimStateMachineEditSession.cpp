@@ -0,0 +1,387 @@
+#include "Services/AnimStateMachineEditSession.h"
+#include "Services/IAnimationBlueprintService.h"
+#include "Animation/AnimBlueprint.h"
+#include "AnimGraphNode_StateMachine.h"
+#include "AnimGraphNode_SequencePlayer.h"
+#include "AnimGraphNode_StateResult.h"
+#include "AnimStateEntryNode.h"
+#include "AnimStateNode.h"
+#include "AnimStateTransitionNode.h"
+#include "AnimationGraph.h"
+#include "AnimationStateMachineGraph.h"
+#include "AnimationStateGraph.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/Kismet2NameValidators.h"
+
+FAnimStateMachineEditSession::FAnimStateMachineEditSession(UAnimBlueprint* InAnimBlueprint, const FString& StateMachineName, bool bCreateIfMissing)
+    : AnimBlueprint(InAnimBlueprint)
+{
+    if (!AnimBlueprint)
+    {
+        Error = TEXT("Invalid Animation Blueprint");
+        return;
+    }
+
+    UAnimationGraph* AnimGraph = nullptr;
+    for (UEdGraph* Graph : AnimBlueprint->FunctionGraphs)
+    {
+        AnimGraph = Cast<UAnimationGraph>(Graph);
+        if (AnimGraph)
+        {
+            break;
+        }
+    }
+
+    if (!AnimGraph)
+    {
+        Error = TEXT("Could not find AnimGraph in Animation Blueprint");
+        return;
+    }
+
+    // Same title match as FAnimationBlueprintService::FindStateMachineNode
+    for (UEdGraphNode* Node : AnimGraph->Nodes)
+    {
+        UAnimGraphNode_StateMachine* Candidate = Cast<UAnimGraphNode_StateMachine>(Node);
+        if (Candidate && Candidate->GetNodeTitle(ENodeTitleType::FullTitle).ToString().Contains(StateMachineName))
+        {
+            StateMachineNode = Candidate;
+            break;
+        }
+    }
+
+    if (!StateMachineNode && bCreateIfMissing)
+    {
+        StateMachineNode = CreateStateMachineNode(AnimGraph, StateMachineName, Error);
+        bCreated = bModified = StateMachineNode != nullptr;
+    }
+
+    if (!StateMachineNode || !StateMachineNode->EditorStateMachineGraph)
+    {
+        if (Error.IsEmpty())
+        {
+            Error = FString::Printf(TEXT("Could not find state machine '%s'"), *StateMachineName);
+        }
+        return;
+    }
+
+    StateMachineGraph = StateMachineNode->EditorStateMachineGraph;
+    for (UEdGraphNode* Node : StateMachineGraph->Nodes)
+    {
+        if (UAnimStateNode* StateNode = Cast<UAnimStateNode>(Node))
+        {
+            StatesByName.FindOrAdd(StateNode->GetStateName(), StateNode);
+        }
+    }
+}
+
+UAnimGraphNode_StateMachine* FAnimStateMachineEditSession::CreateStateMachineNode(UAnimationGraph* AnimGraph, const FString& StateMachineName, FString& OutError)
+{
+    if (!AnimGraph)
+    {
+        OutError = TEXT("Could not find AnimGraph in Animation Blueprint");
+        return nullptr;
+    }
+
+    // Create the state machine node using RF_Transactional (matches editor behavior)
+    // EditorStateMachineGraph must be NULL for PostPlacedNewNode to work
+    UAnimGraphNode_StateMachine* NewNode = NewObject<UAnimGraphNode_StateMachine>(AnimGraph, NAME_None, RF_Transactional);
+    if (!NewNode)
+    {
+        OutError = TEXT("Failed to create state machine node");
+        return nullptr;
+    }
+
+    // Add the node to the AnimGraph FIRST (before PostPlacedNewNode)
+    // PostPlacedNewNode uses GetGraph() which requires the node to be in a graph
+    AnimGraph->AddNode(NewNode, false, false);
+
+    // Let PostPlacedNewNode do its work - this will:
+    // 1. Create EditorStateMachineGraph using CreateNewGraph
+    // 2. Set OwnerAnimGraphNode
+    // 3. Create name validator and rename the graph
+    // 4. Call Schema->CreateDefaultNodesForGraph()
+    // 5. Add graph to SubGraphs
+    // 6. Call EnsureBindingsArePresent() (from base class)
+    // 7. Call UAnimBlueprintExtension::RequestExtensionsForNode() (from base class)
+    NewNode->PostPlacedNewNode();
+
+    // Allocate pins AFTER PostPlacedNewNode (creates output pose pin)
+    NewNode->AllocateDefaultPins();
+
+    // Now rename the state machine graph to our desired name
+    if (!NewNode->EditorStateMachineGraph)
+    {
+        OutError = TEXT("PostPlacedNewNode failed to create state machine graph");
+        return nullptr;
+    }
+
+    TSharedPtr<INameValidatorInterface> NameValidator = FNameValidatorFactory::MakeValidator(NewNode);
+    FBlueprintEditorUtils::RenameGraphWithSuggestion(NewNode->EditorStateMachineGraph, NameValidator, StateMachineName);
+    return NewNode;
+}
+
+UAnimStateNode* FAnimStateMachineEditSession::FindState(const FString& StateName) const
+{
+    UAnimStateNode* const* Found = StatesByName.Find(StateName);
+    return Found ? *Found : nullptr;
+}
+
+UAnimStateNode* FAnimStateMachineEditSession::AddState(const FAnimStateParams& Params, FString& OutError)
+{
+    if (!IsValid())
+    {
+        OutError = Error;
+        return nullptr;
+    }
+
+    if (Params.StateName.IsEmpty())
+    {
+        OutError = TEXT("State name cannot be empty");
+        return nullptr;
+    }
+
+    if (StatesByName.Contains(Params.StateName))
+    {
+        OutError = FString::Printf(TEXT("State '%s' already exists"), *Params.StateName);
+        return nullptr;
+    }
+
+    // Create the state node (BoundGraph must be NULL for PostPlacedNewNode to work)
+    UAnimStateNode* StateNode = NewObject<UAnimStateNode>(StateMachineGraph, NAME_None, RF_Transactional);
+    if (!StateNode)
+    {
+        OutError = TEXT("Failed to create state node");
+        return nullptr;
+    }
+
+    // Set node position BEFORE adding to graph (affects layout)
+    StateNode->NodePosX = static_cast<int32>(Params.NodePosition.X);
+    StateNode->NodePosY = static_cast<int32>(Params.NodePosition.Y);
+
+    // Add to graph FIRST (PostPlacedNewNode uses GetGraph())
+    StateMachineGraph->AddNode(StateNode, false, false);
+
+    // Let PostPlacedNewNode do its work - this will:
+    // 1. Create BoundGraph using CreateNewGraph
+    // 2. Rename with validator
+    // 3. Call CreateDefaultNodesForGraph (creates MyResultNode)
+    // 4. Add BoundGraph to SubGraphs
+    StateNode->PostPlacedNewNode();
+    bModified = true;
+
+    // Rename the bound graph to our desired state name
+    if (!StateNode->BoundGraph)
+    {
+        OutError = TEXT("PostPlacedNewNode failed to create state BoundGraph");
+        return nullptr;
+    }
+
+    TSharedPtr<INameValidatorInterface> NameValidator = FNameValidatorFactory::MakeValidator(StateNode);
+    FBlueprintEditorUtils::RenameGraphWithSuggestion(StateNode->BoundGraph, NameValidator, Params.StateName);
+
+    // Allocate pins AFTER PostPlacedNewNode
+    StateNode->AllocateDefaultPins();
+    StatesByName.Add(Params.StateName, StateNode);
+
+    // If there's an animation asset path, create a sequence player node for it
+    if (!Params.AnimationAssetPath.IsEmpty())
+    {
+        UAnimationStateGraph* StateGraph = Cast<UAnimationStateGraph>(StateNode->BoundGraph);
+        UAnimationAsset* AnimAsset = LoadAnimationAsset(Params.AnimationAssetPath);
+        if (StateGraph && StateGraph->MyResultNode && AnimAsset)
+        {
+            FGraphNodeCreator<UAnimGraphNode_SequencePlayer> SequencePlayerCreator(*StateGraph);
+            UAnimGraphNode_SequencePlayer* SequencePlayer = SequencePlayerCreator.CreateNode();
+            SequencePlayer->SetAnimationAsset(AnimAsset);
+            SequencePlayerCreator.Finalize();
+
+            // Position the sequence player to the left of the result node
+            SequencePlayer->NodePosX = StateGraph->MyResultNode->NodePosX - 400;
+            SequencePlayer->NodePosY = StateGraph->MyResultNode->NodePosY;
+
+            // Connect the sequence player's Pose output to the result node's Result input
+            UEdGraphPin* OutputPin = SequencePlayer->FindPin(TEXT("Pose"), EGPD_Output);
+            UEdGraphPin* InputPin = StateGraph->MyResultNode->FindPin(TEXT("Result"), EGPD_Input);
+            if (OutputPin && InputPin)
+            {
+                OutputPin->MakeLinkTo(InputPin);
+            }
+            else
+            {
+                UE_LOG(LogTemp, Warning, TEXT("FAnimStateMachineEditSession::AddState: Could not find pins to connect animation in state '%s'"), *Params.StateName);
+            }
+        }
+        else if (!AnimAsset)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FAnimStateMachineEditSession::AddState: Could not load animation asset at '%s'"), *Params.AnimationAssetPath);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FAnimStateMachineEditSession::AddState: State graph or result node not available for animation binding"));
+        }
+    }
+
+    if (Params.bIsDefaultState)
+    {
+        FString EntryError;
+        if (!SetEntryState(Params.StateName, EntryError))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FAnimStateMachineEditSession::AddState: %s"), *EntryError);
+        }
+    }
+
+    return StateNode;
+}
+
+bool FAnimStateMachineEditSession::SetEntryState(const FString& StateName, FString& OutError)
+{
+    UAnimStateNode* StateNode = FindState(StateName);
+    if (!StateNode)
+    {
+        OutError = FString::Printf(TEXT("Could not find state '%s'"), *StateName);
+        return false;
+    }
+
+    UAnimStateEntryNode* EntryNode = StateMachineGraph->EntryNode;
+    UEdGraphPin* EntryPin = nullptr;
+    if (EntryNode)
+    {
+        for (UEdGraphPin* Pin : EntryNode->Pins)
+        {
+            if (Pin && Pin->Direction == EGPD_Output)
+            {
+                EntryPin = Pin;
+                break;
+            }
+        }
+    }
+
+    UEdGraphPin* StatePin = StateNode->GetInputPin();
+    if (!EntryPin || !StatePin)
+    {
+        OutError = FString::Printf(TEXT("Could not connect the entry node to state '%s'"), *StateName);
+        return false;
+    }
+
+    EntryPin->BreakAllPinLinks();
+    EntryPin->MakeLinkTo(StatePin);
+    bModified = true;
+    return true;
+}
+
+bool FAnimStateMachineEditSession::AddTransition(const FAnimTransitionParams& Params, FString& OutError)
+{
+    if (!IsValid())
+    {
+        OutError = Error;
+        return false;
+    }
+
+    UAnimStateNode* FromState = FindState(Params.FromStateName);
+    if (!FromState)
+    {
+        OutError = FString::Printf(TEXT("Could not find source state '%s'"), *Params.FromStateName);
+        return false;
+    }
+
+    UAnimStateNode* ToState = FindState(Params.ToStateName);
+    if (!ToState)
+    {
+        OutError = FString::Printf(TEXT("Could not find destination state '%s'"), *Params.ToStateName);
+        return false;
+    }
+
+    // Create the transition node with RF_Transactional flag
+    UAnimStateTransitionNode* TransitionNode = NewObject<UAnimStateTransitionNode>(StateMachineGraph, NAME_None, RF_Transactional);
+    if (!TransitionNode)
+    {
+        OutError = TEXT("Failed to create transition node");
+        return false;
+    }
+
+    // Add to graph FIRST (PostPlacedNewNode uses GetGraph())
+    StateMachineGraph->AddNode(TransitionNode, false, false);
+
+    // Let PostPlacedNewNode create the BoundGraph (transition rule graph)
+    // This creates UAnimationTransitionGraph with proper schema and default nodes
+    TransitionNode->PostPlacedNewNode();
+
+    // Allocate pins AFTER PostPlacedNewNode
+    TransitionNode->AllocateDefaultPins();
+
+    TransitionNode->CrossfadeDuration = Params.BlendDuration;
+    ApplyTransitionRule(TransitionNode, Params);
+
+    // Create connections between states through this transition
+    // This properly wires the pins: FromState -> TransitionNode -> ToState
+    TransitionNode->CreateConnections(FromState, ToState);
+    bModified = true;
+    return true;
+}
+
+void FAnimStateMachineEditSession::ApplyTransitionRule(UAnimStateTransitionNode* TransitionNode, const FAnimTransitionParams& Params)
+{
+    const FString RuleType = Params.TransitionRuleType.ToLower();
+
+    if (RuleType == TEXT("timeremaining"))
+    {
+        // TimeRemaining: Use automatic rule based on sequence player's remaining time
+        TransitionNode->bAutomaticRuleBasedOnSequencePlayerInState = true;
+        // Negative value means trigger 'CrossfadeDuration' seconds before the end
+        // so a standard blend would finish just as the asset player ends
+        TransitionNode->AutomaticRuleTriggerTime = -1.0f;
+        TransitionNode->LogicType = ETransitionLogicType::TLT_StandardBlend;
+    }
+    else if (RuleType == TEXT("inertialization"))
+    {
+        // Inertialization: Use inertialization blend mode
+        TransitionNode->LogicType = ETransitionLogicType::TLT_Inertialization;
+        TransitionNode->bAutomaticRuleBasedOnSequencePlayerInState = false;
+    }
+    else if (RuleType == TEXT("custom"))
+    {
+        // Custom: Use custom graph for transition logic (requires manual graph setup)
+        TransitionNode->LogicType = ETransitionLogicType::TLT_Custom;
+        TransitionNode->bAutomaticRuleBasedOnSequencePlayerInState = false;
+    }
+    else if (RuleType == TEXT("boolvariable") && !Params.ConditionVariableName.IsEmpty())
+    {
+        // BoolVariable: Standard blend with a condition variable
+        // Note: The BoundGraph needs to be populated with the variable getter logic
+        // For now, we log that this requires manual setup or future implementation
+        TransitionNode->LogicType = ETransitionLogicType::TLT_StandardBlend;
+        TransitionNode->bAutomaticRuleBasedOnSequencePlayerInState = false;
+        UE_LOG(LogTemp, Warning, TEXT("FAnimStateMachineEditSession::ApplyTransitionRule: BoolVariable rule set, but variable logic in BoundGraph requires manual setup. Variable: %s"), *Params.ConditionVariableName);
+    }
+    else
+    {
+        // Default: CrossfadeBlend (standard blend without automatic rule)
+        TransitionNode->LogicType = ETransitionLogicType::TLT_StandardBlend;
+        TransitionNode->bAutomaticRuleBasedOnSequencePlayerInState = false;
+    }
+}
+
+UAnimationAsset* FAnimStateMachineEditSession::LoadAnimationAsset(const FString& AssetPath)
+{
+    if (UAnimationAsset** Cached = AssetsByPath.Find(AssetPath))
+    {
+        return *Cached;
+    }
+
+    UAnimationAsset* AnimAsset = LoadObject<UAnimationAsset>(nullptr, *AssetPath);
+    AssetsByPath.Add(AssetPath, AnimAsset);
+    return AnimAsset;
+}
+
+void FAnimStateMachineEditSession::Commit()
+{
+    if (!bModified)
+    {
+        return;
+    }
+
+    // Notify the graph that it changed so positions are properly applied
+    StateMachineGraph->NotifyGraphChanged();
+    FBlueprintEditorUtils::MarkBlueprintAsModified(AnimBlueprint);
+    bModified = false;
+}
@@ -282,7 +282,7 @@ bool FAnimationBlueprintService::GetLinkedAnimationLayers(UAnimBlueprint* AnimBl
     return true;
 }
 
-// State machine operations (CreateStateMachine, AddStateToStateMachine, AddStateTransition, GetStateMachineStates)
+// State machine operations (CreateStateMachine, AddStateToStateMachine, AddStateTransition, BuildStateMachine, GetStateMachineStates)
 // are implemented in AnimationBlueprintStateMachineOps.cpp
 
 bool FAnimationBlueprintService::AddAnimVariable(UAnimBlueprint* AnimBlueprint, const FString& VariableName, const FString& VariableType, const FString& DefaultValue, FString& OutError)
@@ -912,24 +912,3 @@ UAnimGraphNode_StateMachine* FAnimationBlueprintService::FindStateMachineNode(UA
 
     return nullptr;
 }
-
-UAnimStateNode* FAnimationBlueprintService::FindStateNode(UAnimationStateMachineGraph* StateMachineGraph, const FString& StateName) const
-{
-    if (!StateMachineGraph)
-    {
-        return nullptr;
-    }
-
-    for (UEdGraphNode* Node : StateMachineGraph->Nodes)
-    {
-        if (UAnimStateNode* StateNode = Cast<UAnimStateNode>(Node))
-        {
-            if (StateNode->GetStateName() == StateName)
-            {
-                return StateNode;
-            }
-        }
-    }
-
-    return nullptr;
-}
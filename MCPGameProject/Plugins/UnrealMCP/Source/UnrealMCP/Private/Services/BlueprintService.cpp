@@ -31,6 +31,8 @@
 #include "Logging/TokenizedMessage.h"
 #include "Logging/MessageLog.h"
 #include "Kismet2/CompilerResultsLog.h"
+#include "BlueprintCompilationManager.h"
+#include "Editor.h"
 #include "Engine/BlueprintCore.h"
 #include "UObject/StructOnScope.h"
 #include "Engine/Engine.h"
@@ -251,6 +253,156 @@ bool FBlueprintService::CompileBlueprint(UBlueprint* Blueprint, FString& OutErro
     return true;
 }
 
+namespace
+{
+    FString BlueprintStatusToString(EBlueprintStatus Status)
+    {
+        switch (Status)
+        {
+            case BS_Dirty: return TEXT("Dirty");
+            case BS_Error: return TEXT("Error");
+            case BS_UpToDate: return TEXT("UpToDate");
+            case BS_BeingCreated: return TEXT("BeingCreated");
+            case BS_UpToDateWithWarnings: return TEXT("UpToDateWithWarnings");
+            default: return TEXT("Unknown");
+        }
+    }
+
+    /** Read the messages the compiler left on nodes; the manager annotates nodes of every Blueprint it compiles */
+    void CollectNodeCompilerMessages(UBlueprint* Blueprint, FBlueprintCompileResult& OutResult)
+    {
+        TArray<UEdGraph*> AllGraphs;
+        Blueprint->GetAllGraphs(AllGraphs);
+        for (UEdGraph* Graph : AllGraphs)
+        {
+            if (!Graph)
+            {
+                continue;
+            }
+            for (UEdGraphNode* Node : Graph->Nodes)
+            {
+                if (!Node || !Node->bHasCompilerMessage)
+                {
+                    continue;
+                }
+                const FString Message = FString::Printf(TEXT("%s / %s: %s"),
+                    *Graph->GetName(), *Node->GetNodeTitle(ENodeTitleType::ListView).ToString(), *Node->ErrorMsg);
+                if (Node->ErrorType <= EMessageSeverity::Error)
+                {
+                    OutResult.Errors.Add(Message);
+                }
+                else if (Node->ErrorType <= EMessageSeverity::Warning)
+                {
+                    OutResult.Warnings.Add(Message);
+                }
+            }
+        }
+    }
+}
+
+bool FBlueprintService::CompileBlueprints(const TArray<TPair<FString, UBlueprint*>>& Blueprints, bool bSkipUpToDate, FBlueprintBatchCompileResult& OutResult)
+{
+    OutResult = FBlueprintBatchCompileResult();
+    const double StartTime = FPlatformTime::Seconds();
+
+    // Queue every target first so one flush compiles them together: each stage (skeletons,
+    // functions, CDOs) runs across the whole set and dependents are reinstanced once
+    TSet<UBlueprint*> Requested;
+    TArray<int32> QueuedIndices;
+    for (const TPair<FString, UBlueprint*>& Target : Blueprints)
+    {
+        FBlueprintCompileResult& Result = OutResult.Results.AddDefaulted_GetRef();
+        Result.BlueprintName = Target.Key;
+
+        UBlueprint* Blueprint = Target.Value;
+        if (!Blueprint)
+        {
+            Result.Status = TEXT("NotFound");
+            Result.Errors.Add(FString::Printf(TEXT("Blueprint not found: %s"), *Target.Key));
+            ++OutResult.NumFailed;
+            continue;
+        }
+
+        bool bAlreadyRequested = false;
+        Requested.Add(Blueprint, &bAlreadyRequested);
+        if (bAlreadyRequested || (bSkipUpToDate && Blueprint->IsUpToDate() && !Blueprint->bBeingCompiled))
+        {
+            Result.bSkipped = true;
+            Result.Status = BlueprintStatusToString(Blueprint->Status);
+            CollectNodeCompilerMessages(Blueprint, Result);
+            ++OutResult.NumSkipped;
+            continue;
+        }
+
+        FBlueprintCompilationManager::QueueForCompilation(Blueprint);
+        QueuedIndices.Add(OutResult.Results.Num() - 1);
+    }
+    const double QueuedTime = FPlatformTime::Seconds();
+
+    if (QueuedIndices.Num() > 0)
+    {
+        // The manager broadcasts pre-compile for everything it compiles, including dependents it pulled in
+        TSet<UBlueprint*> CompiledByManager;
+        FDelegateHandle PreCompileHandle;
+        if (GEditor)
+        {
+            PreCompileHandle = GEditor->OnBlueprintPreCompile().AddLambda([&CompiledByManager](UBlueprint* Blueprint)
+            {
+                CompiledByManager.Add(Blueprint);
+            });
+        }
+
+        FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+
+        if (GEditor)
+        {
+            GEditor->OnBlueprintPreCompile().Remove(PreCompileHandle);
+        }
+
+        for (UBlueprint* Compiled : CompiledByManager)
+        {
+            if (Compiled && !Requested.Contains(Compiled))
+            {
+                OutResult.DependentsRecompiled.Add(Compiled->GetPathName());
+            }
+        }
+        OutResult.DependentsRecompiled.Sort();
+    }
+    const double CompiledTime = FPlatformTime::Seconds();
+
+    for (int32 Index : QueuedIndices)
+    {
+        UBlueprint* Blueprint = Blueprints[Index].Value;
+        FBlueprintCompileResult& Result = OutResult.Results[Index];
+        Result.Status = BlueprintStatusToString(Blueprint->Status);
+        CollectNodeCompilerMessages(Blueprint, Result);
+
+        if (Blueprint->Status == BS_Error)
+        {
+            if (Result.Errors.IsEmpty())
+            {
+                Result.Errors.Add(FString::Printf(TEXT("Blueprint '%s' failed to compile"), *Blueprint->GetName()));
+            }
+            ++OutResult.NumFailed;
+        }
+        else
+        {
+            ++OutResult.NumCompiled;
+        }
+        BlueprintCache.InvalidateBlueprint(Blueprint->GetName());
+    }
+
+    const double EndTime = FPlatformTime::Seconds();
+    OutResult.QueueMs = (QueuedTime - StartTime) * 1000.0;
+    OutResult.CompileMs = (CompiledTime - QueuedTime) * 1000.0;
+    OutResult.CollectMs = (EndTime - CompiledTime) * 1000.0;
+
+    UE_LOG(LogTemp, Log, TEXT("FBlueprintService::CompileBlueprints: %d compiled, %d skipped, %d failed, %d dependent(s) in %.1f ms"),
+        OutResult.NumCompiled, OutResult.NumSkipped, OutResult.NumFailed, OutResult.DependentsRecompiled.Num(), OutResult.CompileMs);
+
+    return OutResult.NumFailed == 0;
+}
+
 UBlueprint* FBlueprintService::FindBlueprint(const FString& BlueprintName)
 {
     UE_LOG(LogTemp, Verbose, TEXT("FBlueprintService::FindBlueprint: Looking for blueprint '%s'"), *BlueprintName);
@@ -0,0 +1,313 @@
+#include "Services/IBulkImportBackend.h"
+
+#include "AssetCompilingManager.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Commands/Editor/ImportStaticMeshCommand.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Texture2D.h"
+#include "Factories/SoundFactory.h"
+#include "Factories/TextureFactory.h"
+#include "IImageWrapperModule.h"
+#include "ImageCoreUtils.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Sound/SoundWave.h"
+#include "UObject/Package.h"
+#include "Utils/TextureProcessingUtils.h"
+
+bool FBulkImportItem::ResolveType(const FString& Extension, EBulkImportAssetType& OutType)
+{
+	// Same extension lists as import_static_mesh, import_texture and import_sound_file
+	static const TCHAR* const MeshExtensions[] = { TEXT("fbx"), TEXT("obj") };
+	static const TCHAR* const TextureExtensions[] = { TEXT("png"), TEXT("tga"), TEXT("tif"), TEXT("tiff"), TEXT("jpg"), TEXT("jpeg"), TEXT("exr"), TEXT("hdr"), TEXT("bmp") };
+	static const TCHAR* const SoundExtensions[] = { TEXT("wav"), TEXT("mp3"), TEXT("ogg"), TEXT("flac"), TEXT("aiff"), TEXT("aif") };
+
+	auto Contains = [&Extension](const auto& List)
+	{
+		for (const TCHAR* Candidate : List)
+		{
+			if (Extension.Equals(Candidate, ESearchCase::IgnoreCase))
+			{
+				return true;
+			}
+		}
+		return false;
+	};
+
+	if (Contains(MeshExtensions))
+	{
+		OutType = EBulkImportAssetType::StaticMesh;
+		return true;
+	}
+	if (Contains(TextureExtensions))
+	{
+		OutType = EBulkImportAssetType::Texture;
+		return true;
+	}
+	if (Contains(SoundExtensions))
+	{
+		OutType = EBulkImportAssetType::Sound;
+		return true;
+	}
+	return false;
+}
+
+FString FBulkImportItem::DefaultFolder(EBulkImportAssetType Type)
+{
+	switch (Type)
+	{
+	case EBulkImportAssetType::StaticMesh: return TEXT("/Game/Meshes");
+	case EBulkImportAssetType::Sound: return TEXT("/Game/Audio");
+	default: return TEXT("/Game/Textures");
+	}
+}
+
+const TCHAR* FBulkImportItem::TypeToString(EBulkImportAssetType Type)
+{
+	switch (Type)
+	{
+	case EBulkImportAssetType::StaticMesh: return TEXT("static_mesh");
+	case EBulkImportAssetType::Sound: return TEXT("sound");
+	default: return TEXT("texture");
+	}
+}
+
+namespace
+{
+TextureCompressionSettings ParseCompressionSettings(const FString& Name)
+{
+	if (Name == TEXT("Normalmap")) return TC_Normalmap;
+	if (Name == TEXT("Masks")) return TC_Masks;
+	if (Name == TEXT("Grayscale")) return TC_Grayscale;
+	if (Name == TEXT("HDR")) return TC_HDR;
+	if (Name == TEXT("Alpha")) return TC_Alpha;
+	return TC_Default;
+}
+
+class FEngineBulkImportBackend final : public IBulkImportBackend
+{
+public:
+	FEngineBulkImportBackend()
+		// Loaded here on the game thread; workers only use the pointer
+		: ImageWrapperModule(&FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper")))
+	{
+	}
+
+	virtual bool ReadSource(const FBulkImportItem& Item, FBulkImportPayload& OutPayload, FString& OutError) override
+	{
+		if (!FPaths::FileExists(Item.SourceFilePath))
+		{
+			OutError = FString::Printf(TEXT("Source file does not exist: %s"), *Item.SourceFilePath);
+			return false;
+		}
+
+		// The FBX SDK opens the file itself and is not thread-safe; nothing to prefetch
+		if (Item.Type == EBulkImportAssetType::StaticMesh)
+		{
+			return true;
+		}
+
+		if (!FFileHelper::LoadFileToArray(OutPayload.Bytes, *Item.SourceFilePath))
+		{
+			OutError = FString::Printf(TEXT("Failed to read source file: %s"), *Item.SourceFilePath);
+			return false;
+		}
+
+		if (Item.Type == EBulkImportAssetType::Texture
+			&& ImageWrapperModule->DecompressImage(OutPayload.Bytes.GetData(), OutPayload.Bytes.Num(), OutPayload.Image))
+		{
+			OutPayload.bImageDecoded = true;
+			OutPayload.Bytes.Empty();
+		}
+		// Formats the image wrappers cannot decode keep their bytes for UTextureFactory
+		return true;
+	}
+
+	virtual bool CreateAssets(const FBulkImportItem& Item, FBulkImportPayload& Payload, TArray<FString>& OutAssetPaths, FString& OutError) override
+	{
+		switch (Item.Type)
+		{
+		case EBulkImportAssetType::StaticMesh: return CreateStaticMesh(Item, OutAssetPaths, OutError);
+		case EBulkImportAssetType::Sound: return CreateSound(Item, Payload, OutAssetPaths, OutError);
+		default: return CreateTexture(Item, Payload, OutAssetPaths, OutError);
+		}
+	}
+
+	virtual int32 GetNumPendingCompiles() const override
+	{
+		return FAssetCompilingManager::Get().GetNumRemainingAssets();
+	}
+
+private:
+	static bool CreateStaticMesh(const FBulkImportItem& Item, TArray<FString>& OutAssetPaths, FString& OutError)
+	{
+		// Reuse import_static_mesh so pack splitting, reimport and collision behave identically
+		TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+		if (Item.MeshOptions.IsValid())
+		{
+			Params->Values = Item.MeshOptions->Values;
+		}
+		Params->SetStringField(TEXT("source_file_path"), Item.SourceFilePath);
+		Params->SetStringField(TEXT("asset_name"), Item.AssetName);
+		Params->SetStringField(TEXT("folder_path"), Item.FolderPath);
+
+		FString ParamsString;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ParamsString);
+		FJsonSerializer::Serialize(Params, Writer);
+
+		FImportStaticMeshCommand Command;
+		const FString ResultString = Command.Execute(ParamsString);
+
+		TSharedPtr<FJsonObject> Result;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResultString);
+		if (!FJsonSerializer::Deserialize(Reader, Result) || !Result.IsValid())
+		{
+			OutError = TEXT("import_static_mesh returned an unreadable response");
+			return false;
+		}
+		if (!Result->GetBoolField(TEXT("success")))
+		{
+			Result->TryGetStringField(TEXT("error"), OutError);
+			return false;
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* Meshes = nullptr;
+		if (Result->TryGetArrayField(TEXT("meshes"), Meshes))
+		{
+			for (const TSharedPtr<FJsonValue>& Mesh : *Meshes)
+			{
+				const TSharedPtr<FJsonObject>* MeshObject = nullptr;
+				FString Path;
+				if (Mesh->TryGetObject(MeshObject) && (*MeshObject)->TryGetStringField(TEXT("path"), Path))
+				{
+					OutAssetPaths.Add(Path);
+				}
+			}
+		}
+		return true;
+	}
+
+	static bool CreateTexture(const FBulkImportItem& Item, FBulkImportPayload& Payload, TArray<FString>& OutAssetPaths, FString& OutError)
+	{
+		const FString PackagePath = Item.FolderPath / Item.AssetName;
+		UPackage* Package = CreatePackage(*PackagePath);
+		if (!Package)
+		{
+			OutError = FString::Printf(TEXT("Failed to create package: %s"), *PackagePath);
+			return false;
+		}
+		Package->FullyLoad();
+
+		const TextureCompressionSettings Compression = ParseCompressionSettings(Item.CompressionSettings);
+		const FName AssetFName(*Item.AssetName);
+		UTexture2D* Texture = nullptr;
+
+		bool bCreated = true;
+		bool bHDRSource = false;
+		if (Payload.bImageDecoded)
+		{
+			Texture = FTextureProcessingUtils::WriteTextureSource(Package, Item.AssetName, Payload.Image, Item.SourceFilePath, bCreated, OutError);
+			if (!Texture)
+			{
+				return false;
+			}
+			bHDRSource = ERawImageFormat::IsHDR(Payload.Image.Format);
+		}
+		else
+		{
+			TArray64<uint8> FileBytes = MoveTemp(Payload.Bytes);
+			if (FileBytes.Num() == 0 && !FFileHelper::LoadFileToArray(FileBytes, *Item.SourceFilePath))
+			{
+				OutError = FString::Printf(TEXT("Failed to read source file: %s"), *Item.SourceFilePath);
+				return false;
+			}
+
+			UTextureFactory* TextureFactory = NewObject<UTextureFactory>();
+			TextureFactory->AddToRoot();
+			TextureFactory->SuppressImportOverwriteDialog();
+			TextureFactory->NoAlpha = !Item.bPreserveAlpha;
+
+			const uint8* DataPtr = FileBytes.GetData();
+			const FString Extension = FPaths::GetExtension(Item.SourceFilePath).ToLower();
+			Texture = Cast<UTexture2D>(TextureFactory->FactoryCreateBinary(
+				UTexture2D::StaticClass(), Package, AssetFName, RF_Public | RF_Standalone,
+				nullptr, *Extension, DataPtr, DataPtr + FileBytes.Num(), GWarn));
+			TextureFactory->RemoveFromRoot();
+
+			if (!Texture)
+			{
+				OutError = FString::Printf(TEXT("Failed to import texture file: %s"), *Item.SourceFilePath);
+				return false;
+			}
+			bHDRSource = Texture->CompressionSettings == TC_HDR;
+		}
+
+		// Float sources stay HDR unless a setting was asked for
+		const bool bKeepHDR = Compression == TC_Default && bHDRSource;
+		Texture->CompressionSettings = bKeepHDR ? TC_HDR : Compression;
+		Texture->SRGB = Item.bSRGB && !bKeepHDR;
+		if (Compression == TC_Normalmap || Compression == TC_Masks || Compression == TC_Grayscale)
+		{
+			Texture->SRGB = false;
+		}
+		Texture->CompressionNoAlpha = !Item.bPreserveAlpha;
+
+		// PostEditChange queues the platform build with the texture compiling manager
+		// instead of compressing here; the asset is usable with a placeholder until it lands
+		Texture->PostEditChange();
+
+		if (bCreated)
+		{
+			FAssetRegistryModule::AssetCreated(Texture);
+		}
+		Package->MarkPackageDirty();
+		OutAssetPaths.Add(PackagePath);
+		return true;
+	}
+
+	static bool CreateSound(const FBulkImportItem& Item, FBulkImportPayload& Payload, TArray<FString>& OutAssetPaths, FString& OutError)
+	{
+		const FString PackagePath = Item.FolderPath / Item.AssetName;
+		UPackage* Package = CreatePackage(*PackagePath);
+		if (!Package)
+		{
+			OutError = FString::Printf(TEXT("Failed to create package: %s"), *PackagePath);
+			return false;
+		}
+		Package->FullyLoad();
+
+		USoundFactory* SoundFactory = NewObject<USoundFactory>();
+		SoundFactory->AddToRoot();
+		SoundFactory->SuppressImportOverwriteDialog();
+
+		const uint8* DataPtr = Payload.Bytes.GetData();
+		const FString Extension = FPaths::GetExtension(Item.SourceFilePath).ToLower();
+		UObject* ImportedObject = SoundFactory->FactoryCreateBinary(
+			USoundWave::StaticClass(), Package, FName(*Item.AssetName), RF_Public | RF_Standalone,
+			nullptr, *Extension, DataPtr, DataPtr + Payload.Bytes.Num(), GWarn);
+		SoundFactory->RemoveFromRoot();
+
+		if (!ImportedObject)
+		{
+			OutError = FString::Printf(TEXT("Failed to import audio file: %s"), *Item.SourceFilePath);
+			return false;
+		}
+
+		FAssetRegistryModule::AssetCreated(ImportedObject);
+		Package->MarkPackageDirty();
+		OutAssetPaths.Add(PackagePath);
+		return true;
+	}
+
+	IImageWrapperModule* ImageWrapperModule;
+};
+}
+
+TSharedRef<IBulkImportBackend> CreateBulkImportBackend()
+{
+	return MakeShared<FEngineBulkImportBackend>();
+}
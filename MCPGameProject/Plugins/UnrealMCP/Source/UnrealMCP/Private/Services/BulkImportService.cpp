@@ -0,0 +1,253 @@
+#include "Services/BulkImportService.h"
+
+#include "Async/Async.h"
+
+FBulkImportJob::FBulkImportJob(FString InJobId, TArray<FBulkImportItem>&& InItems, const FBulkImportJobOptions& InOptions, TSharedRef<IBulkImportBackend> InBackend)
+	: JobId(MoveTemp(InJobId))
+	, Options(InOptions)
+	, Backend(MoveTemp(InBackend))
+	, StartSeconds(FPlatformTime::Seconds())
+	, bCancelled(MakeShared<std::atomic<bool>>(false))
+{
+	Options.MaxConcurrentReads = FMath::Max(Options.MaxConcurrentReads, 1);
+	Items.Reserve(InItems.Num());
+	for (FBulkImportItem& Item : InItems)
+	{
+		TSharedRef<FItemRecord> Record = MakeShared<FItemRecord>();
+		Record->Item = MoveTemp(Item);
+		Items.Add(Record);
+	}
+	if (Items.Num() == 0)
+	{
+		EndSeconds = StartSeconds;
+	}
+}
+
+void FBulkImportJob::StartReads()
+{
+	// Payloads read ahead of the import cursor count against the limit, so decoded
+	// textures never pile up faster than the game thread consumes them
+	while (NextToRead < Items.Num() && NextToRead - NextToImport < Options.MaxConcurrentReads)
+	{
+		TSharedRef<FItemRecord> Record = Items[NextToRead++];
+		Record->SetState(EBulkImportItemState::Reading);
+
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Record, Backend = Backend, bCancelled = bCancelled]()
+		{
+			if (bCancelled->load(std::memory_order_relaxed))
+			{
+				Record->Error = TEXT("Cancelled");
+				Record->SetState(EBulkImportItemState::Failed);
+				return;
+			}
+
+			const double ReadStart = FPlatformTime::Seconds();
+			FString Error;
+			const bool bRead = Backend->ReadSource(Record->Item, Record->Payload, Error);
+			Record->ReadMs = (FPlatformTime::Seconds() - ReadStart) * 1000.0;
+			if (!bRead)
+			{
+				Record->Payload.Reset();
+				Record->Error = Error;
+				Record->SetState(EBulkImportItemState::Failed);
+				return;
+			}
+			Record->SetState(EBulkImportItemState::Ready);
+		});
+	}
+}
+
+int32 FBulkImportJob::Tick()
+{
+	if (IsComplete())
+	{
+		return 0;
+	}
+	++TickCount;
+
+	StartReads();
+
+	const double TickStart = FPlatformTime::Seconds();
+	const double BudgetSeconds = Options.FrameBudgetMs / 1000.0;
+	int32 Imported = 0;
+
+	while (NextToImport < NextToRead)
+	{
+		FItemRecord& Record = *Items[NextToImport];
+		const EBulkImportItemState State = Record.GetState();
+		if (State == EBulkImportItemState::Reading)
+		{
+			// Keep creation in request order; later items wait for this read
+			break;
+		}
+
+		if (State == EBulkImportItemState::Ready && bCancelled->load(std::memory_order_relaxed))
+		{
+			// Read finished after the job was cancelled; drop the payload instead of creating assets
+			Record.Payload.Reset();
+			Record.Error = TEXT("Cancelled");
+			Record.SetState(EBulkImportItemState::Failed);
+		}
+		else if (State == EBulkImportItemState::Ready)
+		{
+			// Always make progress, even when a single item exceeds the budget
+			if (Imported > 0 && FPlatformTime::Seconds() - TickStart >= BudgetSeconds)
+			{
+				break;
+			}
+
+			Record.SetState(EBulkImportItemState::Importing);
+			const double ImportStart = FPlatformTime::Seconds();
+			FString Error;
+			const bool bCreated = Backend->CreateAssets(Record.Item, Record.Payload, Record.AssetPaths, Error);
+			Record.ImportMs = (FPlatformTime::Seconds() - ImportStart) * 1000.0;
+			Record.Payload.Reset();
+			if (bCreated)
+			{
+				Record.SetState(EBulkImportItemState::Succeeded);
+			}
+			else
+			{
+				Record.Error = Error;
+				Record.SetState(EBulkImportItemState::Failed);
+			}
+			++Imported;
+		}
+
+		++NextToImport;
+		StartReads();
+	}
+
+	if (IsComplete())
+	{
+		EndSeconds = FPlatformTime::Seconds();
+	}
+	return Imported;
+}
+
+void FBulkImportJob::Cancel()
+{
+	bCancelled->store(true, std::memory_order_relaxed);
+	for (int32 Index = NextToRead; Index < Items.Num(); ++Index)
+	{
+		Items[Index]->Error = TEXT("Cancelled");
+		Items[Index]->SetState(EBulkImportItemState::Failed);
+	}
+	NextToRead = Items.Num();
+
+	// Items already read (or still reading) are failed by the following ticks, so the job only
+	// completes once no worker still owns one of its items
+}
+
+void FBulkImportJob::GetStatus(FBulkImportJobStatus& OutStatus, bool bIncludeItems) const
+{
+	OutStatus = FBulkImportJobStatus();
+	OutStatus.JobId = JobId;
+	OutStatus.bComplete = IsComplete();
+	OutStatus.Total = Items.Num();
+	OutStatus.Ticks = TickCount;
+	OutStatus.ElapsedMs = ((OutStatus.bComplete ? EndSeconds : FPlatformTime::Seconds()) - StartSeconds) * 1000.0;
+
+	if (bIncludeItems)
+	{
+		OutStatus.Items.Reserve(Items.Num());
+	}
+
+	for (const TSharedRef<FItemRecord>& Record : Items)
+	{
+		const EBulkImportItemState State = Record->GetState();
+		++OutStatus.Counts[static_cast<int32>(State)];
+
+		// Worker-owned fields are only stable once the read has finished
+		const bool bReadFinished = State != EBulkImportItemState::Queued && State != EBulkImportItemState::Reading;
+		if (bReadFinished)
+		{
+			OutStatus.ReadMs += Record->ReadMs;
+			OutStatus.ImportMs += Record->ImportMs;
+		}
+
+		if (bIncludeItems)
+		{
+			FBulkImportItemStatus& ItemStatus = OutStatus.Items.AddDefaulted_GetRef();
+			ItemStatus.Item = Record->Item;
+			ItemStatus.State = State;
+			if (bReadFinished)
+			{
+				ItemStatus.Error = Record->Error;
+				ItemStatus.AssetPaths = Record->AssetPaths;
+				ItemStatus.ReadMs = Record->ReadMs;
+				ItemStatus.ImportMs = Record->ImportMs;
+			}
+		}
+	}
+}
+
+FMCPBatchJobCounts FBulkImportJob::GetCounts() const
+{
+	FBulkImportJobStatus Status;
+	GetStatus(Status, false);
+
+	FMCPBatchJobCounts Counts;
+	Counts.Total = Status.Total;
+	Counts.Succeeded = Status.Count(EBulkImportItemState::Succeeded);
+	Counts.Failed = Status.Count(EBulkImportItemState::Failed);
+	Counts.ElapsedMs = Status.ElapsedMs;
+	Counts.bComplete = Status.bComplete;
+	return Counts;
+}
+
+FBulkImportService& FBulkImportService::Get()
+{
+	static FBulkImportService Instance;
+	return Instance;
+}
+
+FBulkImportService::FBulkImportService()
+	: Jobs(TEXT("bulk_import"), TEXT("bulk_import"), TEXT("items"), TEXT("imported"))
+{
+}
+
+void FBulkImportService::Shutdown()
+{
+	Jobs.Shutdown();
+	DefaultBackend.Reset();
+}
+
+FString FBulkImportService::StartJob(TArray<FBulkImportItem>&& Items, const FBulkImportJobOptions& Options, TSharedPtr<IBulkImportBackend> Backend)
+{
+	check(IsInGameThread());
+
+	if (!Backend.IsValid())
+	{
+		if (!DefaultBackend.IsValid())
+		{
+			DefaultBackend = CreateBulkImportBackend();
+		}
+		Backend = DefaultBackend;
+	}
+
+	const FString JobId = Jobs.MakeJobId();
+	Jobs.Add(MakeShared<FBulkImportJob>(JobId, MoveTemp(Items), Options, Backend.ToSharedRef()));
+	return JobId;
+}
+
+bool FBulkImportService::CancelJob(const FString& JobId)
+{
+	return Jobs.Cancel(JobId);
+}
+
+bool FBulkImportService::GetJobStatus(const FString& JobId, FBulkImportJobStatus& OutStatus, bool bIncludeItems) const
+{
+	const FBulkImportJob* Job = Jobs.Find(JobId);
+	if (!Job)
+	{
+		return false;
+	}
+	Job->GetStatus(OutStatus, bIncludeItems);
+	return true;
+}
+
+int32 FBulkImportService::GetNumPendingCompiles() const
+{
+	return DefaultBackend.IsValid() ? DefaultBackend->GetNumPendingCompiles() : 0;
+}
@@ -645,7 +645,16 @@ bool FEditorService::SetActorTransform(AActor* Actor, const FVector* Location, c
         NewTransform.SetScale3D(*Scale);
     }
     
+    Actor->Modify();
     Actor->SetActorTransform(NewTransform);
+
+    // Same notifications as a viewport move: components refresh, and listeners such as the
+    // scene stats cache (which stores world-space instance locations) see the change
+    Actor->PostEditMove(true);
+    if (GEngine)
+    {
+        GEngine->BroadcastOnActorMoved(Actor);
+    }
     return true;
 }
 
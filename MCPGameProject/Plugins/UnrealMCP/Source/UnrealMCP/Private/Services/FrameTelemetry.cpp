@@ -0,0 +1,222 @@
+#include "Services/FrameTelemetry.h"
+
+#include "DynamicRHI.h"
+#include "Misc/App.h"
+#include "Misc/CoreDelegates.h"
+#include "RenderCore.h"
+#include "RHIStats.h"
+
+FFrameTelemetryRing::FFrameTelemetryRing(uint32 InCapacity)
+	: Capacity(FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(InCapacity, 2)))
+	, Mask(Capacity - 1)
+	, Slots(MakeUnique<FSlot[]>(Capacity))
+{
+}
+
+void FFrameTelemetryRing::Push(const FFrameTelemetrySample& Sample)
+{
+	const uint64 Index = WriteIndex.load(std::memory_order_relaxed);
+	FSlot& Slot = Slots[Index & Mask];
+
+	// Odd sequence marks the slot as being written; readers discard what they copy meanwhile
+	Slot.Sequence.store(Index * 2 + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	Slot.Sample = Sample;
+	Slot.Sequence.store(Index * 2 + 2, std::memory_order_release);
+
+	WriteIndex.store(Index + 1, std::memory_order_release);
+}
+
+void FFrameTelemetryRing::Snapshot(TArray<FFrameTelemetrySample>& OutSamples, double MinTimestampSeconds) const
+{
+	const uint64 End = WriteIndex.load(std::memory_order_acquire);
+	const uint64 Begin = End > Capacity ? End - Capacity : 0;
+
+	OutSamples.Reset(static_cast<int32>(End - Begin));
+	for (uint64 Index = Begin; Index < End; ++Index)
+	{
+		const FSlot& Slot = Slots[Index & Mask];
+		const uint64 ExpectedSequence = Index * 2 + 2;
+		if (Slot.Sequence.load(std::memory_order_acquire) != ExpectedSequence)
+		{
+			continue;
+		}
+
+		const FFrameTelemetrySample Copy = Slot.Sample;
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (Slot.Sequence.load(std::memory_order_relaxed) != ExpectedSequence)
+		{
+			continue;
+		}
+
+		if (Copy.TimestampSeconds >= MinTimestampSeconds)
+		{
+			OutSamples.Add(Copy);
+		}
+	}
+}
+
+namespace
+{
+template <typename ProjectionType>
+FFrameTelemetryChannelStats ComputeChannelStats(const TArray<FFrameTelemetrySample>& Samples, ProjectionType Projection)
+{
+	FFrameTelemetryChannelStats Stats;
+	if (Samples.Num() == 0)
+	{
+		return Stats;
+	}
+
+	TArray<double> Values;
+	Values.Reserve(Samples.Num());
+	double Sum = 0.0;
+	for (const FFrameTelemetrySample& Sample : Samples)
+	{
+		const double Value = Projection(Sample);
+		Values.Add(Value);
+		Sum += Value;
+	}
+	Values.Sort();
+
+	// Nearest-rank percentile
+	auto Percentile = [&Values](double Fraction)
+	{
+		const int32 Rank = FMath::CeilToInt(Fraction * Values.Num());
+		return Values[FMath::Clamp(Rank - 1, 0, Values.Num() - 1)];
+	};
+
+	Stats.P50 = Percentile(0.50);
+	Stats.P95 = Percentile(0.95);
+	Stats.P99 = Percentile(0.99);
+	Stats.Max = Values.Last();
+	Stats.Average = Sum / Values.Num();
+	return Stats;
+}
+
+FString ClassifyHitch(const FFrameTelemetrySample& Sample)
+{
+	FString BoundBy = TEXT("game");
+	float Longest = Sample.GameThreadMs;
+	if (Sample.RenderThreadMs > Longest)
+	{
+		BoundBy = TEXT("render");
+		Longest = Sample.RenderThreadMs;
+	}
+	if (Sample.RHIThreadMs > Longest)
+	{
+		BoundBy = TEXT("rhi");
+		Longest = Sample.RHIThreadMs;
+	}
+	if (Sample.GPUMs > Longest)
+	{
+		BoundBy = TEXT("gpu");
+	}
+	return BoundBy;
+}
+}
+
+FFrameTelemetry& FFrameTelemetry::Get()
+{
+	static FFrameTelemetry Instance;
+	return Instance;
+}
+
+void FFrameTelemetry::Initialize()
+{
+	if (!EndFrameHandle.IsValid())
+	{
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FFrameTelemetry::HandleEndFrame);
+	}
+	UE_LOG(LogTemp, Log, TEXT("FFrameTelemetry initialized (%u frame ring)"), Ring.GetCapacity());
+}
+
+void FFrameTelemetry::Shutdown()
+{
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	EndFrameHandle.Reset();
+}
+
+void FFrameTelemetry::HandleEndFrame()
+{
+	const double Now = FPlatformTime::Seconds();
+
+	FFrameTelemetrySample Sample;
+	Sample.FrameNumber = GFrameCounter;
+	Sample.TimestampSeconds = Now;
+	// Wall time between end-of-frame callbacks also catches stalls outside the engine tick (e.g. modal dialogs)
+	Sample.FrameMs = LastFrameTimestamp > 0.0
+		? static_cast<float>((Now - LastFrameTimestamp) * 1000.0)
+		: static_cast<float>(FApp::GetDeltaTime() * 1000.0);
+	Sample.GameThreadMs = FPlatformTime::ToMilliseconds(GGameThreadTime);
+	Sample.RenderThreadMs = FPlatformTime::ToMilliseconds(GRenderThreadTime);
+	Sample.RHIThreadMs = FPlatformTime::ToMilliseconds(GRHIThreadTime);
+	Sample.GPUMs = FPlatformTime::ToMilliseconds(RHIGetGPUFrameCycles(0));
+	Sample.DrawCalls = static_cast<uint32>(GNumDrawCallsRHI[0]);
+	Sample.Primitives = static_cast<uint32>(GNumPrimitivesDrawnRHI[0]);
+
+	LastFrameTimestamp = Now;
+	Ring.Push(Sample);
+}
+
+FFrameTelemetryReport FFrameTelemetry::BuildReport(const FFrameTelemetryQuery& Query, double NowSeconds) const
+{
+	TArray<FFrameTelemetrySample> Samples;
+	Ring.Snapshot(Samples, Query.WindowSeconds > 0.0 ? NowSeconds - Query.WindowSeconds : 0.0);
+	return BuildReport(Samples, Query);
+}
+
+FFrameTelemetryReport FFrameTelemetry::BuildReport(const TArray<FFrameTelemetrySample>& Samples, const FFrameTelemetryQuery& Query)
+{
+	FFrameTelemetryReport Report;
+	Report.SampleCount = Samples.Num();
+	Report.HistogramBucketMs = Query.HistogramBucketMs > 0.0 ? Query.HistogramBucketMs : 4.0;
+	Report.Histogram.SetNumZeroed(FMath::Max(Query.HistogramBuckets, 1));
+	if (Samples.Num() == 0)
+	{
+		Report.HitchThresholdMs = Query.HitchThresholdMs > 0.0 ? Query.HitchThresholdMs : MinHitchMs;
+		return Report;
+	}
+
+	Report.WindowSeconds = Samples.Last().TimestampSeconds - Samples[0].TimestampSeconds;
+
+	Report.FrameMs = ComputeChannelStats(Samples, [](const FFrameTelemetrySample& S) { return S.FrameMs; });
+	Report.GameThreadMs = ComputeChannelStats(Samples, [](const FFrameTelemetrySample& S) { return S.GameThreadMs; });
+	Report.RenderThreadMs = ComputeChannelStats(Samples, [](const FFrameTelemetrySample& S) { return S.RenderThreadMs; });
+	Report.RHIThreadMs = ComputeChannelStats(Samples, [](const FFrameTelemetrySample& S) { return S.RHIThreadMs; });
+	Report.GPUMs = ComputeChannelStats(Samples, [](const FFrameTelemetrySample& S) { return S.GPUMs; });
+	Report.DrawCalls = ComputeChannelStats(Samples, [](const FFrameTelemetrySample& S) { return static_cast<double>(S.DrawCalls); });
+	Report.Primitives = ComputeChannelStats(Samples, [](const FFrameTelemetrySample& S) { return static_cast<double>(S.Primitives); });
+
+	Report.HitchThresholdMs = Query.HitchThresholdMs > 0.0
+		? Query.HitchThresholdMs
+		: FMath::Max(MinHitchMs, Report.FrameMs.P50 * 2.0);
+
+	const int32 LastBucket = Report.Histogram.Num() - 1;
+	TArray<const FFrameTelemetrySample*> HitchSamples;
+	for (const FFrameTelemetrySample& Sample : Samples)
+	{
+		const int32 Bucket = FMath::Min(FMath::FloorToInt(Sample.FrameMs / Report.HistogramBucketMs), LastBucket);
+		++Report.Histogram[FMath::Max(Bucket, 0)];
+
+		if (Sample.FrameMs >= Report.HitchThresholdMs)
+		{
+			HitchSamples.Add(&Sample);
+		}
+	}
+
+	Report.HitchCount = HitchSamples.Num();
+
+	// Keep the worst hitches, then present them newest first
+	HitchSamples.Sort([](const FFrameTelemetrySample& A, const FFrameTelemetrySample& B) { return A.FrameMs > B.FrameMs; });
+	HitchSamples.SetNum(FMath::Min(HitchSamples.Num(), FMath::Max(Query.MaxHitches, 0)));
+	HitchSamples.Sort([](const FFrameTelemetrySample& A, const FFrameTelemetrySample& B) { return A.FrameNumber > B.FrameNumber; });
+
+	for (const FFrameTelemetrySample* Sample : HitchSamples)
+	{
+		FFrameTelemetryHitch& Hitch = Report.Hitches.AddDefaulted_GetRef();
+		Hitch.Sample = *Sample;
+		Hitch.BoundBy = ClassifyHitch(*Sample);
+	}
+
+	return Report;
+}
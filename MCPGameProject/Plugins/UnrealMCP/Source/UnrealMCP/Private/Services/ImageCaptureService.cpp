@@ -0,0 +1,412 @@
+#include "Services/ImageCaptureService.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "TextureResource.h"
+#include "RenderingThread.h"
+#include "RHICommandList.h"
+#include "RHIGPUReadback.h"
+#include "ImageUtils.h"
+#include "IImageWrapperModule.h"
+#include "Misc/Base64.h"
+#include "Misc/FileHelper.h"
+#include "Misc/SecureHash.h"
+#include "Modules/ModuleManager.h"
+#include "Async/Async.h"
+#include "UObject/Package.h"
+#include <atomic>
+
+namespace
+{
+    /** Idle targets kept per (size, format) and in total; captures rarely use more than a couple of sizes */
+    constexpr int32 MaxFreeRenderTargetsPerSize = 2;
+    constexpr int32 MaxFreeRenderTargets = 8;
+
+    /** Give up on a readback the GPU never completes (device lost, editor minimized for a long time...) */
+    constexpr double ReadbackTimeoutSeconds = 10.0;
+}
+
+struct FImageCaptureService::FPendingReadback
+{
+    TUniquePtr<FRHIGPUTextureReadback> Readback;
+    int32 Width = 0;
+    int32 Height = 0;
+    EPixelFormat Format = PF_Unknown;
+    FImageCaptureOptions Options;
+    FOnImageCaptured OnComplete;
+    UTextureRenderTarget2D* PooledTarget = nullptr;
+    TSharedPtr<void> KeepAlive;
+    double StartTime = 0.0;
+
+    /** Written by the render thread once the staging data has been copied into Pixels */
+    std::atomic<bool> bDataReady{false};
+
+    /** A poll command is queued on the render thread; don't queue another */
+    std::atomic<bool> bPollInFlight{false};
+
+    TArray<FColor> Pixels;
+};
+
+FImageCaptureService& FImageCaptureService::Get()
+{
+    static FImageCaptureService Instance;
+    return Instance;
+}
+
+void FImageCaptureService::Shutdown()
+{
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+
+    // Render commands may still reference pending readbacks; let them drain before the data goes away
+    FlushRenderingCommands();
+
+    // Callers (e.g. deferred bridge requests) wait on OnComplete; fail them now rather than leaving them to time out
+    TArray<TSharedPtr<FPendingReadback>> Abandoned = MoveTemp(PendingReadbacks);
+    PendingReadbacks.Reset();
+    for (const TSharedPtr<FPendingReadback>& Pending : Abandoned)
+    {
+        Pending->KeepAlive.Reset();
+
+        FImageCaptureResult Result;
+        Result.Error = TEXT("Capture abandoned: the plugin is shutting down");
+        Pending->OnComplete(MoveTemp(Result));
+    }
+    FreeRenderTargets.Empty();
+    RenderTargetsInUse.Empty();
+}
+
+uint64 FImageCaptureService::MakePoolKey(int32 Width, int32 Height, EPixelFormat Format)
+{
+    return (static_cast<uint64>(static_cast<uint16>(Width)) << 32) |
+        (static_cast<uint64>(static_cast<uint16>(Height)) << 16) |
+        static_cast<uint64>(static_cast<uint16>(Format));
+}
+
+bool FImageCaptureService::IsReadableFormat(EPixelFormat Format)
+{
+    return Format == PF_B8G8R8A8 || Format == PF_R8G8B8A8;
+}
+
+UTextureRenderTarget2D* FImageCaptureService::AcquireRenderTarget(int32 Width, int32 Height, EPixelFormat Format)
+{
+    check(IsInGameThread());
+
+    UTextureRenderTarget2D* RenderTarget = nullptr;
+
+    TArray<TStrongObjectPtr<UTextureRenderTarget2D>>* FreeList = FreeRenderTargets.Find(MakePoolKey(Width, Height, Format));
+    while (FreeList && FreeList->Num() > 0 && !RenderTarget)
+    {
+        TStrongObjectPtr<UTextureRenderTarget2D> Pooled = FreeList->Pop(EAllowShrinking::No);
+        if (Pooled.IsValid() && Pooled->GameThread_GetRenderTargetResource())
+        {
+            RenderTarget = Pooled.Get();
+            RenderTargetsInUse.Add(RenderTarget, MoveTemp(Pooled));
+        }
+    }
+
+    if (RenderTarget)
+    {
+        // A fresh target is cleared to ClearColor on creation; do the same for a reused one so
+        // draws that don't clear (FWidgetRenderer with bClearTarget=false) see identical input
+        FTextureRenderTargetResource* Resource = RenderTarget->GameThread_GetRenderTargetResource();
+        ENQUEUE_RENDER_COMMAND(MCPClearPooledRenderTarget)([Resource](FRHICommandListImmediate& RHICmdList)
+        {
+            FRHITexture* Texture = Resource->GetRenderTargetTexture();
+            if (!Texture)
+            {
+                return;
+            }
+            RHICmdList.Transition(FRHITransitionInfo(Texture, ERHIAccess::Unknown, ERHIAccess::RTV));
+            FRHIRenderPassInfo RPInfo(Texture, ERenderTargetActions::Clear_Store);
+            RHICmdList.BeginRenderPass(RPInfo, TEXT("MCPClearPooledRenderTarget"));
+            RHICmdList.EndRenderPass();
+            RHICmdList.Transition(FRHITransitionInfo(Texture, ERHIAccess::RTV, ERHIAccess::SRVMask));
+        });
+        return RenderTarget;
+    }
+
+    RenderTarget = NewObject<UTextureRenderTarget2D>(GetTransientPackage());
+    RenderTarget->InitCustomFormat(Width, Height, Format, true);
+    RenderTarget->UpdateResourceImmediate(true);
+    RenderTargetsInUse.Add(RenderTarget, TStrongObjectPtr<UTextureRenderTarget2D>(RenderTarget));
+
+    UE_LOG(LogTemp, Verbose, TEXT("FImageCaptureService: Created %dx%d render target (format %d)"), Width, Height, static_cast<int32>(Format));
+    return RenderTarget;
+}
+
+void FImageCaptureService::ReleaseRenderTarget(UTextureRenderTarget2D* RenderTarget)
+{
+    check(IsInGameThread());
+
+    TStrongObjectPtr<UTextureRenderTarget2D> Pooled;
+    if (!RenderTarget || !RenderTargetsInUse.RemoveAndCopyValue(RenderTarget, Pooled))
+    {
+        return;
+    }
+
+    int32 FreeCount = 0;
+    for (const TPair<uint64, TArray<TStrongObjectPtr<UTextureRenderTarget2D>>>& Pair : FreeRenderTargets)
+    {
+        FreeCount += Pair.Value.Num();
+    }
+
+    TArray<TStrongObjectPtr<UTextureRenderTarget2D>>& FreeList = FreeRenderTargets.FindOrAdd(
+        MakePoolKey(RenderTarget->SizeX, RenderTarget->SizeY, RenderTarget->GetFormat()));
+    if (FreeList.Num() < MaxFreeRenderTargetsPerSize && FreeCount < MaxFreeRenderTargets)
+    {
+        FreeList.Add(MoveTemp(Pooled));
+    }
+    // Otherwise the strong pointer goes out of scope and GC reclaims the target
+}
+
+void FImageCaptureService::ReadbackRenderTarget(UTextureRenderTarget2D* RenderTarget, const FImageCaptureOptions& Options,
+                                                FOnImageCaptured OnComplete, TSharedPtr<void> KeepAlive)
+{
+    check(IsInGameThread());
+
+    FTextureRenderTargetResource* Resource = RenderTarget ? RenderTarget->GameThread_GetRenderTargetResource() : nullptr;
+    if (!Resource || !IsReadableFormat(RenderTarget->GetFormat()))
+    {
+        ReleaseRenderTarget(RenderTarget);
+        FImageCaptureResult Result;
+        Result.Error = TEXT("Render target cannot be read back");
+        OnComplete(MoveTemp(Result));
+        return;
+    }
+
+    StartReadback([Resource]() -> FRHITexture* { return Resource->GetRenderTargetTexture(); },
+        RenderTarget->SizeX, RenderTarget->SizeY, RenderTarget->GetFormat(),
+        Options, MoveTemp(OnComplete), RenderTarget, MoveTemp(KeepAlive));
+}
+
+bool FImageCaptureService::ReadbackTexture(const FTextureRHIRef& Texture, const FImageCaptureOptions& Options, FOnImageCaptured OnComplete)
+{
+    check(IsInGameThread());
+
+    if (!Texture.IsValid() || !IsReadableFormat(Texture->GetFormat()) || Texture->IsMultisampled())
+    {
+        return false;
+    }
+
+    const FIntPoint Size = Texture->GetSizeXY();
+    FTextureRHIRef SourceTexture = Texture;
+    StartReadback([SourceTexture]() -> FRHITexture* { return SourceTexture.GetReference(); },
+        Size.X, Size.Y, Texture->GetFormat(), Options, MoveTemp(OnComplete), nullptr, nullptr);
+    return true;
+}
+
+void FImageCaptureService::StartReadback(TFunction<FRHITexture*()> ResolveSourceTexture, int32 Width, int32 Height, EPixelFormat Format,
+                                         const FImageCaptureOptions& Options, FOnImageCaptured OnComplete,
+                                         UTextureRenderTarget2D* PooledTarget, TSharedPtr<void> KeepAlive)
+{
+    // Compression runs on a worker; make sure the image wrapper module is loaded from the game thread first
+    FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+
+    TSharedPtr<FPendingReadback> Pending = MakeShared<FPendingReadback>();
+    Pending->Readback = MakeUnique<FRHIGPUTextureReadback>(TEXT("MCPImageCapture"));
+    Pending->Width = Width;
+    Pending->Height = Height;
+    Pending->Format = Format;
+    Pending->Options = Options;
+    Pending->OnComplete = MoveTemp(OnComplete);
+    Pending->PooledTarget = PooledTarget;
+    Pending->KeepAlive = MoveTemp(KeepAlive);
+    Pending->StartTime = FPlatformTime::Seconds();
+
+    FRHIGPUTextureReadback* Readback = Pending->Readback.Get();
+    ENQUEUE_RENDER_COMMAND(MCPImageCaptureCopy)([Readback, ResolveSourceTexture = MoveTemp(ResolveSourceTexture), Width, Height](FRHICommandListImmediate& RHICmdList)
+    {
+        FRHITexture* SourceTexture = ResolveSourceTexture();
+        if (!SourceTexture)
+        {
+            return;
+        }
+        RHICmdList.Transition(FRHITransitionInfo(SourceTexture, ERHIAccess::Unknown, ERHIAccess::CopySrc));
+        Readback->EnqueueCopy(RHICmdList, SourceTexture, FResolveRect(0, 0, Width, Height));
+        RHICmdList.Transition(FRHITransitionInfo(SourceTexture, ERHIAccess::CopySrc, ERHIAccess::SRVMask));
+    });
+
+    PendingReadbacks.Add(Pending);
+    EnsureTicking();
+}
+
+void FImageCaptureService::EnsureTicking()
+{
+    if (!TickerHandle.IsValid())
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FImageCaptureService::TickReadbacks));
+    }
+}
+
+bool FImageCaptureService::TickReadbacks(float DeltaTime)
+{
+    const double Now = FPlatformTime::Seconds();
+
+    for (int32 Index = PendingReadbacks.Num() - 1; Index >= 0; --Index)
+    {
+        TSharedPtr<FPendingReadback> Pending = PendingReadbacks[Index];
+
+        if (Pending->bDataReady)
+        {
+            PendingReadbacks.RemoveAtSwap(Index);
+
+            // The GPU copy has been consumed; the target and any draw payload can be reused/freed
+            ReleaseRenderTarget(Pending->PooledTarget);
+            Pending->KeepAlive.Reset();
+
+            EncodeAsync(MoveTemp(Pending->Pixels), Pending->Width, Pending->Height, Pending->Options,
+                [Pending, OnComplete = MoveTemp(Pending->OnComplete)](FImageCaptureResult&& Result)
+                {
+                    Result.ElapsedMs = (FPlatformTime::Seconds() - Pending->StartTime) * 1000.0;
+                    OnComplete(MoveTemp(Result));
+                });
+            continue;
+        }
+
+        if (Pending->bPollInFlight)
+        {
+            continue;
+        }
+
+        if (Now - Pending->StartTime > ReadbackTimeoutSeconds)
+        {
+            PendingReadbacks.RemoveAtSwap(Index);
+
+            // The copy out of the target may still be in flight on the GPU; a pooled target could be
+            // handed out and cleared underneath it, so unroot it for GC instead of returning it
+            if (Pending->PooledTarget)
+            {
+                RenderTargetsInUse.Remove(Pending->PooledTarget);
+            }
+            Pending->KeepAlive.Reset();
+
+            UE_LOG(LogTemp, Error, TEXT("FImageCaptureService: GPU readback timed out after %.0f seconds"), ReadbackTimeoutSeconds);
+            FImageCaptureResult Result;
+            Result.Error = FString::Printf(TEXT("GPU readback timed out after %.0f seconds"), ReadbackTimeoutSeconds);
+            Pending->OnComplete(MoveTemp(Result));
+            continue;
+        }
+
+        // IsReady/Lock touch the RHI, so poll from the render thread; the result is picked up next tick
+        Pending->bPollInFlight = true;
+        ENQUEUE_RENDER_COMMAND(MCPImageCapturePoll)([Pending](FRHICommandListImmediate& RHICmdList)
+        {
+            if (Pending->Readback->IsReady())
+            {
+                int32 RowPitchInPixels = 0;
+                const FColor* Data = static_cast<const FColor*>(Pending->Readback->Lock(RowPitchInPixels));
+                if (Data)
+                {
+                    const int32 Width = Pending->Width;
+                    const int32 Height = Pending->Height;
+                    Pending->Pixels.SetNumUninitialized(Width * Height);
+                    for (int32 Row = 0; Row < Height; ++Row)
+                    {
+                        FMemory::Memcpy(&Pending->Pixels[Row * Width], Data + Row * RowPitchInPixels, Width * sizeof(FColor));
+                    }
+                    Pending->Readback->Unlock();
+
+                    if (Pending->Format == PF_R8G8B8A8)
+                    {
+                        for (FColor& Pixel : Pending->Pixels)
+                        {
+                            Swap(Pixel.R, Pixel.B);
+                        }
+                    }
+                }
+                Pending->bDataReady = true;
+            }
+            Pending->bPollInFlight = false;
+        });
+    }
+
+    if (PendingReadbacks.Num() == 0)
+    {
+        TickerHandle.Reset();
+        return false;
+    }
+    return true;
+}
+
+void FImageCaptureService::EncodeAsync(TArray<FColor>&& Pixels, int32 Width, int32 Height, const FImageCaptureOptions& Options,
+                                       FOnImageCaptured OnComplete)
+{
+    FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
+        [Pixels = MoveTemp(Pixels), Width, Height, Options, OnComplete = MoveTemp(OnComplete)]() mutable
+        {
+            TSharedPtr<FImageCaptureResult> Result = MakeShared<FImageCaptureResult>();
+            if (Pixels.Num() != Width * Height)
+            {
+                Result->Error = TEXT("GPU readback returned no pixel data");
+            }
+            else
+            {
+                EncodePixels(Pixels, Width, Height, Options, *Result);
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [Result, OnComplete = MoveTemp(OnComplete)]()
+            {
+                OnComplete(MoveTemp(*Result));
+            });
+        });
+}
+
+void FImageCaptureService::EncodePixels(TArray<FColor>& Pixels, int32 Width, int32 Height, const FImageCaptureOptions& Options,
+                                        FImageCaptureResult& OutResult)
+{
+    OutResult.Width = Width;
+    OutResult.Height = Height;
+
+    if (Options.bForceOpaque)
+    {
+        for (FColor& Pixel : Pixels)
+        {
+            Pixel.A = 255;
+        }
+    }
+
+    const FString RequestedFormat = Options.Format.ToLower();
+    if (RequestedFormat == TEXT("jpg") || RequestedFormat == TEXT("jpeg"))
+    {
+        OutResult.Format = TEXT("jpg");
+        TArray<uint8> Compressed;
+        FImageUtils::ThumbnailCompressImageArray(Width, Height, Pixels, Compressed);
+        OutResult.EncodedBytes.Append(Compressed.GetData(), Compressed.Num());
+    }
+    else
+    {
+        OutResult.Format = TEXT("png");
+        FImageUtils::PNGCompressImageArray(Width, Height, TArrayView64<const FColor>(Pixels), OutResult.EncodedBytes);
+    }
+
+    if (OutResult.EncodedBytes.Num() == 0)
+    {
+        OutResult.Error = FString::Printf(TEXT("Failed to compress image to %s"), *OutResult.Format.ToUpper());
+        return;
+    }
+
+    if (Options.bComputeHash)
+    {
+        FSHAHash Hash;
+        FSHA1::HashBuffer(OutResult.EncodedBytes.GetData(), OutResult.EncodedBytes.Num(), Hash.Hash);
+        OutResult.Sha1 = Hash.ToString().ToLower();
+    }
+
+    if (Options.bEncodeBase64)
+    {
+        OutResult.Base64 = FBase64::Encode(OutResult.EncodedBytes.GetData(), OutResult.EncodedBytes.Num());
+    }
+
+    if (!Options.OutputFilePath.IsEmpty() && !FFileHelper::SaveArrayToFile(OutResult.EncodedBytes, *Options.OutputFilePath))
+    {
+        OutResult.Error = FString::Printf(TEXT("Failed to save screenshot to: %s"), *Options.OutputFilePath);
+        return;
+    }
+
+    OutResult.bSuccess = true;
+}
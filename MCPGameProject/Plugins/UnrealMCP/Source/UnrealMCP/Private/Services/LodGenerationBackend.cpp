@@ -0,0 +1,240 @@
+#include "Services/ILodGenerationBackend.h"
+
+#include "Async/ParallelFor.h"
+#include "Engine/StaticMesh.h"
+#include "IMeshReductionInterfaces.h"
+#include "IMeshReductionManagerModule.h"
+#include "Modules/ModuleManager.h"
+#include "OverlappingCorners.h"
+#include "StaticMeshAttributes.h"
+#include "StaticMeshOperations.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+float FLodGenerationRequest::ResolvePercentTriangles(int32 LodIndex) const
+{
+	if (PercentTriangles.IsValidIndex(LodIndex))
+	{
+		return FMath::Clamp(PercentTriangles[LodIndex], 0.01f, 1.0f);
+	}
+	// Same default auto_generate_lods always used: evenly spaced, never below 5%
+	return FMath::Max(0.05f, 1.0f - (float)LodIndex / (float)FMath::Max(LodCount, 1));
+}
+
+void FLodGenerationPayload::PlanLods(const FLodGenerationRequest& Request)
+{
+	Lods.Reset(Request.LodCount);
+	for (int32 LodIndex = 0; LodIndex < Request.LodCount; ++LodIndex)
+	{
+		FLodGenerationLodStats& Stats = Lods.AddDefaulted_GetRef();
+		Stats.LodIndex = LodIndex;
+		const bool bKept = LodIndex == 0 || (Request.bKeepExistingLods && LodIndex < PreviousLodCount);
+		Stats.bGenerated = !bKept;
+		if (LodIndex > 0 || !Request.bKeepExistingLods)
+		{
+			Stats.PercentTriangles = Request.ResolvePercentTriangles(LodIndex);
+		}
+	}
+}
+
+int32 FLodGenerationPayload::NumGenerated() const
+{
+	int32 Count = 0;
+	for (const FLodGenerationLodStats& Stats : Lods)
+	{
+		Count += Stats.bGenerated ? 1 : 0;
+	}
+	return Count;
+}
+
+namespace
+{
+class FEngineLodGenerationBackend final : public ILodGenerationBackend
+{
+public:
+	FEngineLodGenerationBackend()
+	{
+		// Module loading must happen on the game thread; workers only use the interface
+		IMeshReductionManagerModule& ReductionModule = FModuleManager::Get().LoadModuleChecked<IMeshReductionManagerModule>(TEXT("MeshReductionInterface"));
+		Reduction = ReductionModule.GetStaticMeshReductionInterface();
+	}
+
+	virtual bool PrepareSource(const FLodGenerationRequest& Request, FLodGenerationPayload& Payload, FString& OutError) override
+	{
+		UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *Request.MeshPath);
+		if (!Mesh)
+		{
+			OutError = FString::Printf(TEXT("Mesh not found: %s"), *Request.MeshPath);
+			return false;
+		}
+
+		const FMeshDescription* LOD0 = Mesh->GetMeshDescription(0);
+		if (!LOD0)
+		{
+			OutError = FString::Printf(TEXT("LOD0 of %s has no source geometry"), *Request.MeshPath);
+			return false;
+		}
+
+		Payload.Mesh = Mesh;
+		Payload.PreviousLodCount = Mesh->GetNumSourceModels();
+		Payload.SourceTriangles = LOD0->Triangles().Num();
+		Payload.PlanLods(Request);
+
+		for (FLodGenerationLodStats& Stats : Payload.Lods)
+		{
+			if (!Stats.bGenerated && Mesh->GetRenderData() && Stats.LodIndex < Mesh->GetNumLODs())
+			{
+				Stats.Triangles = Stats.LodIndex == 0 ? Payload.SourceTriangles : Mesh->GetNumTriangles(Stats.LodIndex);
+				Stats.Vertices = Mesh->GetNumVertices(Stats.LodIndex);
+			}
+		}
+
+		if (Payload.NumGenerated() > 0)
+		{
+			if (!Reduction || !Reduction->IsSupported())
+			{
+				OutError = TEXT("No static mesh reduction module is available");
+				return false;
+			}
+			// The only copy of source geometry the job makes; workers never touch the UObject
+			Payload.Source = *LOD0;
+		}
+		return true;
+	}
+
+	virtual bool Reduce(const FLodGenerationRequest& Request, FLodGenerationPayload& Payload, FString& OutError) override
+	{
+		if (Payload.NumGenerated() == 0)
+		{
+			return true;
+		}
+
+		FOverlappingCorners OverlappingCorners;
+		FStaticMeshOperations::FindOverlappingCorners(OverlappingCorners, Payload.Source, THRESH_POINTS_ARE_SAME);
+
+		TArray<int32> Generated;
+		for (const FLodGenerationLodStats& Stats : Payload.Lods)
+		{
+			if (Stats.bGenerated)
+			{
+				Generated.Add(Stats.LodIndex);
+			}
+		}
+
+		// LODs of one mesh all reduce from the same read-only source, so they run side by side
+		Payload.Reduced.SetNum(Payload.Lods.Num());
+		ParallelFor(Generated.Num(), [this, &Payload, &Generated, &OverlappingCorners](int32 Index)
+		{
+			FLodGenerationLodStats& Stats = Payload.Lods[Generated[Index]];
+			FMeshDescription& Reduced = Payload.Reduced[Stats.LodIndex];
+			FStaticMeshAttributes(Reduced).Register();
+
+			FMeshReductionSettings Settings;
+			Settings.PercentTriangles = Stats.PercentTriangles;
+			float MaxDeviation = 0.0f;
+			Reduction->ReduceMeshDescription(Reduced, MaxDeviation, Payload.Source, OverlappingCorners, Settings);
+
+			Stats.Triangles = Reduced.Triangles().Num();
+			Stats.Vertices = Reduced.Vertices().Num();
+			Stats.MaxDeviation = MaxDeviation;
+		});
+
+		for (const int32 LodIndex : Generated)
+		{
+			if (Payload.Lods[LodIndex].Triangles == 0)
+			{
+				OutError = FString::Printf(TEXT("Reduction of LOD%d produced no triangles"), LodIndex);
+				return false;
+			}
+		}
+		return true;
+	}
+
+	virtual bool Commit(const FLodGenerationRequest& Request, FLodGenerationPayload& Payload, FString& OutError) override
+	{
+		UStaticMesh* Mesh = Payload.Mesh.Get();
+		if (!Mesh)
+		{
+			OutError = FString::Printf(TEXT("%s was unloaded before its LODs were committed"), *Request.MeshPath);
+			return false;
+		}
+
+		Mesh->Modify();
+		Mesh->SetNumSourceModels(Request.LodCount);
+		if (!Request.bKeepExistingLods)
+		{
+			Mesh->GetSourceModel(0).ReductionSettings.PercentTriangles = Payload.Lods[0].PercentTriangles;
+		}
+
+		const FMeshBuildSettings BaseBuildSettings = Mesh->GetSourceModel(0).BuildSettings;
+		for (const FLodGenerationLodStats& Stats : Payload.Lods)
+		{
+			if (!Stats.bGenerated)
+			{
+				continue;
+			}
+			FStaticMeshSourceModel& SourceModel = Mesh->GetSourceModel(Stats.LodIndex);
+			SourceModel.BuildSettings = BaseBuildSettings;
+			// Geometry is already reduced; the build must not reduce it again
+			SourceModel.ReductionSettings = FMeshReductionSettings();
+			Mesh->CreateMeshDescription(Stats.LodIndex, MoveTemp(Payload.Reduced[Stats.LodIndex]));
+			Mesh->CommitMeshDescription(Stats.LodIndex);
+		}
+
+		Mesh->bAutoComputeLODScreenSize = true;
+		// With async static mesh compilation this queues the build and returns
+		Mesh->PostEditChange();
+		Mesh->MarkPackageDirty();
+		return true;
+	}
+
+	virtual bool IsBuilding(const FLodGenerationPayload& Payload) const override
+	{
+		const UStaticMesh* Mesh = Payload.Mesh.Get();
+		return Mesh && Mesh->IsCompiling();
+	}
+
+	virtual bool Finalize(const FLodGenerationRequest& Request, FLodGenerationPayload& Payload, FString& OutError) override
+	{
+		UStaticMesh* Mesh = Payload.Mesh.Get();
+		if (!Mesh)
+		{
+			OutError = FString::Printf(TEXT("%s was unloaded before it was saved"), *Request.MeshPath);
+			return false;
+		}
+
+		if (Request.bSave)
+		{
+			UPackage* Package = Mesh->GetOutermost();
+			const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+			FSavePackageArgs SaveArgs;
+			SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+			if (!UPackage::SavePackage(Package, Mesh, *Filename, SaveArgs))
+			{
+				OutError = FString::Printf(TEXT("LODs built but failed to save %s"), *Filename);
+				return false;
+			}
+		}
+
+		for (FLodGenerationLodStats& Stats : Payload.Lods)
+		{
+			if (Stats.LodIndex < Mesh->GetNumLODs())
+			{
+				Stats.RenderTriangles = Mesh->GetNumTriangles(Stats.LodIndex);
+				Stats.RenderVertices = Mesh->GetNumVertices(Stats.LodIndex);
+			}
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("Generated %d LOD(s) for %s (%d total)"), Payload.NumGenerated(), *Request.MeshPath, Mesh->GetNumLODs());
+		return true;
+	}
+
+private:
+	IMeshReduction* Reduction = nullptr;
+};
+}
+
+TSharedRef<ILodGenerationBackend> CreateLodGenerationBackend()
+{
+	return MakeShared<FEngineLodGenerationBackend>();
+}
@@ -0,0 +1,378 @@
+#include "Services/LodGenerationService.h"
+
+#include "Async/Async.h"
+#include "Dom/JsonObject.h"
+
+namespace
+{
+constexpr int32 MaxLodJobMeshes = 500;
+}
+
+FLodGenerationJob::FLodGenerationJob(FString InJobId, TArray<FLodGenerationRequest>&& InRequests, const FLodGenerationJobOptions& InOptions, TSharedRef<ILodGenerationBackend> InBackend)
+	: JobId(MoveTemp(InJobId))
+	, Options(InOptions)
+	, Backend(MoveTemp(InBackend))
+	, StartSeconds(FPlatformTime::Seconds())
+	, bCancelled(MakeShared<std::atomic<bool>>(false))
+{
+	Options.MaxConcurrentReductions = FMath::Max(Options.MaxConcurrentReductions, 1);
+	Meshes.Reserve(InRequests.Num());
+	for (FLodGenerationRequest& Request : InRequests)
+	{
+		TSharedRef<FMeshRecord> Record = MakeShared<FMeshRecord>();
+		Record->Request = MoveTemp(Request);
+		Meshes.Add(Record);
+	}
+	if (Meshes.Num() == 0)
+	{
+		bComplete = true;
+		EndSeconds = StartSeconds;
+	}
+}
+
+void FLodGenerationJob::Fail(FMeshRecord& Record, const FString& Error)
+{
+	Record.Payload.ReleaseMeshData();
+	Record.Error = Error;
+	Record.SetState(ELodGenerationState::Failed);
+}
+
+void FLodGenerationJob::StartReduction(const TSharedRef<FMeshRecord>& Record)
+{
+	Record->SetState(ELodGenerationState::Reducing);
+
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Record, Backend = Backend, bCancelled = bCancelled]()
+	{
+		if (bCancelled->load(std::memory_order_relaxed))
+		{
+			Record->Payload.ReleaseMeshData();
+			Record->Error = TEXT("Cancelled");
+			Record->SetState(ELodGenerationState::Failed);
+			return;
+		}
+
+		const double ReduceStart = FPlatformTime::Seconds();
+		FString Error;
+		const bool bReduced = Backend->Reduce(Record->Request, Record->Payload, Error);
+		Record->ReduceMs = (FPlatformTime::Seconds() - ReduceStart) * 1000.0;
+
+		// The source copy is no longer needed either way; free it before the commit waits its turn
+		Record->Payload.Source = FMeshDescription();
+		if (!bReduced || bCancelled->load(std::memory_order_relaxed))
+		{
+			Record->Payload.ReleaseMeshData();
+			Record->Error = bReduced ? FString(TEXT("Cancelled")) : Error;
+			Record->SetState(ELodGenerationState::Failed);
+			return;
+		}
+		Record->SetState(ELodGenerationState::Reduced);
+	});
+}
+
+int32 FLodGenerationJob::Tick()
+{
+	if (bComplete)
+	{
+		return 0;
+	}
+	++TickCount;
+
+	const double TickStart = FPlatformTime::Seconds();
+	const double BudgetSeconds = Options.FrameBudgetMs / 1000.0;
+	int32 Steps = 0;
+
+	// Always make progress, even when a single step exceeds the budget
+	auto HasBudget = [&Steps, TickStart, BudgetSeconds]()
+	{
+		return Steps == 0 || FPlatformTime::Seconds() - TickStart < BudgetSeconds;
+	};
+
+	// Save finished builds first so packages land on disk as early as possible
+	for (const TSharedRef<FMeshRecord>& Record : Meshes)
+	{
+		if (Record->GetState() != ELodGenerationState::Building || Backend->IsBuilding(Record->Payload))
+		{
+			continue;
+		}
+		if (!HasBudget())
+		{
+			break;
+		}
+
+		Record->BuildMs = (FPlatformTime::Seconds() - Record->BuildStartSeconds) * 1000.0;
+		const double FinalizeStart = FPlatformTime::Seconds();
+		FString Error;
+		const bool bFinalized = Backend->Finalize(Record->Request, Record->Payload, Error);
+		Record->FinalizeMs = (FPlatformTime::Seconds() - FinalizeStart) * 1000.0;
+		if (bFinalized)
+		{
+			Record->SetState(ELodGenerationState::Succeeded);
+		}
+		else
+		{
+			Fail(*Record, Error);
+		}
+		++Steps;
+	}
+
+	// Commit in whatever order reductions finish; each mesh is independent
+	int32 InFlight = 0;
+	for (const TSharedRef<FMeshRecord>& Record : Meshes)
+	{
+		const ELodGenerationState State = Record->GetState();
+		if (State == ELodGenerationState::Reducing)
+		{
+			++InFlight;
+			continue;
+		}
+		if (State != ELodGenerationState::Reduced)
+		{
+			continue;
+		}
+		if (bCancelled->load(std::memory_order_relaxed))
+		{
+			// Reduction finished after the job was cancelled; never commit it
+			Fail(*Record, TEXT("Cancelled"));
+			continue;
+		}
+		if (!HasBudget())
+		{
+			++InFlight;
+			continue;
+		}
+
+		const double CommitStart = FPlatformTime::Seconds();
+		FString Error;
+		const bool bCommitted = Backend->Commit(Record->Request, Record->Payload, Error);
+		Record->CommitMs = (FPlatformTime::Seconds() - CommitStart) * 1000.0;
+		Record->Payload.ReleaseMeshData();
+		if (bCommitted)
+		{
+			Record->BuildStartSeconds = FPlatformTime::Seconds();
+			Record->SetState(ELodGenerationState::Building);
+		}
+		else
+		{
+			Fail(*Record, Error);
+		}
+		++Steps;
+	}
+
+	// Copy LOD0 of the next meshes and hand them to workers. Reduced payloads waiting for a
+	// commit count against the limit, so mesh copies never pile up faster than they are consumed
+	while (NextToPrepare < Meshes.Num() && InFlight < Options.MaxConcurrentReductions && HasBudget())
+	{
+		const TSharedRef<FMeshRecord>& Record = Meshes[NextToPrepare++];
+		const double PrepareStart = FPlatformTime::Seconds();
+		FString Error;
+		const bool bPrepared = Backend->PrepareSource(Record->Request, Record->Payload, Error);
+		Record->PrepareMs = (FPlatformTime::Seconds() - PrepareStart) * 1000.0;
+		++Steps;
+		if (!bPrepared)
+		{
+			Fail(*Record, Error);
+			continue;
+		}
+		StartReduction(Record);
+		++InFlight;
+	}
+
+	bool bAllFinished = NextToPrepare >= Meshes.Num();
+	for (int32 Index = 0; bAllFinished && Index < Meshes.Num(); ++Index)
+	{
+		const ELodGenerationState State = Meshes[Index]->GetState();
+		bAllFinished = State == ELodGenerationState::Succeeded || State == ELodGenerationState::Failed;
+	}
+	if (bAllFinished)
+	{
+		bComplete = true;
+		EndSeconds = FPlatformTime::Seconds();
+	}
+	return Steps;
+}
+
+void FLodGenerationJob::Cancel()
+{
+	bCancelled->store(true, std::memory_order_relaxed);
+	for (const TSharedRef<FMeshRecord>& Record : Meshes)
+	{
+		const ELodGenerationState State = Record->GetState();
+		if (State == ELodGenerationState::Queued || State == ELodGenerationState::Reduced)
+		{
+			Fail(*Record, TEXT("Cancelled"));
+		}
+		else if (State == ELodGenerationState::Building)
+		{
+			// Geometry is already in the mesh; only the save is skipped
+			Fail(*Record, TEXT("Cancelled before save"));
+		}
+	}
+	NextToPrepare = Meshes.Num();
+
+	// Reductions still running fail themselves on their worker; the job completes on the first
+	// tick after the last of them lands, so no worker still owns one of its meshes
+}
+
+void FLodGenerationJob::GetStatus(FLodGenerationJobStatus& OutStatus, bool bIncludeMeshes) const
+{
+	OutStatus = FLodGenerationJobStatus();
+	OutStatus.JobId = JobId;
+	OutStatus.bComplete = bComplete;
+	OutStatus.Total = Meshes.Num();
+	OutStatus.Ticks = TickCount;
+	OutStatus.ElapsedMs = ((bComplete ? EndSeconds : FPlatformTime::Seconds()) - StartSeconds) * 1000.0;
+
+	if (bIncludeMeshes)
+	{
+		OutStatus.Meshes.Reserve(Meshes.Num());
+	}
+
+	for (const TSharedRef<FMeshRecord>& Record : Meshes)
+	{
+		const ELodGenerationState State = Record->GetState();
+		++OutStatus.Counts[static_cast<int32>(State)];
+
+		// Worker-owned fields are only stable once the reduction has finished
+		const bool bStable = State != ELodGenerationState::Reducing;
+		if (bStable)
+		{
+			OutStatus.ReduceMs += Record->ReduceMs;
+			OutStatus.GameThreadMs += Record->PrepareMs + Record->CommitMs + Record->FinalizeMs;
+		}
+
+		if (bIncludeMeshes)
+		{
+			FLodGenerationMeshStatus& MeshStatus = OutStatus.Meshes.AddDefaulted_GetRef();
+			MeshStatus.Request = Record->Request;
+			MeshStatus.State = State;
+			MeshStatus.PrepareMs = Record->PrepareMs;
+			if (bStable)
+			{
+				MeshStatus.Error = Record->Error;
+				MeshStatus.PreviousLodCount = Record->Payload.PreviousLodCount;
+				MeshStatus.SourceTriangles = Record->Payload.SourceTriangles;
+				MeshStatus.Lods = Record->Payload.Lods;
+				MeshStatus.ReduceMs = Record->ReduceMs;
+				MeshStatus.CommitMs = Record->CommitMs;
+				MeshStatus.BuildMs = State == ELodGenerationState::Building
+					? (FPlatformTime::Seconds() - Record->BuildStartSeconds) * 1000.0
+					: Record->BuildMs;
+				MeshStatus.FinalizeMs = Record->FinalizeMs;
+			}
+		}
+	}
+}
+
+FMCPBatchJobCounts FLodGenerationJob::GetCounts() const
+{
+	FLodGenerationJobStatus Status;
+	GetStatus(Status, false);
+
+	FMCPBatchJobCounts Counts;
+	Counts.Total = Status.Total;
+	Counts.Succeeded = Status.Count(ELodGenerationState::Succeeded);
+	Counts.Failed = Status.Count(ELodGenerationState::Failed);
+	Counts.ElapsedMs = Status.ElapsedMs;
+	Counts.bComplete = Status.bComplete;
+	return Counts;
+}
+
+FLodGenerationService& FLodGenerationService::Get()
+{
+	static FLodGenerationService Instance;
+	return Instance;
+}
+
+FLodGenerationService::FLodGenerationService()
+	: Jobs(TEXT("lod_job"), TEXT("lod_generation"), TEXT("meshes"), TEXT("processed"))
+{
+}
+
+void FLodGenerationService::Shutdown()
+{
+	Jobs.Shutdown();
+	DefaultBackend.Reset();
+}
+
+FString FLodGenerationService::StartJob(TArray<FLodGenerationRequest>&& Requests, const FLodGenerationJobOptions& Options, TSharedPtr<ILodGenerationBackend> Backend)
+{
+	check(IsInGameThread());
+
+	if (!Backend.IsValid())
+	{
+		if (!DefaultBackend.IsValid())
+		{
+			DefaultBackend = CreateLodGenerationBackend();
+		}
+		Backend = DefaultBackend;
+	}
+
+	const FString JobId = Jobs.MakeJobId();
+	Jobs.Add(MakeShared<FLodGenerationJob>(JobId, MoveTemp(Requests), Options, Backend.ToSharedRef()));
+	return JobId;
+}
+
+bool FLodGenerationService::CancelJob(const FString& JobId)
+{
+	return Jobs.Cancel(JobId);
+}
+
+bool FLodGenerationService::GetJobStatus(const FString& JobId, FLodGenerationJobStatus& OutStatus, bool bIncludeMeshes) const
+{
+	const FLodGenerationJob* Job = Jobs.Find(JobId);
+	if (!Job)
+	{
+		return false;
+	}
+	Job->GetStatus(OutStatus, bIncludeMeshes);
+	return true;
+}
+
+bool FLodGenerationService::ParseJobTargets(const FJsonObject& JsonObject, TArray<FString>& OutMeshPaths, FLodGenerationJobOptions& OutOptions, bool& bOutSave, FString& OutError)
+{
+	OutMeshPaths.Reset();
+
+	FString MeshPath;
+	if (JsonObject.TryGetStringField(TEXT("mesh_path"), MeshPath) && !MeshPath.IsEmpty())
+	{
+		OutMeshPaths.Add(MeshPath);
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* MeshPaths = nullptr;
+	if (JsonObject.TryGetArrayField(TEXT("mesh_paths"), MeshPaths))
+	{
+		for (int32 Index = 0; Index < MeshPaths->Num(); ++Index)
+		{
+			FString Path;
+			if (!(*MeshPaths)[Index]->TryGetString(Path) || Path.IsEmpty())
+			{
+				OutError = FString::Printf(TEXT("mesh_paths[%d]: expected a non-empty string"), Index);
+				return false;
+			}
+			OutMeshPaths.AddUnique(Path);
+		}
+	}
+
+	if (OutMeshPaths.Num() == 0)
+	{
+		OutError = TEXT("Missing required parameter: mesh_path or mesh_paths");
+		return false;
+	}
+	if (OutMeshPaths.Num() > MaxLodJobMeshes)
+	{
+		OutError = FString::Printf(TEXT("Too many meshes: %d (max %d per job)"), OutMeshPaths.Num(), MaxLodJobMeshes);
+		return false;
+	}
+
+	bOutSave = true;
+	JsonObject.TryGetBoolField(TEXT("save"), bOutSave);
+
+	double FrameBudgetMs = OutOptions.FrameBudgetMs;
+	JsonObject.TryGetNumberField(TEXT("frame_budget_ms"), FrameBudgetMs);
+	OutOptions.FrameBudgetMs = FMath::Clamp(FrameBudgetMs, 1.0, 100.0);
+
+	int32 MaxConcurrentReductions = OutOptions.MaxConcurrentReductions;
+	JsonObject.TryGetNumberField(TEXT("max_concurrent_reductions"), MaxConcurrentReductions);
+	OutOptions.MaxConcurrentReductions = FMath::Clamp(MaxConcurrentReductions, 1, 16);
+	return true;
+}
@@ -0,0 +1,248 @@
+#include "Services/MCPJobService.h"
+
+#include "Async/Async.h"
+#include "Dom/JsonObject.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+const TCHAR* FMCPJobSnapshot::StateToString(EMCPJobState State)
+{
+	switch (State)
+	{
+	case EMCPJobState::Running: return TEXT("running");
+	case EMCPJobState::Succeeded: return TEXT("succeeded");
+	case EMCPJobState::Failed: return TEXT("failed");
+	default: return TEXT("cancelled");
+	}
+}
+
+FMCPJobService& FMCPJobService::Get()
+{
+	static FMCPJobService Instance;
+	return Instance;
+}
+
+void FMCPJobService::Shutdown()
+{
+	FScopeLock ScopeLock(&Lock);
+	Jobs.Empty();
+}
+
+FMCPJobService::FJobRecord& FMCPJobService::AddRecord(const FString& JobId, const FString& CommandName, TFunction<void()>&& OnCancel)
+{
+	TSharedRef<FJobRecord> Record = MakeShared<FJobRecord>();
+	Record->Snapshot.JobId = JobId;
+	Record->Snapshot.CommandName = CommandName;
+	Record->StartSeconds = FPlatformTime::Seconds();
+	Record->OnCancel = MoveTemp(OnCancel);
+	Jobs.Add(Record);
+	return *Record;
+}
+
+FString FMCPJobService::CreateJob(const FString& CommandName, TFunction<void()> OnCancel)
+{
+	FScopeLock ScopeLock(&Lock);
+	const FString JobId = FString::Printf(TEXT("job_%d"), NextJobNumber++);
+	AddRecord(JobId, CommandName, MoveTemp(OnCancel));
+	return JobId;
+}
+
+void FMCPJobService::RegisterJob(const FString& JobId, const FString& CommandName, TFunction<void()> OnCancel)
+{
+	FScopeLock ScopeLock(&Lock);
+	AddRecord(JobId, CommandName, MoveTemp(OnCancel));
+}
+
+void FMCPJobService::ReportProgress(const FString& JobId, float Progress, const FString& Message)
+{
+	FScopeLock ScopeLock(&Lock);
+	for (const TSharedRef<FJobRecord>& Record : Jobs)
+	{
+		if (Record->Snapshot.JobId == JobId && Record->Snapshot.State == EMCPJobState::Running)
+		{
+			Record->Snapshot.Progress = FMath::Clamp(Progress, 0.0f, 1.0f);
+			Record->Snapshot.ProgressMessage = Message;
+			return;
+		}
+	}
+}
+
+void FMCPJobService::Complete(const FString& JobId, const FString& Result, bool bSucceeded)
+{
+	FScopeLock ScopeLock(&Lock);
+	for (const TSharedRef<FJobRecord>& Record : Jobs)
+	{
+		if (Record->Snapshot.JobId != JobId || !Record->Snapshot.Result.IsEmpty())
+		{
+			continue;
+		}
+		Record->Snapshot.Result = Result;
+		if (Record->Snapshot.State == EMCPJobState::Running)
+		{
+			Record->Snapshot.State = bSucceeded ? EMCPJobState::Succeeded : EMCPJobState::Failed;
+			Record->Snapshot.Progress = 1.0f;
+			Record->EndSeconds = FPlatformTime::Seconds();
+		}
+		Record->OnCancel = nullptr;
+		break;
+	}
+	EvictFinished();
+}
+
+void FMCPJobService::CompleteWithResult(const FString& JobId, const TSharedRef<FJsonObject>& Result)
+{
+	bool bSucceeded = true;
+	Result->TryGetBoolField(TEXT("success"), bSucceeded);
+
+	TSharedRef<FJsonObject> Envelope = MakeShared<FJsonObject>();
+	Envelope->SetStringField(TEXT("status"), bSucceeded ? TEXT("success") : TEXT("error"));
+	if (!bSucceeded)
+	{
+		Envelope->SetStringField(TEXT("error"), Result->GetStringField(TEXT("error")));
+	}
+	Envelope->SetObjectField(TEXT("result"), Result);
+
+	FString Serialized;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Serialized);
+	FJsonSerializer::Serialize(Envelope, Writer);
+	Complete(JobId, Serialized, bSucceeded);
+}
+
+void FMCPJobService::PublishBatchJob(const FString& JobId, const FMCPBatchJobCounts& Counts, const TCHAR* ItemNoun, const TCHAR* ProgressVerb)
+{
+	const int32 Processed = Counts.Succeeded + Counts.Failed;
+	if (!Counts.bComplete)
+	{
+		const float Progress = Counts.Total > 0 ? static_cast<float>(Processed) / Counts.Total : 0.0f;
+		ReportProgress(JobId, Progress, FString::Printf(TEXT("%d/%d %s %s"), Processed, Counts.Total, ItemNoun, ProgressVerb));
+		return;
+	}
+
+	TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), Counts.Failed == 0);
+	Result->SetStringField(TEXT("job_id"), JobId);
+	Result->SetNumberField(TEXT("total"), Counts.Total);
+	Result->SetNumberField(TEXT("succeeded"), Counts.Succeeded);
+	Result->SetNumberField(TEXT("failed"), Counts.Failed);
+	Result->SetNumberField(TEXT("elapsed_ms"), Counts.ElapsedMs);
+	if (Counts.Failed > 0)
+	{
+		Result->SetStringField(TEXT("error"), FString::Printf(TEXT("%d of %d %s failed"), Counts.Failed, Counts.Total, ItemNoun));
+	}
+	CompleteWithResult(JobId, Result);
+}
+
+bool FMCPJobService::Cancel(const FString& JobId, FString& OutError)
+{
+	TFunction<void()> OnCancel;
+	{
+		FScopeLock ScopeLock(&Lock);
+		const TSharedRef<FJobRecord>* Found = Jobs.FindByPredicate([&JobId](const TSharedRef<FJobRecord>& Record)
+		{
+			return Record->Snapshot.JobId == JobId;
+		});
+		if (!Found)
+		{
+			OutError = FString::Printf(TEXT("Unknown job: %s"), *JobId);
+			return false;
+		}
+
+		FJobRecord& Record = **Found;
+		if (Record.Snapshot.State != EMCPJobState::Running)
+		{
+			OutError = FString::Printf(TEXT("Job %s already %s"), *JobId, FMCPJobSnapshot::StateToString(Record.Snapshot.State));
+			return false;
+		}
+		Record.Snapshot.bCancelRequested = true;
+		Record.Snapshot.State = EMCPJobState::Cancelled;
+		Record.EndSeconds = FPlatformTime::Seconds();
+		OnCancel = MoveTemp(Record.OnCancel);
+		Record.OnCancel = nullptr;
+		EvictFinished();
+	}
+
+	// Outside the lock: the handler may complete the job or report progress
+	if (OnCancel)
+	{
+		if (IsInGameThread())
+		{
+			OnCancel();
+		}
+		else
+		{
+			AsyncTask(ENamedThreads::GameThread, MoveTemp(OnCancel));
+		}
+	}
+	return true;
+}
+
+bool FMCPJobService::IsCancelRequested(const FString& JobId) const
+{
+	FScopeLock ScopeLock(&Lock);
+	for (const TSharedRef<FJobRecord>& Record : Jobs)
+	{
+		if (Record->Snapshot.JobId == JobId)
+		{
+			return Record->Snapshot.bCancelRequested;
+		}
+	}
+	return false;
+}
+
+void FMCPJobService::FillElapsed(const FJobRecord& Record, FMCPJobSnapshot& OutSnapshot)
+{
+	const double EndSeconds = Record.Snapshot.State == EMCPJobState::Running ? FPlatformTime::Seconds() : Record.EndSeconds;
+	OutSnapshot.ElapsedMs = (EndSeconds - Record.StartSeconds) * 1000.0;
+}
+
+bool FMCPJobService::GetJob(const FString& JobId, FMCPJobSnapshot& OutSnapshot) const
+{
+	FScopeLock ScopeLock(&Lock);
+	for (const TSharedRef<FJobRecord>& Record : Jobs)
+	{
+		if (Record->Snapshot.JobId == JobId)
+		{
+			OutSnapshot = Record->Snapshot;
+			FillElapsed(*Record, OutSnapshot);
+			return true;
+		}
+	}
+	return false;
+}
+
+TArray<FMCPJobSnapshot> FMCPJobService::ListJobs() const
+{
+	FScopeLock ScopeLock(&Lock);
+	TArray<FMCPJobSnapshot> Snapshots;
+	Snapshots.Reserve(Jobs.Num());
+	for (int32 Index = Jobs.Num() - 1; Index >= 0; --Index)
+	{
+		FMCPJobSnapshot& Snapshot = Snapshots.Add_GetRef(Jobs[Index]->Snapshot);
+		Snapshot.Result.Empty();
+		FillElapsed(*Jobs[Index], Snapshot);
+	}
+	return Snapshots;
+}
+
+void FMCPJobService::EvictFinished()
+{
+	// Caller holds Lock. Running jobs are never evicted.
+	int32 Finished = 0;
+	for (const TSharedRef<FJobRecord>& Record : Jobs)
+	{
+		Finished += Record->Snapshot.State != EMCPJobState::Running ? 1 : 0;
+	}
+	for (int32 Index = 0; Index < Jobs.Num() && Finished > MaxFinishedJobs;)
+	{
+		if (Jobs[Index]->Snapshot.State != EMCPJobState::Running)
+		{
+			Jobs.RemoveAt(Index);
+			--Finished;
+		}
+		else
+		{
+			++Index;
+		}
+	}
+}
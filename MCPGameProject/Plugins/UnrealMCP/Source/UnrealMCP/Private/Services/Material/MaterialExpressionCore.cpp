@@ -55,7 +55,7 @@
 #include "Dom/JsonValue.h"
 #include "Engine/Texture.h"
 #include "Toolkits/ToolkitManager.h"  // For FToolkitManager - correct API for finding Material Editor
-#include "UObject/UObjectIterator.h"  // For TObjectIterator - dynamic class discovery
+#include "Services/ReflectionCatalog.h"  // Indexed expression class discovery
 
 // Singleton instance
 TUniquePtr<FMaterialExpressionService> FMaterialExpressionService::Instance;
@@ -79,9 +79,6 @@ UClass* FMaterialExpressionService::GetExpressionClassFromTypeName(const FString
     // Static map for ALIASES ONLY - shorthand names that don't match the UMaterialExpression{Name} pattern
     static TMap<FString, FString> AliasMap;
 
-    // Cache for dynamically discovered classes
-    static TMap<FString, UClass*> ClassCache;
-
     // Initialize alias map on first call (only for names that differ from class naming convention)
     if (AliasMap.Num() == 0)
     {
@@ -94,12 +91,6 @@ UClass* FMaterialExpressionService::GetExpressionClassFromTypeName(const FString
         AliasMap.Add(TEXT("FunctionCall"), TEXT("MaterialFunctionCall"));
     }
 
-    // Check cache first
-    if (UClass** CachedClass = ClassCache.Find(TypeName))
-    {
-        return *CachedClass;
-    }
-
     // Resolve alias if one exists
     FString ResolvedTypeName = TypeName;
     if (FString* Alias = AliasMap.Find(TypeName))
@@ -107,33 +98,15 @@ UClass* FMaterialExpressionService::GetExpressionClassFromTypeName(const FString
         ResolvedTypeName = *Alias;
     }
 
-    // Try to find the class dynamically using UE's reflection system
-    // UMaterialExpression classes follow the pattern: UMaterialExpression{TypeName}
+    // UMaterialExpression classes follow the pattern: UMaterialExpression{TypeName}.
+    // The reflection catalog resolves the name from its index (no per-miss class scan), and
+    // picks up expression classes from modules loaded later, so misses are not cached here.
     FString ClassName = FString::Printf(TEXT("MaterialExpression%s"), *ResolvedTypeName);
-
-    // Search through all UMaterialExpression subclasses
-    UClass* FoundClass = nullptr;
-    for (TObjectIterator<UClass> It; It; ++It)
-    {
-        UClass* TestClass = *It;
-        if (TestClass->IsChildOf(UMaterialExpression::StaticClass()) && !TestClass->HasAnyClassFlags(CLASS_Abstract))
-        {
-            // Check if class name matches (without the 'U' prefix)
-            FString TestClassName = TestClass->GetName();
-            if (TestClassName.Equals(ClassName, ESearchCase::IgnoreCase))
-            {
-                FoundClass = TestClass;
-                break;
-            }
-        }
-    }
-
-    // Cache the result (even if null, to avoid repeated searches)
-    ClassCache.Add(TypeName, FoundClass);
+    UClass* FoundClass = FReflectionCatalog::Get().FindClassByName(ClassName, UMaterialExpression::StaticClass(), CLASS_Abstract);
 
     if (FoundClass)
     {
-        UE_LOG(LogTemp, Log, TEXT("GetExpressionClassFromTypeName: Found class %s for type '%s'"), *FoundClass->GetName(), *TypeName);
+        UE_LOG(LogTemp, Verbose, TEXT("GetExpressionClassFromTypeName: Found class %s for type '%s'"), *FoundClass->GetName(), *TypeName);
     }
     else
     {
@@ -303,16 +276,78 @@ UMaterialExpression* FMaterialExpressionService::FindExpressionByGuid(UMaterial*
         return nullptr;
     }
 
-    // Search through all expressions
-    for (UMaterialExpression* Expression : EditorData->ExpressionCollection.Expressions)
+    return FindIndexedExpression(Material, EditorData->ExpressionCollection.Expressions, ExpressionId);
+}
+
+UMaterialExpression* FMaterialExpressionService::FindIndexedExpression(
+    const UObject* Owner,
+    const TArray<TObjectPtr<UMaterialExpression>>& Expressions,
+    const FGuid& ExpressionId)
+{
+    check(IsInGameThread());
+
+    FExpressionGuidIndex& Index = ExpressionGuidIndices.FindOrAdd(Owner);
+
+    // Nodes added/removed in the Material Editor UI bypass InvalidateExpressionIndex,
+    // so compare a cheap fingerprint of the collection before trusting the index
+    const UMaterialExpression* Tail = Expressions.Num() > 0 ? Expressions.Last().Get() : nullptr;
+    bool bRebuilt = false;
+    if (Index.ExpressionCount != Expressions.Num() || Index.LastExpression.Get() != Tail)
+    {
+        RebuildExpressionIndex(Index, Expressions);
+        bRebuilt = true;
+    }
+
+    auto Resolve = [&Index, &ExpressionId]() -> UMaterialExpression*
+    {
+        const TWeakObjectPtr<UMaterialExpression>* Found = Index.ByGuid.Find(ExpressionId);
+        UMaterialExpression* Expression = Found ? Found->Get() : nullptr;
+        // A GUID can be regenerated in place (e.g. after duplicating a node); treat that as a miss
+        return (Expression && Expression->MaterialExpressionGuid == ExpressionId) ? Expression : nullptr;
+    };
+
+    UMaterialExpression* Expression = Resolve();
+    if (!Expression && !bRebuilt)
+    {
+        // Misses are rare (they are usually caller errors), so one rebuild keeps lookups exact
+        RebuildExpressionIndex(Index, Expressions);
+        Expression = Resolve();
+    }
+
+    return Expression;
+}
+
+void FMaterialExpressionService::RebuildExpressionIndex(FExpressionGuidIndex& Index, const TArray<TObjectPtr<UMaterialExpression>>& Expressions)
+{
+    Index.ByGuid.Reset();
+    Index.ByGuid.Reserve(Expressions.Num());
+    for (UMaterialExpression* Expression : Expressions)
     {
-        if (Expression && Expression->MaterialExpressionGuid == ExpressionId)
+        if (Expression && Expression->MaterialExpressionGuid.IsValid())
         {
-            return Expression;
+            // Keep the first expression on duplicate GUIDs, matching the previous linear scan
+            if (!Index.ByGuid.Contains(Expression->MaterialExpressionGuid))
+            {
+                Index.ByGuid.Add(Expression->MaterialExpressionGuid, Expression);
+            }
         }
     }
+    Index.ExpressionCount = Expressions.Num();
+    Index.LastExpression = Expressions.Num() > 0 ? Expressions.Last().Get() : nullptr;
+}
+
+void FMaterialExpressionService::InvalidateExpressionIndex(const UObject* Owner)
+{
+    ExpressionGuidIndices.Remove(Owner);
 
-    return nullptr;
+    // Drop indices whose material/function has been garbage collected (e.g. closed editor copies)
+    for (auto It = ExpressionGuidIndices.CreateIterator(); It; ++It)
+    {
+        if (!It->Key.IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
 }
 
 void FMaterialExpressionService::RecompileMaterial(UMaterial* Material)
@@ -827,6 +827,7 @@ UMaterialExpression* FMaterialExpressionService::AddExpression(
             {
                 EditorData->ExpressionCollection.AddExpression(NewExpression);
             }
+            InvalidateExpressionIndex(Material);
 
             // Apply type-specific properties after creation
             if (Params.Properties.IsValid())
@@ -839,6 +840,7 @@ UMaterialExpression* FMaterialExpressionService::AddExpression(
                     // Property validation failed - clean up and return
                     Material->GetEditorOnlyData()->ExpressionCollection.RemoveExpression(NewExpression);
                     NewExpression->MarkAsGarbage();
+                    InvalidateExpressionIndex(Material);
                     return nullptr;
                 }
 
@@ -903,6 +905,7 @@ UMaterialExpression* FMaterialExpressionService::AddExpression(
         {
             EditorData->ExpressionCollection.AddExpression(NewExpression);
         }
+        InvalidateExpressionIndex(Material);
 
         // Ensure graph exists and rebuild to create visual nodes
         EnsureMaterialGraph(Material);
@@ -27,6 +27,7 @@ bool FMaterialExpressionService::DeleteExpression(
                 return false;
             }
             UMaterialEditingLibrary::DeleteMaterialExpressionInFunction(MatFunc, FnExpr);
+            InvalidateExpressionIndex(MatFunc);
             UMaterialEditingLibrary::UpdateMaterialFunction(MatFunc, nullptr);
             MatFunc->MarkPackageDirty();
             if (UPackage* FnPackage = MatFunc->GetOutermost())
@@ -125,6 +126,7 @@ bool FMaterialExpressionService::DeleteExpression(
 
     // Remove from expression collection
     EditorData->ExpressionCollection.RemoveExpression(Expression);
+    InvalidateExpressionIndex(Material);
 
     // Recompile the material
     RecompileMaterial(Material);
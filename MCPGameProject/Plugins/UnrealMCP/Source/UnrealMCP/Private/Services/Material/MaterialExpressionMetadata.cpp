@@ -291,6 +291,22 @@ bool FMaterialExpressionService::GetGraphMetadata(
     {
         TSharedPtr<FJsonObject> FlowObj = MakeShared<FJsonObject>();
 
+        // Reverse adjacency (expression -> consumers and their input index), built once so each
+        // traced node is O(fan-out) instead of rescanning every expression in the graph
+        TMap<UMaterialExpression*, TArray<TPair<UMaterialExpression*, int32>>> Downstream;
+        for (UMaterialExpression* OtherExpr : Expressions)
+        {
+            if (!OtherExpr) continue;
+            for (int32 i = 0; i < OtherExpr->GetInputsView().Num(); ++i)
+            {
+                FExpressionInput* OtherInput = OtherExpr->GetInput(i);
+                if (OtherInput && OtherInput->Expression)
+                {
+                    Downstream.FindOrAdd(OtherInput->Expression).Emplace(OtherExpr, i);
+                }
+            }
+        }
+
         // Helper to trace path from a material output back to source nodes
         auto TraceFlow = [&](EMaterialProperty Prop, const FString& PropName) {
             FExpressionInput* Input = Material->GetExpressionInputForProperty(Prop);
@@ -314,19 +330,14 @@ bool FMaterialExpressionService::GetGraphMetadata(
 
                 // Find what this node connects to (downstream)
                 TArray<TSharedPtr<FJsonValue>> DownstreamArray;
-                for (UMaterialExpression* OtherExpr : Expressions)
+                if (const TArray<TPair<UMaterialExpression*, int32>>* Consumers = Downstream.Find(Current))
                 {
-                    if (!OtherExpr) continue;
-                    for (int32 i = 0; i < OtherExpr->GetInputsView().Num(); ++i)
+                    for (const TPair<UMaterialExpression*, int32>& Consumer : *Consumers)
                     {
-                        FExpressionInput* OtherInput = OtherExpr->GetInput(i);
-                        if (OtherInput && OtherInput->Expression == Current)
-                        {
-                            TSharedPtr<FJsonObject> DownObj = MakeShared<FJsonObject>();
-                            DownObj->SetStringField(TEXT("target_id"), OtherExpr->MaterialExpressionGuid.ToString());
-                            DownObj->SetStringField(TEXT("target_input"), OtherExpr->GetInputName(i).ToString());
-                            DownstreamArray.Add(MakeShared<FJsonValueObject>(DownObj));
-                        }
+                        TSharedPtr<FJsonObject> DownObj = MakeShared<FJsonObject>();
+                        DownObj->SetStringField(TEXT("target_id"), Consumer.Key->MaterialExpressionGuid.ToString());
+                        DownObj->SetStringField(TEXT("target_input"), Consumer.Key->GetInputName(Consumer.Value).ToString());
+                        DownstreamArray.Add(MakeShared<FJsonValueObject>(DownObj));
                     }
                 }
                 NodeObj->SetArrayField(TEXT("connects_to"), DownstreamArray);
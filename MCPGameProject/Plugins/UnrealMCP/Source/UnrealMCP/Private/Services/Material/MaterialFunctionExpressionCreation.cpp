@@ -48,6 +48,7 @@ UMaterialExpression* FMaterialExpressionService::AddExpressionToFunction(
         {
             // Clean up on failure
             UMaterialEditingLibrary::DeleteMaterialExpressionInFunction(MatFunc, NewExpression);
+            InvalidateExpressionIndex(MatFunc);
             return nullptr;
         }
     }
@@ -116,6 +117,8 @@ UMaterialExpression* FMaterialExpressionService::AddExpressionToFunction(
         OutputExpr->ConditionallyGenerateId(true);
     }
 
+    InvalidateExpressionIndex(MatFunc);
+
     // Update and save
     UMaterialEditingLibrary::UpdateMaterialFunction(MatFunc, nullptr);
     MatFunc->MarkPackageDirty();
@@ -150,15 +153,7 @@ UMaterialExpression* FMaterialExpressionService::AddExpressionToFunction(
 
 UMaterialExpression* FMaterialExpressionService::FindExpressionInFunction(UMaterialFunction* Function, const FGuid& ExpressionId)
 {
-    if (!Function) return nullptr;
+    if (!Function || !ExpressionId.IsValid()) return nullptr;
 
-    const TArray<TObjectPtr<UMaterialExpression>>& Expressions = Function->GetExpressionCollection().Expressions;
-    for (UMaterialExpression* Expr : Expressions)
-    {
-        if (Expr && Expr->MaterialExpressionGuid == ExpressionId)
-        {
-            return Expr;
-        }
-    }
-    return nullptr;
+    return FindIndexedExpression(Function, Function->GetExpressionCollection().Expressions, ExpressionId);
 }
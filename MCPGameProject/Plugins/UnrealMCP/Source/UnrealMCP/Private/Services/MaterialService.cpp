@@ -15,6 +15,7 @@
 #include "IAssetTools.h"
 #include "Misc/PackageName.h"
 #include "Dom/JsonValue.h"
+#include "MaterialShared.h"  // For FMaterialUpdateContext
 
 // Singleton instance
 TUniquePtr<FMaterialService> FMaterialService::Instance;
@@ -517,6 +518,141 @@ bool FMaterialService::SetTextureParameter(const FString& MaterialPath, const FS
     return false;
 }
 
+namespace
+{
+    /** Insert or overwrite an override entry on a material instance without triggering per-write updates */
+    template <typename ParameterValueType, typename ValueType>
+    void UpsertParameterOverride(TArray<ParameterValueType>& Overrides, const FString& ParameterName, const ValueType& Value)
+    {
+        const FMaterialParameterInfo ParameterInfo(*ParameterName);
+        for (ParameterValueType& Existing : Overrides)
+        {
+            if (Existing.ParameterInfo == ParameterInfo)
+            {
+                Existing.ParameterValue = Value;
+                return;
+            }
+        }
+
+        ParameterValueType& Added = Overrides.AddDefaulted_GetRef();
+        Added.ParameterInfo = ParameterInfo;
+        Added.ParameterValue = Value;
+    }
+}
+
+bool FMaterialService::BatchSetInstanceParameters(const TArray<FString>& InstancePaths, const FMaterialParameterBatch& Batch, TArray<FMaterialInstanceBatchResult>& OutResults, FString& OutError)
+{
+    OutResults.Reset(InstancePaths.Num());
+
+    if (InstancePaths.Num() == 0)
+    {
+        OutError = TEXT("No material instances provided");
+        return false;
+    }
+    if (Batch.IsEmpty())
+    {
+        OutError = TEXT("No parameters provided");
+        return false;
+    }
+
+    // Textures are shared by every instance, so load each one once up front
+    TArray<TPair<FString, UTexture*>> Textures;
+    for (const TPair<FString, FString>& Pair : Batch.TextureParameters)
+    {
+        UTexture* Texture = LoadObject<UTexture>(nullptr, *Pair.Value);
+        if (!Texture)
+        {
+            OutError = FString::Printf(TEXT("Texture not found: %s"), *Pair.Value);
+            return false;
+        }
+        Textures.Emplace(Pair.Key, Texture);
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    int32 SucceededCount = 0;
+    {
+        // One update context for the whole batch: primitives using any of the edited instances
+        // have their render state recreated once when it goes out of scope, not per parameter
+        FMaterialUpdateContext UpdateContext;
+
+        for (const FString& InstancePath : InstancePaths)
+        {
+            FMaterialInstanceBatchResult& Result = OutResults.AddDefaulted_GetRef();
+            Result.InstancePath = InstancePath;
+
+            UMaterialInterface* Material = FindMaterial(InstancePath);
+            if (!Material)
+            {
+                Result.Error = FString::Printf(TEXT("Material not found: %s"), *InstancePath);
+                continue;
+            }
+
+            if (UMaterialInstanceConstant* MIC = Cast<UMaterialInstanceConstant>(Material))
+            {
+                // Write the override arrays directly and notify once; the *EditorOnly setters
+                // re-cache uniform expressions on every call
+                MIC->PreEditChange(nullptr);
+                for (const TPair<FString, float>& Pair : Batch.ScalarParameters)
+                {
+                    UpsertParameterOverride(MIC->ScalarParameterValues, Pair.Key, Pair.Value);
+                    Result.AppliedScalars.Add(Pair.Key);
+                }
+                for (const TPair<FString, FLinearColor>& Pair : Batch.VectorParameters)
+                {
+                    UpsertParameterOverride(MIC->VectorParameterValues, Pair.Key, Pair.Value);
+                    Result.AppliedVectors.Add(Pair.Key);
+                }
+                for (const TPair<FString, UTexture*>& Pair : Textures)
+                {
+                    UpsertParameterOverride(MIC->TextureParameterValues, Pair.Key, TObjectPtr<UTexture>(Pair.Value));
+                    Result.AppliedTextures.Add(Pair.Key);
+                }
+                MIC->PostEditChange();
+                MIC->MarkPackageDirty();
+                UpdateContext.AddMaterialInstance(MIC);
+            }
+            else if (UMaterialInstanceDynamic* MID = Cast<UMaterialInstanceDynamic>(Material))
+            {
+                for (const TPair<FString, float>& Pair : Batch.ScalarParameters)
+                {
+                    MID->SetScalarParameterValue(FName(*Pair.Key), Pair.Value);
+                    Result.AppliedScalars.Add(Pair.Key);
+                }
+                for (const TPair<FString, FLinearColor>& Pair : Batch.VectorParameters)
+                {
+                    MID->SetVectorParameterValue(FName(*Pair.Key), Pair.Value);
+                    Result.AppliedVectors.Add(Pair.Key);
+                }
+                for (const TPair<FString, UTexture*>& Pair : Textures)
+                {
+                    MID->SetTextureParameterValue(FName(*Pair.Key), Pair.Value);
+                    Result.AppliedTextures.Add(Pair.Key);
+                }
+            }
+            else
+            {
+                Result.Error = TEXT("Cannot set parameters on base Material. Use a Material Instance instead.");
+                continue;
+            }
+
+            Result.bSuccess = true;
+            ++SucceededCount;
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Batch parameter update: %d/%d instances, %d parameters each, %.1f ms"),
+        SucceededCount, InstancePaths.Num(),
+        Batch.ScalarParameters.Num() + Batch.VectorParameters.Num() + Batch.TextureParameters.Num(),
+        (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+    if (SucceededCount != InstancePaths.Num())
+    {
+        OutError = FString::Printf(TEXT("%d of %d material instances failed"), InstancePaths.Num() - SucceededCount, InstancePaths.Num());
+        return false;
+    }
+    return true;
+}
+
 bool FMaterialService::GetScalarParameter(const FString& MaterialPath, const FString& ParameterName, float& OutValue, FString& OutError)
 {
     UMaterialInterface* Material = FindMaterial(MaterialPath);
@@ -0,0 +1,466 @@
+#include "Services/IMeshDrawStatsCaptureBackend.h"
+
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+// Header names written by the renderer's MeshDrawCommandStats dump
+enum class EMeshDrawStatsColumn : uint8
+{
+	Pass,
+	VisiblePrimitiveCount,
+	VisibleVertices,
+	VisibleInstances,
+	Category,
+	ResourceName,
+	LODIndex,
+	MaterialName,
+	TotalInstanceCount,
+	TotalPrimitiveCount,
+	TotalVertexCount,
+	Unknown
+};
+
+EMeshDrawStatsColumn ResolveColumn(const FString& HeaderName)
+{
+	static const TPair<const TCHAR*, EMeshDrawStatsColumn> KnownColumns[] = {
+		{TEXT("Pass"), EMeshDrawStatsColumn::Pass},
+		{TEXT("VisiblePrimitiveCount"), EMeshDrawStatsColumn::VisiblePrimitiveCount},
+		{TEXT("VisibleVertices"), EMeshDrawStatsColumn::VisibleVertices},
+		{TEXT("VisibleInstances"), EMeshDrawStatsColumn::VisibleInstances},
+		{TEXT("Category"), EMeshDrawStatsColumn::Category},
+		{TEXT("ResourceName"), EMeshDrawStatsColumn::ResourceName},
+		{TEXT("LODIndex"), EMeshDrawStatsColumn::LODIndex},
+		{TEXT("MaterialName"), EMeshDrawStatsColumn::MaterialName},
+		{TEXT("TotalInstanceCount"), EMeshDrawStatsColumn::TotalInstanceCount},
+		{TEXT("TotalPrimitiveCount"), EMeshDrawStatsColumn::TotalPrimitiveCount},
+		{TEXT("TotalVertexCount"), EMeshDrawStatsColumn::TotalVertexCount},
+	};
+
+	for (const TPair<const TCHAR*, EMeshDrawStatsColumn>& Column : KnownColumns)
+	{
+		if (HeaderName.Equals(Column.Key, ESearchCase::IgnoreCase))
+		{
+			return Column.Value;
+		}
+	}
+	return EMeshDrawStatsColumn::Unknown;
+}
+
+/** Byte span of one CSV field with surrounding whitespace removed */
+struct FCsvField
+{
+	const ANSICHAR* Data = nullptr;
+	int32 Length = 0;
+};
+
+FCsvField TrimField(const ANSICHAR* Begin, const ANSICHAR* End)
+{
+	while (Begin < End && (*Begin == ' ' || *Begin == '\t' || *Begin == '"'))
+	{
+		++Begin;
+	}
+	while (End > Begin && (End[-1] == ' ' || End[-1] == '\t' || End[-1] == '\r' || End[-1] == '"'))
+	{
+		--End;
+	}
+	return FCsvField{Begin, static_cast<int32>(End - Begin)};
+}
+
+int64 ParseInteger(const FCsvField& Field)
+{
+	int32 Index = 0;
+	const bool bNegative = Field.Length > 0 && Field.Data[0] == '-';
+	if (bNegative)
+	{
+		++Index;
+	}
+
+	int64 Value = 0;
+	for (; Index < Field.Length && Field.Data[Index] >= '0' && Field.Data[Index] <= '9'; ++Index)
+	{
+		Value = Value * 10 + (Field.Data[Index] - '0');
+	}
+	return bNegative ? -Value : Value;
+}
+
+FString FieldToString(const FCsvField& Field)
+{
+	const FUTF8ToTCHAR Converted(Field.Data, Field.Length);
+	return FString(Converted.Length(), Converted.Get());
+}
+
+/** Split [Begin, End) on commas, calling Visit(ColumnIndex, Field) for each field */
+template <typename VisitorType>
+void ForEachField(const ANSICHAR* Begin, const ANSICHAR* End, VisitorType&& Visit)
+{
+	int32 ColumnIndex = 0;
+	const ANSICHAR* FieldStart = Begin;
+	for (const ANSICHAR* Cursor = Begin; ; ++Cursor)
+	{
+		if (Cursor == End || *Cursor == ',')
+		{
+			Visit(ColumnIndex++, TrimField(FieldStart, Cursor));
+			if (Cursor == End)
+			{
+				break;
+			}
+			FieldStart = Cursor + 1;
+		}
+	}
+}
+
+class FEngineMeshDrawStatsCaptureBackend final : public IMeshDrawStatsCaptureBackend
+{
+public:
+	virtual void RequestCapture() override
+	{
+		// A dump for an earlier request is still being written; it answers this request too,
+		// and asking for another would replace it before it could be taken
+		if (!LandingFile.IsEmpty())
+		{
+			return;
+		}
+
+		// File timestamps can be second-granular; allow a dump from the same second
+		RequestTime = FDateTime::UtcNow() - FTimespan::FromSeconds(1.0);
+
+		// r.MeshDrawCommands.DumpStats asks the renderer to collect stats for the next
+		// rendered frame and write them out at the end of that frame
+		if (GEngine)
+		{
+			UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+			GEngine->Exec(World, TEXT("r.MeshDrawCommands.DumpStats"));
+		}
+	}
+
+	virtual TSharedPtr<FMeshDrawStatsCapture> TryTakeCapture() override
+	{
+		// The renderer's stats manager is private to the Renderer module; its dump file is the
+		// only exported surface. Only the directory listing happens here - the read, parse and
+		// aggregation run on a worker through FMeshDrawStatsCapture::ReadBytes.
+		const FString ProfilingDir = FPaths::ProfilingDir();
+		TArray<FString> FoundFiles;
+		IFileManager::Get().FindFiles(
+			FoundFiles,
+			*FPaths::Combine(ProfilingDir, TEXT("MeshDrawCommandStats*.csv")),
+			true, false);
+		if (FoundFiles.Num() == 0)
+		{
+			return nullptr;
+		}
+
+		FoundFiles.Sort();
+		const FString LatestFile = FPaths::Combine(ProfilingDir, FoundFiles.Last());
+		if (RequestTime != FDateTime::MinValue() && IFileManager::Get().GetTimeStamp(*LatestFile) < RequestTime)
+		{
+			return nullptr;
+		}
+
+		// The renderer creates the file before it finishes writing it; only hand it off once its
+		// size holds across two polls
+		const int64 FileSize = IFileManager::Get().FileSize(*LatestFile);
+		if (FileSize <= 0 || LatestFile != LandingFile || FileSize != LandingFileSize)
+		{
+			LandingFile = LatestFile;
+			LandingFileSize = FileSize;
+			return nullptr;
+		}
+
+		// Older dumps are never read again
+		for (int32 Index = 0; Index < FoundFiles.Num() - 1; ++Index)
+		{
+			IFileManager::Get().Delete(*FPaths::Combine(ProfilingDir, FoundFiles[Index]));
+		}
+
+		RequestTime = FDateTime::MinValue();
+		LandingFile.Reset();
+		LandingFileSize = -1;
+		TSharedPtr<FMeshDrawStatsCapture> Capture = MakeShared<FMeshDrawStatsCapture>();
+		Capture->FilePath = LatestFile;
+		return Capture;
+	}
+
+private:
+	FDateTime RequestTime = FDateTime::MinValue();
+
+	/** Newest dump seen by the last poll and its size then; taken once a poll sees the same size */
+	FString LandingFile;
+	int64 LandingFileSize = -1;
+};
+}
+
+bool FMeshDrawStatsTable::Parse(const TArray64<uint8>& Utf8Csv, FMeshDrawStatsTable& OutTable, FString& OutError)
+{
+	OutTable = FMeshDrawStatsTable();
+
+	const ANSICHAR* Cursor = reinterpret_cast<const ANSICHAR*>(Utf8Csv.GetData());
+	const ANSICHAR* const End = Cursor + Utf8Csv.Num();
+
+	// Skip a UTF-8 BOM
+	if (End - Cursor >= 3 && static_cast<uint8>(Cursor[0]) == 0xEF && static_cast<uint8>(Cursor[1]) == 0xBB && static_cast<uint8>(Cursor[2]) == 0xBF)
+	{
+		Cursor += 3;
+	}
+
+	TArray<EMeshDrawStatsColumn> Columns;
+	TMap<FString, int32> NameIds;
+	auto Intern = [&OutTable, &NameIds](const FCsvField& Field) -> int32
+	{
+		FString Name = FieldToString(Field);
+		if (const int32* Existing = NameIds.Find(Name))
+		{
+			return *Existing;
+		}
+		const int32 Id = OutTable.Names.Add(Name);
+		NameIds.Add(MoveTemp(Name), Id);
+		return Id;
+	};
+
+	while (Cursor < End)
+	{
+		const ANSICHAR* LineEnd = Cursor;
+		while (LineEnd < End && *LineEnd != '\n')
+		{
+			++LineEnd;
+		}
+		const ANSICHAR* const LineBegin = Cursor;
+		Cursor = LineEnd < End ? LineEnd + 1 : End;
+
+		if (TrimField(LineBegin, LineEnd).Length == 0)
+		{
+			continue;
+		}
+
+		if (Columns.Num() == 0)
+		{
+			ForEachField(LineBegin, LineEnd, [&Columns](int32, const FCsvField& Field)
+			{
+				Columns.Add(ResolveColumn(FieldToString(Field)));
+			});
+			if (!Columns.Contains(EMeshDrawStatsColumn::ResourceName))
+			{
+				OutError = TEXT("Mesh draw stats dump has no ResourceName column");
+				return false;
+			}
+
+			// Interned id 0 is the empty name so missing fields need no special case
+			OutTable.Names.Add(FString());
+			NameIds.Add(FString(), 0);
+			continue;
+		}
+
+		int32 Pass = 0, Resource = 0, Category = 0, Material = 0, LOD = 0;
+		int64 VisPrim = 0, VisVert = 0, VisInst = 0, TotInst = 0, TotPrim = 0, TotVert = 0;
+		int32 FieldCount = 0;
+		ForEachField(LineBegin, LineEnd, [&](int32 ColumnIndex, const FCsvField& Field)
+		{
+			++FieldCount;
+			if (!Columns.IsValidIndex(ColumnIndex))
+			{
+				return;
+			}
+			switch (Columns[ColumnIndex])
+			{
+			case EMeshDrawStatsColumn::Pass: Pass = Intern(Field); break;
+			case EMeshDrawStatsColumn::Category: Category = Intern(Field); break;
+			case EMeshDrawStatsColumn::ResourceName: Resource = Intern(Field); break;
+			case EMeshDrawStatsColumn::MaterialName: Material = Intern(Field); break;
+			case EMeshDrawStatsColumn::LODIndex: LOD = static_cast<int32>(ParseInteger(Field)); break;
+			case EMeshDrawStatsColumn::VisiblePrimitiveCount: VisPrim = ParseInteger(Field); break;
+			case EMeshDrawStatsColumn::VisibleVertices: VisVert = ParseInteger(Field); break;
+			case EMeshDrawStatsColumn::VisibleInstances: VisInst = ParseInteger(Field); break;
+			case EMeshDrawStatsColumn::TotalInstanceCount: TotInst = ParseInteger(Field); break;
+			case EMeshDrawStatsColumn::TotalPrimitiveCount: TotPrim = ParseInteger(Field); break;
+			case EMeshDrawStatsColumn::TotalVertexCount: TotVert = ParseInteger(Field); break;
+			default: break;
+			}
+		});
+
+		if (FieldCount < 2)
+		{
+			continue;
+		}
+
+		OutTable.Pass.Add(Pass);
+		OutTable.Resource.Add(Resource);
+		OutTable.Category.Add(Category);
+		OutTable.Material.Add(Material);
+		OutTable.LODIndex.Add(LOD);
+		OutTable.VisiblePrimitives.Add(VisPrim);
+		OutTable.VisibleVertices.Add(VisVert);
+		OutTable.VisibleInstances.Add(VisInst);
+		OutTable.TotalInstances.Add(TotInst);
+		OutTable.TotalPrimitives.Add(TotPrim);
+		OutTable.TotalVertices.Add(TotVert);
+	}
+
+	if (Columns.Num() == 0)
+	{
+		OutError = TEXT("Mesh draw stats dump is empty");
+		return false;
+	}
+	return true;
+}
+
+FMeshDrawStatsSummary AggregateMeshDrawStats(const FMeshDrawStatsTable& Table, const FMeshDrawStatsQuery& Query)
+{
+	FMeshDrawStatsSummary Summary;
+
+	// Evaluate the filter once per distinct name rather than once per row
+	TBitArray<> NameMatches(Query.MeshFilter.IsEmpty(), Table.Names.Num());
+	if (!Query.MeshFilter.IsEmpty())
+	{
+		for (int32 NameId = 0; NameId < Table.Names.Num(); ++NameId)
+		{
+			NameMatches[NameId] = Table.Names[NameId].Contains(Query.MeshFilter, ESearchCase::IgnoreCase);
+		}
+	}
+
+	const TArray<int32>* KeyColumn = nullptr;
+	switch (Query.GroupBy)
+	{
+	case EMeshDrawStatsGroupBy::Resource: KeyColumn = &Table.Resource; break;
+	case EMeshDrawStatsGroupBy::Material: KeyColumn = &Table.Material; break;
+	case EMeshDrawStatsGroupBy::Pass: KeyColumn = &Table.Pass; break;
+	default: break;
+	}
+
+	// Group accumulators; for Entry grouping each matching row is its own group
+	TArray<int32> GroupFirstRow;
+	TArray<int32> GroupEntryCount;
+	TArray<int64> GroupVisPrim, GroupVisVert, GroupVisInst, GroupTotInst, GroupTotPrim, GroupTotVert;
+	TArray<int32> GroupByName;
+	if (KeyColumn)
+	{
+		GroupByName.Init(INDEX_NONE, Table.Names.Num());
+	}
+
+	for (int32 Row = 0; Row < Table.Num(); ++Row)
+	{
+		if (!NameMatches[Table.Resource[Row]])
+		{
+			continue;
+		}
+
+		++Summary.MatchedEntries;
+		Summary.TotalVisiblePrimitives += Table.VisiblePrimitives[Row];
+		Summary.TotalVisibleVertices += Table.VisibleVertices[Row];
+		Summary.TotalVisibleInstances += Table.VisibleInstances[Row];
+
+		int32 Group = INDEX_NONE;
+		if (KeyColumn)
+		{
+			Group = GroupByName[(*KeyColumn)[Row]];
+		}
+		if (Group == INDEX_NONE)
+		{
+			Group = GroupFirstRow.Add(Row);
+			GroupEntryCount.Add(0);
+			GroupVisPrim.Add(0);
+			GroupVisVert.Add(0);
+			GroupVisInst.Add(0);
+			GroupTotInst.Add(0);
+			GroupTotPrim.Add(0);
+			GroupTotVert.Add(0);
+			if (KeyColumn)
+			{
+				GroupByName[(*KeyColumn)[Row]] = Group;
+			}
+		}
+
+		++GroupEntryCount[Group];
+		GroupVisPrim[Group] += Table.VisiblePrimitives[Row];
+		GroupVisVert[Group] += Table.VisibleVertices[Row];
+		GroupVisInst[Group] += Table.VisibleInstances[Row];
+		GroupTotInst[Group] += Table.TotalInstances[Row];
+		GroupTotPrim[Group] += Table.TotalPrimitives[Row];
+		GroupTotVert[Group] += Table.TotalVertices[Row];
+	}
+
+	Summary.GroupCount = GroupFirstRow.Num();
+
+	// Bounded min-heap: the top holds the smallest of the best TopN seen so far
+	const int32 TopN = FMath::Max(Query.TopN, 0);
+	auto FewerPrimitives = [&GroupVisPrim](int32 A, int32 B)
+	{
+		return GroupVisPrim[A] < GroupVisPrim[B] || (GroupVisPrim[A] == GroupVisPrim[B] && A > B);
+	};
+	TArray<int32> Ranked;
+	Ranked.Reserve(FMath::Min(TopN, Summary.GroupCount) + 1);
+	for (int32 Group = 0; Group < Summary.GroupCount && TopN > 0; ++Group)
+	{
+		if (Ranked.Num() < TopN)
+		{
+			Ranked.HeapPush(Group, FewerPrimitives);
+		}
+		else if (FewerPrimitives(Ranked.HeapTop(), Group))
+		{
+			Ranked.HeapPopDiscard(FewerPrimitives);
+			Ranked.HeapPush(Group, FewerPrimitives);
+		}
+	}
+	Ranked.Sort([&FewerPrimitives](int32 A, int32 B) { return FewerPrimitives(B, A); });
+
+	Summary.Rows.Reserve(Ranked.Num());
+	for (const int32 Group : Ranked)
+	{
+		const int32 Row = GroupFirstRow[Group];
+		FMeshDrawStatsRow& Out = Summary.Rows.AddDefaulted_GetRef();
+		switch (Query.GroupBy)
+		{
+		case EMeshDrawStatsGroupBy::Entry:
+			Out.Pass = Table.Names[Table.Pass[Row]];
+			Out.Resource = Table.Names[Table.Resource[Row]];
+			Out.Category = Table.Names[Table.Category[Row]];
+			Out.Material = Table.Names[Table.Material[Row]];
+			Out.LODIndex = Table.LODIndex[Row];
+			break;
+		case EMeshDrawStatsGroupBy::Resource:
+			Out.Resource = Table.Names[Table.Resource[Row]];
+			break;
+		case EMeshDrawStatsGroupBy::Material:
+			Out.Material = Table.Names[Table.Material[Row]];
+			break;
+		case EMeshDrawStatsGroupBy::Pass:
+			Out.Pass = Table.Names[Table.Pass[Row]];
+			break;
+		}
+		Out.EntryCount = GroupEntryCount[Group];
+		Out.VisiblePrimitives = GroupVisPrim[Group];
+		Out.VisibleVertices = GroupVisVert[Group];
+		Out.VisibleInstances = GroupVisInst[Group];
+		Out.TotalInstances = GroupTotInst[Group];
+		Out.TotalPrimitives = GroupTotPrim[Group];
+		Out.TotalVertices = GroupTotVert[Group];
+	}
+
+	return Summary;
+}
+
+bool FMeshDrawStatsCapture::ReadBytes(TArray64<uint8>& OutBytes, FString& OutError)
+{
+	if (FilePath.IsEmpty())
+	{
+		OutBytes = MoveTemp(Bytes);
+		return true;
+	}
+
+	const bool bLoaded = FFileHelper::LoadFileToArray(OutBytes, *FilePath);
+	if (!bLoaded)
+	{
+		OutError = FString::Printf(TEXT("Failed to read mesh draw stats dump: %s"), *FilePath);
+	}
+	// Each dump is consumed once; leaving it would only grow Saved/Profiling
+	IFileManager::Get().Delete(*FilePath);
+	return bLoaded;
+}
+
+TSharedRef<IMeshDrawStatsCaptureBackend> CreateMeshDrawStatsCaptureBackend()
+{
+	return MakeShared<FEngineMeshDrawStatsCaptureBackend>();
+}
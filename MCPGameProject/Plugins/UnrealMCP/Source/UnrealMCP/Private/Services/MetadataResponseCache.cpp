@@ -0,0 +1,295 @@
+#include "Services/MetadataResponseCache.h"
+
+#include "Editor.h"
+#include "Hash/CityHash.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Guid.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+FString SerializeCondensed(const TSharedRef<FJsonObject>& Object)
+{
+	FString Output;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Output);
+	FJsonSerializer::Serialize(Object, Writer);
+	return Output;
+}
+
+FString SerializeResponse(const TSharedRef<FJsonObject>& Object)
+{
+	FString Output;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	FJsonSerializer::Serialize(Object, Writer);
+	return Output;
+}
+}
+
+FMetadataResponseCache& FMetadataResponseCache::Get()
+{
+	static FMetadataResponseCache Instance;
+	return Instance;
+}
+
+FMetadataResponseCache::FMetadataResponseCache()
+	: SessionSalt(GetTypeHash(FGuid::NewGuid()))
+{
+}
+
+void FMetadataResponseCache::Initialize()
+{
+	ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FMetadataResponseCache::HandleObjectModified);
+	PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FMetadataResponseCache::HandleObjectPropertyChanged);
+	PackageDirtyHandle = UPackage::PackageMarkedDirtyEvent.AddRaw(this, &FMetadataResponseCache::HandlePackageMarkedDirty);
+	ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddRaw(this, &FMetadataResponseCache::HandleObjectsReplaced);
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FMetadataResponseCache::HandleReloadComplete);
+	UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FMetadataResponseCache::BumpEpoch);
+
+	// GEditor does not exist yet when the module loads during engine init
+	if (GEditor)
+	{
+		BindEditorDelegates();
+	}
+	else
+	{
+		PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FMetadataResponseCache::BindEditorDelegates);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("FMetadataResponseCache initialized"));
+}
+
+void FMetadataResponseCache::Shutdown()
+{
+	FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+	UPackage::PackageMarkedDirtyEvent.Remove(PackageDirtyHandle);
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+	FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+
+	ObjectModifiedHandle.Reset();
+	PropertyChangedHandle.Reset();
+	PackageDirtyHandle.Reset();
+	ObjectsReplacedHandle.Reset();
+	ReloadCompleteHandle.Reset();
+	UndoRedoHandle.Reset();
+	PostEngineInitHandle.Reset();
+	BlueprintCompiledHandle.Reset();
+
+	Reset();
+	PackageGenerations.Empty();
+}
+
+void FMetadataResponseCache::BindEditorDelegates()
+{
+	// A compile reinstances dependents and changes status in other assets' metadata
+	if (GEditor && !BlueprintCompiledHandle.IsValid())
+	{
+		BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FMetadataResponseCache::BumpEpoch);
+	}
+}
+
+FString FMetadataResponseCache::Serve(const FString& CommandName, const FString& Parameters, const UObject* Asset, TFunctionRef<TSharedPtr<FJsonObject>()> BuildResponse,
+	TConstArrayView<const UObject*> Dependencies)
+{
+	check(IsInGameThread());
+
+	if (!Asset)
+	{
+		TSharedPtr<FJsonObject> Response = BuildResponse();
+		return Response.IsValid() ? SerializeResponse(Response.ToSharedRef()) : FString();
+	}
+
+	FString RequestKey;
+	FString IfNoneMatch;
+	ParseRequest(Parameters, RequestKey, IfNoneMatch);
+	const FString CacheKey = MakeCacheKey(CommandName, RequestKey, Asset);
+	const FString ETag = MakeETagForKey(CacheKey, Asset, Dependencies);
+
+	if (!IfNoneMatch.IsEmpty() && IfNoneMatch == ETag)
+	{
+		TSharedRef<FJsonObject> NotModified = MakeShared<FJsonObject>();
+		NotModified->SetBoolField(TEXT("success"), true);
+		NotModified->SetBoolField(TEXT("not_modified"), true);
+		NotModified->SetStringField(TEXT("etag"), ETag);
+		return SerializeResponse(NotModified);
+	}
+
+	if (FEntry* Entry = Entries.Find(CacheKey))
+	{
+		if (Entry->ETag == ETag)
+		{
+			Entry->LastUsed = ++UseCounter;
+			return Entry->Response;
+		}
+	}
+
+	TSharedPtr<FJsonObject> Response = BuildResponse();
+	if (!Response.IsValid())
+	{
+		return FString();
+	}
+
+	// Some metadata commands return the metadata object itself, without a success flag
+	bool bSuccess = true;
+	Response->TryGetBoolField(TEXT("success"), bSuccess);
+	if (!bSuccess)
+	{
+		return SerializeResponse(Response.ToSharedRef());
+	}
+
+	Response->SetStringField(TEXT("etag"), ETag);
+	FString Serialized = SerializeResponse(Response.ToSharedRef());
+	Store(CacheKey, ETag, Serialized);
+	return Serialized;
+}
+
+FString FMetadataResponseCache::MakeETag(const FString& CommandName, const FString& Parameters, const UObject* Asset, TConstArrayView<const UObject*> Dependencies) const
+{
+	FString RequestKey;
+	FString IfNoneMatch;
+	ParseRequest(Parameters, RequestKey, IfNoneMatch);
+	return MakeETagForKey(MakeCacheKey(CommandName, RequestKey, Asset), Asset, Dependencies);
+}
+
+void FMetadataResponseCache::Reset()
+{
+	Entries.Empty();
+	TotalBytes = 0;
+	BumpEpoch();
+}
+
+void FMetadataResponseCache::ParseRequest(const FString& Parameters, FString& OutRequestKey, FString& OutIfNoneMatch)
+{
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		OutRequestKey = Parameters;
+		return;
+	}
+
+	JsonObject->TryGetStringField(TEXT("if_none_match"), OutIfNoneMatch);
+	JsonObject->RemoveField(TEXT("if_none_match"));
+
+	// Key order in the request must not split the cache
+	TArray<FString> Keys;
+	JsonObject->Values.GetKeys(Keys);
+	Keys.Sort();
+	TSharedRef<FJsonObject> Canonical = MakeShared<FJsonObject>();
+	for (const FString& Key : Keys)
+	{
+		Canonical->SetField(Key, JsonObject->Values[Key]);
+	}
+	OutRequestKey = SerializeCondensed(Canonical);
+}
+
+FString FMetadataResponseCache::MakeCacheKey(const FString& CommandName, const FString& RequestKey, const UObject* Asset)
+{
+	return FString::Printf(TEXT("%s|%s|%s"), *CommandName, Asset ? *Asset->GetPathName() : TEXT(""), *RequestKey);
+}
+
+FString FMetadataResponseCache::MakeETagForKey(const FString& CacheKey, const UObject* Asset, TConstArrayView<const UObject*> Dependencies) const
+{
+	const uint64* Generation = Asset ? PackageGenerations.Find(Asset->GetOutermost()->GetFName()) : nullptr;
+
+	// The object's unique id changes when the asset is reloaded or replaced
+	uint64 RequestHash = CityHash64(reinterpret_cast<const char*>(*CacheKey), CacheKey.Len() * sizeof(TCHAR));
+	RequestHash = CityHash128to64(Uint128_64(RequestHash, Asset ? static_cast<uint64>(Asset->GetUniqueID()) : 0));
+
+	// Dependencies live in other packages; fold in their counters (and identities, for reloads)
+	for (const UObject* Dependency : Dependencies)
+	{
+		if (Dependency)
+		{
+			const uint64* DependencyGeneration = PackageGenerations.Find(Dependency->GetOutermost()->GetFName());
+			RequestHash = CityHash128to64(Uint128_64(RequestHash, DependencyGeneration ? *DependencyGeneration : 0));
+			RequestHash = CityHash128to64(Uint128_64(RequestHash, static_cast<uint64>(Dependency->GetUniqueID())));
+		}
+	}
+
+	return FString::Printf(TEXT("%08x-%llx-%llx-%016llx"), SessionSalt, Epoch, Generation ? *Generation : 0ull, RequestHash);
+}
+
+void FMetadataResponseCache::Store(const FString& CacheKey, const FString& ETag, const FString& Response)
+{
+	if (FEntry* Existing = Entries.Find(CacheKey))
+	{
+		TotalBytes -= Existing->Response.Len() * sizeof(TCHAR);
+	}
+
+	FEntry& Entry = Entries.Add(CacheKey);
+	Entry.ETag = ETag;
+	Entry.Response = Response;
+	Entry.LastUsed = ++UseCounter;
+	TotalBytes += Response.Len() * sizeof(TCHAR);
+
+	EvictIfNeeded();
+}
+
+void FMetadataResponseCache::EvictIfNeeded()
+{
+	while (Entries.Num() > 1 && (Entries.Num() > MaxEntries || TotalBytes > MaxBytes))
+	{
+		const FString* OldestKey = nullptr;
+		uint64 OldestUse = MAX_uint64;
+		for (const TPair<FString, FEntry>& Pair : Entries)
+		{
+			if (Pair.Value.LastUsed < OldestUse)
+			{
+				OldestUse = Pair.Value.LastUsed;
+				OldestKey = &Pair.Key;
+			}
+		}
+
+		const FString KeyToRemove = *OldestKey;
+		TotalBytes -= Entries[KeyToRemove].Response.Len() * sizeof(TCHAR);
+		Entries.Remove(KeyToRemove);
+	}
+}
+
+void FMetadataResponseCache::BumpPackage(const UObject* Object)
+{
+	if (Object)
+	{
+		++PackageGenerations.FindOrAdd(Object->GetOutermost()->GetFName());
+	}
+}
+
+void FMetadataResponseCache::BumpEpoch()
+{
+	++Epoch;
+}
+
+void FMetadataResponseCache::HandleObjectModified(UObject* Object)
+{
+	BumpPackage(Object);
+}
+
+void FMetadataResponseCache::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+	BumpPackage(Object);
+}
+
+void FMetadataResponseCache::HandlePackageMarkedDirty(UPackage* Package, bool bWasDirty)
+{
+	BumpPackage(Package);
+}
+
+void FMetadataResponseCache::HandleObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+	BumpEpoch();
+}
+
+void FMetadataResponseCache::HandleReloadComplete(EReloadCompleteReason Reason)
+{
+	BumpEpoch();
+}
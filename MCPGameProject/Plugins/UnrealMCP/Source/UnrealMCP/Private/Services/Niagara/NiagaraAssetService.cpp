@@ -210,9 +210,8 @@ bool FNiagaraService::AddEmitterToSystem(const FString& SystemPath, const FStrin
     // This is what the engine does after adding emitters - fixes ParameterMap traversal errors
     System->OnSystemPostEditChange().Broadcast(System);
 
-    // Request synchronous compilation and wait for it to complete
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    // Queue a recompile; edits in quick succession share one compile
+    QueueSystemCompile(System);
 
     RefreshEditors(System);
 
@@ -330,9 +329,8 @@ bool FNiagaraService::SetEmitterEnabled(const FString& SystemPath, const FString
     // Mark dirty and recompile
     MarkSystemDirty(System);
 
-    // Request compilation and wait
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    // Queue a recompile; edits in quick succession share one compile
+    QueueSystemCompile(System);
 
     RefreshEditors(System);
 
@@ -477,10 +475,10 @@ bool FNiagaraService::SetEmitterProperty(const FNiagaraEmitterPropertyParams& Pa
 
     // Mark dirty and recompile
     MarkSystemDirty(System);
+    InvalidateModuleInputSchemas(EmitterHandle.GetInstance().Emitter);
 
-    // Request compilation and wait
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    // Queue a recompile; edits in quick succession share one compile
+    QueueSystemCompile(System);
 
     RefreshEditors(System);
 
@@ -589,9 +587,8 @@ bool FNiagaraService::RemoveEmitterFromSystem(const FString& SystemPath, const F
     // Broadcast post-edit change to trigger parameter map rebuilding
     System->OnSystemPostEditChange().Broadcast(System);
 
-    // Request compilation and wait
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    // Queue a recompile; edits in quick succession share one compile
+    QueueSystemCompile(System);
 
     RefreshEditors(System);
 
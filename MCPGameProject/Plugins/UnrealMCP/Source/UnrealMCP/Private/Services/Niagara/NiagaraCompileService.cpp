@@ -1,5 +1,5 @@
 // NiagaraCompileService.cpp - Compilation
-// CompileAsset
+// CompileAsset, compile queue (QueueSystemCompile, FlushSystemCompile, GetSystemCompileStatus)
 
 #include "Services/NiagaraService.h"
 
@@ -11,14 +11,22 @@
 #include "NiagaraNodeFunctionCall.h"
 #include "NiagaraScriptSource.h"
 
+namespace
+{
+    // Edits arriving closer together than this share one compile
+    constexpr double CompileQueueSettleSeconds = 0.5;
+}
+
 bool FNiagaraService::CompileAsset(const FString& AssetPath, FString& OutError)
 {
     // Try as system first
     UNiagaraSystem* System = FindSystem(AssetPath);
     if (System)
     {
-        // Request compilation
-        System->RequestCompile(false);  // false = synchronous
+        // Start the queued compile now (or a fresh one if nothing is queued) and wait for it
+        bool bForce = false;
+        PendingCompiles.RemoveAndCopyValue(System, bForce);
+        System->RequestCompile(bForce);
         System->WaitForCompilationComplete();
 
         // In UE5.7, we check if the system is valid after compilation
@@ -277,3 +285,92 @@ bool FNiagaraService::CompileAsset(const FString& AssetPath, FString& OutError)
     OutError = FString::Printf(TEXT("Asset not found: %s"), *AssetPath);
     return false;
 }
+
+// ============================================================================
+// Compile Queue
+// ============================================================================
+
+void FNiagaraService::QueueSystemCompile(UNiagaraSystem* System, bool bForce)
+{
+    if (!System)
+    {
+        return;
+    }
+
+    bool& bPendingForce = PendingCompiles.FindOrAdd(System, false);
+    bPendingForce |= bForce;
+    LastCompileQueueTime = FPlatformTime::Seconds();
+
+    if (!CompileQueueTickerHandle.IsValid())
+    {
+        CompileQueueTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FNiagaraService::TickCompileQueue));
+    }
+}
+
+bool FNiagaraService::TickCompileQueue(float DeltaTime)
+{
+    if (FPlatformTime::Seconds() - LastCompileQueueTime < CompileQueueSettleSeconds)
+    {
+        return true;
+    }
+
+    // Start every queued compile without waiting; the Niagara compile manager finishes them in the background
+    TMap<TWeakObjectPtr<UNiagaraSystem>, bool> ToCompile = MoveTemp(PendingCompiles);
+    PendingCompiles.Reset();
+    for (const TPair<TWeakObjectPtr<UNiagaraSystem>, bool>& Pair : ToCompile)
+    {
+        if (UNiagaraSystem* System = Pair.Key.Get())
+        {
+            System->RequestCompile(Pair.Value);
+            UE_LOG(LogNiagaraService, Verbose, TEXT("Started queued compile for '%s'"), *System->GetPathName());
+        }
+    }
+
+    CompileQueueTickerHandle.Reset();
+    return false;
+}
+
+void FNiagaraService::Shutdown()
+{
+    if (CompileQueueTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(CompileQueueTickerHandle);
+        CompileQueueTickerHandle.Reset();
+    }
+    PendingCompiles.Reset();
+}
+
+void FNiagaraService::FlushSystemCompile(UNiagaraSystem* System, bool bWaitForCompletion)
+{
+    if (!System)
+    {
+        return;
+    }
+
+    bool bForce = false;
+    if (PendingCompiles.RemoveAndCopyValue(System, bForce))
+    {
+        System->RequestCompile(bForce);
+    }
+
+    if (bWaitForCompletion)
+    {
+        System->WaitForCompilationComplete();
+    }
+}
+
+FString FNiagaraService::GetSystemCompileStatus(const UNiagaraSystem* System) const
+{
+    if (!System)
+    {
+        return TEXT("unknown");
+    }
+
+    if (PendingCompiles.Contains(const_cast<UNiagaraSystem*>(System)))
+    {
+        return TEXT("queued");
+    }
+
+    return System->HasOutstandingCompilationRequests() ? TEXT("compiling") : TEXT("up_to_date");
+}
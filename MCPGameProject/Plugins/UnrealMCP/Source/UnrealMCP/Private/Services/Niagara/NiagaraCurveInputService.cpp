@@ -1196,8 +1196,8 @@ bool FNiagaraService::SetModuleCurveInput(const FNiagaraModuleCurveInputParams&
 
     // CRITICAL: Force system recompile for runtime to pick up graph changes
     // Use bForce=true to ensure recompile even if system thinks nothing changed
-    System->RequestCompile(true);
-    UE_LOG(LogNiagaraService, Log, TEXT("Forced system recompile after curve input change"));
+    QueueSystemCompile(System, true);
+    UE_LOG(LogNiagaraService, Log, TEXT("Queued forced system recompile after curve input change"));
 
     // Refresh editors
     RefreshEditors(System);
@@ -1479,8 +1479,8 @@ bool FNiagaraService::SetModuleColorCurveInput(const FNiagaraModuleColorCurveInp
     Graph->NotifyGraphChanged();
 
     // CRITICAL: Force system recompile for runtime to pick up graph changes
-    System->RequestCompile(false);
-    UE_LOG(LogNiagaraService, Log, TEXT("Requested system recompile after color curve input change"));
+    QueueSystemCompile(System);
+    UE_LOG(LogNiagaraService, Log, TEXT("Queued system recompile after color curve input change"));
 
     // Refresh editors
     RefreshEditors(System);
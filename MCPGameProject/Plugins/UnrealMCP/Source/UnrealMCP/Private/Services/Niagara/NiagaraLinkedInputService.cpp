@@ -375,7 +375,7 @@ bool FNiagaraService::SetModuleLinkedInput(const FNiagaraModuleLinkedInputParams
 
     // CRITICAL: Force system recompile for runtime to pick up graph changes
     // Use bForce=true to ensure recompile even if system thinks nothing changed
-    System->RequestCompile(true);
+    QueueSystemCompile(System, true);
 
     // Refresh editors
     RefreshEditors(System);
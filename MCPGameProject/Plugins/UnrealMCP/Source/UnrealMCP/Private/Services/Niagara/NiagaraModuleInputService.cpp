@@ -145,8 +145,7 @@ bool FNiagaraService::SetModuleInput(const FNiagaraModuleInputParams& Params, FS
         {
             MarkSystemDirty(System);
             Graph->NotifyGraphChanged();
-            System->RequestCompile(false);
-            System->WaitForCompilationComplete();
+            QueueSystemCompile(System);
             RefreshEditors(System);
             return true;
         }
@@ -680,8 +679,7 @@ bool FNiagaraService::SetModuleInput(const FNiagaraModuleInputParams& Params, FS
     // Mark system dirty and force recompile to update UI
     MarkSystemDirty(System);
     Graph->NotifyGraphChanged();
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    QueueSystemCompile(System);
 
     // Refresh editors to show updated values
     RefreshEditors(System);
@@ -24,26 +24,168 @@
 #include "ViewModels/Stack/NiagaraParameterHandle.h"
 #include "EdGraphSchema_Niagara.h"
 
-// Helper to find UNiagaraNodeStaticSwitch in module graph by parameter name
-static UNiagaraNodeStaticSwitch* FindStaticSwitchNodeByName(UNiagaraGraph* Graph, const FName& ParameterName)
+namespace
 {
-    if (!Graph)
+    /**
+     * Static part of a module's input list: the inputs reported by the stack utilities (names, types,
+     * defaults) and the module graph's static switch nodes. It only changes when the module script,
+     * its selected version, its graph, the owning system or emitter, the emitter's compile constants
+     * (which resolve the switches), or the static switch values on the calling node change.
+     */
+    struct FModuleInputSchema
     {
-        return nullptr;
-    }
+        TArray<FNiagaraVariable> Inputs;
+        TMap<FName, TWeakObjectPtr<UNiagaraNodeStaticSwitch>> StaticSwitchNodes;
 
-    TArray<UNiagaraNodeStaticSwitch*> StaticSwitchNodes;
-    Graph->GetNodesOfClass<UNiagaraNodeStaticSwitch>(StaticSwitchNodes);
+        UNiagaraNodeStaticSwitch* FindStaticSwitch(const FName& ParameterName) const
+        {
+            const TWeakObjectPtr<UNiagaraNodeStaticSwitch>* Found = StaticSwitchNodes.Find(ParameterName);
+            return Found ? Found->Get() : nullptr;
+        }
+    };
 
-    for (UNiagaraNodeStaticSwitch* SwitchNode : StaticSwitchNodes)
+    struct FModuleInputSchemaKey
     {
-        if (SwitchNode && SwitchNode->InputParameterName == ParameterName)
+        TWeakObjectPtr<UNiagaraScript> ModuleScript;
+        TWeakObjectPtr<UNiagaraSystem> System;
+        TWeakObjectPtr<UNiagaraEmitter> Emitter;
+        FGuid ScriptVersion;
+        FGuid EmitterVersion;
+        FGuid GraphChangeId;
+        /** Emitter settings the compile constant resolver reads (sim target, local space, ...) */
+        uint32 EmitterConstants = 0;
+        /** Name and default value of every input pin on the calling node, in pin order */
+        TArray<TPair<FName, FString>> PinState;
+        uint32 PinStateHash = 0;
+        uint8 Usage = 0;
+
+        bool operator==(const FModuleInputSchemaKey& Other) const
+        {
+            // The hash only narrows the lookup; the pin state itself decides equality
+            return ModuleScript == Other.ModuleScript
+                && System == Other.System
+                && Emitter == Other.Emitter
+                && ScriptVersion == Other.ScriptVersion
+                && EmitterVersion == Other.EmitterVersion
+                && GraphChangeId == Other.GraphChangeId
+                && EmitterConstants == Other.EmitterConstants
+                && PinStateHash == Other.PinStateHash
+                && Usage == Other.Usage
+                && PinState == Other.PinState;
+        }
+
+        friend uint32 GetTypeHash(const FModuleInputSchemaKey& Key)
         {
-            return SwitchNode;
+            uint32 Hash = HashCombine(GetTypeHash(Key.ModuleScript), GetTypeHash(Key.ScriptVersion));
+            Hash = HashCombine(Hash, HashCombine(GetTypeHash(Key.System), GetTypeHash(Key.Emitter)));
+            Hash = HashCombine(Hash, HashCombine(GetTypeHash(Key.EmitterVersion), GetTypeHash(Key.GraphChangeId)));
+            Hash = HashCombine(Hash, Key.EmitterConstants);
+            return HashCombine(Hash, HashCombine(Key.PinStateHash, Key.Usage));
         }
+    };
+
+    constexpr int32 MaxCachedModuleInputSchemas = 256;
+    TMap<FModuleInputSchemaKey, TSharedPtr<const FModuleInputSchema>> ModuleInputSchemaCache;
+
+    TSharedRef<FModuleInputSchema> BuildModuleInputSchema(UNiagaraNodeFunctionCall& ModuleNode, UNiagaraSystem* System, ENiagaraScriptUsage ScriptUsage)
+    {
+        TSharedRef<FModuleInputSchema> Schema = MakeShared<FModuleInputSchema>();
+
+        // Same query SetModuleInput uses; this traversal of the module graph is the expensive part
+        FCompileConstantResolver ConstantResolver(System, ScriptUsage);
+        FNiagaraStackGraphUtilities::GetStackFunctionInputs(
+            ModuleNode,
+            Schema->Inputs,
+            ConstantResolver,
+            FNiagaraStackGraphUtilities::ENiagaraGetStackFunctionInputPinsOptions::ModuleInputsOnly
+        );
+
+        if (UNiagaraGraph* CalledGraph = ModuleNode.GetCalledGraph())
+        {
+            TArray<UNiagaraNodeStaticSwitch*> StaticSwitchNodes;
+            CalledGraph->GetNodesOfClass<UNiagaraNodeStaticSwitch>(StaticSwitchNodes);
+            for (UNiagaraNodeStaticSwitch* SwitchNode : StaticSwitchNodes)
+            {
+                if (SwitchNode && !Schema->StaticSwitchNodes.Contains(SwitchNode->InputParameterName))
+                {
+                    Schema->StaticSwitchNodes.Add(SwitchNode->InputParameterName, SwitchNode);
+                }
+            }
+        }
+
+        return Schema;
     }
 
-    return nullptr;
+    /**
+     * Get the input schema for a module node, reusing a cached one when the module script, version,
+     * graph, owning system and emitter, and static switch values are unchanged. Current override
+     * values are not part of the schema.
+     */
+    TSharedPtr<const FModuleInputSchema> GetModuleInputSchema(UNiagaraNodeFunctionCall& ModuleNode, UNiagaraSystem* System, const FVersionedNiagaraEmitter& Emitter, ENiagaraScriptUsage ScriptUsage, bool& bOutFromCache)
+    {
+        bOutFromCache = false;
+
+        UNiagaraScript* ModuleScript = ModuleNode.FunctionScript;
+        if (!ModuleScript)
+        {
+            return BuildModuleInputSchema(ModuleNode, System, ScriptUsage);
+        }
+
+        FModuleInputSchemaKey Key;
+        Key.ModuleScript = ModuleScript;
+        Key.System = System;
+        Key.Emitter = Emitter.Emitter;
+        Key.EmitterVersion = Emitter.Version;
+        Key.ScriptVersion = ModuleNode.SelectedScriptVersion;
+        Key.Usage = static_cast<uint8>(ScriptUsage);
+        if (UNiagaraGraph* CalledGraph = ModuleNode.GetCalledGraph())
+        {
+            Key.GraphChangeId = CalledGraph->GetChangeID();
+        }
+        if (const FVersionedNiagaraEmitterData* EmitterData = Emitter.GetEmitterData())
+        {
+            Key.EmitterConstants = static_cast<uint32>(EmitterData->SimTarget)
+                | (EmitterData->bLocalSpace ? 1u << 8 : 0u)
+                | (EmitterData->bDeterminism ? 1u << 9 : 0u)
+                | (EmitterData->bRequiresPersistentIDs ? 1u << 10 : 0u);
+        }
+
+        // Static switch values live on the calling node's input pins and select which inputs exist
+        for (const UEdGraphPin* Pin : ModuleNode.Pins)
+        {
+            if (Pin && Pin->Direction == EGPD_Input)
+            {
+                Key.PinState.Emplace(Pin->PinName, Pin->DefaultValue);
+                Key.PinStateHash = HashCombine(Key.PinStateHash, HashCombine(GetTypeHash(Pin->PinName), GetTypeHash(Pin->DefaultValue)));
+            }
+        }
+
+        if (const TSharedPtr<const FModuleInputSchema>* Cached = ModuleInputSchemaCache.Find(Key))
+        {
+            bOutFromCache = true;
+            return *Cached;
+        }
+
+        if (ModuleInputSchemaCache.Num() >= MaxCachedModuleInputSchemas)
+        {
+            ModuleInputSchemaCache.Reset();
+        }
+
+        TSharedPtr<const FModuleInputSchema> Schema = BuildModuleInputSchema(ModuleNode, System, ScriptUsage);
+        ModuleInputSchemaCache.Add(MoveTemp(Key), Schema);
+        return Schema;
+    }
+}
+
+void FNiagaraService::InvalidateModuleInputSchemas(const UNiagaraEmitter* Emitter)
+{
+    for (auto It = ModuleInputSchemaCache.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().Emitter.IsValid() || It.Key().Emitter.Get() == Emitter)
+        {
+            It.RemoveCurrent();
+        }
+    }
 }
 
 // Helper to add enum options to JSON object from a static switch node
@@ -936,15 +1078,12 @@ bool FNiagaraService::GetModuleInputs(const FString& SystemPath, const FString&
     OutInputs->SetStringField(TEXT("emitter_name"), EmitterName);
     OutInputs->SetStringField(TEXT("stage"), Stage);
 
-    // Get module inputs using the Stack API (same as SetModuleInput)
-    FCompileConstantResolver ConstantResolver(System, ScriptUsage);
-    TArray<FNiagaraVariable> ModuleInputs;
-    FNiagaraStackGraphUtilities::GetStackFunctionInputs(
-        *ModuleNode,
-        ModuleInputs,
-        ConstantResolver,
-        FNiagaraStackGraphUtilities::ENiagaraGetStackFunctionInputPinsOptions::ModuleInputsOnly
-    );
+    // Get module inputs using the Stack API (same as SetModuleInput); the static schema is cached
+    // per module script/version and owning emitter, so only the current values below are read on every call
+    bool bSchemaFromCache = false;
+    const TSharedPtr<const FModuleInputSchema> Schema = GetModuleInputSchema(*ModuleNode, System, EmitterHandle.GetInstance(), ScriptUsage, bSchemaFromCache);
+    const TArray<FNiagaraVariable>& ModuleInputs = Schema->Inputs;
+    OutInputs->SetBoolField(TEXT("schema_cached"), bSchemaFromCache);
 
     // Get emitter unique name for rapid iteration parameter lookup
     FString UniqueEmitterName = EmitterHandle.GetInstance().Emitter->GetUniqueEmitterName();
@@ -1405,21 +1544,16 @@ bool FNiagaraService::GetModuleInputs(const FString& SystemPath, const FString&
                     // Fallback for Niagara static switches - check module's internal graph
                     if (!bEnumResolved && MatchingPin->PinType.PinCategory.ToString() == TEXT("Type"))
                     {
-                        // Get the module's internal graph to find static switch nodes
-                        UNiagaraGraph* ModuleGraph = ModuleNode->GetCalledGraph();
-                        if (ModuleGraph)
+                        // Find static switch by pin name in the module's internal graph
+                        UNiagaraNodeStaticSwitch* SwitchNode = Schema->FindStaticSwitch(MatchingPin->PinName);
+                        if (SwitchNode)
                         {
-                            // Find static switch by pin name
-                            UNiagaraNodeStaticSwitch* SwitchNode = FindStaticSwitchNodeByName(ModuleGraph, MatchingPin->PinName);
-                            if (SwitchNode)
+                            // Use helper to add enum options from the static switch node
+                            AddStaticSwitchEnumOptions(InputObj, SwitchNode, ValueStr);
+                            // Update ValueStr if helper resolved it
+                            if (InputObj->HasField(TEXT("value")))
                             {
-                                // Use helper to add enum options from the static switch node
-                                AddStaticSwitchEnumOptions(InputObj, SwitchNode, ValueStr);
-                                // Update ValueStr if helper resolved it
-                                if (InputObj->HasField(TEXT("value")))
-                                {
-                                    ValueStr = InputObj->GetStringField(TEXT("value"));
-                                }
+                                ValueStr = InputObj->GetStringField(TEXT("value"));
                             }
                         }
                     }
@@ -1561,21 +1695,16 @@ bool FNiagaraService::GetModuleInputs(const FString& SystemPath, const FString&
                 // Static switches in Niagara don't expose UEnum via PinSubCategoryObject
                 if (!bEnumResolved && Pin->PinType.PinCategory.ToString() == TEXT("Type"))
                 {
-                    // Get the module's internal graph to find static switch nodes
-                    UNiagaraGraph* ModuleGraph = ModuleNode->GetCalledGraph();
-                    if (ModuleGraph)
+                    // Find static switch by pin name in the module's internal graph
+                    UNiagaraNodeStaticSwitch* SwitchNode = Schema->FindStaticSwitch(Pin->PinName);
+                    if (SwitchNode)
                     {
-                        // Find static switch by pin name
-                        UNiagaraNodeStaticSwitch* SwitchNode = FindStaticSwitchNodeByName(ModuleGraph, Pin->PinName);
-                        if (SwitchNode)
+                        // Use helper to add enum options from the static switch node
+                        AddStaticSwitchEnumOptions(InputObj, SwitchNode, Value);
+                        // Update Value if helper resolved it
+                        if (InputObj->HasField(TEXT("value")))
                         {
-                            // Use helper to add enum options from the static switch node
-                            AddStaticSwitchEnumOptions(InputObj, SwitchNode, Value);
-                            // Update Value if helper resolved it
-                            if (InputObj->HasField(TEXT("value")))
-                            {
-                                Value = InputObj->GetStringField(TEXT("value"));
-                            }
+                            Value = InputObj->GetStringField(TEXT("value"));
                         }
                     }
                 }
@@ -562,9 +562,8 @@ bool FNiagaraService::RemoveModule(const FNiagaraModuleRemoveParams& Params, FSt
     // Notify graph of changes
     Graph->NotifyGraphChanged();
 
-    // Request compilation and wait for it
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    // Queue a recompile; edits in quick succession share one compile
+    QueueSystemCompile(System);
 
     // Refresh editors
     RefreshEditors(System);
@@ -935,9 +934,8 @@ bool FNiagaraService::MoveModule(const FNiagaraModuleMoveParams& Params, FString
     // Notify graph of changes
     Graph->NotifyGraphChanged();
 
-    // Request compilation
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    // Queue a recompile; edits in quick succession share one compile
+    QueueSystemCompile(System);
 
     // Refresh editors
     RefreshEditors(System);
@@ -629,7 +629,7 @@ bool FNiagaraService::SetModuleRandomInput(const FNiagaraModuleRandomInputParams
     Graph->NotifyGraphChanged();
 
     // CRITICAL: Force system recompile for runtime to pick up graph changes
-    System->RequestCompile(false);
+    QueueSystemCompile(System);
 
     // Refresh editors
     RefreshEditors(System);
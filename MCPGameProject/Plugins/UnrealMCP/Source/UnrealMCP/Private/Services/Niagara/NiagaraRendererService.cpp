@@ -85,9 +85,8 @@ bool FNiagaraService::AddRenderer(const FNiagaraRendererParams& Params, FString&
     // Broadcast post-edit change to trigger parameter map rebuilding
     System->OnSystemPostEditChange().Broadcast(System);
 
-    // Request synchronous compilation and wait for it to complete
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    // Queue a recompile; edits in quick succession share one compile
+    QueueSystemCompile(System);
 
     // Refresh editors
     RefreshEditors(System);
@@ -196,11 +195,10 @@ bool FNiagaraService::SetRendererProperty(const FString& SystemPath, const FStri
 
         UE_LOG(LogNiagaraService, Log, TEXT("Set mesh renderer ParticleMesh to '%s'"), *ValueStr);
 
-        // Mark dirty and compile
+        // Mark dirty and queue a recompile
         MarkSystemDirty(System);
         System->OnSystemPostEditChange().Broadcast(System);
-        System->RequestCompile(false);
-        System->WaitForCompilationComplete();
+        QueueSystemCompile(System);
         RefreshEditors(System);
 
         return true;
@@ -234,11 +232,10 @@ bool FNiagaraService::SetRendererProperty(const FString& SystemPath, const FStri
 
         UE_LOG(LogNiagaraService, Log, TEXT("Set mesh renderer OverrideMaterials to '%s'"), *ValueStr);
 
-        // Mark dirty and compile
+        // Mark dirty and queue a recompile
         MarkSystemDirty(System);
         System->OnSystemPostEditChange().Broadcast(System);
-        System->RequestCompile(false);
-        System->WaitForCompilationComplete();
+        QueueSystemCompile(System);
         RefreshEditors(System);
 
         return true;
@@ -281,11 +278,10 @@ bool FNiagaraService::SetRendererProperty(const FString& SystemPath, const FStri
         RibbonRenderer->Shape = NewShape;
         UE_LOG(LogNiagaraService, Log, TEXT("Set ribbon renderer Shape to '%s'"), *ValueStr);
 
-        // Mark dirty and compile
+        // Mark dirty and queue a recompile
         MarkSystemDirty(System);
         System->OnSystemPostEditChange().Broadcast(System);
-        System->RequestCompile(false);
-        System->WaitForCompilationComplete();
+        QueueSystemCompile(System);
         RefreshEditors(System);
 
         return true;
@@ -311,11 +307,10 @@ bool FNiagaraService::SetRendererProperty(const FString& SystemPath, const FStri
         RibbonRenderer->MultiPlaneCount = Count;
         UE_LOG(LogNiagaraService, Log, TEXT("Set ribbon renderer MultiPlaneCount to %d"), Count);
 
-        // Mark dirty and compile
+        // Mark dirty and queue a recompile
         MarkSystemDirty(System);
         System->OnSystemPostEditChange().Broadcast(System);
-        System->RequestCompile(false);
-        System->WaitForCompilationComplete();
+        QueueSystemCompile(System);
         RefreshEditors(System);
 
         return true;
@@ -341,11 +336,10 @@ bool FNiagaraService::SetRendererProperty(const FString& SystemPath, const FStri
         RibbonRenderer->WidthSegmentationCount = Count;
         UE_LOG(LogNiagaraService, Log, TEXT("Set ribbon renderer WidthSegmentationCount to %d"), Count);
 
-        // Mark dirty and compile
+        // Mark dirty and queue a recompile
         MarkSystemDirty(System);
         System->OnSystemPostEditChange().Broadcast(System);
-        System->RequestCompile(false);
-        System->WaitForCompilationComplete();
+        QueueSystemCompile(System);
         RefreshEditors(System);
 
         return true;
@@ -628,9 +622,8 @@ bool FNiagaraService::SetRendererProperty(const FString& SystemPath, const FStri
     // Broadcast post-edit change to trigger parameter map rebuilding
     System->OnSystemPostEditChange().Broadcast(System);
 
-    // Request synchronous compilation and wait for it to complete
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    // Queue a recompile; edits in quick succession share one compile
+    QueueSystemCompile(System);
 
     // Refresh editors
     RefreshEditors(System);
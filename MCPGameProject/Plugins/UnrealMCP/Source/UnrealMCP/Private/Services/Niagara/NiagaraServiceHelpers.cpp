@@ -359,6 +359,8 @@ void FNiagaraService::AddSystemMetadata(UNiagaraSystem* System, const TArray<FSt
         // In UE5.7, use IsValid() to determine basic compilation status
         FString StatusString = System->IsValid() ? TEXT("Valid") : TEXT("Invalid");
         OutMetadata->SetStringField(TEXT("compile_status"), StatusString);
+        // Edits queue their compile, so report whether the status above is still pending
+        OutMetadata->SetStringField(TEXT("compile_state"), GetSystemCompileStatus(System));
     }
 
     // Parameters
@@ -295,8 +295,7 @@ bool FNiagaraService::SetModuleStaticSwitch(const FNiagaraModuleStaticSwitchPara
     // Mark dirty, notify, and recompile - static switches require recompilation
     MarkSystemDirty(System);
     Graph->NotifyGraphChanged();
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    QueueSystemCompile(System);
     RefreshEditors(System);
 
     UE_LOG(LogNiagaraService, Log, TEXT("Successfully set static switch '%s' on module '%s' to '%s'"),
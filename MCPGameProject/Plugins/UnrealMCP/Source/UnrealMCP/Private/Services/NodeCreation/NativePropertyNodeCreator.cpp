@@ -4,13 +4,86 @@
 #include "NodeCreationHelpers.h"
 #include "K2Node_VariableGet.h"
 #include "K2Node_VariableSet.h"
-#include "UObject/UObjectIterator.h"
+#include "Services/ReflectionCatalog.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerController.h"
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphNode.h"
 
+namespace
+{
+    /** Strip a leading 'b' only when it is followed by an uppercase character (UE bool convention) */
+    FString StripBoolPrefix(const FString& InName)
+    {
+        if (InName.StartsWith(TEXT("b")) && InName.Len() > 1 && FChar::IsUpper(InName[1]))
+        {
+            return InName.Mid(1);
+        }
+        return InName;
+    }
+
+    /** A BlueprintVisible property together with the class that declares it */
+    struct FDeclaredProperty
+    {
+        TWeakObjectPtr<UClass> OwnerClass;
+        FProperty* Property = nullptr;
+    };
+
+    /** Lowercased name option (raw name, bool-stripped name, display name) -> declared properties */
+    using FBlueprintPropertyIndex = TMap<FString, TArray<FDeclaredProperty>>;
+
+    /**
+     * Index of declared BlueprintVisible properties, rebuilt whenever the reflection catalog
+     * snapshot changes (module load, hot reload, Blueprint compile) instead of per request.
+     */
+    const FBlueprintPropertyIndex& GetBlueprintPropertyIndex()
+    {
+        static FBlueprintPropertyIndex Index;
+        static uint32 IndexGeneration = 0;
+
+        FReflectionCatalog& Catalog = FReflectionCatalog::Get();
+        const uint32 CatalogGeneration = Catalog.GetGeneration();
+        if (IndexGeneration == CatalogGeneration)
+        {
+            return Index;
+        }
+
+        Index.Reset();
+        for (UClass* OwnerClass : Catalog.GetDerivedClasses(UObject::StaticClass()))
+        {
+            for (TFieldIterator<FProperty> PropIt(OwnerClass, EFieldIteratorFlags::ExcludeSuper); PropIt; ++PropIt)
+            {
+                FProperty* Property = *PropIt;
+                if (!Property->HasAnyPropertyFlags(CPF_BlueprintVisible))
+                {
+                    continue; // Not visible to Blueprints – skip
+                }
+
+                const FString PropName = Property->GetName();
+                FString DisplayNameMeta = Property->GetMetaData(TEXT("DisplayName"));
+                if (DisplayNameMeta.IsEmpty())
+                {
+                    DisplayNameMeta = NodeCreationHelpers::ConvertPropertyNameToDisplay(PropName);
+                }
+
+                TArray<FString, TInlineAllocator<3>> NameOptions;
+                NameOptions.AddUnique(PropName.ToLower());
+                NameOptions.AddUnique(StripBoolPrefix(PropName).ToLower());
+                NameOptions.AddUnique(DisplayNameMeta.Replace(TEXT(" "), TEXT("")).ToLower());
+
+                for (const FString& Option : NameOptions)
+                {
+                    Index.FindOrAdd(Option).Add({ OwnerClass, Property });
+                }
+            }
+        }
+
+        IndexGeneration = CatalogGeneration;
+        return Index;
+    }
+}
+
 bool FNativePropertyNodeCreator::TryCreateNativePropertyNode(
     const FString& VarName,
     bool bIsGetter,
@@ -23,16 +96,6 @@ bool FNativePropertyNodeCreator::TryCreateNativePropertyNode(
 )
 {
     // Helper lambdas -------------------------------------------------------
-    auto StripBoolPrefix = [](const FString& InName) -> FString
-    {
-        // Strip a leading 'b' only when it is followed by an uppercase character (UE bool convention)
-        if (InName.StartsWith(TEXT("b")) && InName.Len() > 1 && FChar::IsUpper(InName[1]))
-        {
-            return InName.Mid(1);
-        }
-        return InName;
-    };
-
     auto IsPropertyWritable = [bIsGetter](FProperty* Property) -> bool
     {
         const bool bConstParm = Property->HasAnyPropertyFlags(CPF_ConstParm);
@@ -61,65 +124,40 @@ bool FNativePropertyNodeCreator::TryCreateNativePropertyNode(
     };
     TArray<FPropMatch> Matches;
 
-    // Iterate over all loaded classes once and gather potential matches
-    for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
+    // Gather (class, property) pairs from the declared-property index. A property matches on
+    // its declaring class and on every non-deprecated subclass, mirroring an IncludeSuper scan.
+    const FBlueprintPropertyIndex& Index = GetBlueprintPropertyIndex();
+    TSet<FProperty*> SeenProperties;
+    for (const FString& Candidate : Candidates)
     {
-        UClass* TargetClass = *ClassIt;
-        if (!TargetClass || TargetClass->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists))
+        const TArray<FDeclaredProperty>* Declared = Index.Find(Candidate.ToLower());
+        if (!Declared)
         {
             continue;
         }
 
-        for (TFieldIterator<FProperty> PropIt(TargetClass, EFieldIteratorFlags::IncludeSuper); PropIt; ++PropIt)
+        for (const FDeclaredProperty& Entry : *Declared)
         {
-            FProperty* Property = *PropIt;
-            if (!Property->HasAnyPropertyFlags(CPF_BlueprintVisible))
+            UClass* OwnerClass = Entry.OwnerClass.Get();
+            if (!OwnerClass || SeenProperties.Contains(Entry.Property))
             {
-                continue; // Not visible to Blueprints – skip
+                continue; // Owner was garbage collected, or already matched via another candidate
             }
+            SeenProperties.Add(Entry.Property);
 
             // For setter requests ensure the property is writable
-            if (!bIsGetter && !IsPropertyWritable(Property))
+            if (!bIsGetter && !IsPropertyWritable(Entry.Property))
             {
                 continue; // Not writable – skip for setters
             }
 
-            const FString PropName    = Property->GetName();
-            const FString StrippedProp = StripBoolPrefix(PropName);
-
-            // Build list of potential property names for matching
-            TArray<FString> NameOptions;
-            NameOptions.Add(PropName);
-            if (StrippedProp != PropName)
+            if (!OwnerClass->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists))
             {
-                NameOptions.Add(StrippedProp);
+                Matches.Add({ OwnerClass, Entry.Property });
             }
-
-            FString DisplayNameMeta = Property->GetMetaData(TEXT("DisplayName"));
-            if (DisplayNameMeta.IsEmpty())
-            {
-                DisplayNameMeta = NodeCreationHelpers::ConvertPropertyNameToDisplay(PropName);
-            }
-            NameOptions.Add(DisplayNameMeta.Replace(TEXT(" "), TEXT("")));
-
-            // Perform case-insensitive comparison against all candidates
-            bool bMatch = false;
-            for (const FString& Candidate : Candidates)
-            {
-                for (const FString& Option : NameOptions)
-                {
-                    if (Option.Equals(Candidate, ESearchCase::IgnoreCase))
-                    {
-                        bMatch = true;
-                        break;
-                    }
-                }
-                if (bMatch) break;
-            }
-
-            if (bMatch)
+            for (UClass* Derived : FReflectionCatalog::Get().GetDerivedClasses(OwnerClass, CLASS_Deprecated | CLASS_NewerVersionExists))
             {
-                Matches.Add({ TargetClass, Property });
+                Matches.Add({ Derived, Entry.Property });
             }
         }
     }
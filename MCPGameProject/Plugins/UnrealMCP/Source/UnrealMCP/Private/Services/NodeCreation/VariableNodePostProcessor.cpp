@@ -8,7 +8,7 @@
 #include "Engine/Blueprint.h"
 #include "Engine/SimpleConstructionScript.h"
 #include "Engine/SCS_Node.h"
-#include "UObject/UObjectIterator.h"
+#include "Services/ReflectionCatalog.h"
 
 void FVariableNodePostProcessor::ProcessVariableGetNode(
     UK2Node_VariableGet* GetNode,
@@ -125,24 +125,8 @@ void FVariableNodePostProcessor::ProcessVariableSetNode(
 
 UClass* FVariableNodePostProcessor::FindClassByName(const FString& ClassName)
 {
-    FString ClassNameWithSuffix = ClassName;
-    if (!ClassNameWithSuffix.EndsWith(TEXT("_C")))
-    {
-        ClassNameWithSuffix += TEXT("_C");
-    }
-
-    // Search for Blueprint-generated class
-    for (TObjectIterator<UClass> It; It; ++It)
-    {
-        UClass* TestClass = *It;
-        if (TestClass && (TestClass->GetName().Equals(ClassName, ESearchCase::IgnoreCase) ||
-                          TestClass->GetName().Equals(ClassNameWithSuffix, ESearchCase::IgnoreCase)))
-        {
-            return TestClass;
-        }
-    }
-
-    return nullptr;
+    // The catalog matches case-insensitively with or without the Blueprint "_C" suffix
+    return FReflectionCatalog::Get().FindClassByName(ClassName);
 }
 
 bool FVariableNodePostProcessor::IsSelfVariable(UBlueprint* Blueprint, FName VarName)
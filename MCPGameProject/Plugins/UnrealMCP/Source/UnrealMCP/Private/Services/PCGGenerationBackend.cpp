@@ -0,0 +1,211 @@
+#include "Services/IPCGGenerationBackend.h"
+
+#include "Data/PCGBasePointData.h"
+#include "PCGComponent.h"
+#include "PCGData.h"
+#include "PCGGraph.h"
+#include "PCGNode.h"
+#include "UObject/ObjectKey.h"
+
+#if WITH_EDITOR
+#include "Graph/PCGGraphExecutionInspection.h"
+#endif
+
+namespace
+{
+void CountOutput(const FPCGDataCollection& Collection, int32& OutPoints, int32& OutDataCount)
+{
+	OutDataCount += Collection.TaggedData.Num();
+	for (const FPCGTaggedData& Tagged : Collection.TaggedData)
+	{
+		if (const UPCGBasePointData* PointData = Cast<UPCGBasePointData>(Tagged.Data))
+		{
+			OutPoints += PointData->GetNumPoints();
+		}
+	}
+}
+
+class FPCGGenerationBackend final : public IPCGGenerationBackend
+{
+public:
+	virtual bool StartGeneration(UPCGComponent& Component, const FPCGGenerationOptions& Options, const void* Listener, TFunction<void(bool bGenerated)> OnFinished, FString& OutError) override
+	{
+		if (!Component.GetGraph())
+		{
+			OutError = TEXT("PCG Component has no graph assigned");
+			return false;
+		}
+
+		// Another batch is already waiting for this component: share its generation rather than
+		// restarting it, so both batches see the same notification
+		if (FTracking* Existing = Tracked.Find(&Component))
+		{
+			if (Component.IsGenerating())
+			{
+				Existing->Listeners->Add(Listener, MoveTemp(OnFinished));
+				return true;
+			}
+		}
+
+		FTracking& Tracking = Tracked.FindOrAdd(&Component);
+		Tracking.Listeners->Add(Listener, MoveTemp(OnFinished));
+		if (!Tracking.GeneratedHandle.IsValid())
+		{
+			Tracking.GeneratedHandle = Component.OnPCGGraphGeneratedDelegate.AddLambda([Listeners = Tracking.Listeners](UPCGComponent*)
+			{
+				NotifyListeners(Listeners, true);
+			});
+			Tracking.CancelledHandle = Component.OnPCGGraphCancelledDelegate.AddLambda([Listeners = Tracking.Listeners](UPCGComponent*)
+			{
+				NotifyListeners(Listeners, false);
+			});
+		}
+
+#if WITH_EDITOR
+		if (Options.bCollectNodeStats)
+		{
+			FPCGGraphExecutionInspection& Inspection = Component.GetExecutionState().GetInspection();
+			if (!Inspection.IsInspecting())
+			{
+				Inspection.EnableInspection();
+				Tracking.bEnabledInspection = true;
+			}
+		}
+#endif
+
+		// Same reset as before generation was tracked: stale output must not count towards the result
+		Component.CleanupLocalImmediate(/*bRemoveComponents=*/true);
+		Component.GenerateLocal(Options.bForce);
+
+		// Nothing was scheduled (up to date without force, or finished inline): no notification will follow.
+		// Completion is idempotent, so a notification that already fired is harmless.
+		if (!Component.IsGenerating())
+		{
+			NotifyListeners(Tracking.Listeners, true);
+		}
+		return true;
+	}
+
+	virtual void CollectStats(UPCGComponent& Component, const FPCGGenerationOptions& Options, FPCGComponentGenerationResult& OutResult) override
+	{
+		CountOutput(Component.GetGeneratedGraphOutput(), OutResult.OutputPoints, OutResult.OutputDataCount);
+
+#if WITH_EDITOR
+		if (!Options.bCollectNodeStats)
+		{
+			return;
+		}
+
+		const FPCGGraphExecutionInspection& Inspection = Component.GetExecutionState().GetInspection();
+		for (const auto& NodeAndStacks : Inspection.GetExecutedNodeStacks())
+		{
+			const UPCGNode* Node = NodeAndStacks.Key.ResolveObjectPtr();
+			if (!Node)
+			{
+				continue;
+			}
+
+			FPCGNodeExecutionStats& Stats = OutResult.Nodes.AddDefaulted_GetRef();
+			Stats.NodeName = Node->GetName();
+			Stats.NodeTitle = Node->GetNodeTitle(EPCGNodeTitleType::ListView).ToString();
+			for (const auto& Executed : NodeAndStacks.Value)
+			{
+				++Stats.Executions;
+				Stats.ExecutionMs += Executed.Timer.ExecutionTime() * 1000.0;
+				Stats.PrepareMs += Executed.Timer.PrepareDataTime() * 1000.0;
+
+				// Inspection data is keyed by the stack including the node's own frame
+				FPCGStack NodeStack = Executed.Stack;
+				NodeStack.PushFrame(Node);
+				if (const FPCGDataCollection* NodeOutput = Inspection.GetInspectionData(NodeStack))
+				{
+					CountOutput(*NodeOutput, Stats.OutputPoints, Stats.OutputDataCount);
+				}
+			}
+		}
+
+		OutResult.Nodes.Sort([](const FPCGNodeExecutionStats& A, const FPCGNodeExecutionStats& B)
+		{
+			return A.ExecutionMs + A.PrepareMs > B.ExecutionMs + B.PrepareMs;
+		});
+#endif
+	}
+
+	virtual void CancelGeneration(UPCGComponent& Component) override
+	{
+		// Listeners stop tracking before cancelling; one that remains is another batch still waiting
+		if (!Tracked.Contains(&Component))
+		{
+			Component.CancelGeneration();
+		}
+	}
+
+	virtual void StopTracking(UPCGComponent& Component, const void* Listener) override
+	{
+		FTracking* Existing = Tracked.Find(&Component);
+		if (!Existing)
+		{
+			return;
+		}
+		Existing->Listeners->Remove(Listener);
+		if (Existing->Listeners->Num() > 0)
+		{
+			return;
+		}
+
+		FTracking Tracking;
+		Tracked.RemoveAndCopyValue(&Component, Tracking);
+		RemoveDelegates(Component, Tracking);
+
+#if WITH_EDITOR
+		// Leave inspection alone if the user had it enabled in the graph editor
+		if (Tracking.bEnabledInspection)
+		{
+			Component.GetExecutionState().GetInspection().DisableInspection();
+		}
+#endif
+	}
+
+private:
+	/** Completion callbacks of every batch waiting for one component, keyed by listener */
+	using FListeners = TMap<const void*, TFunction<void(bool)>>;
+
+	struct FTracking
+	{
+		FDelegateHandle GeneratedHandle;
+		FDelegateHandle CancelledHandle;
+		TSharedRef<FListeners> Listeners = MakeShared<FListeners>();
+		bool bEnabledInspection = false;
+	};
+
+	/**
+	 * Callbacks unsubscribe via StopTracking, which can destroy the calling delegate lambda and the
+	 * listener map mid-broadcast; both are copied onto the stack before any callback runs
+	 */
+	static void NotifyListeners(const TSharedRef<FListeners>& Listeners, bool bGenerated)
+	{
+		const TSharedRef<FListeners> Pinned = Listeners;
+		TArray<TFunction<void(bool)>> Callbacks;
+		Pinned->GenerateValueArray(Callbacks);
+		for (const TFunction<void(bool)>& Callback : Callbacks)
+		{
+			Callback(bGenerated);
+		}
+	}
+
+	static void RemoveDelegates(UPCGComponent& Component, FTracking& Tracking)
+	{
+		Component.OnPCGGraphGeneratedDelegate.Remove(Tracking.GeneratedHandle);
+		Component.OnPCGGraphCancelledDelegate.Remove(Tracking.CancelledHandle);
+		Tracking.GeneratedHandle.Reset();
+		Tracking.CancelledHandle.Reset();
+	}
+
+	TMap<TObjectKey<UPCGComponent>, FTracking> Tracked;
+};
+}
+
+TSharedRef<IPCGGenerationBackend> CreatePCGGenerationBackend()
+{
+	return MakeShared<FPCGGenerationBackend>();
+}
@@ -0,0 +1,209 @@
+#include "Services/PCGGenerationBatch.h"
+
+#include "GameFramework/Actor.h"
+#include "PCGComponent.h"
+#include "PCGGraph.h"
+
+const TCHAR* FPCGComponentGenerationResult::StateToString(EPCGGenerationState State)
+{
+	switch (State)
+	{
+	case EPCGGenerationState::Generating: return TEXT("generating");
+	case EPCGGenerationState::Generated: return TEXT("generated");
+	case EPCGGenerationState::Cancelled: return TEXT("cancelled");
+	default: return TEXT("failed");
+	}
+}
+
+FPCGGenerationBatch::FPCGGenerationBatch(const TArray<UPCGComponent*>& InComponents, const FPCGGenerationOptions& InOptions, TSharedRef<IPCGGenerationBackend> InBackend)
+	: Options(InOptions)
+	, Backend(MoveTemp(InBackend))
+{
+	Components.Reserve(InComponents.Num());
+	Results.Reserve(InComponents.Num());
+	for (UPCGComponent* Component : InComponents)
+	{
+		Components.Add(Component);
+		FPCGComponentGenerationResult& Result = Results.AddDefaulted_GetRef();
+		if (Component)
+		{
+			const AActor* Owner = Component->GetOwner();
+			Result.ActorLabel = Owner ? Owner->GetActorNameOrLabel() : Component->GetName();
+			Result.GraphPath = Component->GetGraph() ? Component->GetGraph()->GetPathName() : FString();
+		}
+	}
+}
+
+FPCGGenerationBatch::~FPCGGenerationBatch()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	}
+}
+
+void FPCGGenerationBatch::Start(TFunction<void(const FPCGGenerationBatch&)> InOnComplete)
+{
+	check(IsInGameThread());
+	check(!bStarted);
+	bStarted = true;
+	OnComplete = MoveTemp(InOnComplete);
+	KeepAlive = AsShared();
+	StartSeconds = FPlatformTime::Seconds();
+
+	// Everything is counted as pending first: a backend may report completion synchronously
+	Pending = Components.Num();
+	const TWeakPtr<FPCGGenerationBatch> WeakThis = AsShared();
+	for (int32 Index = 0; Index < Components.Num(); ++Index)
+	{
+		UPCGComponent* Component = Components[Index].Get();
+		if (!Component)
+		{
+			FinishComponent(Index, EPCGGenerationState::Failed, TEXT("Component no longer exists"));
+			continue;
+		}
+
+		FString Error;
+		const bool bScheduled = Backend->StartGeneration(*Component, Options, this, [WeakThis, Index](bool bGenerated)
+		{
+			if (TSharedPtr<FPCGGenerationBatch> This = WeakThis.Pin())
+			{
+				This->HandleFinished(Index, bGenerated);
+			}
+		}, Error);
+
+		if (!bScheduled)
+		{
+			FinishComponent(Index, EPCGGenerationState::Failed, Error);
+		}
+	}
+
+	if (!bComplete)
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateSP(this, &FPCGGenerationBatch::HandleTick), 0.1f);
+	}
+	CompleteIfDone();
+}
+
+void FPCGGenerationBatch::HandleFinished(int32 Index, bool bGenerated)
+{
+	if (!Results.IsValidIndex(Index) || Results[Index].State != EPCGGenerationState::Generating)
+	{
+		return;
+	}
+
+	if (UPCGComponent* Component = Components[Index].Get())
+	{
+		if (bGenerated)
+		{
+			Backend->CollectStats(*Component, Options, Results[Index]);
+		}
+		Backend->StopTracking(*Component, this);
+	}
+	FinishComponent(Index, bGenerated ? EPCGGenerationState::Generated : EPCGGenerationState::Cancelled,
+		bGenerated ? FString() : FString(TEXT("Generation was cancelled")));
+	CompleteIfDone();
+}
+
+void FPCGGenerationBatch::FinishComponent(int32 Index, EPCGGenerationState State, const FString& Error)
+{
+	FPCGComponentGenerationResult& Result = Results[Index];
+	if (Result.State != EPCGGenerationState::Generating)
+	{
+		return;
+	}
+	Result.State = State;
+	Result.Error = Error;
+	Result.GenerationMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+	--Pending;
+}
+
+bool FPCGGenerationBatch::HandleTick(float DeltaTime)
+{
+	const bool bTimedOut = FPlatformTime::Seconds() - StartSeconds > Options.TimeoutSeconds;
+	for (int32 Index = 0; Index < Components.Num(); ++Index)
+	{
+		if (Results[Index].State != EPCGGenerationState::Generating)
+		{
+			continue;
+		}
+
+		UPCGComponent* Component = Components[Index].Get();
+		if (!Component)
+		{
+			FinishComponent(Index, EPCGGenerationState::Failed, TEXT("Component was destroyed while generating"));
+		}
+		else if (bTimedOut)
+		{
+			Backend->StopTracking(*Component, this);
+			Backend->CancelGeneration(*Component);
+			FinishComponent(Index, EPCGGenerationState::Failed,
+				FString::Printf(TEXT("Timed out after %.0f seconds"), Options.TimeoutSeconds));
+		}
+	}
+
+	CompleteIfDone();
+	return !bComplete;
+}
+
+void FPCGGenerationBatch::Cancel()
+{
+	for (int32 Index = 0; Index < Components.Num(); ++Index)
+	{
+		if (Results[Index].State != EPCGGenerationState::Generating)
+		{
+			continue;
+		}
+		if (UPCGComponent* Component = Components[Index].Get())
+		{
+			Backend->StopTracking(*Component, this);
+			Backend->CancelGeneration(*Component);
+		}
+		FinishComponent(Index, EPCGGenerationState::Cancelled, TEXT("Generation was cancelled"));
+	}
+	CompleteIfDone();
+}
+
+void FPCGGenerationBatch::CompleteIfDone()
+{
+	if (bComplete || !bStarted || Pending > 0)
+	{
+		return;
+	}
+
+	bComplete = true;
+	EndSeconds = FPlatformTime::Seconds();
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	// Release the self reference only after the callback, which may still read results
+	TSharedPtr<FPCGGenerationBatch> Self = MoveTemp(KeepAlive);
+	if (OnComplete)
+	{
+		TFunction<void(const FPCGGenerationBatch&)> Callback = MoveTemp(OnComplete);
+		Callback(*this);
+	}
+}
+
+int32 FPCGGenerationBatch::Count(EPCGGenerationState State) const
+{
+	int32 Total = 0;
+	for (const FPCGComponentGenerationResult& Result : Results)
+	{
+		Total += Result.State == State ? 1 : 0;
+	}
+	return Total;
+}
+
+double FPCGGenerationBatch::GetElapsedMs() const
+{
+	if (!bStarted)
+	{
+		return 0.0;
+	}
+	return ((bComplete ? EndSeconds : FPlatformTime::Seconds()) - StartSeconds) * 1000.0;
+}
@@ -5,6 +5,7 @@
 #include "Kismet2/EnumEditorUtils.h"
 #include "AssetToolsModule.h"
 #include "Factories/EnumFactory.h"
+#include "ScopedTransaction.h"
 
 FProjectEnumService& FProjectEnumService::Get()
 {
@@ -60,69 +61,10 @@ bool FProjectEnumService::CreateEnum(const FString& EnumName, const FString& Pat
         return false;
     }
 
-    // Set the enum description (the "Enum Description" property visible in the editor)
-    if (!Description.IsEmpty())
-    {
-#if WITH_EDITORONLY_DATA
-        NewEnum->EnumDescription = FText::FromString(Description);
-#endif
-        // Also set as tooltip metadata for additional compatibility
-        NewEnum->SetMetaData(TEXT("ToolTip"), *Description);
-    }
-
-    // The enum is created with one default enumerator, we need to set up the values properly
-    // First, get the count of existing enumerators to remove the default one later
-    int32 InitialEnumCount = NewEnum->NumEnums();
-
-    // Add the user-specified enumerators using the proper method that sets internal names
-    for (int32 i = 0; i < Values.Num(); ++i)
-    {
-        // Use SetEnumerators which properly sets BOTH internal name AND display name
-        // We'll add each value by directly manipulating the enum's internal data
-
-        // Add a new enumerator first (creates with default name)
-        FEnumEditorUtils::AddNewEnumeratorForUserDefinedEnum(NewEnum);
-
-        // Get the index of the newly added enumerator (it's added at the end, before MAX)
-        int32 NewIndex = NewEnum->NumEnums() - 2; // -1 for MAX, -1 for 0-based
-
-        // Set the display name for this enumerator
-        FText DisplayName = FText::FromString(Values[i]);
-        FEnumEditorUtils::SetEnumeratorDisplayName(NewEnum, NewIndex, DisplayName);
-    }
-
-    // Remove the initial default enumerators that were created with the enum
-    // We need to remove them from the end to avoid index shifting issues
-    // The default enum creates entries like "NewEnumerator0"
-    for (int32 i = InitialEnumCount - 1; i >= 0; --i)
-    {
-        // Only remove if this is a default-named enumerator
-        FName EnumEntryName = NewEnum->GetNameByIndex(i);
-        FString EntryNameStr = EnumEntryName.ToString();
-        if (EntryNameStr.Contains(TEXT("NewEnumerator")) || EntryNameStr.Contains(TEXT("::NewEnumerator")))
-        {
-            FEnumEditorUtils::RemoveEnumeratorFromUserDefinedEnum(NewEnum, i);
-        }
-    }
-
-    // Set per-value descriptions (tooltips) if provided
-    // Iterate through the enum values and match by display name
-    if (ValueDescriptions.Num() > 0)
+    // The factory adds a placeholder enumerator; the definition replaces it in the same pass
+    if (!ApplyEnumDefinition(NewEnum, Description, Values, ValueDescriptions, OutError))
     {
-        for (int32 i = 0; i < NewEnum->NumEnums() - 1; ++i) // -1 to skip _MAX
-        {
-            FText DisplayNameText = NewEnum->GetDisplayNameTextByIndex(i);
-            FString DisplayNameStr = DisplayNameText.ToString();
-
-            if (const FString* ValueDesc = ValueDescriptions.Find(DisplayNameStr))
-            {
-                if (!ValueDesc->IsEmpty())
-                {
-                    NewEnum->SetMetaData(TEXT("ToolTip"), **ValueDesc, i);
-                    UE_LOG(LogTemp, Display, TEXT("MCP Project: Set description for enum value '%s': '%s'"), *DisplayNameStr, **ValueDesc);
-                }
-            }
-        }
+        return false;
     }
 
     // Mark the enum as modified and save
@@ -184,75 +126,130 @@ bool FProjectEnumService::UpdateEnum(const FString& EnumName, const FString& Pat
         return false;
     }
 
-    // Update the enum description if provided
-    if (!Description.IsEmpty())
+    if (!ApplyEnumDefinition(ExistingEnum, Description, Values, ValueDescriptions, OutError))
     {
-#if WITH_EDITORONLY_DATA
-        ExistingEnum->EnumDescription = FText::FromString(Description);
-#endif
-        ExistingEnum->SetMetaData(TEXT("ToolTip"), *Description);
+        return false;
     }
 
-    // Remove all existing enumerators (except MAX)
-    // Work backwards to avoid index shifting
-    int32 CurrentCount = ExistingEnum->NumEnums() - 1; // -1 to skip MAX
-    for (int32 i = CurrentCount - 1; i >= 0; --i)
+    // Mark the enum as modified and save
+    ExistingEnum->MarkPackageDirty();
+    UPackage* Package = ExistingEnum->GetPackage();
+    if (Package)
     {
-        FEnumEditorUtils::RemoveEnumeratorFromUserDefinedEnum(ExistingEnum, i);
+        Package->MarkPackageDirty();
     }
 
-    // Add the new enumerators
-    for (int32 i = 0; i < Values.Num(); ++i)
+    // Save the asset
+    UEditorAssetLibrary::SaveAsset(PackageName, false);
+
+    // Log the updated values for debugging
+    UE_LOG(LogTemp, Display, TEXT("MCP Project: Updated enum '%s' with %d values:"), *EnumName, Values.Num());
+    for (int32 i = 0; i < ExistingEnum->NumEnums() - 1; ++i)
     {
-        // Add a new enumerator (creates with default name like NewEnumerator0)
-        FEnumEditorUtils::AddNewEnumeratorForUserDefinedEnum(ExistingEnum);
+        FName InternalName = ExistingEnum->GetNameByIndex(i);
+        FText DisplayName = ExistingEnum->GetDisplayNameTextByIndex(i);
+        UE_LOG(LogTemp, Display, TEXT("  [%d] Internal: '%s' Display: '%s'"), i, *InternalName.ToString(), *DisplayName.ToString());
+    }
 
-        // Get the index of the newly added enumerator (it's added at the end, before MAX)
-        int32 NewIndex = ExistingEnum->NumEnums() - 2; // -1 for MAX, -1 for 0-based
+    return true;
+}
 
-        // Set the display name for this enumerator
-        FText DisplayName = FText::FromString(Values[i]);
-        FEnumEditorUtils::SetEnumeratorDisplayName(ExistingEnum, NewIndex, DisplayName);
+bool FProjectEnumService::ApplyEnumDefinition(UUserDefinedEnum* Enum, const FString& Description, const TArray<FString>& Values, const TMap<FString, FString>& ValueDescriptions, FString& OutError)
+{
+    if (!Enum)
+    {
+        OutError = TEXT("Invalid user-defined enum");
+        return false;
     }
 
-    // Set per-value descriptions (tooltips) if provided
-    if (ValueDescriptions.Num() > 0)
+    if (Values.Num() == 0)
+    {
+        OutError = TEXT("At least one enum value is required");
+        return false;
+    }
+
+    // Display names must be unique, as the enum editor requires
+    TSet<FString> SeenValues;
+    for (const FString& Value : Values)
     {
-        for (int32 i = 0; i < ExistingEnum->NumEnums() - 1; ++i) // -1 to skip _MAX
+        bool bDuplicate = false;
+        SeenValues.Add(Value, &bDuplicate);
+        if (Value.IsEmpty() || bDuplicate)
         {
-            FText DisplayNameText = ExistingEnum->GetDisplayNameTextByIndex(i);
-            FString DisplayNameStr = DisplayNameText.ToString();
+            OutError = Value.IsEmpty() ? TEXT("Enum values cannot be empty") : FString::Printf(TEXT("Duplicate enum value: %s"), *Value);
+            return false;
+        }
+    }
+
+    // One transaction and one change broadcast for the whole definition; adding, renaming and
+    // removing enumerators one at a time through FEnumEditorUtils refreshes every dependent
+    // Blueprint on each call
+    const FScopedTransaction Transaction(FText::FromString(FString::Printf(TEXT("Define Enum '%s'"), *Enum->GetName())));
+    Enum->Modify();
+
+    // Set the enum description (the "Enum Description" property visible in the editor)
+    if (!Description.IsEmpty())
+    {
+#if WITH_EDITORONLY_DATA
+        Enum->EnumDescription = FText::FromString(Description);
+#endif
+        // Also set as tooltip metadata for additional compatibility
+        Enum->SetMetaData(TEXT("ToolTip"), *Description);
+    }
 
-            if (const FString* ValueDesc = ValueDescriptions.Find(DisplayNameStr))
+    // Values that survive keep their internal name so saved data and pins still resolve
+    TArray<TPair<FName, int64>> OldNames;
+    TMap<FString, FName> InternalNameByDisplayName;
+    TSet<FName> UsedNames;
+    for (int32 Index = 0; Index < Enum->NumEnums() - 1; ++Index) // -1 to skip _MAX
+    {
+        const FName InternalName = Enum->GetNameByIndex(Index);
+        OldNames.Emplace(InternalName, Enum->GetValueByIndex(Index));
+        InternalNameByDisplayName.Add(Enum->GetDisplayNameTextByIndex(Index).ToString(), InternalName);
+        UsedNames.Add(InternalName);
+    }
+
+    // New values get the editor's NewEnumeratorN names, never reusing a removed value's name
+    int32 NextEnumeratorIndex = 0;
+    TArray<TPair<FName, int64>> Names;
+    Names.Reserve(Values.Num());
+    TMap<FName, FText> DisplayNames;
+    for (int32 Index = 0; Index < Values.Num(); ++Index)
+    {
+        FName InternalName;
+        if (const FName* Existing = InternalNameByDisplayName.Find(Values[Index]))
+        {
+            InternalName = *Existing;
+        }
+        else
+        {
+            do
             {
-                if (!ValueDesc->IsEmpty())
-                {
-                    ExistingEnum->SetMetaData(TEXT("ToolTip"), **ValueDesc, i);
-                }
+                InternalName = FName(*Enum->GenerateFullEnumName(*FString::Printf(TEXT("NewEnumerator%d"), NextEnumeratorIndex++)));
             }
+            while (UsedNames.Contains(InternalName));
+            UsedNames.Add(InternalName);
         }
-    }
 
-    // Mark the enum as modified and save
-    ExistingEnum->Modify();
-    ExistingEnum->MarkPackageDirty();
-    UPackage* Package = ExistingEnum->GetPackage();
-    if (Package)
-    {
-        Package->MarkPackageDirty();
+        Names.Emplace(InternalName, Index);
+        DisplayNames.Add(InternalName, FText::FromString(Values[Index]));
     }
 
-    // Save the asset
-    UEditorAssetLibrary::SaveAsset(PackageName, false);
+    Enum->SetEnums(Names, Enum->GetCppForm());
+    Enum->DisplayNameMap = MoveTemp(DisplayNames);
+    FEnumEditorUtils::EnsureAllDisplayNamesExist(Enum);
 
-    // Log the updated values for debugging
-    UE_LOG(LogTemp, Display, TEXT("MCP Project: Updated enum '%s' with %d values:"), *EnumName, Values.Num());
-    for (int32 i = 0; i < ExistingEnum->NumEnums() - 1; ++i)
+    // Set per-value descriptions (tooltips) if provided
+    for (int32 Index = 0; Index < Values.Num(); ++Index)
     {
-        FName InternalName = ExistingEnum->GetNameByIndex(i);
-        FText DisplayName = ExistingEnum->GetDisplayNameTextByIndex(i);
-        UE_LOG(LogTemp, Display, TEXT("  [%d] Internal: '%s' Display: '%s'"), i, *InternalName.ToString(), *DisplayName.ToString());
+        const FString* ValueDesc = ValueDescriptions.Find(Values[Index]);
+        if (ValueDesc && !ValueDesc->IsEmpty())
+        {
+            Enum->SetMetaData(TEXT("ToolTip"), **ValueDesc, Index);
+        }
     }
 
+    FEnumEditorUtils::BroadcastChanges(Enum, OldNames);
+    Enum->MarkPackageDirty();
     return true;
 }
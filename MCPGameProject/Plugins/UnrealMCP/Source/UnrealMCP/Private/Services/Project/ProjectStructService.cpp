@@ -8,6 +8,7 @@
 #include "AssetToolsModule.h"
 #include "Factories/StructureFactory.h"
 #include "UserDefinedStructure/UserDefinedStructEditorData.h"
+#include "ScopedTransaction.h"
 
 FProjectStructService& FProjectStructService::Get()
 {
@@ -56,55 +57,17 @@ bool FProjectStructService::CreateStruct(const FString& StructName, const FStrin
         return false;
     }
 
-    // Set the struct description and tooltip
-    if (!Description.IsEmpty())
-    {
-        NewStruct->SetMetaData(TEXT("Comments"), *Description);
-        FStructureEditorUtils::ChangeTooltip(NewStruct, Description);
-    }
-
-    // First, collect all existing variables to remove
-    TArray<FGuid> ExistingGuids;
-    {
-        const TArray<FStructVariableDescription>& VarDescArray = FStructureEditorUtils::GetVarDesc(NewStruct);
-        for (int32 i = 0; i < VarDescArray.Num(); ++i)
-        {
-            ExistingGuids.Add(VarDescArray[i].VarGuid);
-        }
-    }
-
-    // Remove all existing variables
-    for (const FGuid& Guid : ExistingGuids)
-    {
-        FStructureEditorUtils::RemoveVariable(NewStruct, Guid);
-    }
-
-    // Add new variables
-    for (const TSharedPtr<FJsonObject>& PropertyObj : Properties)
-    {
-        if (!CreateStructProperty(NewStruct, PropertyObj))
-        {
-            UE_LOG(LogTemp, Warning, TEXT("Failed to create property for struct %s"), *StructName);
-        }
-    }
-
-    // Clean up any remaining unrenamed variables (MemberVar_)
-    TArray<FGuid> GuidsToRemove;
-    for (const FStructVariableDescription& Desc : FStructureEditorUtils::GetVarDesc(NewStruct))
+    // The factory adds a placeholder member; the definition replaces it in the same pass
+    TArray<FString> Skipped;
+    if (!ApplyStructDefinition(NewStruct, Description, Properties, Skipped, OutError))
     {
-        if (Desc.VarName.ToString().StartsWith(TEXT("MemberVar_")))
-        {
-            GuidsToRemove.Add(Desc.VarGuid);
-        }
+        return false;
     }
-    for (const FGuid& Guid : GuidsToRemove)
+    for (const FString& Reason : Skipped)
     {
-        FStructureEditorUtils::RemoveVariable(NewStruct, Guid);
+        UE_LOG(LogTemp, Warning, TEXT("MCP Project: Skipped property in struct %s: %s"), *StructName, *Reason);
     }
 
-    // Final compilation and save
-    FStructureEditorUtils::CompileStructure(NewStruct);
-
     // Force save the asset
     NewStruct->MarkPackageDirty();
     UPackage* Package = NewStruct->GetPackage();
@@ -228,255 +191,211 @@ bool FProjectStructService::UpdateStruct(const FString& StructName, const FStrin
         return false;
     }
 
-    // Set the struct description and tooltip
-    if (!Description.IsEmpty())
+    TArray<FString> Skipped;
+    if (!ApplyStructDefinition(ExistingStruct, Description, Properties, Skipped, OutError))
     {
-        ExistingStruct->SetMetaData(TEXT("Comments"), *Description);
-        FStructureEditorUtils::ChangeTooltip(ExistingStruct, Description);
+        return false;
     }
-
-    // Build a map of existing variables by name (extract base name without GUID suffix)
-    // UE UserDefinedStruct variable names follow the pattern: OriginalName_Index_GUID32HEX
-    // e.g., "ColorFull_Start_2_C98BA1A740565E70FB78CE8E7AAD5266"
-    // We need to strip the trailing "_Index_GUID" to recover "ColorFull_Start"
-    TMap<FString, FStructVariableDescription> ExistingVarsByName;
-    auto InitialVarDescArray = FStructureEditorUtils::GetVarDesc(ExistingStruct);
-    for (const FStructVariableDescription& Desc : InitialVarDescArray)
+    for (const FString& Reason : Skipped)
     {
-        FString VarName = Desc.VarName.ToString();
-        // Use the FriendlyName which preserves the original display name
-        FString BaseName = Desc.FriendlyName;
-        if (BaseName.IsEmpty())
-        {
-            // Fallback: strip trailing _Number_GUID32HEX pattern
-            // Find the GUID suffix: last 32 hex chars after underscore
-            int32 LastUnderscore;
-            if (VarName.FindLastChar('_', LastUnderscore) && (VarName.Len() - LastUnderscore - 1) == 32)
-            {
-                // Found GUID suffix, now strip the _Index before it too
-                FString WithoutGuid = VarName.Left(LastUnderscore);
-                int32 SecondLastUnderscore;
-                if (WithoutGuid.FindLastChar('_', SecondLastUnderscore))
-                {
-                    // Check if the part between underscores is a number (the index)
-                    FString PossibleIndex = WithoutGuid.Mid(SecondLastUnderscore + 1);
-                    if (PossibleIndex.IsNumeric())
-                    {
-                        BaseName = WithoutGuid.Left(SecondLastUnderscore);
-                    }
-                    else
-                    {
-                        BaseName = WithoutGuid;
-                    }
-                }
-                else
-                {
-                    BaseName = WithoutGuid;
-                }
-            }
-            else
-            {
-                BaseName = VarName;
-            }
-        }
-        UE_LOG(LogTemp, Display, TEXT("MCP UpdateStruct: Mapped variable '%s' → BaseName '%s'"), *VarName, *BaseName);
-        ExistingVarsByName.Add(BaseName, Desc);
+        UE_LOG(LogTemp, Warning, TEXT("MCP Project: Skipped property in struct %s: %s"), *StructName, *Reason);
     }
 
-    // Track which variables were updated or added
-    TSet<FString> UpdatedOrAddedNames;
+    return true;
+}
 
-    for (const TSharedPtr<FJsonObject>& PropertyObj : Properties)
+bool FProjectStructService::ApplyStructDefinition(UUserDefinedStruct* Struct, const FString& Description, const TArray<TSharedPtr<FJsonObject>>& Properties, TArray<FString>& OutSkipped, FString& OutError)
+{
+    if (!Struct || !Struct->EditorData)
     {
-        if (!PropertyObj.IsValid())
+        OutError = TEXT("Invalid user-defined struct");
+        return false;
+    }
+
+    // Resolve every definition before touching the struct. A property that fails to resolve is
+    // reported as skipped; if it names an existing member, that member is kept as it is rather
+    // than removed along with its saved data
+    struct FResolvedProperty
+    {
+        FString Name;
+        FString Tooltip;
+        FEdGraphPinType PinType;
+    };
+    TArray<FResolvedProperty> Resolved;
+    TSet<FString> SeenNames;
+    TSet<FString> UnresolvedNames;
+    for (int32 Index = 0; Index < Properties.Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>& PropertyObj = Properties[Index];
+        FResolvedProperty Property;
+        FString PropertyType;
+        if (!PropertyObj.IsValid() || !PropertyObj->TryGetStringField(TEXT("name"), Property.Name) || Property.Name.IsEmpty())
         {
+            OutSkipped.Add(FString::Printf(TEXT("property %d has no name"), Index));
             continue;
         }
-
-        FString PropertyName;
-        if (!PropertyObj->TryGetStringField(TEXT("name"), PropertyName))
+        if (!PropertyObj->TryGetStringField(TEXT("type"), PropertyType) ||
+            !FPropertyTypeResolverService::Get().ResolvePropertyType(PropertyType, Property.PinType))
         {
+            OutSkipped.Add(FString::Printf(TEXT("%s: unknown type '%s'"), *Property.Name, *PropertyType));
+            UnresolvedNames.Add(Property.Name);
             continue;
         }
 
-        FString PropertyTooltip;
-        PropertyObj->TryGetStringField(TEXT("description"), PropertyTooltip);
+        FString TypeError;
+        if (!FStructureEditorUtils::CanHaveAMemberVariableOfType(Struct, Property.PinType, &TypeError))
+        {
+            OutSkipped.Add(FString::Printf(TEXT("%s: %s"), *Property.Name, *TypeError));
+            UnresolvedNames.Add(Property.Name);
+            continue;
+        }
 
-        if (ExistingVarsByName.Contains(PropertyName))
+        // FString keys compare case-insensitively, matching the editor's friendly-name check
+        bool bDuplicate = false;
+        SeenNames.Add(Property.Name, &bDuplicate);
+        if (bDuplicate)
         {
-            const FStructVariableDescription& ExistingDesc = ExistingVarsByName[PropertyName];
+            OutSkipped.Add(FString::Printf(TEXT("%s: duplicate property name"), *Property.Name));
+            continue;
+        }
 
-            // Check if type needs to be updated using proper Unreal Engine approach
-            FString NewPropertyType;
-            PropertyObj->TryGetStringField(TEXT("type"), NewPropertyType);
+        PropertyObj->TryGetStringField(TEXT("description"), Property.Tooltip);
+        Resolved.Add(MoveTemp(Property));
+    }
 
-            FEdGraphPinType NewPinType;
-            bool bNewTypeValid = FPropertyTypeResolverService::Get().ResolvePropertyType(NewPropertyType, NewPinType);
+    if (Resolved.Num() == 0)
+    {
+        OutError = TEXT("A struct needs at least one valid property");
+        return false;
+    }
 
-            if (bNewTypeValid)
-            {
-                // Use FStructureEditorUtils::ChangeVariableType for proper type updates
-                // This is the official Unreal Engine way to change variable types
-                if (FStructureEditorUtils::ChangeVariableType(ExistingStruct, ExistingDesc.VarGuid, NewPinType))
-                {
-                    UE_LOG(LogTemp, Display, TEXT("MCP Project: Successfully changed type for property '%s' in struct '%s'"), *PropertyName, *StructName);
-                }
-                else
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("MCP Project: Failed to change type for property '%s' in struct '%s' - type may be the same"), *PropertyName, *StructName);
-                }
-            }
+    // One transaction and one structure-changed broadcast for the whole definition; the
+    // per-variable FStructureEditorUtils calls would each recompile the struct and refresh
+    // every dependent Blueprint
+    const FScopedTransaction Transaction(FText::FromString(FString::Printf(TEXT("Define Struct '%s'"), *Struct->GetName())));
+    Struct->Modify();
+    FStructureEditorUtils::ModifyStructData(Struct);
 
-            // Update tooltip if needed
-            if (!PropertyTooltip.IsEmpty())
-            {
-                FStructureEditorUtils::ChangeVariableTooltip(ExistingStruct, ExistingDesc.VarGuid, PropertyTooltip);
-            }
+    UUserDefinedStructEditorData* EditorData = CastChecked<UUserDefinedStructEditorData>(Struct->EditorData);
+    if (!Description.IsEmpty())
+    {
+        Struct->SetMetaData(TEXT("Comments"), *Description);
+        Struct->SetMetaData(TEXT("ToolTip"), *Description);
+        EditorData->ToolTip = Description;
+    }
 
-            UpdatedOrAddedNames.Add(PropertyName);
+    TArray<FStructVariableDescription>& VarDescs = FStructureEditorUtils::GetVarDesc(Struct);
+    TMap<FString, int32> ExistingByName;
+    for (int32 Index = 0; Index < VarDescs.Num(); ++Index)
+    {
+        ExistingByName.Add(GetVariableBaseName(VarDescs[Index]), Index);
+    }
+
+    // Existing members keep their GUID and position; new ones are appended in definition order
+    TArray<const FResolvedProperty*> KeptDefinitions;
+    KeptDefinitions.SetNumZeroed(VarDescs.Num());
+    TArray<const FResolvedProperty*> Added;
+    for (const FResolvedProperty& Property : Resolved)
+    {
+        if (const int32* ExistingIndex = ExistingByName.Find(Property.Name))
+        {
+            KeptDefinitions[*ExistingIndex] = &Property;
         }
         else
         {
-            // Add new variable
-            if (!CreateStructProperty(ExistingStruct, PropertyObj))
-            {
-                UE_LOG(LogTemp, Warning, TEXT("Failed to add new property %s to struct %s"), *PropertyName, *StructName);
-            }
-            else
-            {
-                UpdatedOrAddedNames.Add(PropertyName);
-            }
+            Added.Add(&Property);
         }
     }
 
-    // Remove variables that are no longer in the properties list
-    TArray<FGuid> GuidsToRemove;
-    for (const FStructVariableDescription& Desc : FStructureEditorUtils::GetVarDesc(ExistingStruct))
+    TArray<FStructVariableDescription> NewVarDescs;
+    NewVarDescs.Reserve(VarDescs.Num() + Added.Num());
+    for (int32 Index = 0; Index < VarDescs.Num(); ++Index)
     {
-        FString VarName = Desc.VarName.ToString();
-        // Use FriendlyName for matching (same logic as building the map above)
-        FString BaseName = Desc.FriendlyName;
-        if (BaseName.IsEmpty())
+        const FResolvedProperty* Property = KeptDefinitions[Index];
+        if (!Property)
         {
-            int32 LastUnderscore;
-            if (VarName.FindLastChar('_', LastUnderscore) && (VarName.Len() - LastUnderscore - 1) == 32)
-            {
-                FString WithoutGuid = VarName.Left(LastUnderscore);
-                int32 SecondLastUnderscore;
-                if (WithoutGuid.FindLastChar('_', SecondLastUnderscore))
-                {
-                    FString PossibleIndex = WithoutGuid.Mid(SecondLastUnderscore + 1);
-                    if (PossibleIndex.IsNumeric())
-                    {
-                        BaseName = WithoutGuid.Left(SecondLastUnderscore);
-                    }
-                    else
-                    {
-                        BaseName = WithoutGuid;
-                    }
-                }
-                else
-                {
-                    BaseName = WithoutGuid;
-                }
-            }
-            else
+            if (UnresolvedNames.Contains(GetVariableBaseName(VarDescs[Index])))
             {
-                BaseName = VarName;
+                NewVarDescs.Add(VarDescs[Index]);
             }
+            continue;
         }
 
-        if (!UpdatedOrAddedNames.Contains(BaseName) && !VarName.StartsWith(TEXT("MemberVar_")))
+        FStructVariableDescription VarDesc = VarDescs[Index];
+
+        // Same as FStructureEditorUtils::ChangeVariableType: a new member name so old data is not
+        // read with the new type, and the default no longer applies
+        if (VarDesc.ToPinType() != Property->PinType)
+        {
+            VarDesc.VarName = MakeMemberVariableName(EditorData, VarDesc.FriendlyName, VarDesc.VarGuid);
+            VarDesc.DefaultValue = FString();
+            VarDesc.SetPinType(Property->PinType);
+        }
+        if (!Property->Tooltip.IsEmpty())
         {
-            GuidsToRemove.Add(Desc.VarGuid);
+            VarDesc.ToolTip = Property->Tooltip;
         }
+        NewVarDescs.Add(MoveTemp(VarDesc));
     }
-    for (const FGuid& Guid : GuidsToRemove)
+
+    for (const FResolvedProperty* Property : Added)
     {
-        FStructureEditorUtils::RemoveVariable(ExistingStruct, Guid);
+        FStructVariableDescription& VarDesc = NewVarDescs.AddDefaulted_GetRef();
+        VarDesc.VarGuid = FGuid::NewGuid();
+        VarDesc.FriendlyName = Property->Name;
+        VarDesc.VarName = MakeMemberVariableName(EditorData, Property->Name, VarDesc.VarGuid);
+        VarDesc.SetPinType(Property->PinType);
+        VarDesc.ToolTip = Property->Tooltip;
     }
 
-    // Final compilation and save
-    FStructureEditorUtils::CompileStructure(ExistingStruct);
-    ExistingStruct->MarkPackageDirty();
+    VarDescs = MoveTemp(NewVarDescs);
+    FStructureEditorUtils::OnStructureChanged(Struct, FStructureEditorUtils::EStructureEditorChangeInfo::Unknown);
 
+    UE_LOG(LogTemp, Display, TEXT("MCP Project: Defined struct '%s' with %d members (%d added)"), *Struct->GetName(), VarDescs.Num(), Added.Num());
     return true;
 }
 
-bool FProjectStructService::CreateStructProperty(UUserDefinedStruct* Struct, const TSharedPtr<FJsonObject>& PropertyObj) const
+FString FProjectStructService::GetVariableBaseName(const FStructVariableDescription& VarDesc)
 {
-    if (!Struct || !PropertyObj.IsValid())
+    // The FriendlyName preserves the original display name
+    if (!VarDesc.FriendlyName.IsEmpty())
     {
-        return false;
+        return VarDesc.FriendlyName;
     }
 
-    FString PropertyName;
-    if (!PropertyObj->TryGetStringField(TEXT("name"), PropertyName))
+    // Fallback: UE UserDefinedStruct variable names follow the pattern OriginalName_Index_GUID32HEX,
+    // e.g. "ColorFull_Start_2_C98BA1A740565E70FB78CE8E7AAD5266"; strip the trailing "_Index_GUID"
+    const FString VarName = VarDesc.VarName.ToString();
+    int32 LastUnderscore;
+    if (!VarName.FindLastChar('_', LastUnderscore) || (VarName.Len() - LastUnderscore - 1) != 32)
     {
-        return false;
+        return VarName;
     }
 
-    FString PropertyType;
-    if (!PropertyObj->TryGetStringField(TEXT("type"), PropertyType))
+    const FString WithoutGuid = VarName.Left(LastUnderscore);
+    int32 SecondLastUnderscore;
+    if (WithoutGuid.FindLastChar('_', SecondLastUnderscore) && WithoutGuid.Mid(SecondLastUnderscore + 1).IsNumeric())
     {
-        return false;
-    }
-
-    FString PropertyTooltip;
-    PropertyObj->TryGetStringField(TEXT("description"), PropertyTooltip);
-
-    // Create the pin type
-    FEdGraphPinType PinType;
-    if (!FPropertyTypeResolverService::Get().ResolvePropertyType(PropertyType, PinType))
-    {
-        return false;
+        return WithoutGuid.Left(SecondLastUnderscore);
     }
+    return WithoutGuid;
+}
 
-    // First, add the variable
-    bool bAdded = FStructureEditorUtils::AddVariable(Struct, PinType);
-    if (!bAdded)
+FName FProjectStructService::MakeMemberVariableName(UUserDefinedStructEditorData* EditorData, const FString& FriendlyName, const FGuid& VarGuid)
+{
+    // Mirrors the editor's member naming so renames and type changes made later in the
+    // struct editor keep working: <Name>_<UniqueId>_<Guid>
+    FString BaseName = FriendlyName;
+    if (!FName::IsValidXName(BaseName, INVALID_OBJECTNAME_CHARACTERS))
     {
-        return false;
+        BaseName = MakeObjectNameFromDisplayLabel(BaseName, NAME_None).GetPlainNameString();
     }
-
-    // Get the updated variable list and find the last added variable
-    const TArray<FStructVariableDescription>& VarDescArray = FStructureEditorUtils::GetVarDesc(Struct);
-    if (VarDescArray.Num() > 0)
+    if (BaseName.IsEmpty())
     {
-        const FStructVariableDescription& NewVarDesc = VarDescArray.Last();
-
-        // Rename the variable - try multiple times if needed
-        bool bRenameSuccess = false;
-        for (int32 Attempt = 0; Attempt < 3; ++Attempt)
-        {
-            if (FStructureEditorUtils::RenameVariable(Struct, NewVarDesc.VarGuid, *PropertyName))
-            {
-                bRenameSuccess = true;
-                break;
-            }
-
-            // Wait a bit and try again
-            FPlatformProcess::Sleep(0.01f);
-        }
-
-        if (!bRenameSuccess)
-        {
-            UE_LOG(LogTemp, Warning, TEXT("Failed to rename variable to %s"), *PropertyName);
-        }
-
-        // Set tooltip
-        if (!PropertyTooltip.IsEmpty())
-        {
-            FStructureEditorUtils::ChangeVariableTooltip(Struct, NewVarDesc.VarGuid, PropertyTooltip);
-        }
-
-        // Mark the struct as modified
-        Struct->MarkPackageDirty();
-
-        return true;
+        BaseName = TEXT("MemberVar");
     }
 
-    return false;
+    return FName(*FString::Printf(TEXT("%s_%u_%s"), *BaseName, EditorData->GenerateUniqueNameIdForMemberVariable(), *VarGuid.ToString(EGuidFormats::Digits)));
 }
 
 TArray<TSharedPtr<FJsonObject>> FProjectStructService::ShowStructVariables(const FString& StructName, const FString& Path, bool& bOutSuccess, FString& OutError)
@@ -255,16 +255,6 @@ TArray<TSharedPtr<FJsonObject>> FProjectService::ShowStructVariables(const FStri
     return FProjectStructService::Get().ShowStructVariables(StructName, Path, bOutSuccess, OutError);
 }
 
-bool FProjectService::CreateStructProperty(UUserDefinedStruct* Struct, const TSharedPtr<FJsonObject>& PropertyObj) const
-{
-    // This private helper is no longer needed since ProjectStructService handles it internally
-    // Keep for backwards compatibility but delegate to the service
-    FProjectStructService& Service = FProjectStructService::Get();
-    // Note: Since CreateStructProperty is private in ProjectStructService, we can't delegate directly
-    // This method shouldn't be called externally - the service handles it internally
-    return false;
-}
-
 // ============================================
 // Enum Operations - Delegate to ProjectEnumService
 // ============================================
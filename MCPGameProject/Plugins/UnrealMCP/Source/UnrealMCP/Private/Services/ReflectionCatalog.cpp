@@ -0,0 +1,345 @@
+#include "Services/ReflectionCatalog.h"
+#include "UObject/UObjectIterator.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/Package.h"
+#include "Engine/Blueprint.h"
+#include "Misc/CoreDelegates.h"
+#include "Editor.h"
+
+namespace
+{
+    /** Whether a module registered reflected types: its /Script package holds a class or struct */
+    bool HasReflectedTypes(FName ModuleName)
+    {
+        const UPackage* ScriptPackage = FindPackage(nullptr, *(TEXT("/Script/") + ModuleName.ToString()));
+        if (!ScriptPackage)
+        {
+            return false;
+        }
+
+        bool bHasTypes = false;
+        ForEachObjectWithPackage(ScriptPackage, [&bHasTypes](UObject* Object)
+        {
+            bHasTypes = Object->IsA<UClass>() || Object->IsA<UScriptStruct>();
+            return !bHasTypes;
+        }, false);
+        return bHasTypes;
+    }
+}
+
+FReflectionCatalog& FReflectionCatalog::Get()
+{
+    static FReflectionCatalog Instance;
+    return Instance;
+}
+
+void FReflectionCatalog::Initialize()
+{
+    ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &FReflectionCatalog::HandleModulesChanged);
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FReflectionCatalog::HandleReloadComplete);
+
+    // GEditor does not exist yet when the module loads during engine init
+    if (GEditor)
+    {
+        BindEditorDelegates();
+    }
+    else
+    {
+        PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FReflectionCatalog::BindEditorDelegates);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("FReflectionCatalog initialized (snapshot is built on first query)"));
+}
+
+void FReflectionCatalog::Shutdown()
+{
+    FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+    if (GEditor)
+    {
+        GEditor->OnBlueprintPreCompile().Remove(BlueprintPreCompileHandle);
+        GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+    }
+
+    ModulesChangedHandle.Reset();
+    ReloadCompleteHandle.Reset();
+    PostEngineInitHandle.Reset();
+    BlueprintPreCompileHandle.Reset();
+    BlueprintCompiledHandle.Reset();
+    CompilingBlueprints.Empty();
+
+    Invalidate();
+    AllClasses.Empty();
+    AllStructs.Empty();
+    ClassesByName.Empty();
+    StructsByName.Empty();
+}
+
+void FReflectionCatalog::BindEditorDelegates()
+{
+    if (GEditor && !BlueprintCompiledHandle.IsValid())
+    {
+        BlueprintPreCompileHandle = GEditor->OnBlueprintPreCompile().AddRaw(this, &FReflectionCatalog::HandleBlueprintPreCompile);
+        BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FReflectionCatalog::HandleBlueprintCompiled);
+    }
+}
+
+void FReflectionCatalog::HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+    // Most modules register no UObject types; loading or unloading one leaves the snapshot (and
+    // every cache derived from its generation) valid
+    if (bIsBuilt && (Reason == EModuleChangeReason::ModuleLoaded || Reason == EModuleChangeReason::ModuleUnloaded) &&
+        HasReflectedTypes(ModuleName))
+    {
+        Invalidate();
+    }
+}
+
+void FReflectionCatalog::HandleReloadComplete(EReloadCompleteReason Reason)
+{
+    Invalidate();
+}
+
+void FReflectionCatalog::HandleBlueprintPreCompile(UBlueprint* Blueprint)
+{
+    if (bIsBuilt && Blueprint)
+    {
+        CompilingBlueprints.AddUnique(Blueprint);
+    }
+}
+
+void FReflectionCatalog::HandleBlueprintCompiled()
+{
+    // A recompile keeps the generated class the snapshot already holds; only a class the
+    // snapshot has not seen (first compile of a new Blueprint) changes what it should list
+    TArray<TWeakObjectPtr<UBlueprint>> Compiled = MoveTemp(CompilingBlueprints);
+    CompilingBlueprints.Reset();
+    for (const TWeakObjectPtr<UBlueprint>& Blueprint : Compiled)
+    {
+        if (bIsBuilt && Blueprint.IsValid() && Blueprint->GeneratedClass && !IsIndexed(Blueprint->GeneratedClass))
+        {
+            Invalidate();
+        }
+    }
+}
+
+bool FReflectionCatalog::IsIndexed(const UClass* Class) const
+{
+    const TArray<TWeakObjectPtr<UClass>>* Candidates = ClassesByName.Find(NormalizeTypeName(Class->GetName()));
+    return Candidates && Candidates->ContainsByPredicate([Class](const TWeakObjectPtr<UClass>& Candidate)
+    {
+        return Candidate.Get() == Class;
+    });
+}
+
+void FReflectionCatalog::Invalidate()
+{
+    bIsBuilt = false;
+    DerivedClassesByBase.Empty();
+    DerivedStructsByBase.Empty();
+}
+
+uint32 FReflectionCatalog::GetGeneration()
+{
+    EnsureBuilt();
+    return Generation;
+}
+
+FString FReflectionCatalog::NormalizeTypeName(const FString& TypeName)
+{
+    // Only the exact Blueprint suffix; a native name ending in "_c" keeps it
+    if (TypeName.EndsWith(TEXT("_C"), ESearchCase::CaseSensitive))
+    {
+        return TypeName.LeftChop(2).ToLower();
+    }
+    return TypeName.ToLower();
+}
+
+void FReflectionCatalog::EnsureBuilt()
+{
+    check(IsInGameThread());
+    if (!bIsBuilt)
+    {
+        Build();
+    }
+}
+
+void FReflectionCatalog::Build()
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    AllClasses.Reset();
+    AllStructs.Reset();
+    ClassesByName.Reset();
+    StructsByName.Reset();
+
+    for (TObjectIterator<UClass> It; It; ++It)
+    {
+        UClass* Class = *It;
+        // Skip stale copies left behind by Blueprint recompiles / hot reload
+        if (!Class || Class->HasAnyClassFlags(CLASS_NewerVersionExists))
+        {
+            continue;
+        }
+        AllClasses.Add(Class);
+        ClassesByName.FindOrAdd(NormalizeTypeName(Class->GetName())).Add(Class);
+    }
+
+    for (TObjectIterator<UScriptStruct> It; It; ++It)
+    {
+        UScriptStruct* Struct = *It;
+        if (!Struct)
+        {
+            continue;
+        }
+        AllStructs.Add(Struct);
+        StructsByName.FindOrAdd(NormalizeTypeName(Struct->GetName())).Add(Struct);
+    }
+
+    DerivedClassesByBase.Empty();
+    DerivedStructsByBase.Empty();
+    bIsBuilt = true;
+    ++Generation;
+
+    UE_LOG(LogTemp, Log, TEXT("FReflectionCatalog: Indexed %d classes and %d structs in %.1f ms (generation %u)"),
+        AllClasses.Num(), AllStructs.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0, Generation);
+}
+
+TArray<UClass*> FReflectionCatalog::GetDerivedClasses(const UClass* BaseClass, EClassFlags ExcludedFlags)
+{
+    TArray<UClass*> Result;
+    if (!BaseClass)
+    {
+        return Result;
+    }
+
+    EnsureBuilt();
+
+    TArray<TWeakObjectPtr<UClass>>* Derived = DerivedClassesByBase.Find(BaseClass);
+    if (!Derived)
+    {
+        Derived = &DerivedClassesByBase.Add(BaseClass);
+        for (const TWeakObjectPtr<UClass>& Class : AllClasses)
+        {
+            if (Class.IsValid() && Class.Get() != BaseClass && Class->IsChildOf(BaseClass))
+            {
+                Derived->Add(Class);
+            }
+        }
+    }
+
+    Result.Reserve(Derived->Num());
+    for (const TWeakObjectPtr<UClass>& Class : *Derived)
+    {
+        if (Class.IsValid() && !Class->HasAnyClassFlags(ExcludedFlags))
+        {
+            Result.Add(Class.Get());
+        }
+    }
+    return Result;
+}
+
+TArray<UScriptStruct*> FReflectionCatalog::GetDerivedStructs(const UScriptStruct* BaseStruct)
+{
+    TArray<UScriptStruct*> Result;
+    if (!BaseStruct)
+    {
+        return Result;
+    }
+
+    EnsureBuilt();
+
+    TArray<TWeakObjectPtr<UScriptStruct>>* Derived = DerivedStructsByBase.Find(BaseStruct);
+    if (!Derived)
+    {
+        Derived = &DerivedStructsByBase.Add(BaseStruct);
+        for (const TWeakObjectPtr<UScriptStruct>& Struct : AllStructs)
+        {
+            if (Struct.IsValid() && Struct.Get() != BaseStruct && Struct->IsChildOf(BaseStruct))
+            {
+                Derived->Add(Struct);
+            }
+        }
+    }
+
+    Result.Reserve(Derived->Num());
+    for (const TWeakObjectPtr<UScriptStruct>& Struct : *Derived)
+    {
+        if (Struct.IsValid())
+        {
+            Result.Add(Struct.Get());
+        }
+    }
+    return Result;
+}
+
+UClass* FReflectionCatalog::FindClassByName(const FString& ClassName, const UClass* BaseClass, EClassFlags ExcludedFlags)
+{
+    if (ClassName.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    EnsureBuilt();
+
+    auto IsAcceptable = [BaseClass, ExcludedFlags](const UClass* Class)
+    {
+        return Class &&
+            !Class->HasAnyClassFlags(CLASS_NewerVersionExists | ExcludedFlags) &&
+            (!BaseClass || Class->IsChildOf(BaseClass));
+    };
+
+    if (const TArray<TWeakObjectPtr<UClass>>* Candidates = ClassesByName.Find(NormalizeTypeName(ClassName)))
+    {
+        for (const TWeakObjectPtr<UClass>& Candidate : *Candidates)
+        {
+            if (IsAcceptable(Candidate.Get()))
+            {
+                return Candidate.Get();
+            }
+        }
+    }
+
+    // Classes created after the snapshot (e.g. a Blueprint compiled mid-request) are still
+    // reachable through the object hash, which is a name lookup rather than a full scan
+    for (const FString& Name : { ClassName, ClassName + TEXT("_C") })
+    {
+        UClass* Found = FindFirstObject<UClass>(*Name, EFindFirstObjectOptions::NativeFirst);
+        if (IsAcceptable(Found))
+        {
+            return Found;
+        }
+    }
+
+    return nullptr;
+}
+
+UScriptStruct* FReflectionCatalog::FindStructByName(const FString& StructName, const UScriptStruct* BaseStruct)
+{
+    if (StructName.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    EnsureBuilt();
+
+    if (const TArray<TWeakObjectPtr<UScriptStruct>>* Candidates = StructsByName.Find(NormalizeTypeName(StructName)))
+    {
+        for (const TWeakObjectPtr<UScriptStruct>& Candidate : *Candidates)
+        {
+            if (Candidate.IsValid() && (!BaseStruct || Candidate->IsChildOf(BaseStruct)))
+            {
+                return Candidate.Get();
+            }
+        }
+    }
+
+    UScriptStruct* Found = FindFirstObject<UScriptStruct>(*StructName, EFindFirstObjectOptions::NativeFirst);
+    if (Found && (!BaseStruct || Found->IsChildOf(BaseStruct)))
+    {
+        return Found;
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,542 @@
+#include "Services/SceneStatsCache.h"
+
+#include "Async/ParallelFor.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "InstancedStaticMeshDelegates.h"
+#include "Misc/CoreDelegates.h"
+#include "StaticMeshResources.h"
+#include "UObject/UObjectGlobals.h"
+
+FSceneStatsCache& FSceneStatsCache::Get()
+{
+	static FSceneStatsCache Instance;
+	return Instance;
+}
+
+void FSceneStatsCache::Initialize()
+{
+	PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FSceneStatsCache::HandleObjectPropertyChanged);
+	ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddRaw(this, &FSceneStatsCache::HandleObjectsReplaced);
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FSceneStatsCache::HandleLevelChanged);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FSceneStatsCache::HandleLevelChanged);
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &FSceneStatsCache::HandleWorldCleanup);
+	InstanceIndexUpdatedHandle = FInstancedStaticMeshDelegates::OnInstanceIndexUpdated.AddLambda(
+		[this](UInstancedStaticMeshComponent* Component, TArrayView<const FInstancedStaticMeshDelegates::FInstanceIndexUpdateData>)
+		{
+			HandleInstanceIndexUpdated(Component);
+		});
+
+	// GEngine does not exist yet when the module loads during engine init
+	if (GEngine)
+	{
+		BindEditorDelegates();
+	}
+	else
+	{
+		PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FSceneStatsCache::BindEditorDelegates);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("FSceneStatsCache initialized (world is gathered on first query)"));
+}
+
+void FSceneStatsCache::Shutdown()
+{
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+	FInstancedStaticMeshDelegates::OnInstanceIndexUpdated.Remove(InstanceIndexUpdatedHandle);
+	FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+		GEngine->OnActorMoved().Remove(ActorMovedHandle);
+	}
+
+	PropertyChangedHandle.Reset();
+	ObjectsReplacedHandle.Reset();
+	LevelAddedHandle.Reset();
+	LevelRemovedHandle.Reset();
+	WorldCleanupHandle.Reset();
+	InstanceIndexUpdatedHandle.Reset();
+	PostEngineInitHandle.Reset();
+	ActorAddedHandle.Reset();
+	ActorDeletedHandle.Reset();
+	ActorMovedHandle.Reset();
+
+	Reset();
+}
+
+void FSceneStatsCache::BindEditorDelegates()
+{
+	if (GEngine && !ActorAddedHandle.IsValid())
+	{
+		ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FSceneStatsCache::MarkActorDirty);
+		ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FSceneStatsCache::MarkActorDirty);
+		ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FSceneStatsCache::MarkActorDirty);
+	}
+}
+
+void FSceneStatsCache::Reset()
+{
+	CachedWorld.Reset();
+	bGathered = false;
+	Components.Empty();
+	ComponentsByActor.Empty();
+	MeshInfos.Empty();
+	DirtyActors.Empty();
+	DirtyMeshes.Empty();
+	CachedSnapshot.Reset();
+	CachedBreakdown.Reset();
+	// Generation keeps counting so breakdowns from before the reset can never match
+	++Generation;
+}
+
+void FSceneStatsCache::MarkActorDirty(AActor* Actor)
+{
+	if (!bGathered || !Actor || Actor->GetWorld() != CachedWorld.Get())
+	{
+		return;
+	}
+	DirtyActors.Add(Actor, Actor);
+}
+
+void FSceneStatsCache::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+	if (!bGathered || !Object)
+	{
+		return;
+	}
+
+	if (UStaticMesh* Mesh = Cast<UStaticMesh>(Object))
+	{
+		// LOD or build settings changed (including reimport); re-read the mesh on the next query
+		if (MeshInfos.Contains(Mesh))
+		{
+			DirtyMeshes.Add(Mesh, Mesh);
+		}
+	}
+	else if (UActorComponent* Component = Cast<UActorComponent>(Object))
+	{
+		MarkActorDirty(Component->GetOwner());
+	}
+	else if (AActor* Actor = Cast<AActor>(Object))
+	{
+		MarkActorDirty(Actor);
+	}
+}
+
+void FSceneStatsCache::HandleInstanceIndexUpdated(UInstancedStaticMeshComponent* Component)
+{
+	if (Component)
+	{
+		MarkActorDirty(Component->GetOwner());
+	}
+}
+
+void FSceneStatsCache::HandleLevelChanged(ULevel* Level, UWorld* World)
+{
+	if (!bGathered || !Level || World != CachedWorld.Get())
+	{
+		return;
+	}
+
+	// Streaming a level in or out only touches that level's actors
+	for (AActor* Actor : Level->Actors)
+	{
+		if (Actor)
+		{
+			DirtyActors.Add(Actor, Actor);
+		}
+	}
+}
+
+void FSceneStatsCache::HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	if (World && World == CachedWorld.Get())
+	{
+		Reset();
+	}
+}
+
+void FSceneStatsCache::HandleObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+	if (!bGathered)
+	{
+		return;
+	}
+
+	// Blueprint recompiles swap actor/component instances; drop the old owners and re-read the new ones
+	for (const TPair<UObject*, UObject*>& Pair : ReplacementMap)
+	{
+		AActor* OldOwner = Cast<AActor>(Pair.Key);
+		AActor* NewOwner = Cast<AActor>(Pair.Value);
+		if (const UActorComponent* OldComponent = Cast<UActorComponent>(Pair.Key))
+		{
+			OldOwner = OldComponent->GetOwner();
+		}
+		if (const UActorComponent* NewComponent = Cast<UActorComponent>(Pair.Value))
+		{
+			NewOwner = NewComponent->GetOwner();
+		}
+
+		if (OldOwner && ComponentsByActor.Contains(OldOwner))
+		{
+			DirtyActors.Add(OldOwner, nullptr);
+		}
+		MarkActorDirty(NewOwner);
+	}
+}
+
+bool FSceneStatsCache::CaptureComponent(UStaticMeshComponent* Component, FSceneStatsComponentRecord& OutRecord)
+{
+	if (!Component || !Component->IsRegistered())
+	{
+		return false;
+	}
+
+	UStaticMesh* Mesh = Component->GetStaticMesh();
+	if (!Mesh)
+	{
+		return false;
+	}
+
+	OutRecord.Mesh = Mesh;
+	OutRecord.Owner = Component->GetOwner();
+	OutRecord.bCastShadow = Component->CastShadow;
+	OutRecord.WPODisableDistance = Component->WorldPositionOffsetDisableDistance;
+	OutRecord.CullDistance = Component->LDMaxDrawDistance;
+
+	if (UInstancedStaticMeshComponent* ISM = Cast<UInstancedStaticMeshComponent>(Component))
+	{
+		const int32 Count = ISM->GetInstanceCount();
+		TSharedRef<TArray<FVector>> Locations = MakeShared<TArray<FVector>>();
+		Locations->Reserve(Count);
+		for (int32 InstanceIndex = 0; InstanceIndex < Count; ++InstanceIndex)
+		{
+			FTransform InstanceTransform;
+			if (ISM->GetInstanceTransform(InstanceIndex, InstanceTransform, true))
+			{
+				Locations->Add(InstanceTransform.GetLocation());
+			}
+		}
+
+		OutRecord.bInstanced = true;
+		OutRecord.InstanceCount = Count;
+		OutRecord.InstanceLocations = Locations;
+	}
+	return true;
+}
+
+TSharedRef<FSceneStatsMeshInfo> FSceneStatsCache::BuildMeshInfo(UStaticMesh* Mesh)
+{
+	TSharedRef<FSceneStatsMeshInfo> Info = MakeShared<FSceneStatsMeshInfo>();
+	Info->MeshPath = Mesh->GetPathName();
+	Info->MeshName = Mesh->GetName();
+	Info->LOD0Tris = Mesh->GetNumTriangles(0);
+	Info->LODCount = Mesh->GetNumLODs();
+	Info->SphereRadius = Mesh->GetBounds().SphereRadius;
+
+	const FStaticMeshRenderData* RenderData = Mesh->GetRenderData();
+	Info->bHasNanite = RenderData && RenderData->HasValidNaniteData();
+	if (RenderData)
+	{
+		for (int32 LODIndex = 0; LODIndex < RenderData->LODResources.Num(); ++LODIndex)
+		{
+			Info->LODTris.Add(Mesh->GetNumTriangles(LODIndex));
+			Info->LODScreenSizes.Add(Mesh->GetNumSourceModels() > LODIndex
+				? Mesh->GetSourceModel(LODIndex).ScreenSize.Default
+				: 0.0f);
+		}
+	}
+	return Info;
+}
+
+void FSceneStatsCache::EnsureMeshInfo(UStaticMesh* Mesh)
+{
+	if (Mesh && !MeshInfos.Contains(Mesh))
+	{
+		MeshInfos.Add(Mesh, BuildMeshInfo(Mesh));
+	}
+}
+
+void FSceneStatsCache::AddComponentRecord(UStaticMeshComponent* Component, FSceneStatsComponentRecord&& Record)
+{
+	EnsureMeshInfo(Component->GetStaticMesh());
+	ComponentsByActor.FindOrAdd(Record.Owner).Add(Component);
+	Components.Add(Component, MoveTemp(Record));
+}
+
+void FSceneStatsCache::RemoveActorRecords(const TObjectKey<AActor>& ActorKey)
+{
+	TArray<TObjectKey<UStaticMeshComponent>> Removed;
+	if (ComponentsByActor.RemoveAndCopyValue(ActorKey, Removed))
+	{
+		for (const TObjectKey<UStaticMeshComponent>& ComponentKey : Removed)
+		{
+			Components.Remove(ComponentKey);
+		}
+	}
+}
+
+void FSceneStatsCache::RefreshActor(AActor* Actor, const TObjectKey<AActor>& ActorKey)
+{
+	RemoveActorRecords(ActorKey);
+
+	UWorld* World = CachedWorld.Get();
+	if (!Actor || !IsValid(Actor) || Actor->IsActorBeingDestroyed() || !World || Actor->GetWorld() != World)
+	{
+		return;
+	}
+
+	// Actors in a level that was just streamed out stay alive briefly but no longer render
+	ULevel* Level = Actor->GetLevel();
+	if (!Level || !World->GetLevels().Contains(Level))
+	{
+		return;
+	}
+
+	Actor->ForEachComponent<UStaticMeshComponent>(false, [this](UStaticMeshComponent* Component)
+	{
+		FSceneStatsComponentRecord Record;
+		if (CaptureComponent(Component, Record))
+		{
+			AddComponentRecord(Component, MoveTemp(Record));
+		}
+	});
+}
+
+void FSceneStatsCache::GatherWorld(UWorld* World)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<UStaticMeshComponent*> Gathered;
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		if (AActor* Actor = *It)
+		{
+			Actor->ForEachComponent<UStaticMeshComponent>(false, [&Gathered](UStaticMeshComponent* Component)
+			{
+				Gathered.Add(Component);
+			});
+		}
+	}
+
+	// Instance transforms dominate cold-start cost on foliage-heavy levels; read them in parallel.
+	// The game thread waits inside ParallelFor, so the components cannot change underneath.
+	TArray<FSceneStatsComponentRecord> Records;
+	Records.SetNum(Gathered.Num());
+	TArray<bool> Captured;
+	Captured.SetNumZeroed(Gathered.Num());
+	ParallelFor(Gathered.Num(), [&Gathered, &Records, &Captured](int32 Index)
+	{
+		Captured[Index] = CaptureComponent(Gathered[Index], Records[Index]);
+	});
+
+	Components.Reserve(Gathered.Num());
+	for (int32 Index = 0; Index < Gathered.Num(); ++Index)
+	{
+		if (Captured[Index])
+		{
+			AddComponentRecord(Gathered[Index], MoveTemp(Records[Index]));
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("FSceneStatsCache: Gathered %d static mesh components (%d meshes) in %.1f ms"),
+		Components.Num(), MeshInfos.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+TSharedRef<const FSceneStatsSnapshot> FSceneStatsCache::Update(UWorld* World)
+{
+	check(IsInGameThread());
+
+	if (CachedWorld.Get() != World)
+	{
+		Reset();
+		CachedWorld = World;
+	}
+
+	if (!bGathered)
+	{
+		GatherWorld(World);
+		bGathered = true;
+		++Generation;
+		CachedSnapshot.Reset();
+	}
+
+	if (DirtyActors.Num() > 0 || DirtyMeshes.Num() > 0)
+	{
+		for (const TPair<TObjectKey<AActor>, TWeakObjectPtr<AActor>>& Dirty : DirtyActors)
+		{
+			RefreshActor(Dirty.Value.Get(), Dirty.Key);
+		}
+		for (const TPair<TObjectKey<UStaticMesh>, TWeakObjectPtr<UStaticMesh>>& Dirty : DirtyMeshes)
+		{
+			MeshInfos.Remove(Dirty.Key);
+			EnsureMeshInfo(Dirty.Value.Get());
+		}
+		DirtyActors.Reset();
+		DirtyMeshes.Reset();
+		++Generation;
+		CachedSnapshot.Reset();
+	}
+
+	if (!CachedSnapshot.IsValid())
+	{
+		TSharedRef<FSceneStatsSnapshot> Snapshot = MakeShared<FSceneStatsSnapshot>();
+		Snapshot->Generation = Generation;
+		Snapshot->TotalComponents = Components.Num();
+		Snapshot->TotalActors = ComponentsByActor.Num();
+
+		TMap<TObjectKey<UStaticMesh>, int32> MeshIndices;
+		MeshIndices.Reserve(MeshInfos.Num());
+		for (const TPair<TObjectKey<UStaticMeshComponent>, FSceneStatsComponentRecord>& Pair : Components)
+		{
+			const TSharedPtr<const FSceneStatsMeshInfo> Info = MeshInfos.FindRef(Pair.Value.Mesh);
+			if (!Info.IsValid())
+			{
+				continue;
+			}
+
+			int32& MeshIndex = MeshIndices.FindOrAdd(Pair.Value.Mesh, INDEX_NONE);
+			if (MeshIndex == INDEX_NONE)
+			{
+				MeshIndex = Snapshot->Meshes.AddDefaulted();
+				Snapshot->Meshes[MeshIndex].Info = Info;
+			}
+			Snapshot->Meshes[MeshIndex].Components.Add(Pair.Value);
+		}
+		CachedSnapshot = Snapshot;
+	}
+
+	return CachedSnapshot.ToSharedRef();
+}
+
+TSharedRef<const FSceneStatsBreakdown> FSceneStatsCache::Aggregate(const FSceneStatsSnapshot& Snapshot, const FVector& CameraLocation, bool bHasCamera)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	TSharedRef<FSceneStatsBreakdown> Breakdown = MakeShared<FSceneStatsBreakdown>();
+	Breakdown->Generation = Snapshot.Generation;
+	Breakdown->CameraLocation = CameraLocation;
+	Breakdown->bHasCamera = bHasCamera;
+	Breakdown->TotalComponents = Snapshot.TotalComponents;
+	Breakdown->TotalActors = Snapshot.TotalActors;
+	Breakdown->Meshes.SetNum(Snapshot.Meshes.Num());
+
+	// Per-mesh sums are cheap; LOD bucketing is per instance, so split that work by component
+	struct FBucketWork
+	{
+		int32 MeshIndex = 0;
+		const FSceneStatsComponentRecord* Record = nullptr;
+		TArray<int32> InstancesPerLOD;
+		int32 InstancesCulled = 0;
+	};
+	TArray<FBucketWork> Work;
+
+	for (int32 MeshIndex = 0; MeshIndex < Snapshot.Meshes.Num(); ++MeshIndex)
+	{
+		const FSceneStatsMeshGroup& Group = Snapshot.Meshes[MeshIndex];
+		FSceneStatsMeshBreakdown& Out = Breakdown->Meshes[MeshIndex];
+		Out.Info = Group.Info;
+		for (const FSceneStatsComponentRecord& Record : Group.Components)
+		{
+			Out.InstanceCount += Record.InstanceCount;
+			++Out.ComponentCount;
+			Out.ShadowCasters += Record.bCastShadow ? 1 : 0;
+			Out.WPODisableDistance = Record.WPODisableDistance;
+			Out.bIsISM |= Record.bInstanced;
+
+			if (bHasCamera && Record.bInstanced && Record.InstanceLocations.IsValid() && Group.Info->LODTris.Num() > 0)
+			{
+				FBucketWork& Item = Work.AddDefaulted_GetRef();
+				Item.MeshIndex = MeshIndex;
+				Item.Record = &Record;
+			}
+		}
+		if (Out.bIsISM && bHasCamera)
+		{
+			Out.InstancesPerLOD.SetNumZeroed(Group.Info->LODTris.Num());
+		}
+	}
+
+	ParallelFor(Work.Num(), [&Work, &Snapshot, &CameraLocation](int32 WorkIndex)
+	{
+		FBucketWork& Item = Work[WorkIndex];
+		const FSceneStatsMeshInfo& Info = *Snapshot.Meshes[Item.MeshIndex].Info;
+		const TArray<float>& ScreenSizes = Info.LODScreenSizes;
+		const float CullDistance = Item.Record->CullDistance;
+		Item.InstancesPerLOD.SetNumZeroed(ScreenSizes.Num());
+
+		for (const FVector& Location : *Item.Record->InstanceLocations)
+		{
+			const float Dist = FVector::Dist(CameraLocation, Location);
+			if (CullDistance > 0.0f && Dist > CullDistance)
+			{
+				++Item.InstancesCulled;
+				continue;
+			}
+
+			// Approximate screen size: radius / distance. UE uses a more complex formula
+			// but this gives reasonable LOD bucketing (screen sizes are in descending order)
+			const float ApproxScreenSize = Dist > 1.0f ? Info.SphereRadius / Dist : 1.0f;
+			int32 LODIndex = 0;
+			for (int32 L = 1; L < ScreenSizes.Num(); ++L)
+			{
+				if (ApproxScreenSize < ScreenSizes[L - 1] && ScreenSizes[L] > 0)
+				{
+					LODIndex = L;
+				}
+			}
+			++Item.InstancesPerLOD[LODIndex];
+		}
+	});
+
+	for (const FBucketWork& Item : Work)
+	{
+		FSceneStatsMeshBreakdown& Out = Breakdown->Meshes[Item.MeshIndex];
+		for (int32 L = 0; L < Item.InstancesPerLOD.Num() && L < Out.InstancesPerLOD.Num(); ++L)
+		{
+			Out.InstancesPerLOD[L] += Item.InstancesPerLOD[L];
+		}
+		Out.InstancesCulled += Item.InstancesCulled;
+	}
+
+	// Sort by instance count * LOD0 tris (worst case cost indicator)
+	Breakdown->Meshes.Sort([](const FSceneStatsMeshBreakdown& A, const FSceneStatsMeshBreakdown& B)
+	{
+		return (int64)A.InstanceCount * A.Info->LOD0Tris > (int64)B.InstanceCount * B.Info->LOD0Tris;
+	});
+
+	Breakdown->AggregateMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	return Breakdown;
+}
+
+TSharedPtr<const FSceneStatsBreakdown> FSceneStatsCache::FindBreakdown(const FSceneStatsSnapshot& Snapshot, const FVector& CameraLocation, bool bHasCamera) const
+{
+	if (CachedBreakdown.IsValid() &&
+		CachedBreakdown->Generation == Snapshot.Generation &&
+		CachedBreakdown->bHasCamera == bHasCamera &&
+		(!bHasCamera || CachedBreakdown->CameraLocation.Equals(CameraLocation, 1.0)))
+	{
+		return CachedBreakdown;
+	}
+	return nullptr;
+}
+
+void FSceneStatsCache::StoreBreakdown(TSharedRef<const FSceneStatsBreakdown> Breakdown)
+{
+	// An older aggregation finishing late must not replace a newer one
+	if (!CachedBreakdown.IsValid() || CachedBreakdown->Generation <= Breakdown->Generation)
+	{
+		CachedBreakdown = Breakdown;
+	}
+}
@@ -2,6 +2,8 @@
 // This file implements the MetaSound operations of FSoundService
 
 #include "Services/SoundService.h"
+#include "Services/MetaSoundPaletteIndex.h"
+#include "Services/SoundGraphEditSession.h"
 #include "MetasoundSource.h"
 #include "MetasoundBuilderSubsystem.h"
 #include "MetasoundBuilderBase.h"
@@ -274,9 +276,6 @@ bool FSoundService::GetMetaSoundMetadata(const FString& MetaSoundPath, TSharedPt
 
 bool FSoundService::AddMetaSoundNode(const FMetaSoundNodeParams& Params, FString& OutNodeId, FString& OutError)
 {
-#if WITH_EDITORONLY_DATA
-    using namespace Metasound::Frontend;
-
     UMetaSoundSource* MetaSound = FindMetaSoundSource(Params.MetaSoundPath);
     if (!MetaSound)
     {
@@ -284,61 +283,15 @@ bool FSoundService::AddMetaSoundNode(const FMetaSoundNodeParams& Params, FString
         return false;
     }
 
-    // Get the builder for this MetaSound
-    Metasound::Engine::FDocumentBuilderRegistry& BuilderRegistry = Metasound::Engine::FDocumentBuilderRegistry::GetChecked();
-    UMetaSoundSourceBuilder& Builder = BuilderRegistry.FindOrBeginBuilding<UMetaSoundSourceBuilder>(*MetaSound);
-
-    // Create the class name from namespace, name, and variant
-    FMetasoundFrontendClassName ClassName;
-    ClassName.Namespace = FName(*Params.NodeNamespace);
-    ClassName.Name = FName(*Params.NodeClassName);
-    if (!Params.NodeVariant.IsEmpty())
-    {
-        ClassName.Variant = FName(*Params.NodeVariant);
-    }
-
     UE_LOG(LogSoundService, Log, TEXT("Adding node: Namespace='%s', Name='%s', Variant='%s'"),
-        *ClassName.Namespace.ToString(), *ClassName.Name.ToString(), *ClassName.Variant.ToString());
-
-    // Mark the MetaSound as modified before making changes
-    MetaSound->Modify();
+        *Params.NodeNamespace, *Params.NodeClassName, *Params.NodeVariant);
 
-    // Add the node using the builder
-    EMetaSoundBuilderResult Result;
-    FMetaSoundNodeHandle NodeHandle = Builder.AddNodeByClassName(ClassName, Result, 1);
-
-    if (Result != EMetaSoundBuilderResult::Succeeded || !NodeHandle.IsSet())
+    FMetaSoundEditSession Session(MetaSound);
+    if (!Session.AddNode(Params.NodeNamespace, Params.NodeClassName, Params.NodeVariant, Params.PosX, Params.PosY, FString(), OutNodeId, OutError))
     {
-        OutError = FString::Printf(TEXT("Failed to add node '%s::%s' (variant: '%s'). Use search_metasound_palette to find valid node names."),
-            *Params.NodeNamespace, *Params.NodeClassName, *Params.NodeVariant);
         return false;
     }
-
-    // Get the node ID from the handle
-    OutNodeId = NodeHandle.NodeID.ToString();
-
-    // CRITICAL: Set the node's location in the document so it appears in the editor graph
-    // Without this, the editor's SynchronizeNodes won't visualize the node
-    FVector2D NodeLocation(static_cast<float>(Params.PosX), static_cast<float>(Params.PosY));
-    Builder.SetNodeLocation(NodeHandle, NodeLocation, Result);
-    if (Result != EMetaSoundBuilderResult::Succeeded)
-    {
-        UE_LOG(LogSoundService, Warning, TEXT("Failed to set node location for '%s::%s', node may not appear in editor graph"),
-            *Params.NodeNamespace, *Params.NodeClassName);
-        // Continue anyway - node was added, just location may be wrong
-    }
-
-    // CRITICAL: Mark the node as modified in the document's ModifyContext
-    // This signals to the editor graph that a node was added and needs synchronization
-    FMetasoundAssetBase* MetaSoundAsset = Metasound::IMetasoundUObjectRegistry::Get().GetObjectAsAssetBase(MetaSound);
-    if (MetaSoundAsset)
-    {
-        MetaSoundAsset->GetModifyContext().AddNodeIDModified(NodeHandle.NodeID);
-    }
-
-    // Register the graph with the frontend to synchronize the editor graph
-    // This creates the visual editor node representation
-    UMetaSoundEditorSubsystem::GetChecked().RegisterGraphWithFrontend(*MetaSound, true);
+    Session.Commit();
 
     // Save the MetaSound
     if (!SaveAsset(MetaSound, OutError))
@@ -350,10 +303,6 @@ bool FSoundService::AddMetaSoundNode(const FMetaSoundNodeParams& Params, FString
         *Params.NodeNamespace, *Params.NodeClassName, *OutNodeId, *Params.MetaSoundPath);
 
     return true;
-#else
-    OutError = TEXT("MetaSound editing requires editor data");
-    return false;
-#endif
 }
 
 bool FSoundService::ConnectMetaSoundNodes(const FString& MetaSoundPath, const FString& SourceNodeId, const FString& SourcePinName, const FString& TargetNodeId, const FString& TargetPinName, FString& OutError)
@@ -365,74 +314,12 @@ bool FSoundService::ConnectMetaSoundNodes(const FString& MetaSoundPath, const FS
         return false;
     }
 
-    // Get or create a builder for this existing MetaSound using the document builder registry
-#if WITH_EDITORONLY_DATA
-    Metasound::Engine::FDocumentBuilderRegistry& BuilderRegistry = Metasound::Engine::FDocumentBuilderRegistry::GetChecked();
-    UMetaSoundSourceBuilder& Builder = BuilderRegistry.FindOrBeginBuilding<UMetaSoundSourceBuilder>(*MetaSound);
-#else
-    OutError = TEXT("MetaSound editing requires editor data");
-    return false;
-#endif
-
-    // Parse node IDs
-    FGuid SourceGuid, TargetGuid;
-    if (!FGuid::Parse(SourceNodeId, SourceGuid))
+    FMetaSoundEditSession Session(MetaSound);
+    if (!Session.Connect(SourceNodeId, SourcePinName, TargetNodeId, TargetPinName, OutError))
     {
-        OutError = FString::Printf(TEXT("Invalid source node ID format: %s"), *SourceNodeId);
         return false;
     }
-    if (!FGuid::Parse(TargetNodeId, TargetGuid))
-    {
-        OutError = FString::Printf(TEXT("Invalid target node ID format: %s"), *TargetNodeId);
-        return false;
-    }
-
-    // Create node handles - use FMetaSoundNodeHandle for generic nodes
-    FMetaSoundNodeHandle SourceHandle;
-    SourceHandle.NodeID = SourceGuid;
-
-    FMetaSoundNodeHandle TargetHandle;
-    TargetHandle.NodeID = TargetGuid;
-
-    // Get output handle from source node
-    EMetaSoundBuilderResult Result;
-    FMetaSoundBuilderNodeOutputHandle OutputHandle = Builder.FindNodeOutputByName(SourceHandle, FName(*SourcePinName), Result);
-    if (Result != EMetaSoundBuilderResult::Succeeded)
-    {
-        OutError = FString::Printf(TEXT("Source pin '%s' not found on node %s"), *SourcePinName, *SourceNodeId);
-        return false;
-    }
-
-    // Get input handle from target node
-    FMetaSoundBuilderNodeInputHandle InputHandle = Builder.FindNodeInputByName(TargetHandle, FName(*TargetPinName), Result);
-    if (Result != EMetaSoundBuilderResult::Succeeded)
-    {
-        OutError = FString::Printf(TEXT("Target pin '%s' not found on node %s"), *TargetPinName, *TargetNodeId);
-        return false;
-    }
-
-    // Mark the MetaSound as modified before making changes
-    MetaSound->Modify();
-
-    // Make the connection
-    Builder.ConnectNodes(OutputHandle, InputHandle, Result);
-    if (Result != EMetaSoundBuilderResult::Succeeded)
-    {
-        OutError = FString::Printf(TEXT("Failed to connect '%s.%s' to '%s.%s'"),
-            *SourceNodeId, *SourcePinName, *TargetNodeId, *TargetPinName);
-        return false;
-    }
-
-    // Mark both connected nodes as modified for synchronization
-    FMetasoundAssetBase* MetaSoundAsset = Metasound::IMetasoundUObjectRegistry::Get().GetObjectAsAssetBase(MetaSound);
-    if (MetaSoundAsset)
-    {
-        MetaSoundAsset->GetModifyContext().AddNodeIDModified(SourceGuid);
-        MetaSoundAsset->GetModifyContext().AddNodeIDModified(TargetGuid);
-    }
-
-    // Register the graph with the frontend to synchronize the editor graph
-    UMetaSoundEditorSubsystem::GetChecked().RegisterGraphWithFrontend(*MetaSound, true);
+    Session.Commit();
 
     // Save the MetaSound
     if (!SaveAsset(MetaSound, OutError))
@@ -455,85 +342,78 @@ bool FSoundService::SetMetaSoundNodeInput(const FString& MetaSoundPath, const FS
         return false;
     }
 
-    // Get the builder subsystem for literal creation helpers
-    UMetaSoundBuilderSubsystem* BuilderSubsystem = UMetaSoundBuilderSubsystem::Get();
-    if (!BuilderSubsystem)
+    FMetaSoundEditSession Session(MetaSound);
+    if (!Session.SetInput(NodeId, InputName, Value, OutError))
     {
-        OutError = TEXT("MetaSound Builder Subsystem not available");
         return false;
     }
+    Session.Commit();
 
-    // Get or create a builder for this existing MetaSound using the document builder registry
-#if WITH_EDITORONLY_DATA
-    Metasound::Engine::FDocumentBuilderRegistry& BuilderRegistry = Metasound::Engine::FDocumentBuilderRegistry::GetChecked();
-    UMetaSoundSourceBuilder& Builder = BuilderRegistry.FindOrBeginBuilding<UMetaSoundSourceBuilder>(*MetaSound);
-#else
-    OutError = TEXT("MetaSound editing requires editor data");
-    return false;
-#endif
-
-    // Parse node ID
-    FGuid NodeGuid;
-    if (!FGuid::Parse(NodeId, NodeGuid))
+    // Save the MetaSound
+    if (!SaveAsset(MetaSound, OutError))
     {
-        OutError = FString::Printf(TEXT("Invalid node ID format: %s"), *NodeId);
-        return false;
+        UE_LOG(LogSoundService, Warning, TEXT("Failed to save MetaSound after setting input: %s"), *OutError);
     }
 
-    // Create node handle - use FMetaSoundNodeHandle for generic nodes
-    FMetaSoundNodeHandle NodeHandle;
-    NodeHandle.NodeID = NodeGuid;
+    UE_LOG(LogSoundService, Log, TEXT("Set input '%s' on node '%s' in MetaSound: %s"), *InputName, *NodeId, *MetaSoundPath);
 
-    // Find the input
-    EMetaSoundBuilderResult Result;
-    FMetaSoundBuilderNodeInputHandle InputHandle = Builder.FindNodeInputByName(NodeHandle, FName(*InputName), Result);
-    if (Result != EMetaSoundBuilderResult::Succeeded)
+    return true;
+}
+
+bool FSoundService::BatchEditMetaSound(const FString& MetaSoundPath, const TArray<FSoundGraphOperation>& Operations, TArray<FSoundGraphOperationResult>& OutResults, FString& OutError)
+{
+    OutResults.Reset(Operations.Num());
+
+    UMetaSoundSource* MetaSound = FindMetaSoundSource(MetaSoundPath);
+    if (!MetaSound)
     {
-        OutError = FString::Printf(TEXT("Input '%s' not found on node %s"), *InputName, *NodeId);
+        OutError = FString::Printf(TEXT("MetaSound not found: %s"), *MetaSoundPath);
         return false;
     }
 
-    // Set the value based on JSON type - need FName references for literal creation
-    FName DataType;
-    if (Value->Type == EJson::Number)
+    FMetaSoundEditSession Session(MetaSound);
+    if (!Session.IsValid())
     {
-        FMetasoundFrontendLiteral Literal = BuilderSubsystem->CreateFloatMetaSoundLiteral(static_cast<float>(Value->AsNumber()), DataType);
-        Builder.SetNodeInputDefault(InputHandle, Literal, Result);
-    }
-    else if (Value->Type == EJson::Boolean)
-    {
-        FMetasoundFrontendLiteral Literal = BuilderSubsystem->CreateBoolMetaSoundLiteral(Value->AsBool(), DataType);
-        Builder.SetNodeInputDefault(InputHandle, Literal, Result);
-    }
-    else if (Value->Type == EJson::String)
-    {
-        FMetasoundFrontendLiteral Literal = BuilderSubsystem->CreateStringMetaSoundLiteral(Value->AsString(), DataType);
-        Builder.SetNodeInputDefault(InputHandle, Literal, Result);
-    }
-    else
-    {
-        OutError = TEXT("Unsupported value type. Supported: number, boolean, string");
+        OutError = TEXT("MetaSound editing requires editor data");
         return false;
     }
 
-    if (Result != EMetaSoundBuilderResult::Succeeded)
+    for (int32 Index = 0; Index < Operations.Num(); ++Index)
     {
-        OutError = FString::Printf(TEXT("Failed to set input value for '%s' on node %s"), *InputName, *NodeId);
-        return false;
-    }
+        const FSoundGraphOperation& Operation = Operations[Index];
+        FSoundGraphOperationResult& OpResult = OutResults.AddDefaulted_GetRef();
+        OpResult.Index = Index;
 
-    // CRITICAL: Sync builder document changes to the MetaSound object
-    MetaSound->ConformObjectToDocument();
+        if (Operation.Op == TEXT("add_node"))
+        {
+            OpResult.bSuccess = Session.AddNode(Operation.NodeNamespace, Operation.NodeClassName, Operation.NodeVariant,
+                Operation.PosX, Operation.PosY, Operation.Ref, OpResult.NodeId, OpResult.Error);
+        }
+        else if (Operation.Op == TEXT("connect"))
+        {
+            OpResult.bSuccess = Session.Connect(Operation.SourceNode, Operation.SourcePin, Operation.TargetNode, Operation.TargetPin, OpResult.Error);
+        }
+        else if (Operation.Op == TEXT("set_input"))
+        {
+            OpResult.bSuccess = Session.SetInput(Operation.NodeId, Operation.InputName, Operation.Value, OpResult.Error);
+        }
+        else
+        {
+            OpResult.Error = FString::Printf(TEXT("Unknown op '%s'. Valid ops: add_node, connect, set_input"), *Operation.Op);
+        }
+    }
 
-    // Save the MetaSound
-    MetaSound->Modify();
-    if (!SaveAsset(MetaSound, OutError))
+    if (Session.HasChanges())
     {
-        UE_LOG(LogSoundService, Warning, TEXT("Failed to save MetaSound after setting input: %s"), *OutError);
+        Session.Commit();
+        FString SaveError;
+        if (!SaveAsset(MetaSound, SaveError))
+        {
+            UE_LOG(LogSoundService, Warning, TEXT("Failed to save MetaSound after batch edit: %s"), *SaveError);
+        }
     }
 
-    UE_LOG(LogSoundService, Log, TEXT("Set input '%s' on node '%s' in MetaSound: %s"), *InputName, *NodeId, *MetaSoundPath);
-
+    UE_LOG(LogSoundService, Log, TEXT("Applied %d graph operations to MetaSound: %s"), Operations.Num(), *MetaSoundPath);
     return true;
 }
 
@@ -793,105 +673,10 @@ bool FSoundService::CompileMetaSound(const FString& MetaSoundPath, FString& OutE
 bool FSoundService::SearchMetaSoundPalette(const FString& SearchQuery, int32 MaxResults, TArray<TSharedPtr<FJsonObject>>& OutResults, FString& OutError)
 {
 #if WITH_EDITORONLY_DATA
-    using namespace Metasound::Frontend;
-
-    // Get all registered MetaSound node classes
-    ISearchEngine& SearchEngine = ISearchEngine::Get();
-    TArray<FMetasoundFrontendClass> AllClasses = SearchEngine.FindAllClasses(false); // false = don't include deprecated versions
-
-    FString LowerQuery = SearchQuery.ToLower();
-    int32 ResultCount = 0;
-
-    for (const FMetasoundFrontendClass& NodeClass : AllClasses)
-    {
-        if (MaxResults > 0 && ResultCount >= MaxResults)
-        {
-            break;
-        }
-
-        const FMetasoundFrontendClassMetadata& Metadata = NodeClass.Metadata;
-        const FMetasoundFrontendClassName& ClassName = Metadata.GetClassName();
-
-        // Build searchable strings
-        FString NameStr = ClassName.Name.ToString();
-        FString NamespaceStr = ClassName.Namespace.ToString();
-        FString VariantStr = ClassName.Variant.ToString();
-        FString DisplayNameStr = Metadata.GetDisplayName().ToString();
-        FString DescriptionStr = Metadata.GetDescription().ToString();
-
-        // Build category string from hierarchy
-        FString CategoryStr;
-        const TArray<FText>& CategoryHierarchy = Metadata.GetCategoryHierarchy();
-        for (int32 i = 0; i < CategoryHierarchy.Num(); ++i)
-        {
-            if (i > 0) CategoryStr += TEXT(" > ");
-            CategoryStr += CategoryHierarchy[i].ToString();
-        }
-
-        // Build keywords string
-        FString KeywordsStr;
-        const TArray<FText>& Keywords = Metadata.GetKeywords();
-        for (const FText& Keyword : Keywords)
-        {
-            KeywordsStr += TEXT(" ") + Keyword.ToString();
-        }
-
-        // Check if any field matches the search query
-        bool bMatches = LowerQuery.IsEmpty() ||
-            NameStr.ToLower().Contains(LowerQuery) ||
-            NamespaceStr.ToLower().Contains(LowerQuery) ||
-            VariantStr.ToLower().Contains(LowerQuery) ||
-            DisplayNameStr.ToLower().Contains(LowerQuery) ||
-            DescriptionStr.ToLower().Contains(LowerQuery) ||
-            CategoryStr.ToLower().Contains(LowerQuery) ||
-            KeywordsStr.ToLower().Contains(LowerQuery);
-
-        if (bMatches)
-        {
-            TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-            ResultObj->SetStringField(TEXT("namespace"), NamespaceStr);
-            ResultObj->SetStringField(TEXT("name"), NameStr);
-            ResultObj->SetStringField(TEXT("variant"), VariantStr);
-            ResultObj->SetStringField(TEXT("display_name"), DisplayNameStr);
-            ResultObj->SetStringField(TEXT("description"), DescriptionStr);
-            ResultObj->SetStringField(TEXT("category"), CategoryStr);
-
-            // Build full class name for use with add_metasound_node
-            FString FullClassName = NamespaceStr + TEXT("::") + NameStr;
-            if (!VariantStr.IsEmpty())
-            {
-                FullClassName += TEXT(" (") + VariantStr + TEXT(")");
-            }
-            ResultObj->SetStringField(TEXT("full_name"), FullClassName);
-
-            // Include inputs/outputs info
-            const FMetasoundFrontendClassInterface& Interface = NodeClass.GetDefaultInterface();
-            TArray<TSharedPtr<FJsonValue>> InputsArray;
-            for (const FMetasoundFrontendClassInput& Input : Interface.Inputs)
-            {
-                TSharedPtr<FJsonObject> InputObj = MakeShared<FJsonObject>();
-                InputObj->SetStringField(TEXT("name"), Input.Name.ToString());
-                InputObj->SetStringField(TEXT("type"), Input.TypeName.ToString());
-                InputsArray.Add(MakeShared<FJsonValueObject>(InputObj));
-            }
-            ResultObj->SetArrayField(TEXT("inputs"), InputsArray);
-
-            TArray<TSharedPtr<FJsonValue>> OutputsArray;
-            for (const FMetasoundFrontendClassOutput& Output : Interface.Outputs)
-            {
-                TSharedPtr<FJsonObject> OutputObj = MakeShared<FJsonObject>();
-                OutputObj->SetStringField(TEXT("name"), Output.Name.ToString());
-                OutputObj->SetStringField(TEXT("type"), Output.TypeName.ToString());
-                OutputsArray.Add(MakeShared<FJsonValueObject>(OutputObj));
-            }
-            ResultObj->SetArrayField(TEXT("outputs"), OutputsArray);
-
-            OutResults.Add(ResultObj);
-            ResultCount++;
-        }
-    }
+    // Ranked lookup over the cached palette index; no per-query registry copy or FText formatting
+    OutResults = FMetaSoundPaletteIndex::Get().Search(SearchQuery, MaxResults);
 
-    UE_LOG(LogSoundService, Log, TEXT("MetaSound palette search for '%s' returned %d results"), *SearchQuery, ResultCount);
+    UE_LOG(LogSoundService, Log, TEXT("MetaSound palette search for '%s' returned %d results"), *SearchQuery, OutResults.Num());
     return true;
 #else
     OutError = TEXT("MetaSound palette search requires editor data");
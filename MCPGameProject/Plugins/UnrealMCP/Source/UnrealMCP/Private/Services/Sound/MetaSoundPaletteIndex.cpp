@@ -0,0 +1,377 @@
+#include "Services/MetaSoundPaletteIndex.h"
+#include "Services/SoundService.h"
+#include "MetasoundFrontendRegistries.h"
+#include "MetasoundFrontendSearchEngine.h"
+#include "Algo/BinarySearch.h"
+#include "Dom/JsonValue.h"
+
+namespace
+{
+    /** Score for a query word matching a field, before the match-kind multiplier */
+    int32 FieldWeight(uint8 Field)
+    {
+        static const int32 Weights[] = { 100, 100, 40, 40, 30, 10 };
+        return Field < UE_ARRAY_COUNT(Weights) ? Weights[Field] : 1;
+    }
+}
+
+FMetaSoundPaletteIndex& FMetaSoundPaletteIndex::Get()
+{
+    static FMetaSoundPaletteIndex Instance;
+    return Instance;
+}
+
+void FMetaSoundPaletteIndex::Initialize()
+{
+    if (FMetasoundFrontendRegistryContainer* Registry = FMetasoundFrontendRegistryContainer::Get())
+    {
+        RegistryTransactions = Registry->CreateTransactionStream();
+    }
+}
+
+void FMetaSoundPaletteIndex::Shutdown()
+{
+    RegistryTransactions.Reset();
+
+    Invalidate();
+    Entries.Empty();
+    Words.Empty();
+    EntriesByWord.Empty();
+    Suffixes.Empty();
+}
+
+void FMetaSoundPaletteIndex::Invalidate()
+{
+    bIsBuilt = false;
+}
+
+bool FMetaSoundPaletteIndex::ConsumeRegistryTransactions()
+{
+    bool bChanged = false;
+    if (RegistryTransactions.IsValid())
+    {
+        RegistryTransactions->Stream([&bChanged](const Metasound::Frontend::FNodeRegistryTransaction&)
+        {
+            bChanged = true;
+        });
+    }
+    return bChanged;
+}
+
+int32 FMetaSoundPaletteIndex::Num()
+{
+    EnsureBuilt();
+    return Entries.Num();
+}
+
+void FMetaSoundPaletteIndex::EnsureBuilt()
+{
+    check(IsInGameThread());
+    if (ConsumeRegistryTransactions())
+    {
+        Invalidate();
+    }
+    if (!bIsBuilt)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        Build(CollectRegisteredClasses());
+        UE_LOG(LogSoundService, Log, TEXT("FMetaSoundPaletteIndex: Indexed %d node classes (%d words, %d suffixes) in %.1f ms"),
+            Entries.Num(), Words.Num(), Suffixes.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    }
+}
+
+TArray<FMetaSoundPaletteEntry> FMetaSoundPaletteIndex::CollectRegisteredClasses()
+{
+    TArray<FMetaSoundPaletteEntry> Result;
+#if WITH_EDITORONLY_DATA
+    using namespace Metasound::Frontend;
+
+    const TArray<FMetasoundFrontendClass> AllClasses = ISearchEngine::Get().FindAllClasses(false); // false = don't include deprecated versions
+    Result.Reserve(AllClasses.Num());
+    for (const FMetasoundFrontendClass& NodeClass : AllClasses)
+    {
+        const FMetasoundFrontendClassMetadata& Metadata = NodeClass.Metadata;
+        const FMetasoundFrontendClassName& ClassName = Metadata.GetClassName();
+
+        FMetaSoundPaletteEntry& Entry = Result.AddDefaulted_GetRef();
+        Entry.Namespace = ClassName.Namespace.ToString();
+        Entry.Name = ClassName.Name.ToString();
+        Entry.Variant = ClassName.Variant.ToString();
+        Entry.DisplayName = Metadata.GetDisplayName().ToString();
+        Entry.Description = Metadata.GetDescription().ToString();
+
+        const TArray<FText>& CategoryHierarchy = Metadata.GetCategoryHierarchy();
+        for (int32 i = 0; i < CategoryHierarchy.Num(); ++i)
+        {
+            if (i > 0) Entry.Category += TEXT(" > ");
+            Entry.Category += CategoryHierarchy[i].ToString();
+        }
+
+        for (const FText& Keyword : Metadata.GetKeywords())
+        {
+            Entry.Keywords.Add(Keyword.ToString());
+        }
+
+        const FMetasoundFrontendClassInterface& Interface = NodeClass.GetDefaultInterface();
+        for (const FMetasoundFrontendClassInput& Input : Interface.Inputs)
+        {
+            Entry.Inputs.Emplace(Input.Name.ToString(), Input.TypeName.ToString());
+        }
+        for (const FMetasoundFrontendClassOutput& Output : Interface.Outputs)
+        {
+            Entry.Outputs.Emplace(Output.Name.ToString(), Output.TypeName.ToString());
+        }
+    }
+#endif
+    return Result;
+}
+
+TSharedPtr<FJsonObject> FMetaSoundPaletteIndex::MakeResponse(const FMetaSoundPaletteEntry& Entry)
+{
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("namespace"), Entry.Namespace);
+    ResultObj->SetStringField(TEXT("name"), Entry.Name);
+    ResultObj->SetStringField(TEXT("variant"), Entry.Variant);
+    ResultObj->SetStringField(TEXT("display_name"), Entry.DisplayName);
+    ResultObj->SetStringField(TEXT("description"), Entry.Description);
+    ResultObj->SetStringField(TEXT("category"), Entry.Category);
+
+    // Build full class name for use with add_metasound_node
+    FString FullClassName = Entry.Namespace + TEXT("::") + Entry.Name;
+    if (!Entry.Variant.IsEmpty())
+    {
+        FullClassName += TEXT(" (") + Entry.Variant + TEXT(")");
+    }
+    ResultObj->SetStringField(TEXT("full_name"), FullClassName);
+
+    auto MakePinArray = [](const TArray<TPair<FString, FString>>& Pins)
+    {
+        TArray<TSharedPtr<FJsonValue>> PinArray;
+        for (const TPair<FString, FString>& Pin : Pins)
+        {
+            TSharedPtr<FJsonObject> PinObj = MakeShared<FJsonObject>();
+            PinObj->SetStringField(TEXT("name"), Pin.Key);
+            PinObj->SetStringField(TEXT("type"), Pin.Value);
+            PinArray.Add(MakeShared<FJsonValueObject>(PinObj));
+        }
+        return PinArray;
+    };
+    ResultObj->SetArrayField(TEXT("inputs"), MakePinArray(Entry.Inputs));
+    ResultObj->SetArrayField(TEXT("outputs"), MakePinArray(Entry.Outputs));
+    return ResultObj;
+}
+
+void FMetaSoundPaletteIndex::Tokenize(const FString& Text, TArray<FString>& OutTokens)
+{
+    auto AddWord = [&OutTokens](const FString& Word)
+    {
+        // Whole word first, then its CamelCase parts ("TriggerRepeat" -> "trigger", "repeat")
+        OutTokens.AddUnique(Word.ToLower());
+
+        int32 PartStart = 0;
+        for (int32 Index = 1; Index < Word.Len(); ++Index)
+        {
+            if (FChar::IsUpper(Word[Index]) && FChar::IsLower(Word[Index - 1]))
+            {
+                OutTokens.AddUnique(Word.Mid(PartStart, Index - PartStart).ToLower());
+                PartStart = Index;
+            }
+        }
+        if (PartStart > 0)
+        {
+            OutTokens.AddUnique(Word.Mid(PartStart).ToLower());
+        }
+    };
+
+    FString Word;
+    for (const TCHAR Char : Text)
+    {
+        if (FChar::IsAlnum(Char))
+        {
+            Word.AppendChar(Char);
+        }
+        else if (!Word.IsEmpty())
+        {
+            AddWord(Word);
+            Word.Reset();
+        }
+    }
+    if (!Word.IsEmpty())
+    {
+        AddWord(Word);
+    }
+}
+
+void FMetaSoundPaletteIndex::AddTokens(int32 EntryIndex, const FString& Text, EField Field, TMap<FString, int32>& InOutWordIndices)
+{
+    TArray<FString> Tokens;
+    Tokenize(Text, Tokens);
+    for (const FString& Token : Tokens)
+    {
+        int32 WordIndex = INDEX_NONE;
+        if (const int32* Existing = InOutWordIndices.Find(Token))
+        {
+            WordIndex = *Existing;
+        }
+        else
+        {
+            WordIndex = Words.Add(Token);
+            EntriesByWord.AddDefaulted();
+            InOutWordIndices.Add(Token, WordIndex);
+        }
+
+        uint8& BestField = EntriesByWord[WordIndex].FindOrAdd(EntryIndex, static_cast<uint8>(Field));
+        BestField = FMath::Min(BestField, static_cast<uint8>(Field));
+    }
+}
+
+void FMetaSoundPaletteIndex::Build(TArray<FMetaSoundPaletteEntry> InEntries)
+{
+    // The entries describe the registry as it is now; earlier transactions are already reflected
+    ConsumeRegistryTransactions();
+
+    Entries.Reset(InEntries.Num());
+    Words.Reset();
+    EntriesByWord.Reset();
+    Suffixes.Reset();
+    TMap<FString, int32> WordIndices;
+
+    for (const FMetaSoundPaletteEntry& Entry : InEntries)
+    {
+        const int32 EntryIndex = Entries.Num();
+        FIndexedEntry& Indexed = Entries.AddDefaulted_GetRef();
+        Indexed.NameLower = Entry.Name.ToLower();
+        Indexed.DisplayNameLower = Entry.DisplayName.ToLower();
+        Indexed.SortKey = (Entry.DisplayName.IsEmpty() ? Indexed.NameLower : Indexed.DisplayNameLower) + TEXT(" ") + Entry.Variant.ToLower();
+        Indexed.Response = MakeResponse(Entry);
+
+        AddTokens(EntryIndex, Entry.Name, EField::Name, WordIndices);
+        AddTokens(EntryIndex, Entry.Variant, EField::Name, WordIndices);
+        AddTokens(EntryIndex, Entry.DisplayName, EField::DisplayName, WordIndices);
+        AddTokens(EntryIndex, Entry.Category, EField::Category, WordIndices);
+        for (const FString& Keyword : Entry.Keywords)
+        {
+            AddTokens(EntryIndex, Keyword, EField::Keyword, WordIndices);
+        }
+        AddTokens(EntryIndex, Entry.Namespace, EField::Namespace, WordIndices);
+        AddTokens(EntryIndex, Entry.Description, EField::Description, WordIndices);
+    }
+
+    // Substring matches of a query word are the suffixes it prefixes, a contiguous sorted range
+    for (int32 WordIndex = 0; WordIndex < Words.Num(); ++WordIndex)
+    {
+        for (int32 Offset = 0; Offset < Words[WordIndex].Len(); ++Offset)
+        {
+            Suffixes.Add({WordIndex, Offset});
+        }
+    }
+    Suffixes.Sort([this](const FWordSuffix& A, const FWordSuffix& B)
+    {
+        return GetSuffix(A).Compare(GetSuffix(B), ESearchCase::CaseSensitive) < 0;
+    });
+
+    bIsBuilt = true;
+}
+
+TArray<TSharedPtr<FJsonObject>> FMetaSoundPaletteIndex::Search(const FString& SearchQuery, int32 MaxResults)
+{
+    EnsureBuilt();
+
+    TArray<FString> QueryTokens;
+    Tokenize(SearchQuery, QueryTokens);
+
+    // Entry index -> accumulated score; an entry stays only while every query word matches
+    TMap<int32, int32> Scores;
+    if (QueryTokens.Num() == 0)
+    {
+        for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+        {
+            Scores.Add(EntryIndex, 0);
+        }
+    }
+
+    for (int32 TokenIndex = 0; TokenIndex < QueryTokens.Num(); ++TokenIndex)
+    {
+        const FStringView QueryToken = QueryTokens[TokenIndex];
+
+        // Words containing the query word: exact words score x3, prefixes x2, substrings x1
+        TMap<int32, int32> TokenScores;
+        const int32 FirstSuffix = Algo::LowerBound(Suffixes, QueryToken, [this](const FWordSuffix& Suffix, FStringView Value)
+        {
+            return GetSuffix(Suffix).Compare(Value, ESearchCase::CaseSensitive) < 0;
+        });
+        for (int32 SuffixIndex = FirstSuffix; SuffixIndex < Suffixes.Num(); ++SuffixIndex)
+        {
+            const FWordSuffix& Suffix = Suffixes[SuffixIndex];
+            if (!GetSuffix(Suffix).StartsWith(QueryToken, ESearchCase::CaseSensitive))
+            {
+                break;
+            }
+
+            const int32 MatchWeight = Suffix.Offset > 0 ? 1 : Words[Suffix.WordIndex].Len() == QueryToken.Len() ? 3 : 2;
+            for (const TPair<int32, uint8>& Hit : EntriesByWord[Suffix.WordIndex])
+            {
+                int32& Best = TokenScores.FindOrAdd(Hit.Key, 0);
+                Best = FMath::Max(Best, FieldWeight(Hit.Value) * MatchWeight);
+            }
+        }
+
+        if (TokenIndex == 0)
+        {
+            Scores = MoveTemp(TokenScores);
+            continue;
+        }
+        for (auto It = Scores.CreateIterator(); It; ++It)
+        {
+            const int32* TokenScore = TokenScores.Find(It.Key());
+            if (TokenScore)
+            {
+                It.Value() += *TokenScore;
+            }
+            else
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    // The whole query naming the node outranks any word-level match
+    const FString LowerQuery = SearchQuery.TrimStartAndEnd().ToLower();
+    TArray<TPair<int32, int32>> Ranked;
+    Ranked.Reserve(Scores.Num());
+    for (const TPair<int32, int32>& Score : Scores)
+    {
+        int32 Total = Score.Value;
+        const FIndexedEntry& Entry = Entries[Score.Key];
+        if (!LowerQuery.IsEmpty())
+        {
+            if (Entry.NameLower == LowerQuery || Entry.DisplayNameLower == LowerQuery)
+            {
+                Total += 1000;
+            }
+            else if (Entry.NameLower.StartsWith(LowerQuery) || Entry.DisplayNameLower.StartsWith(LowerQuery))
+            {
+                Total += 200;
+            }
+        }
+        Ranked.Emplace(Score.Key, Total);
+    }
+
+    Ranked.Sort([this](const TPair<int32, int32>& A, const TPair<int32, int32>& B)
+    {
+        if (A.Value != B.Value)
+        {
+            return A.Value > B.Value;
+        }
+        return Entries[A.Key].SortKey < Entries[B.Key].SortKey;
+    });
+
+    const int32 NumResults = MaxResults > 0 ? FMath::Min(MaxResults, Ranked.Num()) : Ranked.Num();
+    TArray<TSharedPtr<FJsonObject>> Results;
+    Results.Reserve(NumResults);
+    for (int32 Index = 0; Index < NumResults; ++Index)
+    {
+        Results.Add(Entries[Ranked[Index].Key].Response);
+    }
+    return Results;
+}
@@ -2,6 +2,7 @@
 // This file implements the Sound Cue operations of FSoundService
 
 #include "Services/SoundService.h"
+#include "Services/SoundGraphEditSession.h"
 #include "Sound/SoundCue.h"
 #include "Sound/SoundWave.h"
 #include "Sound/SoundNode.h"
@@ -187,97 +188,36 @@ bool FSoundService::GetSoundCueMetadata(const FString& SoundCuePath, TSharedPtr<
     return true;
 }
 
-bool FSoundService::AddSoundCueNode(const FSoundCueNodeParams& Params, FString& OutNodeId, FString& OutError)
+USoundWave* FSoundService::FindWavePlayerSound(const FString& SoundWavePath)
 {
-    USoundCue* SoundCue = FindSoundCue(Params.SoundCuePath);
-    if (!SoundCue)
+    if (SoundWavePath.IsEmpty())
     {
-        OutError = FString::Printf(TEXT("Sound Cue not found: %s"), *Params.SoundCuePath);
-        return false;
+        return nullptr;
     }
 
-    SoundCue->Modify();
-
-    USoundNode* NewNode = nullptr;
-    FString NodeType = Params.NodeType.ToLower();
-
-    // Create the appropriate node type
-    if (NodeType == TEXT("waveplayer") || NodeType == TEXT("wave_player"))
-    {
-        USoundNodeWavePlayer* WavePlayer = SoundCue->ConstructSoundNode<USoundNodeWavePlayer>();
-        if (WavePlayer && !Params.SoundWavePath.IsEmpty())
-        {
-            USoundWave* SoundWave = FindSoundWave(Params.SoundWavePath);
-            if (SoundWave)
-            {
-                WavePlayer->SetSoundWave(SoundWave);
-            }
-            else
-            {
-                UE_LOG(LogSoundService, Warning, TEXT("Sound wave not found: %s"), *Params.SoundWavePath);
-            }
-        }
-        NewNode = WavePlayer;
-    }
-    else if (NodeType == TEXT("mixer"))
-    {
-        NewNode = SoundCue->ConstructSoundNode<USoundNodeMixer>();
-    }
-    else if (NodeType == TEXT("random"))
-    {
-        NewNode = SoundCue->ConstructSoundNode<USoundNodeRandom>();
-    }
-    else if (NodeType == TEXT("modulator"))
+    USoundWave* SoundWave = FindSoundWave(SoundWavePath);
+    if (!SoundWave)
     {
-        USoundNodeModulator* Modulator = SoundCue->ConstructSoundNode<USoundNodeModulator>();
-        if (Modulator)
-        {
-            // Set default ranges
-            Modulator->PitchMin = 1.0f;
-            Modulator->PitchMax = 1.0f;
-            Modulator->VolumeMin = 1.0f;
-            Modulator->VolumeMax = 1.0f;
-        }
-        NewNode = Modulator;
-    }
-    else if (NodeType == TEXT("looping"))
-    {
-        USoundNodeLooping* Looping = SoundCue->ConstructSoundNode<USoundNodeLooping>();
-        if (Looping)
-        {
-            Looping->LoopCount = 1;
-            Looping->bLoopIndefinitely = false;
-        }
-        NewNode = Looping;
-    }
-    else if (NodeType == TEXT("delay"))
-    {
-        NewNode = SoundCue->ConstructSoundNode<USoundNodeDelay>();
-    }
-    else if (NodeType == TEXT("concatenator"))
-    {
-        NewNode = SoundCue->ConstructSoundNode<USoundNodeConcatenator>();
-    }
-    else if (NodeType == TEXT("attenuation"))
-    {
-        NewNode = SoundCue->ConstructSoundNode<USoundNodeAttenuation>();
+        UE_LOG(LogSoundService, Warning, TEXT("Sound wave not found: %s"), *SoundWavePath);
     }
-    else
+    return SoundWave;
+}
+
+bool FSoundService::AddSoundCueNode(const FSoundCueNodeParams& Params, FString& OutNodeId, FString& OutError)
+{
+    USoundCue* SoundCue = FindSoundCue(Params.SoundCuePath);
+    if (!SoundCue)
     {
-        OutError = FString::Printf(TEXT("Unknown node type: %s. Valid types: WavePlayer, Mixer, Random, Modulator, Looping, Delay, Concatenator, Attenuation"), *Params.NodeType);
+        OutError = FString::Printf(TEXT("Sound Cue not found: %s"), *Params.SoundCuePath);
         return false;
     }
 
-    if (!NewNode)
+    FSoundCueEditSession Session(SoundCue);
+    if (!Session.AddNode(Params.NodeType, FindWavePlayerSound(Params.SoundWavePath), FString(), OutNodeId, OutError))
     {
-        OutError = FString::Printf(TEXT("Failed to create node of type: %s"), *Params.NodeType);
         return false;
     }
-
-#if WITH_EDITOR
-    // Link graph nodes to reflect the new node
-    SoundCue->LinkGraphNodesFromSoundNodes();
-#endif
+    Session.Commit();
 
     // Save the asset
     FString SaveError;
@@ -286,7 +226,6 @@ bool FSoundService::AddSoundCueNode(const FSoundCueNodeParams& Params, FString&
         UE_LOG(LogSoundService, Warning, TEXT("Failed to save Sound Cue after adding node: %s"), *SaveError);
     }
 
-    OutNodeId = NewNode->GetName();
     UE_LOG(LogSoundService, Log, TEXT("Added %s node '%s' to Sound Cue: %s"), *Params.NodeType, *OutNodeId, *Params.SoundCuePath);
     return true;
 }
@@ -300,90 +239,69 @@ bool FSoundService::ConnectSoundCueNodes(const FString& SoundCuePath, const FStr
         return false;
     }
 
-    SoundCue->Modify();
-
-#if WITH_EDITORONLY_DATA
-    // Find the source node
-    USoundNode* SourceNode = nullptr;
-    for (USoundNode* Node : SoundCue->AllNodes)
+    FSoundCueEditSession Session(SoundCue);
+    if (!Session.Connect(SourceNodeId, TargetNodeId, TargetPinIndex, OutError))
     {
-        if (Node && Node->GetName() == SourceNodeId)
-        {
-            SourceNode = Node;
-            break;
-        }
+        return false;
     }
+    Session.Commit();
 
-    if (!SourceNode)
+    // Save the asset
+    FString SaveError;
+    if (!SaveAsset(SoundCue, SaveError))
     {
-        OutError = FString::Printf(TEXT("Source node not found: %s"), *SourceNodeId);
-        return false;
+        UE_LOG(LogSoundService, Warning, TEXT("Failed to save Sound Cue after connecting nodes: %s"), *SaveError);
     }
 
-    // Check if target is "Output" - meaning connect to FirstNode (root)
-    if (TargetNodeId.Equals(TEXT("Output"), ESearchCase::IgnoreCase))
+    UE_LOG(LogSoundService, Log, TEXT("Connected '%s' to '%s' at pin %d in Sound Cue: %s"), *SourceNodeId, *TargetNodeId, TargetPinIndex, *SoundCuePath);
+    return true;
+}
+
+bool FSoundService::BatchEditSoundCue(const FString& SoundCuePath, const TArray<FSoundGraphOperation>& Operations, TArray<FSoundGraphOperationResult>& OutResults, FString& OutError)
+{
+    OutResults.Reset(Operations.Num());
+
+    USoundCue* SoundCue = FindSoundCue(SoundCuePath);
+    if (!SoundCue)
     {
-        SoundCue->FirstNode = SourceNode;
-        UE_LOG(LogSoundService, Log, TEXT("Connected '%s' to Sound Cue Output"), *SourceNodeId);
+        OutError = FString::Printf(TEXT("Sound Cue not found: %s"), *SoundCuePath);
+        return false;
     }
-    else
+
+    FSoundCueEditSession Session(SoundCue);
+    for (int32 Index = 0; Index < Operations.Num(); ++Index)
     {
-        // Find the target node
-        USoundNode* TargetNode = nullptr;
-        for (USoundNode* Node : SoundCue->AllNodes)
-        {
-            if (Node && Node->GetName() == TargetNodeId)
-            {
-                TargetNode = Node;
-                break;
-            }
-        }
+        const FSoundGraphOperation& Operation = Operations[Index];
+        FSoundGraphOperationResult& OpResult = OutResults.AddDefaulted_GetRef();
+        OpResult.Index = Index;
 
-        if (!TargetNode)
+        if (Operation.Op == TEXT("add_node"))
         {
-            OutError = FString::Printf(TEXT("Target node not found: %s"), *TargetNodeId);
-            return false;
+            OpResult.bSuccess = Session.AddNode(Operation.NodeType, FindWavePlayerSound(Operation.SoundWavePath),
+                Operation.Ref, OpResult.NodeId, OpResult.Error);
         }
-
-        // Validate pin index against max children
-        int32 MaxChildren = TargetNode->GetMaxChildNodes();
-        if (TargetPinIndex >= MaxChildren)
+        else if (Operation.Op == TEXT("connect"))
         {
-            OutError = FString::Printf(TEXT("Target pin index %d exceeds max children %d for node type %s"),
-                TargetPinIndex, MaxChildren, *TargetNode->GetClass()->GetName());
-            return false;
+            OpResult.bSuccess = Session.Connect(Operation.SourceNode, Operation.TargetNode, Operation.TargetPinIndex, OpResult.Error);
         }
-
-        // Use InsertChildNode to properly add child slots with graph pin synchronization
-        // This ensures InputPins.Num() == ChildNodes.Num() is maintained
-        while (TargetNode->ChildNodes.Num() <= TargetPinIndex)
+        else
         {
-            int32 NewChildIndex = TargetNode->ChildNodes.Num();
-            TargetNode->InsertChildNode(NewChildIndex);
+            OpResult.Error = FString::Printf(TEXT("Unknown op '%s'. Valid ops: add_node, connect"), *Operation.Op);
         }
-
-        // Make the connection
-        TargetNode->ChildNodes[TargetPinIndex] = SourceNode;
-        UE_LOG(LogSoundService, Log, TEXT("Connected '%s' to '%s' at pin %d"), *SourceNodeId, *TargetNodeId, TargetPinIndex);
     }
 
-#if WITH_EDITOR
-    // Update the editor graph to reflect the new connection
-    SoundCue->LinkGraphNodesFromSoundNodes();
-#endif
-
-    // Save the asset
-    FString SaveError;
-    if (!SaveAsset(SoundCue, SaveError))
+    if (Session.HasChanges())
     {
-        UE_LOG(LogSoundService, Warning, TEXT("Failed to save Sound Cue after connecting nodes: %s"), *SaveError);
+        Session.Commit();
+        FString SaveError;
+        if (!SaveAsset(SoundCue, SaveError))
+        {
+            UE_LOG(LogSoundService, Warning, TEXT("Failed to save Sound Cue after batch edit: %s"), *SaveError);
+        }
     }
 
+    UE_LOG(LogSoundService, Log, TEXT("Applied %d graph operations to Sound Cue: %s"), Operations.Num(), *SoundCuePath);
     return true;
-#else
-    OutError = TEXT("Sound Cue node connection requires editor data");
-    return false;
-#endif
 }
 
 bool FSoundService::SetSoundCueNodeProperty(const FString& SoundCuePath, const FString& NodeId, const FString& PropertyName, const TSharedPtr<FJsonValue>& PropertyValue, FString& OutError)
@@ -0,0 +1,457 @@
+#include "Services/SoundGraphEditSession.h"
+#include "Services/SoundService.h"
+#include "MetasoundSource.h"
+#include "MetasoundBuilderSubsystem.h"
+#include "MetasoundBuilderBase.h"
+#include "MetasoundAssetBase.h"
+#include "MetasoundUObjectRegistry.h"
+#include "MetasoundDocumentBuilderRegistry.h"
+#include "MetasoundEditorSubsystem.h"
+#include "Sound/SoundCue.h"
+#include "Sound/SoundWave.h"
+#include "Sound/SoundNode.h"
+#include "Sound/SoundNodeWavePlayer.h"
+#include "Sound/SoundNodeMixer.h"
+#include "Sound/SoundNodeRandom.h"
+#include "Sound/SoundNodeModulator.h"
+#include "Sound/SoundNodeLooping.h"
+#include "Sound/SoundNodeDelay.h"
+#include "Sound/SoundNodeConcatenator.h"
+#include "Sound/SoundNodeAttenuation.h"
+#include "Dom/JsonValue.h"
+
+// ============================================================================
+// FMetaSoundEditSession
+// ============================================================================
+
+FMetaSoundEditSession::FMetaSoundEditSession(UMetaSoundSource* InMetaSound)
+    : MetaSound(InMetaSound)
+{
+#if WITH_EDITORONLY_DATA
+    if (MetaSound)
+    {
+        Metasound::Engine::FDocumentBuilderRegistry& BuilderRegistry = Metasound::Engine::FDocumentBuilderRegistry::GetChecked();
+        Builder = &BuilderRegistry.FindOrBeginBuilding<UMetaSoundSourceBuilder>(*MetaSound);
+    }
+#endif
+}
+
+void FMetaSoundEditSession::BeginChange()
+{
+    if (!HasChanges())
+    {
+        MetaSound->Modify();
+    }
+}
+
+bool FMetaSoundEditSession::ResolveNode(const FString& NodeRef, FGuid& OutNodeId, FString& OutError) const
+{
+    if (const FGuid* Found = NodesByRef.Find(NodeRef))
+    {
+        OutNodeId = *Found;
+        return true;
+    }
+    if (FGuid::Parse(NodeRef, OutNodeId))
+    {
+        return true;
+    }
+    OutError = FString::Printf(TEXT("Invalid node reference: '%s' is neither a node ID nor a ref added earlier in the batch"), *NodeRef);
+    return false;
+}
+
+bool FMetaSoundEditSession::AddNode(const FString& Namespace, const FString& ClassName, const FString& Variant, int32 PosX, int32 PosY,
+                                    const FString& Ref, FString& OutNodeId, FString& OutError)
+{
+    if (!IsValid())
+    {
+        OutError = TEXT("MetaSound editing requires editor data");
+        return false;
+    }
+    if (!Ref.IsEmpty() && NodesByRef.Contains(Ref))
+    {
+        OutError = FString::Printf(TEXT("Ref '%s' is already used in this batch"), *Ref);
+        return false;
+    }
+
+    // Create the class name from namespace, name, and variant
+    FMetasoundFrontendClassName FrontendClassName;
+    FrontendClassName.Namespace = FName(*Namespace);
+    FrontendClassName.Name = FName(*ClassName);
+    if (!Variant.IsEmpty())
+    {
+        FrontendClassName.Variant = FName(*Variant);
+    }
+
+    BeginChange();
+
+    EMetaSoundBuilderResult Result;
+    FMetaSoundNodeHandle NodeHandle = Builder->AddNodeByClassName(FrontendClassName, Result, 1);
+    if (Result != EMetaSoundBuilderResult::Succeeded || !NodeHandle.IsSet())
+    {
+        OutError = FString::Printf(TEXT("Failed to add node '%s::%s' (variant: '%s'). Use search_metasound_palette to find valid node names."),
+            *Namespace, *ClassName, *Variant);
+        return false;
+    }
+    bGraphChanged = true;
+
+    // Without a location the editor's SynchronizeNodes won't visualize the node
+    Builder->SetNodeLocation(NodeHandle, FVector2D(static_cast<float>(PosX), static_cast<float>(PosY)), Result);
+    if (Result != EMetaSoundBuilderResult::Succeeded)
+    {
+        UE_LOG(LogSoundService, Warning, TEXT("Failed to set node location for '%s::%s', node may not appear in editor graph"),
+            *Namespace, *ClassName);
+    }
+
+    ModifiedNodes.Add(NodeHandle.NodeID);
+    if (!Ref.IsEmpty())
+    {
+        NodesByRef.Add(Ref, NodeHandle.NodeID);
+    }
+    OutNodeId = NodeHandle.NodeID.ToString();
+    return true;
+}
+
+bool FMetaSoundEditSession::Connect(const FString& SourceNode, const FString& SourcePin, const FString& TargetNode, const FString& TargetPin, FString& OutError)
+{
+    if (!IsValid())
+    {
+        OutError = TEXT("MetaSound editing requires editor data");
+        return false;
+    }
+
+    FMetaSoundNodeHandle SourceHandle;
+    FMetaSoundNodeHandle TargetHandle;
+    if (!ResolveNode(SourceNode, SourceHandle.NodeID, OutError) || !ResolveNode(TargetNode, TargetHandle.NodeID, OutError))
+    {
+        return false;
+    }
+
+    EMetaSoundBuilderResult Result;
+    FMetaSoundBuilderNodeOutputHandle OutputHandle = Builder->FindNodeOutputByName(SourceHandle, FName(*SourcePin), Result);
+    if (Result != EMetaSoundBuilderResult::Succeeded)
+    {
+        OutError = FString::Printf(TEXT("Source pin '%s' not found on node %s"), *SourcePin, *SourceNode);
+        return false;
+    }
+
+    FMetaSoundBuilderNodeInputHandle InputHandle = Builder->FindNodeInputByName(TargetHandle, FName(*TargetPin), Result);
+    if (Result != EMetaSoundBuilderResult::Succeeded)
+    {
+        OutError = FString::Printf(TEXT("Target pin '%s' not found on node %s"), *TargetPin, *TargetNode);
+        return false;
+    }
+
+    BeginChange();
+
+    Builder->ConnectNodes(OutputHandle, InputHandle, Result);
+    if (Result != EMetaSoundBuilderResult::Succeeded)
+    {
+        OutError = FString::Printf(TEXT("Failed to connect '%s.%s' to '%s.%s'"), *SourceNode, *SourcePin, *TargetNode, *TargetPin);
+        return false;
+    }
+
+    bGraphChanged = true;
+    ModifiedNodes.Add(SourceHandle.NodeID);
+    ModifiedNodes.Add(TargetHandle.NodeID);
+    return true;
+}
+
+bool FMetaSoundEditSession::SetInput(const FString& Node, const FString& InputName, const TSharedPtr<FJsonValue>& Value, FString& OutError)
+{
+    if (!IsValid())
+    {
+        OutError = TEXT("MetaSound editing requires editor data");
+        return false;
+    }
+
+    // The builder subsystem provides the literal creation helpers
+    UMetaSoundBuilderSubsystem* BuilderSubsystem = UMetaSoundBuilderSubsystem::Get();
+    if (!BuilderSubsystem)
+    {
+        OutError = TEXT("MetaSound Builder Subsystem not available");
+        return false;
+    }
+    if (!Value.IsValid())
+    {
+        OutError = TEXT("Missing value");
+        return false;
+    }
+
+    FMetaSoundNodeHandle NodeHandle;
+    if (!ResolveNode(Node, NodeHandle.NodeID, OutError))
+    {
+        return false;
+    }
+
+    EMetaSoundBuilderResult Result;
+    FMetaSoundBuilderNodeInputHandle InputHandle = Builder->FindNodeInputByName(NodeHandle, FName(*InputName), Result);
+    if (Result != EMetaSoundBuilderResult::Succeeded)
+    {
+        OutError = FString::Printf(TEXT("Input '%s' not found on node %s"), *InputName, *Node);
+        return false;
+    }
+
+    FName DataType;
+    FMetasoundFrontendLiteral Literal;
+    if (Value->Type == EJson::Number)
+    {
+        Literal = BuilderSubsystem->CreateFloatMetaSoundLiteral(static_cast<float>(Value->AsNumber()), DataType);
+    }
+    else if (Value->Type == EJson::Boolean)
+    {
+        Literal = BuilderSubsystem->CreateBoolMetaSoundLiteral(Value->AsBool(), DataType);
+    }
+    else if (Value->Type == EJson::String)
+    {
+        Literal = BuilderSubsystem->CreateStringMetaSoundLiteral(Value->AsString(), DataType);
+    }
+    else
+    {
+        OutError = TEXT("Unsupported value type. Supported: number, boolean, string");
+        return false;
+    }
+
+    BeginChange();
+
+    Builder->SetNodeInputDefault(InputHandle, Literal, Result);
+    if (Result != EMetaSoundBuilderResult::Succeeded)
+    {
+        OutError = FString::Printf(TEXT("Failed to set input value for '%s' on node %s"), *InputName, *Node);
+        return false;
+    }
+
+    bInputsChanged = true;
+    return true;
+}
+
+void FMetaSoundEditSession::Commit()
+{
+    if (!HasChanges())
+    {
+        return;
+    }
+
+    // Input defaults live in the builder document until conformed to the object
+    if (bInputsChanged)
+    {
+        MetaSound->ConformObjectToDocument();
+    }
+
+    if (bGraphChanged)
+    {
+        // Flag every touched node so the editor graph synchronizes them, then rebuild it once
+        if (FMetasoundAssetBase* MetaSoundAsset = Metasound::IMetasoundUObjectRegistry::Get().GetObjectAsAssetBase(MetaSound))
+        {
+            for (const FGuid& NodeId : ModifiedNodes)
+            {
+                MetaSoundAsset->GetModifyContext().AddNodeIDModified(NodeId);
+            }
+        }
+        UMetaSoundEditorSubsystem::GetChecked().RegisterGraphWithFrontend(*MetaSound, true);
+    }
+
+    ModifiedNodes.Reset();
+    bGraphChanged = false;
+    bInputsChanged = false;
+}
+
+// ============================================================================
+// FSoundCueEditSession
+// ============================================================================
+
+namespace
+{
+    USoundNode* ConstructSoundCueNode(USoundCue& SoundCue, const FString& NodeType, USoundWave* SoundWave, FString& OutError)
+    {
+        const FString Type = NodeType.ToLower();
+        if (Type == TEXT("waveplayer") || Type == TEXT("wave_player"))
+        {
+            USoundNodeWavePlayer* WavePlayer = SoundCue.ConstructSoundNode<USoundNodeWavePlayer>();
+            if (WavePlayer && SoundWave)
+            {
+                WavePlayer->SetSoundWave(SoundWave);
+            }
+            return WavePlayer;
+        }
+        if (Type == TEXT("mixer"))
+        {
+            return SoundCue.ConstructSoundNode<USoundNodeMixer>();
+        }
+        if (Type == TEXT("random"))
+        {
+            return SoundCue.ConstructSoundNode<USoundNodeRandom>();
+        }
+        if (Type == TEXT("modulator"))
+        {
+            USoundNodeModulator* Modulator = SoundCue.ConstructSoundNode<USoundNodeModulator>();
+            if (Modulator)
+            {
+                // Set default ranges
+                Modulator->PitchMin = 1.0f;
+                Modulator->PitchMax = 1.0f;
+                Modulator->VolumeMin = 1.0f;
+                Modulator->VolumeMax = 1.0f;
+            }
+            return Modulator;
+        }
+        if (Type == TEXT("looping"))
+        {
+            USoundNodeLooping* Looping = SoundCue.ConstructSoundNode<USoundNodeLooping>();
+            if (Looping)
+            {
+                Looping->LoopCount = 1;
+                Looping->bLoopIndefinitely = false;
+            }
+            return Looping;
+        }
+        if (Type == TEXT("delay"))
+        {
+            return SoundCue.ConstructSoundNode<USoundNodeDelay>();
+        }
+        if (Type == TEXT("concatenator"))
+        {
+            return SoundCue.ConstructSoundNode<USoundNodeConcatenator>();
+        }
+        if (Type == TEXT("attenuation"))
+        {
+            return SoundCue.ConstructSoundNode<USoundNodeAttenuation>();
+        }
+
+        OutError = FString::Printf(TEXT("Unknown node type: %s. Valid types: WavePlayer, Mixer, Random, Modulator, Looping, Delay, Concatenator, Attenuation"), *NodeType);
+        return nullptr;
+    }
+}
+
+FSoundCueEditSession::FSoundCueEditSession(USoundCue* InSoundCue)
+    : SoundCue(InSoundCue)
+{
+#if WITH_EDITORONLY_DATA
+    if (SoundCue)
+    {
+        NodesByName.Reserve(SoundCue->AllNodes.Num());
+        for (USoundNode* Node : SoundCue->AllNodes)
+        {
+            if (Node)
+            {
+                NodesByName.Add(Node->GetName(), Node);
+            }
+        }
+    }
+#endif
+}
+
+void FSoundCueEditSession::BeginChange()
+{
+    if (!bModified)
+    {
+        SoundCue->Modify();
+        bModified = true;
+    }
+}
+
+USoundNode* FSoundCueEditSession::FindNode(const FString& NodeRef) const
+{
+    USoundNode* const* Found = NodesByName.Find(NodeRef);
+    return Found ? *Found : nullptr;
+}
+
+bool FSoundCueEditSession::AddNode(const FString& NodeType, USoundWave* SoundWave, const FString& Ref, FString& OutNodeId, FString& OutError)
+{
+    if (!IsValid())
+    {
+        OutError = TEXT("Sound Cue not found");
+        return false;
+    }
+    if (!Ref.IsEmpty() && NodesByName.Contains(Ref))
+    {
+        OutError = FString::Printf(TEXT("Ref '%s' is already used by a node in this Sound Cue"), *Ref);
+        return false;
+    }
+
+    BeginChange();
+
+    USoundNode* NewNode = ConstructSoundCueNode(*SoundCue, NodeType, SoundWave, OutError);
+    if (!NewNode)
+    {
+        if (OutError.IsEmpty())
+        {
+            OutError = FString::Printf(TEXT("Failed to create node of type: %s"), *NodeType);
+        }
+        return false;
+    }
+
+    OutNodeId = NewNode->GetName();
+    NodesByName.Add(OutNodeId, NewNode);
+    if (!Ref.IsEmpty())
+    {
+        NodesByName.Add(Ref, NewNode);
+    }
+    return true;
+}
+
+bool FSoundCueEditSession::Connect(const FString& SourceNode, const FString& TargetNode, int32 TargetPinIndex, FString& OutError)
+{
+#if WITH_EDITORONLY_DATA
+    if (!IsValid())
+    {
+        OutError = TEXT("Sound Cue not found");
+        return false;
+    }
+
+    USoundNode* Source = FindNode(SourceNode);
+    if (!Source)
+    {
+        OutError = FString::Printf(TEXT("Source node not found: %s"), *SourceNode);
+        return false;
+    }
+
+    // "Output" means the root of the cue
+    if (TargetNode.Equals(TEXT("Output"), ESearchCase::IgnoreCase))
+    {
+        BeginChange();
+        SoundCue->FirstNode = Source;
+        return true;
+    }
+
+    USoundNode* Target = FindNode(TargetNode);
+    if (!Target)
+    {
+        OutError = FString::Printf(TEXT("Target node not found: %s"), *TargetNode);
+        return false;
+    }
+
+    const int32 MaxChildren = Target->GetMaxChildNodes();
+    if (TargetPinIndex < 0 || TargetPinIndex >= MaxChildren)
+    {
+        OutError = FString::Printf(TEXT("Target pin index %d exceeds max children %d for node type %s"),
+            TargetPinIndex, MaxChildren, *Target->GetClass()->GetName());
+        return false;
+    }
+
+    BeginChange();
+
+    // InsertChildNode keeps InputPins.Num() == ChildNodes.Num() for the graph pins
+    while (Target->ChildNodes.Num() <= TargetPinIndex)
+    {
+        Target->InsertChildNode(Target->ChildNodes.Num());
+    }
+    Target->ChildNodes[TargetPinIndex] = Source;
+    return true;
+#else
+    OutError = TEXT("Sound Cue node connection requires editor data");
+    return false;
+#endif
+}
+
+void FSoundCueEditSession::Commit()
+{
+    if (!bModified)
+    {
+        return;
+    }
+
+#if WITH_EDITOR
+    SoundCue->LinkGraphNodesFromSoundNodes();
+#endif
+    bModified = false;
+}
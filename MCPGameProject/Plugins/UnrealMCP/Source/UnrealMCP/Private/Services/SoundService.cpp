@@ -18,9 +18,54 @@
 #include "Misc/Paths.h"
 #include "HAL/FileManager.h"
 #include "AudioDeviceManager.h"
+#include "Async/ParallelFor.h"
 
 DEFINE_LOG_CATEGORY(LogSoundService);
 
+namespace
+{
+    /** Decoded waves held at once before their kernels run; bounds memory on large batches */
+    constexpr int32 MaxPendingAnalyses = 16;
+
+    void WriteAnalysis(const FAudioAnalysisResult& Analysis, const FIoHash& SourceHash, bool bCached, FJsonObject& Out)
+    {
+        const double SampleRate = FMath::Max(Analysis.SampleRate, 1);
+        const double Duration = Analysis.NumFrames / SampleRate;
+
+        Out.SetBoolField(TEXT("success"), true);
+        Out.SetNumberField(TEXT("sample_rate"), Analysis.SampleRate);
+        Out.SetNumberField(TEXT("num_channels"), Analysis.NumChannels);
+        Out.SetNumberField(TEXT("num_frames"), Analysis.NumFrames);
+        Out.SetNumberField(TEXT("duration"), Duration);
+        Out.SetNumberField(TEXT("peak_dbfs"), FAudioAnalysisUtils::ToDecibels(Analysis.Peak));
+        Out.SetNumberField(TEXT("rms_dbfs"), FAudioAnalysisUtils::ToDecibels(Analysis.Rms));
+        if (Analysis.bHasLoudness)
+        {
+            Out.SetNumberField(TEXT("integrated_loudness_lufs"), Analysis.IntegratedLoudness);
+        }
+        Out.SetNumberField(TEXT("clipped_samples"), Analysis.ClippedSamples);
+        Out.SetNumberField(TEXT("trim_start_seconds"), Analysis.TrimStartFrame / SampleRate);
+        Out.SetNumberField(TEXT("trim_end_seconds"), Analysis.TrimEndFrame / SampleRate);
+        Out.SetNumberField(TEXT("leading_silence_seconds"), Analysis.TrimStartFrame / SampleRate);
+        Out.SetNumberField(TEXT("trailing_silence_seconds"), (Analysis.NumFrames - Analysis.TrimEndFrame) / SampleRate);
+
+        TArray<TSharedPtr<FJsonValue>> ChannelsArray;
+        for (const FAudioChannelStats& Channel : Analysis.Channels)
+        {
+            TSharedPtr<FJsonObject> ChannelObj = MakeShared<FJsonObject>();
+            ChannelObj->SetNumberField(TEXT("peak_dbfs"), FAudioAnalysisUtils::ToDecibels(Channel.Peak));
+            ChannelObj->SetNumberField(TEXT("rms_dbfs"), FAudioAnalysisUtils::ToDecibels(Channel.Rms));
+            ChannelObj->SetNumberField(TEXT("dc_offset"), Channel.DcOffset);
+            ChannelObj->SetNumberField(TEXT("clipped_samples"), Channel.ClippedSamples);
+            ChannelsArray.Add(MakeShared<FJsonValueObject>(ChannelObj));
+        }
+        Out.SetArrayField(TEXT("channels"), ChannelsArray);
+
+        Out.SetStringField(TEXT("source_hash"), LexToString(SourceHash));
+        Out.SetBoolField(TEXT("cached"), bCached);
+    }
+}
+
 // Singleton instance
 TUniquePtr<FSoundService> FSoundService::Instance;
 
@@ -151,6 +196,108 @@ bool FSoundService::GetSoundWaveMetadata(const FString& SoundWavePath, TSharedPt
     return true;
 }
 
+bool FSoundService::AnalyzeSoundWaves(const TArray<FString>& SoundWavePaths, TArray<TSharedPtr<FJsonObject>>& OutResults, FString& OutError)
+{
+    if (SoundWavePaths.Num() == 0)
+    {
+        OutError = TEXT("No sound waves to analyze");
+        return false;
+    }
+
+#if WITH_EDITORONLY_DATA
+    struct FPendingAnalysis
+    {
+        int32 ResultIndex = INDEX_NONE;
+        FIoHash SourceHash;
+        int32 SampleRate = 0;
+        TArray<TArray<float>> Channels;
+        FAudioAnalysisResult Analysis;
+    };
+
+    const double StartSeconds = FPlatformTime::Seconds();
+    const FAudioAnalysisSettings Settings;
+    TArray<FPendingAnalysis> Pending;
+    int32 NumCached = 0;
+    int32 NumAnalyzed = 0;
+
+    // Decoding reads editor bulk data on the game thread; the kernels then run across waves on workers
+    auto FlushPending = [this, &Pending, &Settings, &OutResults, &NumAnalyzed]()
+    {
+        ParallelFor(Pending.Num(), [&Pending, &Settings](int32 Index)
+        {
+            FPendingAnalysis& Item = Pending[Index];
+            Item.Analysis = FAudioAnalysisUtils::Analyze(Item.Channels, Item.SampleRate, Settings);
+        });
+        for (const FPendingAnalysis& Item : Pending)
+        {
+            AnalysisCache.Add(Item.SourceHash, Item.Analysis);
+            WriteAnalysis(Item.Analysis, Item.SourceHash, false, *OutResults[Item.ResultIndex]);
+        }
+        NumAnalyzed += Pending.Num();
+        Pending.Reset();
+    };
+
+    OutResults.Reset(SoundWavePaths.Num());
+    for (const FString& SoundWavePath : SoundWavePaths)
+    {
+        TSharedPtr<FJsonObject>& ResultObj = OutResults.Add_GetRef(MakeShared<FJsonObject>());
+        ResultObj->SetStringField(TEXT("path"), SoundWavePath);
+        ResultObj->SetBoolField(TEXT("success"), false);
+
+        USoundWave* SoundWave = FindSoundWave(SoundWavePath);
+        if (!SoundWave)
+        {
+            ResultObj->SetStringField(TEXT("error"), FString::Printf(TEXT("Sound wave not found: %s"), *SoundWavePath));
+            continue;
+        }
+
+        const FIoHash SourceHash = SoundWave->RawData.GetPayloadId();
+        if (SourceHash.IsZero())
+        {
+            ResultObj->SetStringField(TEXT("error"), TEXT("Sound wave has no imported source data"));
+            continue;
+        }
+
+        if (const FAudioAnalysisResult* Cached = AnalysisCache.Find(SourceHash))
+        {
+            WriteAnalysis(*Cached, SourceHash, true, *ResultObj);
+            ++NumCached;
+            continue;
+        }
+
+        TArray<uint8> PcmData;
+        uint32 SampleRate = 0;
+        uint16 NumChannels = 0;
+        if (!SoundWave->GetImportedSoundWaveData(PcmData, SampleRate, NumChannels) || NumChannels == 0)
+        {
+            ResultObj->SetStringField(TEXT("error"), TEXT("Failed to decode the imported PCM data"));
+            continue;
+        }
+
+        FPendingAnalysis& Item = Pending.AddDefaulted_GetRef();
+        Item.ResultIndex = OutResults.Num() - 1;
+        Item.SourceHash = SourceHash;
+        Item.SampleRate = static_cast<int32>(SampleRate);
+        FAudioAnalysisUtils::DeinterleavePcm16(
+            TConstArrayView<int16>(reinterpret_cast<const int16*>(PcmData.GetData()), PcmData.Num() / sizeof(int16)),
+            NumChannels, Item.Channels);
+
+        if (Pending.Num() >= MaxPendingAnalyses)
+        {
+            FlushPending();
+        }
+    }
+    FlushPending();
+
+    UE_LOG(LogSoundService, Log, TEXT("Analyzed %d sound waves (%d decoded, %d from cache) in %.1f ms"),
+        SoundWavePaths.Num(), NumAnalyzed, NumCached, (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+    return true;
+#else
+    OutError = TEXT("Sound wave analysis requires editor data");
+    return false;
+#endif
+}
+
 bool FSoundService::SetSoundWaveProperties(const FString& SoundWavePath, bool bLooping, float Volume, float Pitch, const FString& SoundClassPath, FString& OutError)
 {
     USoundWave* SoundWave = FindSoundWave(SoundWavePath);
@@ -0,0 +1,150 @@
+#include "Services/StateTreeEditSession.h"
+#include "StateTree.h"
+#include "StateTreeEditorData.h"
+#include "StateTreeState.h"
+#include "UObject/UObjectGlobals.h"
+
+FStateTreeEditSession::FStateTreeEditSession(UStateTree* InStateTree)
+    : StateTree(InStateTree)
+{
+    if (!StateTree)
+    {
+        return;
+    }
+
+    EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
+    if (!EditorData)
+    {
+        return;
+    }
+
+    for (UStateTreeState* RootState : EditorData->SubTrees)
+    {
+        IndexState(RootState);
+    }
+}
+
+void FStateTreeEditSession::IndexState(UStateTreeState* State)
+{
+    if (!State)
+    {
+        return;
+    }
+
+    // Keep the first match so lookups agree with the recursive search used elsewhere
+    const FString StateName = State->Name.ToString();
+    if (!StatesByName.Contains(StateName))
+    {
+        StatesByName.Add(StateName, State);
+    }
+
+    for (UStateTreeState* Child : State->Children)
+    {
+        IndexState(Child);
+    }
+}
+
+UStateTreeState* FStateTreeEditSession::FindState(const FString& StateName) const
+{
+    UStateTreeState* const* Found = StatesByName.Find(StateName);
+    return Found ? *Found : nullptr;
+}
+
+void FStateTreeEditSession::MarkModified()
+{
+    if (!bModified && IsValid())
+    {
+        StateTree->Modify();
+        EditorData->Modify();
+    }
+    bModified = true;
+}
+
+UStateTreeState* FStateTreeEditSession::AddState(const FString& StateName, const FString& ParentStateName, FString& OutError)
+{
+    if (!IsValid())
+    {
+        OutError = TEXT("StateTree has no editor data");
+        return nullptr;
+    }
+
+    if (StateName.IsEmpty())
+    {
+        OutError = TEXT("State name is required");
+        return nullptr;
+    }
+
+    if (FindState(StateName))
+    {
+        OutError = FString::Printf(TEXT("State already exists: '%s'"), *StateName);
+        return nullptr;
+    }
+
+    UStateTreeState* ParentState = nullptr;
+    if (!ParentStateName.IsEmpty())
+    {
+        ParentState = FindState(ParentStateName);
+        if (!ParentState)
+        {
+            OutError = FString::Printf(TEXT("Parent state not found: '%s'"), *ParentStateName);
+            return nullptr;
+        }
+    }
+
+    MarkModified();
+
+    // The object name only has to be unique under the editor data; the state's Name is what users see
+    const FName ObjectName = MakeUniqueObjectName(EditorData, UStateTreeState::StaticClass(), FName(*StateName));
+    UStateTreeState* NewState = NewObject<UStateTreeState>(EditorData, ObjectName, RF_Transactional);
+    if (!NewState)
+    {
+        OutError = TEXT("Failed to create state object");
+        return nullptr;
+    }
+
+    NewState->Name = FName(*StateName);
+    if (ParentState)
+    {
+        ParentState->Modify();
+        ParentState->Children.Add(NewState);
+        NewState->Parent = ParentState;
+    }
+    else
+    {
+        EditorData->SubTrees.Add(NewState);
+    }
+
+    StatesByName.Add(StateName, NewState);
+    return NewState;
+}
+
+bool FStateTreeEditSession::AddTransition(const FString& SourceStateName, const FString& TargetStateName, const FStateTreeTransition& Transition, FString& OutError)
+{
+    UStateTreeState* SourceState = FindState(SourceStateName);
+    if (!SourceState)
+    {
+        OutError = FString::Printf(TEXT("Source state not found: '%s'"), *SourceStateName);
+        return false;
+    }
+
+    FStateTreeTransition NewTransition = Transition;
+    if (!TargetStateName.IsEmpty())
+    {
+        UStateTreeState* TargetState = FindState(TargetStateName);
+        if (!TargetState)
+        {
+            OutError = FString::Printf(TEXT("Target state not found: '%s'"), *TargetStateName);
+            return false;
+        }
+
+        // LinkType MUST be GotoState for the transition to link to the target
+        NewTransition.State.ID = TargetState->ID;
+        NewTransition.State.LinkType = EStateTreeTransitionType::GotoState;
+        NewTransition.State.Name = TargetState->Name;
+    }
+
+    MarkModified();
+    SourceState->Modify();
+    SourceState->Transitions.Add(NewTransition);
+    return true;
+}
@@ -1,4 +1,5 @@
 #include "Services/StateTreeService.h"
+#include "Services/StateTreeEditSession.h"
 #include "Services/PropertyService.h"
 #include "StateTree.h"
 #include "StateTreeEditorData.h"
@@ -17,6 +18,7 @@
 #include "IAssetTools.h"
 #include "Factories/Factory.h"
 #include "UObject/SavePackage.h"
+#include "Serialization/ArchiveObjectCrc32.h"
 #include "UObject/UObjectGlobals.h"
 #include "Misc/PackageName.h"
 #include "Dom/JsonObject.h"
@@ -24,6 +26,8 @@
 #include "GameplayTagContainer.h"
 #include "Engine/Blueprint.h"
 #include "Modules/ModuleManager.h"
+#include "Services/ReflectionCatalog.h"
+#include "Services/StateTreeTypeCatalog.h"
 
 // Helper function to find UScriptStruct by path, handling both native (/Script/) and asset paths
 static UScriptStruct* FindScriptStructByPath(const FString& StructPath)
@@ -50,14 +54,32 @@ static UScriptStruct* FindScriptStructByPath(const FString& StructPath)
         // Extract struct name
         FString StructName = FPackageName::ObjectPathToObjectName(StructPath);
 
-        // Method 1: Quick check with FindFirstObject
+        // The catalogs match names case-insensitively; a path names one exact struct
+        auto IsExactName = [&StructName](const UScriptStruct* Struct)
+        {
+            return Struct && Struct->GetName().Equals(StructName, ESearchCase::CaseSensitive);
+        };
+
+        // Method 1: Known StateTree node type (indexed by full path, then by name)
+        FStateTreeTypeCatalog& TypeCatalog = FStateTreeTypeCatalog::Get();
+        if (UScriptStruct* NodeStruct = TypeCatalog.FindType(StructPath))
+        {
+            return NodeStruct;
+        }
+        UScriptStruct* NodeStruct = TypeCatalog.FindType(StructName);
+        if (IsExactName(NodeStruct))
+        {
+            return NodeStruct;
+        }
+
+        // Method 2: Quick check with FindFirstObject
         UScriptStruct* QuickFind = FindFirstObject<UScriptStruct>(*StructName, EFindFirstObjectOptions::NativeFirst);
         if (QuickFind)
         {
             return QuickFind;
         }
 
-        // Method 2: Find the package first, then find the struct within it
+        // Method 3: Find the package first, then find the struct within it
         UPackage* Package = FindPackage(nullptr, *PackagePath);
         if (Package)
         {
@@ -68,49 +90,44 @@ static UScriptStruct* FindScriptStructByPath(const FString& StructPath)
             }
         }
 
-        // Method 3: Try with StaticFindObject using the full path
+        // Method 4: Try with StaticFindObject using the full path
         UScriptStruct* FoundStruct = Cast<UScriptStruct>(StaticFindObject(UScriptStruct::StaticClass(), nullptr, *StructPath));
         if (FoundStruct)
         {
             return FoundStruct;
         }
 
-        // Method 4: Try finding via StateTree's base struct hierarchy
-        UScriptStruct* StateTreeEvaluatorBase = FindFirstObject<UScriptStruct>(TEXT("FStateTreeEvaluatorBase"), EFindFirstObjectOptions::NativeFirst);
-        UScriptStruct* StateTreeTaskBase = FindFirstObject<UScriptStruct>(TEXT("FStateTreeTaskBase"), EFindFirstObjectOptions::NativeFirst);
-        UScriptStruct* StateTreeConditionBase = FindFirstObject<UScriptStruct>(TEXT("FStateTreeConditionBase"), EFindFirstObjectOptions::NativeFirst);
-
-        for (TObjectIterator<UScriptStruct> It; It; ++It)
-        {
-            UScriptStruct* TestStruct = *It;
-            if (TestStruct->GetName() == StructName)
-            {
-                // Check if this is a StateTree-related struct
-                if ((StateTreeEvaluatorBase && TestStruct->IsChildOf(StateTreeEvaluatorBase)) ||
-                    (StateTreeTaskBase && TestStruct->IsChildOf(StateTreeTaskBase)) ||
-                    (StateTreeConditionBase && TestStruct->IsChildOf(StateTreeConditionBase)))
-                {
-                    return TestStruct;
-                }
-            }
-        }
-
-        // Method 5: Final fallback - iterate over all UScriptStructs to find a match by name
-        for (TObjectIterator<UScriptStruct> It; It; ++It)
-        {
-            if (It->GetName() == StructName)
-            {
-                return *It;
-            }
-        }
+        // Method 5: Final fallback - any loaded UScriptStruct with a matching name
+        UScriptStruct* NamedStruct = FReflectionCatalog::Get().FindStructByName(StructName);
+        return IsExactName(NamedStruct) ? NamedStruct : nullptr;
+    }
 
-        return nullptr;
+    // Bare names ("StateTreeDelayTask", "FStateTreeDelayTask") resolve through the node type catalog
+    if (!StructPath.Contains(TEXT("/")))
+    {
+        return FStateTreeTypeCatalog::Get().FindType(StructPath);
     }
 
     // For asset-based structs (Blueprint structs, etc.), use LoadObject
     return LoadObject<UScriptStruct>(nullptr, *StructPath);
 }
 
+// CRC of the editor data and every object it owns (states, nodes), ignoring transient properties
+class FStateTreeEditorDataCrc32 : public FArchiveObjectCrc32
+{
+public:
+    virtual bool ShouldSkipProperty(const FProperty* InProperty) const override
+    {
+        return InProperty->HasAnyPropertyFlags(CPF_Transient) || FArchiveObjectCrc32::ShouldSkipProperty(InProperty);
+    }
+};
+
+static uint32 CalculateEditorDataHash(UStateTreeEditorData* EditorData)
+{
+    FStateTreeEditorDataCrc32 Archive;
+    return Archive.Crc32(EditorData, 0);
+}
+
 // Param struct validation implementations
 bool FStateTreeCreationParams::IsValid(FString& OutError) const
 {
@@ -801,19 +818,11 @@ UStateTree* FStateTreeService::CreateStateTree(const FStateTreeCreationParams& P
     // Last resort: iterate through all loaded UStateTreeSchema subclasses and find by name
     if (!SchemaClass)
     {
-        for (TObjectIterator<UClass> It; It; ++It)
+        FReflectionCatalog& Catalog = FReflectionCatalog::Get();
+        SchemaClass = Catalog.FindClassByName(SchemaClassName, UStateTreeSchema::StaticClass(), CLASS_Abstract);
+        if (!SchemaClass)
         {
-            UClass* Class = *It;
-            if (Class && Class->IsChildOf(UStateTreeSchema::StaticClass()) && !Class->HasAnyClassFlags(CLASS_Abstract))
-            {
-                FString ClassName = Class->GetName();
-                if (ClassName.Equals(SchemaClassName, ESearchCase::IgnoreCase) ||
-                    ClassName.Equals(TargetNameWithU, ESearchCase::IgnoreCase))
-                {
-                    SchemaClass = Class;
-                    break;
-                }
-            }
+            SchemaClass = Catalog.FindClassByName(TargetNameWithU, UStateTreeSchema::StaticClass(), CLASS_Abstract);
         }
     }
 
@@ -890,6 +899,12 @@ UStateTree* FStateTreeService::FindStateTree(const FString& PathOrName)
 }
 
 bool FStateTreeService::CompileStateTree(UStateTree* StateTree, FString& OutError)
+{
+    FStateTreeCompileStats Stats;
+    return CompileStateTree(StateTree, false, Stats, OutError);
+}
+
+bool FStateTreeService::CompileStateTree(UStateTree* StateTree, bool bForce, FStateTreeCompileStats& OutStats, FString& OutError)
 {
     if (!StateTree)
     {
@@ -897,8 +912,6 @@ bool FStateTreeService::CompileStateTree(UStateTree* StateTree, FString& OutErro
         return false;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::CompileStateTree: Compiling StateTree '%s'"), *StateTree->GetName());
-
     UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
     if (!EditorData)
     {
@@ -906,6 +919,19 @@ bool FStateTreeService::CompileStateTree(UStateTree* StateTree, FString& OutErro
         return false;
     }
 
+    // Nothing changed since the last successful compile (which also saved): skip compile and save
+    OutStats.EditorDataHash = CalculateEditorDataHash(EditorData);
+    const uint32* LastHash = LastCompiledHashes.Find(StateTree);
+    if (!bForce && LastHash && *LastHash == OutStats.EditorDataHash && StateTree->IsReadyToRun())
+    {
+        OutStats.bSkipped = true;
+        UE_LOG(LogTemp, Log, TEXT("FStateTreeService::CompileStateTree: '%s' is up to date, skipping compile"), *StateTree->GetName());
+        return true;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::CompileStateTree: Compiling StateTree '%s'"), *StateTree->GetName());
+    const double StartTime = FPlatformTime::Seconds();
+
     // Check for basic validity first
     if (EditorData->SubTrees.Num() == 0)
     {
@@ -952,17 +978,29 @@ bool FStateTreeService::CompileStateTree(UStateTree* StateTree, FString& OutErro
 
         UE_LOG(LogTemp, Error, TEXT("FStateTreeService::CompileStateTree: Compilation failed for '%s': %s"),
             *StateTree->GetName(), *OutError);
+        LastCompiledHashes.Remove(StateTree);
+        OutStats.CompileMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
         return false;
     }
 
-    // Save after successful compilation
+    // The compiler may fix up editor data (IDs, bindings), so hash what it left behind
+    OutStats.EditorDataHash = CalculateEditorDataHash(EditorData);
+
+    // Save after successful compilation; only a saved tree may take the skip path next time
     FString SaveError;
-    if (!SaveAsset(StateTree, SaveError))
+    if (SaveAsset(StateTree, SaveError))
+    {
+        LastCompiledHashes.Add(StateTree, OutStats.EditorDataHash);
+    }
+    else
     {
         UE_LOG(LogTemp, Warning, TEXT("FStateTreeService::CompileStateTree: Failed to save after compilation: %s"), *SaveError);
+        LastCompiledHashes.Remove(StateTree);
     }
+    OutStats.CompileMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
 
-    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::CompileStateTree: Successfully compiled StateTree '%s'"), *StateTree->GetName());
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::CompileStateTree: Successfully compiled StateTree '%s' in %.1f ms"),
+        *StateTree->GetName(), OutStats.CompileMs);
     return true;
 }
 
@@ -1004,8 +1042,8 @@ bool FStateTreeService::AddState(const FAddStateParams& Params, FString& OutErro
         return false;
     }
 
-    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
-    if (!EditorData)
+    FStateTreeEditSession Session(StateTree);
+    if (!Session.IsValid())
     {
         OutError = TEXT("StateTree has no editor data");
         return false;
@@ -1014,27 +1052,27 @@ bool FStateTreeService::AddState(const FAddStateParams& Params, FString& OutErro
     UE_LOG(LogTemp, Log, TEXT("FStateTreeService::AddState: Adding state '%s' to '%s'"),
         *Params.StateName, *StateTree->GetName());
 
-    // Find parent state if specified
-    UStateTreeState* ParentState = nullptr;
-    if (!Params.ParentStateName.IsEmpty())
+    if (!ApplyAddState(Session, Params, OutError))
     {
-        ParentState = FindStateByName(EditorData, Params.ParentStateName);
-        if (!ParentState)
-        {
-            OutError = FString::Printf(TEXT("Parent state not found: '%s'"), *Params.ParentStateName);
-            return false;
-        }
+        return false;
     }
 
-    // Create the new state
-    UStateTreeState* NewState = NewObject<UStateTreeState>(EditorData, FName(*Params.StateName), RF_Transactional);
+    // Mark dirty and save
+    StateTree->Modify();
+    SaveAsset(StateTree, OutError);
+
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::AddState: Successfully added state '%s'"), *Params.StateName);
+    return true;
+}
+
+bool FStateTreeService::ApplyAddState(FStateTreeEditSession& Session, const FAddStateParams& Params, FString& OutError)
+{
+    UStateTreeState* NewState = Session.AddState(Params.StateName, Params.ParentStateName, OutError);
     if (!NewState)
     {
-        OutError = TEXT("Failed to create state object");
         return false;
     }
 
-    NewState->Name = FName(*Params.StateName);
     NewState->bEnabled = Params.bEnabled;
 
     // Set state type
@@ -1042,23 +1080,6 @@ bool FStateTreeService::AddState(const FAddStateParams& Params, FString& OutErro
 
     // Set selection behavior
     NewState->SelectionBehavior = static_cast<EStateTreeStateSelectionBehavior>(ParseSelectionBehavior(Params.SelectionBehavior));
-
-    // Add to parent or root
-    if (ParentState)
-    {
-        ParentState->Children.Add(NewState);
-        NewState->Parent = ParentState;
-    }
-    else
-    {
-        EditorData->SubTrees.Add(NewState);
-    }
-
-    // Mark dirty and save
-    StateTree->Modify();
-    SaveAsset(StateTree, OutError);
-
-    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::AddState: Successfully added state '%s'"), *Params.StateName);
     return true;
 }
 
@@ -1169,49 +1190,36 @@ bool FStateTreeService::AddTransition(const FAddTransitionParams& Params, FStrin
         return false;
     }
 
-    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
-    if (!EditorData)
+    FStateTreeEditSession Session(StateTree);
+    if (!Session.IsValid())
     {
         OutError = TEXT("StateTree has no editor data");
         return false;
     }
 
-    UStateTreeState* SourceState = FindStateByName(EditorData, Params.SourceStateName);
-    if (!SourceState)
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::AddTransition: Adding transition from '%s' in '%s'"),
+        *Params.SourceStateName, *StateTree->GetName());
+
+    if (!ApplyAddTransition(Session, Params, OutError))
     {
-        OutError = FString::Printf(TEXT("Source state not found: '%s'"), *Params.SourceStateName);
         return false;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::AddTransition: Adding transition from '%s' in '%s'"),
-        *Params.SourceStateName, *StateTree->GetName());
+    StateTree->Modify();
+    SaveAsset(StateTree, OutError);
+
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::AddTransition: Successfully added transition"));
+    return true;
+}
 
+bool FStateTreeService::ApplyAddTransition(FStateTreeEditSession& Session, const FAddTransitionParams& Params, FString& OutError)
+{
     // Create the transition
     FStateTreeTransition NewTransition;
 
     // Set trigger type
     NewTransition.Trigger = static_cast<EStateTreeTransitionTrigger>(ParseTransitionTrigger(Params.Trigger));
 
-    // Set target state if TargetStateName is provided
-    // The target state should be set regardless of TransitionType - if a target is specified, link to it
-    if (!Params.TargetStateName.IsEmpty())
-    {
-        UStateTreeState* TargetState = FindStateByName(EditorData, Params.TargetStateName);
-        if (!TargetState)
-        {
-            OutError = FString::Printf(TEXT("Target state not found: '%s'"), *Params.TargetStateName);
-            return false;
-        }
-        // FStateTreeStateLink holds the target state ID, LinkType, and Name
-        // LinkType MUST be set to GotoState for the transition to properly link to the target
-        NewTransition.State.ID = TargetState->ID;
-        NewTransition.State.LinkType = EStateTreeTransitionType::GotoState;
-        NewTransition.State.Name = FName(*Params.TargetStateName);
-
-        UE_LOG(LogTemp, Log, TEXT("FStateTreeService::AddTransition: Set target state '%s' (ID: %s, LinkType: GotoState)"),
-            *Params.TargetStateName, *TargetState->ID.ToString());
-    }
-
     // Set required event tag if OnEvent trigger
     if (Params.Trigger == TEXT("OnEvent") && !Params.EventTag.IsEmpty())
     {
@@ -1226,14 +1234,8 @@ bool FStateTreeService::AddTransition(const FAddTransitionParams& Params, FStrin
     // Set priority
     NewTransition.Priority = static_cast<EStateTreeTransitionPriority>(ParsePriority(Params.Priority));
 
-    // Add the transition to the source state
-    SourceState->Transitions.Add(NewTransition);
-
-    StateTree->Modify();
-    SaveAsset(StateTree, OutError);
-
-    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::AddTransition: Successfully added transition"));
-    return true;
+    // The target state is linked regardless of TransitionType - if a target is specified, link to it
+    return Session.AddTransition(Params.SourceStateName, Params.TargetStateName, NewTransition, OutError);
 }
 
 bool FStateTreeService::RemoveTransition(const FRemoveTransitionParams& Params, FString& OutError)
@@ -1735,48 +1737,21 @@ bool FStateTreeService::GetStateTreeDiagnostics(UStateTree* StateTree, TSharedPt
 bool FStateTreeService::GetAvailableTaskTypes(TArray<TPair<FString, FString>>& OutTasks)
 {
     // Find all task structs derived from FStateTreeTaskBase
-    for (TObjectIterator<UScriptStruct> It; It; ++It)
-    {
-        UScriptStruct* Struct = *It;
-        if (Struct && Struct->IsChildOf(FStateTreeTaskBase::StaticStruct()) && Struct != FStateTreeTaskBase::StaticStruct())
-        {
-            FString StructPath = Struct->GetPathName();
-            FString StructName = Struct->GetName();
-            OutTasks.Add(TPair<FString, FString>(StructPath, StructName));
-        }
-    }
+    OutTasks.Append(FStateTreeTypeCatalog::Get().GetTypes(EStateTreeNodeKind::Task));
     return true;
 }
 
 bool FStateTreeService::GetAvailableConditionTypes(TArray<TPair<FString, FString>>& OutConditions)
 {
     // Find all condition structs derived from FStateTreeConditionBase
-    for (TObjectIterator<UScriptStruct> It; It; ++It)
-    {
-        UScriptStruct* Struct = *It;
-        if (Struct && Struct->IsChildOf(FStateTreeConditionBase::StaticStruct()) && Struct != FStateTreeConditionBase::StaticStruct())
-        {
-            FString StructPath = Struct->GetPathName();
-            FString StructName = Struct->GetName();
-            OutConditions.Add(TPair<FString, FString>(StructPath, StructName));
-        }
-    }
+    OutConditions.Append(FStateTreeTypeCatalog::Get().GetTypes(EStateTreeNodeKind::Condition));
     return true;
 }
 
 bool FStateTreeService::GetAvailableEvaluatorTypes(TArray<TPair<FString, FString>>& OutEvaluators)
 {
     // Find all evaluator structs derived from FStateTreeEvaluatorBase
-    for (TObjectIterator<UScriptStruct> It; It; ++It)
-    {
-        UScriptStruct* Struct = *It;
-        if (Struct && Struct->IsChildOf(FStateTreeEvaluatorBase::StaticStruct()) && Struct != FStateTreeEvaluatorBase::StaticStruct())
-        {
-            FString StructPath = Struct->GetPathName();
-            FString StructName = Struct->GetName();
-            OutEvaluators.Add(TPair<FString, FString>(StructPath, StructName));
-        }
-    }
+    OutEvaluators.Append(FStateTreeTypeCatalog::Get().GetTypes(EStateTreeNodeKind::Evaluator));
     return true;
 }
 
@@ -3537,7 +3512,7 @@ bool FStateTreeService::SetStateSelectionWeight(const FSetStateSelectionWeightPa
 // Section 15: Batch Operations Implementation
 // ============================================================================
 
-bool FStateTreeService::BatchAddStates(const FBatchAddStatesParams& Params, FString& OutError)
+bool FStateTreeService::BatchAddStates(const FBatchAddStatesParams& Params, FStateTreeBatchResult& OutResult, FString& OutError)
 {
     UStateTree* StateTree = FindStateTree(Params.StateTreePath);
     if (!StateTree)
@@ -3546,48 +3521,78 @@ bool FStateTreeService::BatchAddStates(const FBatchAddStatesParams& Params, FStr
         return false;
     }
 
-    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
-    if (!EditorData)
+    // One session for the whole batch: the asset is resolved and indexed once and saved once
+    FStateTreeEditSession Session(StateTree);
+    if (!Session.IsValid())
     {
         OutError = TEXT("StateTree has no editor data");
         return false;
     }
 
-    int32 AddedCount = 0;
-    for (const FBatchStateDefinition& StateDef : Params.States)
+    // Apply in passes so a parent defined later in the batch still resolves; a pass that adds
+    // nothing leaves only items whose parent is missing, which then fail with that error
+    TArray<int32> Pending;
+    Pending.Reserve(Params.States.Num());
+    for (int32 Index = 0; Index < Params.States.Num(); ++Index)
     {
-        FAddStateParams AddParams;
-        AddParams.StateTreePath = Params.StateTreePath;
-        AddParams.StateName = StateDef.StateName;
-        AddParams.ParentStateName = StateDef.ParentStateName;
-        AddParams.StateType = StateDef.StateType;
-        AddParams.SelectionBehavior = StateDef.SelectionBehavior;
-        AddParams.bEnabled = StateDef.bEnabled;
+        Pending.Add(Index);
+    }
 
-        FString LocalError;
-        if (AddState(AddParams, LocalError))
-        {
-            AddedCount++;
-        }
-        else
+    bool bFinalPass = false;
+    while (Pending.Num() > 0)
+    {
+        TArray<int32> Deferred;
+        for (const int32 Index : Pending)
         {
-            UE_LOG(LogTemp, Warning, TEXT("FStateTreeService::BatchAddStates: Failed to add state '%s': %s"),
-                *StateDef.StateName, *LocalError);
+            const FBatchStateDefinition& StateDef = Params.States[Index];
+            if (!bFinalPass && !StateDef.ParentStateName.IsEmpty() && !Session.FindState(StateDef.ParentStateName))
+            {
+                Deferred.Add(Index);
+                continue;
+            }
+
+            FAddStateParams AddParams;
+            AddParams.StateTreePath = Params.StateTreePath;
+            AddParams.StateName = StateDef.StateName;
+            AddParams.ParentStateName = StateDef.ParentStateName;
+            AddParams.StateType = StateDef.StateType;
+            AddParams.SelectionBehavior = StateDef.SelectionBehavior;
+            AddParams.bEnabled = StateDef.bEnabled;
+
+            FString LocalError;
+            if (ApplyAddState(Session, AddParams, LocalError))
+            {
+                OutResult.NumApplied++;
+            }
+            else
+            {
+                UE_LOG(LogTemp, Warning, TEXT("FStateTreeService::BatchAddStates: Failed to add state '%s': %s"),
+                    *StateDef.StateName, *LocalError);
+                OutResult.ItemErrors.Add({ Index, LocalError });
+            }
         }
+
+        bFinalPass = Deferred.Num() == Pending.Num();
+        Pending = MoveTemp(Deferred);
     }
 
-    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::BatchAddStates: Added %d/%d states"), AddedCount, Params.States.Num());
+    OutResult.ItemErrors.Sort([](const FStateTreeBatchItemError& A, const FStateTreeBatchItemError& B)
+    {
+        return A.Index < B.Index;
+    });
+
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::BatchAddStates: Added %d/%d states"), OutResult.NumApplied, Params.States.Num());
 
-    if (AddedCount == 0)
+    if (OutResult.NumApplied == 0)
     {
         OutError = TEXT("Failed to add any states");
         return false;
     }
 
-    return true;
+    return CommitEditSession(Session, Params.bCompile, OutResult, OutError);
 }
 
-bool FStateTreeService::BatchAddTransitions(const FBatchAddTransitionsParams& Params, FString& OutError)
+bool FStateTreeService::BatchAddTransitions(const FBatchAddTransitionsParams& Params, FStateTreeBatchResult& OutResult, FString& OutError)
 {
     UStateTree* StateTree = FindStateTree(Params.StateTreePath);
     if (!StateTree)
@@ -3596,16 +3601,17 @@ bool FStateTreeService::BatchAddTransitions(const FBatchAddTransitionsParams& Pa
         return false;
     }
 
-    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
-    if (!EditorData)
+    FStateTreeEditSession Session(StateTree);
+    if (!Session.IsValid())
     {
         OutError = TEXT("StateTree has no editor data");
         return false;
     }
 
-    int32 AddedCount = 0;
-    for (const FBatchTransitionDefinition& TransDef : Params.Transitions)
+    for (int32 Index = 0; Index < Params.Transitions.Num(); ++Index)
     {
+        const FBatchTransitionDefinition& TransDef = Params.Transitions[Index];
+
         FAddTransitionParams AddParams;
         AddParams.StateTreePath = Params.StateTreePath;
         AddParams.SourceStateName = TransDef.SourceStateName;
@@ -3613,28 +3619,53 @@ bool FStateTreeService::BatchAddTransitions(const FBatchAddTransitionsParams& Pa
         AddParams.Trigger = TransDef.Trigger;
         AddParams.TransitionType = TransDef.TransitionType;
         AddParams.Priority = TransDef.Priority;
+        AddParams.EventTag = TransDef.EventTag;
 
         FString LocalError;
-        if (AddTransition(AddParams, LocalError))
+        if (ApplyAddTransition(Session, AddParams, LocalError))
         {
-            AddedCount++;
+            OutResult.NumApplied++;
         }
         else
         {
             UE_LOG(LogTemp, Warning, TEXT("FStateTreeService::BatchAddTransitions: Failed to add transition from '%s' to '%s': %s"),
                 *TransDef.SourceStateName, *TransDef.TargetStateName, *LocalError);
+            OutResult.ItemErrors.Add({ Index, LocalError });
         }
     }
 
-    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::BatchAddTransitions: Added %d/%d transitions"), AddedCount, Params.Transitions.Num());
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::BatchAddTransitions: Added %d/%d transitions"), OutResult.NumApplied, Params.Transitions.Num());
 
-    if (AddedCount == 0)
+    if (OutResult.NumApplied == 0)
     {
         OutError = TEXT("Failed to add any transitions");
         return false;
     }
 
-    return true;
+    return CommitEditSession(Session, Params.bCompile, OutResult, OutError);
+}
+
+bool FStateTreeService::CommitEditSession(FStateTreeEditSession& Session, bool bCompile, FStateTreeBatchResult& OutResult, FString& OutError)
+{
+    if (!Session.HasChanges())
+    {
+        return true;
+    }
+
+    if (bCompile)
+    {
+        // CompileStateTree saves on success
+        OutResult.bCompiled = CompileStateTree(Session.GetStateTree(), false, OutResult.CompileStats, OutResult.CompileError);
+        if (OutResult.bCompiled)
+        {
+            return true;
+        }
+
+        // A half-built tree often fails to compile; keep the edits and report the compiler error
+        UE_LOG(LogTemp, Warning, TEXT("FStateTreeService: Batch applied but compile failed: %s"), *OutResult.CompileError);
+    }
+
+    return SaveAsset(Session.GetStateTree(), OutError);
 }
 
 // ============================================================================
@@ -0,0 +1,114 @@
+#include "Services/StateTreeTypeCatalog.h"
+#include "Services/ReflectionCatalog.h"
+#include "StateTreeTaskBase.h"
+#include "StateTreeConditionBase.h"
+#include "StateTreeEvaluatorBase.h"
+#include "StateTreeConsiderationBase.h"
+
+FStateTreeTypeCatalog& FStateTreeTypeCatalog::Get()
+{
+    static FStateTreeTypeCatalog Instance;
+    return Instance;
+}
+
+const UScriptStruct* FStateTreeTypeCatalog::GetBaseStruct(EStateTreeNodeKind Kind)
+{
+    switch (Kind)
+    {
+    case EStateTreeNodeKind::Task: return FStateTreeTaskBase::StaticStruct();
+    case EStateTreeNodeKind::Condition: return FStateTreeConditionBase::StaticStruct();
+    case EStateTreeNodeKind::Evaluator: return FStateTreeEvaluatorBase::StaticStruct();
+    case EStateTreeNodeKind::Consideration: return FStateTreeConsiderationBase::StaticStruct();
+    default: return nullptr;
+    }
+}
+
+void FStateTreeTypeCatalog::EnsureCurrent()
+{
+    FReflectionCatalog& Catalog = FReflectionCatalog::Get();
+    const uint32 CatalogGeneration = Catalog.GetGeneration();
+    if (BuiltGeneration == CatalogGeneration)
+    {
+        return;
+    }
+
+    Entries.Reset();
+    EntriesByPath.Reset();
+    EntriesByName.Reset();
+
+    for (int32 KindIndex = 0; KindIndex < static_cast<int32>(EStateTreeNodeKind::Num); ++KindIndex)
+    {
+        const EStateTreeNodeKind Kind = static_cast<EStateTreeNodeKind>(KindIndex);
+        TArray<TPair<FString, FString>>& Types = TypesByKind[KindIndex];
+        Types.Reset();
+
+        for (UScriptStruct* Struct : Catalog.GetDerivedStructs(GetBaseStruct(Kind)))
+        {
+            const FString StructPath = Struct->GetPathName();
+            const FString StructName = Struct->GetName();
+            Types.Add(TPair<FString, FString>(StructPath, StructName));
+
+            const int32 EntryIndex = Entries.Add({ Struct, Kind });
+            EntriesByPath.Add(StructPath.ToLower(), EntryIndex);
+            if (!EntriesByName.Contains(StructName.ToLower()))
+            {
+                EntriesByName.Add(StructName.ToLower(), EntryIndex);
+            }
+        }
+    }
+
+    BuiltGeneration = CatalogGeneration;
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeTypeCatalog: Indexed %d tasks, %d conditions, %d evaluators, %d considerations"),
+        TypesByKind[0].Num(), TypesByKind[1].Num(), TypesByKind[2].Num(), TypesByKind[3].Num());
+}
+
+const TArray<TPair<FString, FString>>& FStateTreeTypeCatalog::GetTypes(EStateTreeNodeKind Kind)
+{
+    EnsureCurrent();
+    check(Kind < EStateTreeNodeKind::Num);
+    return TypesByKind[static_cast<int32>(Kind)];
+}
+
+UScriptStruct* FStateTreeTypeCatalog::ResolveEntry(const int32* EntryIndex, EStateTreeNodeKind* OutKind) const
+{
+    if (!EntryIndex)
+    {
+        return nullptr;
+    }
+
+    const FEntry& Entry = Entries[*EntryIndex];
+    UScriptStruct* Struct = Entry.Struct.Get();
+    if (Struct && OutKind)
+    {
+        *OutKind = Entry.Kind;
+    }
+    return Struct;
+}
+
+UScriptStruct* FStateTreeTypeCatalog::FindType(const FString& PathOrName, EStateTreeNodeKind* OutKind)
+{
+    if (PathOrName.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    EnsureCurrent();
+
+    const FString Key = PathOrName.ToLower();
+    if (Key.Contains(TEXT(".")))
+    {
+        return ResolveEntry(EntriesByPath.Find(Key), OutKind);
+    }
+
+    if (UScriptStruct* Found = ResolveEntry(EntriesByName.Find(Key), OutKind))
+    {
+        return Found;
+    }
+
+    // C++ spelling: reflected struct names drop the F prefix
+    if (Key.StartsWith(TEXT("f")))
+    {
+        return ResolveEntry(EntriesByName.Find(Key.RightChop(1)), OutKind);
+    }
+    return nullptr;
+}
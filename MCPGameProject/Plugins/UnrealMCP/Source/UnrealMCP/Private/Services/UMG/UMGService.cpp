@@ -1954,6 +1954,21 @@ bool FUMGService::CaptureWidgetScreenshot(const FString& BlueprintName, int32 Wi
     return FWidgetLayoutService::CaptureWidgetScreenshot(WidgetBlueprint, Width, Height, Format, OutScreenshotData);
 }
 
+void FUMGService::CaptureWidgetScreenshotAsync(const FString& BlueprintName, int32 Width, int32 Height,
+                                              const FString& Format, const FString& OutputFilePath,
+                                              TFunction<void(TSharedPtr<FJsonObject>)> OnComplete)
+{
+    UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprint(BlueprintName);
+    if (!WidgetBlueprint)
+    {
+        UE_LOG(LogTemp, Error, TEXT("UMGService: Widget blueprint '%s' not found"), *BlueprintName);
+        OnComplete(nullptr);
+        return;
+    }
+
+    FWidgetLayoutService::CaptureWidgetScreenshotAsync(WidgetBlueprint, Width, Height, Format, OutputFilePath, MoveTemp(OnComplete));
+}
+
 bool FUMGService::CreateWidgetInputHandler(const FString& WidgetName, const FString& ComponentName,
                                           const FString& InputType, const FString& InputEvent,
                                           const FString& Trigger, const FString& HandlerName,
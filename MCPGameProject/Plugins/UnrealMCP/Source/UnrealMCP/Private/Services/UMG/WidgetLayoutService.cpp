@@ -19,8 +19,10 @@
 // Includes for screenshot capture
 #include "Slate/WidgetRenderer.h"
 #include "Engine/TextureRenderTarget2D.h"
-#include "Misc/Base64.h"
-#include "ImageUtils.h"
+#include "TextureResource.h"
+#include "RenderingThread.h"
+#include "Services/ImageCaptureService.h"
+#include "UObject/StrongObjectPtr.h"
 #include "Engine/World.h"
 #include "Editor.h"
 
@@ -273,8 +275,52 @@ TSharedPtr<FJsonObject> FWidgetLayoutService::BuildWidgetHierarchy(UWidget* Widg
     return WidgetInfo;
 }
 
-bool FWidgetLayoutService::CaptureWidgetScreenshot(UWidgetBlueprint* WidgetBlueprint, int32 Width, int32 Height,
-                                                   const FString& Format, TSharedPtr<FJsonObject>& OutScreenshotData)
+namespace
+{
+    /** Keeps the preview widget and its renderer alive until the GPU has consumed the draw */
+    struct FWidgetDrawPayload
+    {
+        TStrongObjectPtr<UUserWidget> PreviewWidget;
+        TSharedPtr<SWidget> SlateWidget;
+        TSharedPtr<FWidgetRenderer> Renderer;
+
+        ~FWidgetDrawPayload()
+        {
+            SlateWidget.Reset();
+            if (PreviewWidget.IsValid())
+            {
+                PreviewWidget->RemoveFromParent();
+                PreviewWidget->MarkAsGarbage();
+            }
+        }
+    };
+
+    TSharedPtr<FJsonObject> MakeScreenshotData(const FImageCaptureResult& Result, const FString& OutputFilePath = FString())
+    {
+        TSharedPtr<FJsonObject> ScreenshotData = MakeShareable(new FJsonObject);
+        ScreenshotData->SetBoolField(TEXT("success"), true);
+        if (OutputFilePath.IsEmpty())
+        {
+            ScreenshotData->SetStringField(TEXT("output_mode"), TEXT("base64"));
+            ScreenshotData->SetStringField(TEXT("image_base64"), Result.Base64);
+        }
+        else
+        {
+            // Shared-file mode: the client reads the bytes from disk, so skip the Base64/JSON round trip
+            ScreenshotData->SetStringField(TEXT("output_mode"), TEXT("file"));
+            ScreenshotData->SetStringField(TEXT("file_path"), OutputFilePath);
+            ScreenshotData->SetStringField(TEXT("sha1"), Result.Sha1);
+        }
+        ScreenshotData->SetNumberField(TEXT("width"), Result.Width);
+        ScreenshotData->SetNumberField(TEXT("height"), Result.Height);
+        ScreenshotData->SetStringField(TEXT("format"), Result.Format);
+        ScreenshotData->SetNumberField(TEXT("image_size_bytes"), Result.EncodedBytes.Num());
+        return ScreenshotData;
+    }
+}
+
+bool FWidgetLayoutService::DrawWidgetToPooledTarget(UWidgetBlueprint* WidgetBlueprint, int32 Width, int32 Height,
+                                                    UTextureRenderTarget2D*& OutRenderTarget, TSharedPtr<void>& OutDrawPayload)
 {
     if (!WidgetBlueprint)
     {
@@ -307,96 +353,115 @@ bool FWidgetLayoutService::CaptureWidgetScreenshot(UWidgetBlueprint* WidgetBluep
         UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Invalid or incompatible generated class"));
         return false;
     }
-    UUserWidget* PreviewWidget = CreateWidget<UUserWidget>(EditorWorld, GeneratedClass);
-    if (!PreviewWidget)
+
+    TSharedPtr<FWidgetDrawPayload> Payload = MakeShared<FWidgetDrawPayload>();
+    Payload->PreviewWidget.Reset(CreateWidget<UUserWidget>(EditorWorld, GeneratedClass));
+    if (!Payload->PreviewWidget.IsValid())
     {
         UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Failed to create widget preview instance"));
         return false;
     }
 
     // Get the Slate widget
-    TSharedPtr<SWidget> SlateWidget = PreviewWidget->TakeWidget();
-    if (!SlateWidget.IsValid())
+    Payload->SlateWidget = Payload->PreviewWidget->TakeWidget();
+    if (!Payload->SlateWidget.IsValid())
     {
         UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Failed to get Slate widget"));
-        PreviewWidget->RemoveFromParent();
-        PreviewWidget->MarkAsGarbage();
         return false;
     }
 
-    // Create render target
-    UTextureRenderTarget2D* RenderTarget = NewObject<UTextureRenderTarget2D>();
-    RenderTarget->InitCustomFormat(Width, Height, PF_B8G8R8A8, true);
-    RenderTarget->UpdateResourceImmediate(true);
+    // Render widget into a pooled texture (reused across captures of the same size)
+    UTextureRenderTarget2D* RenderTarget = FImageCaptureService::Get().AcquireRenderTarget(Width, Height, PF_B8G8R8A8);
 
-    // Render widget to texture
-    FWidgetRenderer WidgetRenderer(true, false);
-    WidgetRenderer.DrawWidget(
+    Payload->Renderer = MakeShared<FWidgetRenderer>(true, false);
+    Payload->Renderer->DrawWidget(
         RenderTarget,
-        SlateWidget.ToSharedRef(),
+        Payload->SlateWidget.ToSharedRef(),
         FVector2D(Width, Height),
         0.0f);
 
-    // Flush rendering commands to ensure texture is ready
-    FlushRenderingCommands();
+    OutRenderTarget = RenderTarget;
+    OutDrawPayload = Payload;
+    return true;
+}
 
-    // Read pixels from render target
-    FTextureRenderTargetResource* RTResource = RenderTarget->GameThread_GetRenderTargetResource();
-    if (!RTResource)
+bool FWidgetLayoutService::CaptureWidgetScreenshot(UWidgetBlueprint* WidgetBlueprint, int32 Width, int32 Height,
+                                                   const FString& Format, TSharedPtr<FJsonObject>& OutScreenshotData)
+{
+    UTextureRenderTarget2D* RenderTarget = nullptr;
+    TSharedPtr<void> DrawPayload;
+    if (!DrawWidgetToPooledTarget(WidgetBlueprint, Width, Height, RenderTarget, DrawPayload))
     {
-        UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Failed to get render target resource"));
-        PreviewWidget->RemoveFromParent();
-        PreviewWidget->MarkAsGarbage();
         return false;
     }
 
+    // Flush rendering commands to ensure texture is ready
+    FlushRenderingCommands();
+
+    // Read pixels from render target
     TArray<FColor> OutPixels;
-    if (!RTResource->ReadPixels(OutPixels))
+    FTextureRenderTargetResource* RTResource = RenderTarget->GameThread_GetRenderTargetResource();
+    const bool bReadPixels = RTResource && RTResource->ReadPixels(OutPixels);
+    FImageCaptureService::Get().ReleaseRenderTarget(RenderTarget);
+    if (!bReadPixels)
     {
         UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Failed to read pixels from render target"));
-        PreviewWidget->RemoveFromParent();
-        PreviewWidget->MarkAsGarbage();
         return false;
     }
 
-    // Compress to PNG or JPEG
-    TArray<uint8> CompressedImage;
-    FString ActualFormat = Format.ToLower();
+    // Compress to PNG or JPEG and encode as base64
+    FImageCaptureOptions Options;
+    Options.Format = Format;
+    Options.bEncodeBase64 = true;
 
-    if (ActualFormat == TEXT("jpg") || ActualFormat == TEXT("jpeg"))
+    FImageCaptureResult Result;
+    FImageCaptureService::EncodePixels(OutPixels, Width, Height, Options, Result);
+    if (!Result.bSuccess)
     {
-        // JPEG compression - use thumbnail compression for JPEG
-        FImageUtils::ThumbnailCompressImageArray(Width, Height, OutPixels, CompressedImage);
-    }
-    else
-    {
-        // PNG compression (default)
-        ActualFormat = TEXT("png");
-        TArray64<uint8> CompressedImage64;
-        FImageUtils::PNGCompressImageArray(Width, Height, TArrayView64<const FColor>(OutPixels), CompressedImage64);
-        // Convert from TArray64 to TArray
-        CompressedImage.Append(CompressedImage64.GetData(), CompressedImage64.Num());
+        UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - %s"), *Result.Error);
+        return false;
     }
 
-    // Encode as base64
-    FString Base64Image = FBase64::Encode(CompressedImage);
+    OutScreenshotData = MakeScreenshotData(Result);
 
-    // Build response
-    OutScreenshotData = MakeShareable(new FJsonObject);
-    OutScreenshotData->SetBoolField(TEXT("success"), true);
-    OutScreenshotData->SetStringField(TEXT("image_base64"), Base64Image);
-    OutScreenshotData->SetNumberField(TEXT("width"), Width);
-    OutScreenshotData->SetNumberField(TEXT("height"), Height);
-    OutScreenshotData->SetStringField(TEXT("format"), ActualFormat);
-    OutScreenshotData->SetNumberField(TEXT("image_size_bytes"), CompressedImage.Num());
+    UE_LOG(LogTemp, Log, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Screenshot captured successfully, %lld bytes"),
+           Result.EncodedBytes.Num());
 
-    // Clean up
-    PreviewWidget->RemoveFromParent();
-    PreviewWidget->MarkAsGarbage();
-    RenderTarget->MarkAsGarbage();
+    return true;
+}
 
-    UE_LOG(LogTemp, Log, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Screenshot captured successfully, %d bytes"),
-           CompressedImage.Num());
+void FWidgetLayoutService::CaptureWidgetScreenshotAsync(UWidgetBlueprint* WidgetBlueprint, int32 Width, int32 Height,
+                                                        const FString& Format, const FString& OutputFilePath,
+                                                        TFunction<void(TSharedPtr<FJsonObject>)> OnComplete)
+{
+    UTextureRenderTarget2D* RenderTarget = nullptr;
+    TSharedPtr<void> DrawPayload;
+    if (!DrawWidgetToPooledTarget(WidgetBlueprint, Width, Height, RenderTarget, DrawPayload))
+    {
+        OnComplete(nullptr);
+        return;
+    }
 
-    return true;
+    FImageCaptureOptions Options;
+    Options.Format = Format;
+    Options.bEncodeBase64 = OutputFilePath.IsEmpty();
+    Options.OutputFilePath = OutputFilePath;
+    Options.bComputeHash = !OutputFilePath.IsEmpty();
+
+    // The readback is ordered after the widget draw on the render thread, so no flush is needed
+    FImageCaptureService::Get().ReadbackRenderTarget(RenderTarget, Options,
+        [OutputFilePath, OnComplete = MoveTemp(OnComplete)](FImageCaptureResult&& Result)
+        {
+            if (!Result.bSuccess)
+            {
+                UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshotAsync - %s"), *Result.Error);
+                OnComplete(nullptr);
+                return;
+            }
+
+            UE_LOG(LogTemp, Log, TEXT("WidgetLayoutService::CaptureWidgetScreenshotAsync - Screenshot captured, %lld bytes in %.1f ms"),
+                   Result.EncodedBytes.Num(), Result.ElapsedMs);
+            OnComplete(MakeScreenshotData(Result, OutputFilePath));
+        },
+        MoveTemp(DrawPayload));
 }
@@ -0,0 +1,225 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Utils/AudioAnalysisUtils.h"
+#include "Commands/Sound/AnalyzeSoundWavesCommand.h"
+#include "Services/SoundService.h"
+
+#include "Audio.h"
+#include "Dom/JsonObject.h"
+#include "Memory/SharedBuffer.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Sound/SoundWave.h"
+#include "UObject/Package.h"
+
+namespace
+{
+constexpr int32 TestSampleRate = 48000;
+
+/** Sine of the given amplitude, padded with silence on both sides */
+TArray<float> MakeTone(float Amplitude, float Frequency, float Seconds, float PadSeconds)
+{
+	const int32 Pad = FMath::RoundToInt32(PadSeconds * TestSampleRate);
+	const int32 Length = FMath::RoundToInt32(Seconds * TestSampleRate);
+	TArray<float> Samples;
+	Samples.SetNumZeroed(Pad + Length + Pad);
+	for (int32 Index = 0; Index < Length; ++Index)
+	{
+		Samples[Pad + Index] = Amplitude * FMath::Sin(2.0f * UE_PI * Frequency * Index / TestSampleRate);
+	}
+	return Samples;
+}
+
+TSharedPtr<FJsonObject> ParseResponse(const FString& Json)
+{
+	TSharedPtr<FJsonObject> Result;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+	FJsonSerializer::Deserialize(Reader, Result);
+	return Result;
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FAudioAnalysisChannelStatsTest,
+	"UnrealMCP.Editor.AudioAnalysis.ChannelStats",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAudioAnalysisChannelStatsTest::RunTest(const FString& Parameters)
+{
+	// Odd length so the scalar tail after the vector loop is exercised
+	TArray<float> Samples;
+	Samples.Init(0.25f, 10001);
+	Samples[17] = 1.0f;
+	Samples[10000] = -1.0f;
+
+	const FAudioChannelStats Stats = FAudioAnalysisUtils::ComputeChannelStats(Samples, 0.999f);
+	TestEqual(TEXT("Peak"), Stats.Peak, 1.0f);
+	TestEqual(TEXT("Clipped samples in vector body and tail"), Stats.ClippedSamples, int64(2));
+	TestEqual(TEXT("DC offset"), Stats.DcOffset, (0.25f * 9999 + 1.0f - 1.0f) / 10001.0f, 1e-5f);
+	TestEqual(TEXT("RMS"), Stats.Rms, FMath::Sqrt((0.0625f * 9999 + 2.0f) / 10001.0f), 1e-5f);
+
+	const FAudioChannelStats Empty = FAudioAnalysisUtils::ComputeChannelStats(TArray<float>(), 0.999f);
+	TestEqual(TEXT("Empty channel"), Empty.Peak, 0.0f);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FAudioAnalysisLoudnessTest,
+	"UnrealMCP.Editor.AudioAnalysis.Loudness",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAudioAnalysisLoudnessTest::RunTest(const FString& Parameters)
+{
+	FAudioAnalysisSettings Settings;
+
+	// BS.1770 reference: a full-scale 997 Hz sine in one channel reads -3.01 LUFS
+	TArray<TArray<float>> Mono;
+	Mono.Add(MakeTone(1.0f, 997.0f, 3.0f, 0.0f));
+	float Loudness = 0.0f;
+	if (TestTrue(TEXT("Mono measured"), FAudioAnalysisUtils::ComputeIntegratedLoudness(Mono, TestSampleRate, Settings, Loudness)))
+	{
+		TestEqual(TEXT("Mono sine loudness"), Loudness, -3.01f, 0.05f);
+	}
+
+	// The same tone in both channels sums power: +3 dB
+	TArray<TArray<float>> Stereo;
+	Stereo.Add(Mono[0]);
+	Stereo.Add(Mono[0]);
+	if (TestTrue(TEXT("Stereo measured"), FAudioAnalysisUtils::ComputeIntegratedLoudness(Stereo, TestSampleRate, Settings, Loudness)))
+	{
+		TestEqual(TEXT("Stereo sine loudness"), Loudness, 0.0f, 0.05f);
+	}
+
+	// Gating drops the silent blocks around the tone; only the blocks straddling its edges
+	// still count (-3.42 LUFS, against -6.50 for the ungated mean)
+	TArray<TArray<float>> Padded;
+	Padded.Add(MakeTone(1.0f, 997.0f, 3.0f, 2.0f));
+	if (TestTrue(TEXT("Padded measured"), FAudioAnalysisUtils::ComputeIntegratedLoudness(Padded, TestSampleRate, Settings, Loudness)))
+	{
+		TestEqual(TEXT("Silence is gated out"), Loudness, -3.42f, 0.05f);
+	}
+
+	TArray<TArray<float>> Short;
+	Short.Add(MakeTone(1.0f, 997.0f, 0.2f, 0.0f));
+	TestFalse(TEXT("Shorter than one block"), FAudioAnalysisUtils::ComputeIntegratedLoudness(Short, TestSampleRate, Settings, Loudness));
+
+	TArray<TArray<float>> Silent;
+	Silent.AddDefaulted_GetRef().SetNumZeroed(TestSampleRate);
+	TestFalse(TEXT("Silence has no loudness"), FAudioAnalysisUtils::ComputeIntegratedLoudness(Silent, TestSampleRate, Settings, Loudness));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FAudioAnalysisAnalyzeTest,
+	"UnrealMCP.Editor.AudioAnalysis.Analyze",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAudioAnalysisAnalyzeTest::RunTest(const FString& Parameters)
+{
+	// Interleaved stereo: left carries a half-scale tone between 0.5 s of silence, right is silent
+	const TArray<float> Tone = MakeTone(0.5f, 440.0f, 1.0f, 0.5f);
+	TArray<int16> Interleaved;
+	Interleaved.SetNumZeroed(Tone.Num() * 2);
+	for (int32 Frame = 0; Frame < Tone.Num(); ++Frame)
+	{
+		Interleaved[Frame * 2] = int16(FMath::RoundToInt32(Tone[Frame] * 32767.0f));
+	}
+
+	TArray<TArray<float>> Channels;
+	FAudioAnalysisUtils::DeinterleavePcm16(Interleaved, 2, Channels);
+	if (!TestEqual(TEXT("Two channels"), Channels.Num(), 2) || !TestEqual(TEXT("Frames"), Channels[0].Num(), Tone.Num()))
+	{
+		return false;
+	}
+
+	FAudioAnalysisSettings Parallel;
+	FAudioAnalysisSettings Serial;
+	Serial.bForceSingleThread = true;
+	const FAudioAnalysisResult Result = FAudioAnalysisUtils::Analyze(Channels, TestSampleRate, Parallel);
+	const FAudioAnalysisResult SerialResult = FAudioAnalysisUtils::Analyze(Channels, TestSampleRate, Serial);
+
+	TestEqual(TEXT("Peak about -6 dBFS"), FAudioAnalysisUtils::ToDecibels(Result.Peak), -6.02f, 0.05f);
+	TestEqual(TEXT("Silent channel floors"), FAudioAnalysisUtils::ToDecibels(Result.Channels[1].Peak), FAudioAnalysisUtils::MinDecibels);
+	TestEqual(TEXT("No clipping"), Result.ClippedSamples, int64(0));
+	TestTrue(TEXT("Trim start near 0.5 s"), FMath::Abs(Result.TrimStartFrame - TestSampleRate / 2) < 10);
+	TestTrue(TEXT("Trim end near 1.5 s"), FMath::Abs(Result.TrimEndFrame - TestSampleRate * 3 / 2) < 10);
+	TestTrue(TEXT("Loudness measured"), Result.bHasLoudness);
+	TestEqual(TEXT("Threading does not change the result"), Result.Rms, SerialResult.Rms);
+	TestEqual(TEXT("Threading does not change loudness"), Result.IntegratedLoudness, SerialResult.IntegratedLoudness);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FAnalyzeSoundWavesCommandTest,
+	"UnrealMCP.Editor.AudioAnalysis.Command",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAnalyzeSoundWavesCommandTest::RunTest(const FString& Parameters)
+{
+	// Mono half-scale tone between 0.5 s of silence, imported as a 16-bit WAV payload
+	const TArray<float> Tone = MakeTone(0.5f, 440.0f, 1.0f, 0.5f);
+	TArray<int16> Pcm;
+	Pcm.SetNumUninitialized(Tone.Num());
+	for (int32 Index = 0; Index < Tone.Num(); ++Index)
+	{
+		Pcm[Index] = int16(FMath::RoundToInt32(Tone[Index] * 32767.0f));
+	}
+	TArray<uint8> WaveFile;
+	SerializeWaveFile(WaveFile, reinterpret_cast<const uint8*>(Pcm.GetData()), Pcm.Num() * sizeof(int16), 1, TestSampleRate);
+
+	USoundWave* Imported = NewObject<USoundWave>(GetTransientPackage(), NAME_None, RF_Transient);
+	Imported->RawData.UpdatePayload(FSharedBuffer::Clone(WaveFile.GetData(), WaveFile.Num()));
+	USoundWave* Empty = NewObject<USoundWave>(GetTransientPackage(), NAME_None, RF_Transient);
+
+	// A fresh service so the analysis cache starts empty
+	FSoundService Service;
+	FAnalyzeSoundWavesCommand Command(Service);
+	const FString Request = FString::Printf(TEXT(R"({"sound_wave_path":"%s","sound_wave_paths":["%s","%s"]})"),
+		*Imported->GetPathName(), *Imported->GetPathName(), *Empty->GetPathName());
+
+	const TSharedPtr<FJsonObject> First = ParseResponse(Command.Execute(Request));
+	if (!TestTrue(TEXT("First batch succeeds"), First && First->GetBoolField(TEXT("success"))))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Duplicate path analyzed once"), First->GetIntegerField(TEXT("analyzed")), 1);
+	TestEqual(TEXT("Wave without source data fails"), First->GetIntegerField(TEXT("failed")), 1);
+	TestEqual(TEXT("Nothing cached yet"), First->GetIntegerField(TEXT("cached")), 0);
+
+	const TArray<TSharedPtr<FJsonValue>>* Results = nullptr;
+	if (!TestTrue(TEXT("One result per unique path"), First->TryGetArrayField(TEXT("results"), Results) && Results->Num() == 2))
+	{
+		return false;
+	}
+	const TSharedPtr<FJsonObject> Analyzed = (*Results)[0]->AsObject();
+	TestTrue(TEXT("Imported wave analyzed"), Analyzed->GetBoolField(TEXT("success")));
+	TestEqual(TEXT("Sample rate read from the payload"), Analyzed->GetIntegerField(TEXT("sample_rate")), TestSampleRate);
+	TestEqual(TEXT("Peak about -6 dBFS"), Analyzed->GetNumberField(TEXT("peak_dbfs")), -6.02, 0.05);
+	TestEqual(TEXT("Leading silence"), Analyzed->GetNumberField(TEXT("leading_silence_seconds")), 0.5, 0.01);
+	TestEqual(TEXT("Trailing silence"), Analyzed->GetNumberField(TEXT("trailing_silence_seconds")), 0.5, 0.01);
+	TestFalse(TEXT("Decoded, not cached"), Analyzed->GetBoolField(TEXT("cached")));
+
+	const TSharedPtr<FJsonObject> Failed = (*Results)[1]->AsObject();
+	TestFalse(TEXT("Empty wave reported"), Failed->GetBoolField(TEXT("success")));
+	TestEqual(TEXT("Failed result keeps its path"), Failed->GetStringField(TEXT("path")), Empty->GetPathName());
+	TestTrue(TEXT("Failed result explains why"), Failed->GetStringField(TEXT("error")).Contains(TEXT("source data")));
+
+	// Same source payload: served from the cache keyed by its hash
+	const TSharedPtr<FJsonObject> Second = ParseResponse(Command.Execute(Request));
+	TestTrue(TEXT("Second batch succeeds"), Second && Second->GetBoolField(TEXT("success")));
+	TestEqual(TEXT("Second batch hits the cache"), Second ? Second->GetIntegerField(TEXT("cached")) : 0, 1);
+	const TArray<TSharedPtr<FJsonValue>>* SecondResults = nullptr;
+	if (Second && Second->TryGetArrayField(TEXT("results"), SecondResults) && SecondResults->Num() == 2)
+	{
+		const TSharedPtr<FJsonObject> Cached = (*SecondResults)[0]->AsObject();
+		TestTrue(TEXT("Cached result flagged"), Cached->GetBoolField(TEXT("cached")));
+		TestEqual(TEXT("Cached result matches"), Cached->GetNumberField(TEXT("rms_dbfs")), Analyzed->GetNumberField(TEXT("rms_dbfs")));
+	}
+
+	const TSharedPtr<FJsonObject> NoPaths = ParseResponse(Command.Execute(TEXT(R"({"sound_wave_paths":[]})")));
+	TestFalse(TEXT("Paths required"), NoPaths && NoPaths->GetBoolField(TEXT("success")));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
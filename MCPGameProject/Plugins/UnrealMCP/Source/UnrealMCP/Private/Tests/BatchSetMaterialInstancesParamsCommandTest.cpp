@@ -0,0 +1,125 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Commands/Material/BatchSetMaterialInstancesParamsCommand.h"
+
+#include "Dom/JsonObject.h"
+#include "Materials/Material.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Services/IMaterialService.h"
+
+namespace
+{
+class FMultiInstanceMaterialFakeService final : public IMaterialService
+{
+public:
+	int32 BatchCalls = 0;
+	int32 SingleSetterCalls = 0;
+	TArray<FString> LastPaths;
+	FMaterialParameterBatch LastBatch;
+	FString FailingPath;
+
+	virtual UMaterial* CreateMaterial(const FMaterialCreationParams&, FString&, FString&) override { return nullptr; }
+	virtual UMaterialInterface* CreateMaterialInstance(const FMaterialInstanceCreationParams&, FString&, FString&) override { return nullptr; }
+	virtual UMaterialInterface* FindMaterial(const FString&) override { return nullptr; }
+	virtual bool GetMaterialMetadata(const FString&, const TArray<FString>*, TSharedPtr<FJsonObject>&) override { return false; }
+	virtual bool SetScalarParameter(const FString&, const FString&, float, FString&) override { ++SingleSetterCalls; return true; }
+	virtual bool SetVectorParameter(const FString&, const FString&, const FLinearColor&, FString&) override { ++SingleSetterCalls; return true; }
+	virtual bool SetTextureParameter(const FString&, const FString&, const FString&, FString&) override { ++SingleSetterCalls; return true; }
+	virtual bool BatchSetInstanceParameters(const TArray<FString>& InstancePaths, const FMaterialParameterBatch& Batch, TArray<FMaterialInstanceBatchResult>& OutResults, FString& OutError) override
+	{
+		++BatchCalls;
+		LastPaths = InstancePaths;
+		LastBatch = Batch;
+		bool bAllSucceeded = true;
+		for (const FString& Path : InstancePaths)
+		{
+			FMaterialInstanceBatchResult& Result = OutResults.AddDefaulted_GetRef();
+			Result.InstancePath = Path;
+			if (Path == FailingPath)
+			{
+				Result.Error = TEXT("synthetic instance failure");
+				bAllSucceeded = false;
+				continue;
+			}
+			Result.bSuccess = true;
+			for (const TPair<FString, float>& Pair : Batch.ScalarParameters) { Result.AppliedScalars.Add(Pair.Key); }
+			for (const TPair<FString, FLinearColor>& Pair : Batch.VectorParameters) { Result.AppliedVectors.Add(Pair.Key); }
+			for (const TPair<FString, FString>& Pair : Batch.TextureParameters) { Result.AppliedTextures.Add(Pair.Key); }
+		}
+		if (!bAllSucceeded)
+		{
+			OutError = TEXT("1 of 2 material instances failed");
+		}
+		return bAllSucceeded;
+	}
+	virtual bool GetScalarParameter(const FString&, const FString&, float&, FString&) override { return false; }
+	virtual bool GetVectorParameter(const FString&, const FString&, FLinearColor&, FString&) override { return false; }
+	virtual bool GetTextureParameter(const FString&, const FString&, FString&, FString&) override { return false; }
+	virtual bool ApplyMaterialToActor(const FString&, const FString&, int32, const FString&, FString&) override { return false; }
+	virtual bool DuplicateMaterialInstance(const FString&, const FString&, const FString&, FString&, FString&, FString&) override { return false; }
+};
+
+TSharedPtr<FJsonObject> ParseResponse(const FString& Json)
+{
+	TSharedPtr<FJsonObject> Result;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+	FJsonSerializer::Deserialize(Reader, Result);
+	return Result;
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBatchSetMaterialInstancesParamsCommandTest,
+	"UnrealMCP.Material.BatchSetMaterialInstancesParams.Contract",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FBatchSetMaterialInstancesParamsCommandTest::RunTest(const FString& Parameters)
+{
+	FMultiInstanceMaterialFakeService Service;
+	FBatchSetMaterialInstancesParamsCommand Command(Service);
+
+	const TSharedPtr<FJsonObject> Valid = ParseResponse(Command.Execute(TEXT(
+		R"({"material_instances":["/Game/Test/MI_A.MI_A","/Game/Test/MI_B.MI_B","/Game/Test/MI_A.MI_A"],"scalar_params":{"Roughness":0.5},"vector_params":{"Tint":[1,0.5,0.25]}})")));
+	TestTrue(TEXT("Valid payload succeeds"), Valid && Valid->GetBoolField(TEXT("success")));
+	TestEqual(TEXT("Service batch entry point is called once"), Service.BatchCalls, 1);
+	TestEqual(TEXT("Per-parameter setters are not used"), Service.SingleSetterCalls, 0);
+	TestEqual(TEXT("Duplicate instance paths are collapsed"), Service.LastPaths.Num(), 2);
+	TestEqual(TEXT("Scalar map is parsed"), Service.LastBatch.ScalarParameters.Num(), 1);
+	TestEqual(TEXT("Vector map is parsed"), Service.LastBatch.VectorParameters.Num(), 1);
+	if (Service.LastBatch.VectorParameters.Num() == 1)
+	{
+		TestEqual(TEXT("Missing vector alpha defaults to 1"), Service.LastBatch.VectorParameters[0].Value.A, 1.0f);
+	}
+	TestTrue(TEXT("Instance count is reported"), Valid && Valid->GetIntegerField(TEXT("instance_count")) == 2);
+
+	const TSharedPtr<FJsonObject> InvalidVector = ParseResponse(Command.Execute(TEXT(
+		R"({"material_instances":["/Game/Test/MI_A.MI_A"],"vector_params":{"Broken":[1,"bad",0]}})")));
+	TestFalse(TEXT("Invalid vector fails validation"), InvalidVector && InvalidVector->GetBoolField(TEXT("success")));
+	TestEqual(TEXT("Validation happens before the service is called"), Service.BatchCalls, 1);
+
+	const TSharedPtr<FJsonObject> WrongInstanceType = ParseResponse(Command.Execute(TEXT(
+		R"({"material_instances":["/Game/Test/MI_A.MI_A",7],"scalar_params":{"Roughness":0.5}})")));
+	TestFalse(TEXT("Non-string instance path is rejected"), WrongInstanceType && WrongInstanceType->GetBoolField(TEXT("success")));
+	TestEqual(TEXT("Rejected instance list causes no mutation"), Service.BatchCalls, 1);
+
+	Service.FailingPath = TEXT("/Game/Test/MI_B.MI_B");
+	const TSharedPtr<FJsonObject> Partial = ParseResponse(Command.Execute(TEXT(
+		R"({"material_instances":["/Game/Test/MI_A.MI_A","/Game/Test/MI_B.MI_B"],"scalar_params":{"Roughness":0.5}})")));
+	TestFalse(TEXT("Instance failure makes the batch fail"), Partial && Partial->GetBoolField(TEXT("success")));
+	TestTrue(TEXT("Partial update is explicit"), Partial && Partial->GetBoolField(TEXT("partial_update")));
+	TestTrue(TEXT("Failed count is reported"), Partial && Partial->GetIntegerField(TEXT("failed_count")) == 1);
+	const TArray<TSharedPtr<FJsonValue>>* Instances = nullptr;
+	TestTrue(TEXT("Per-instance results are present"), Partial && Partial->TryGetArrayField(TEXT("instances"), Instances) && Instances->Num() == 2);
+	if (Instances && Instances->Num() == 2)
+	{
+		const TSharedPtr<FJsonObject> Failed = (*Instances)[1]->AsObject();
+		TestFalse(TEXT("Failing instance is marked"), Failed->GetBoolField(TEXT("success")));
+		TestTrue(TEXT("Instance diagnostic is preserved"), Failed->GetStringField(TEXT("error")).Contains(TEXT("synthetic instance failure")));
+	}
+
+	return true;
+}
+
+#endif
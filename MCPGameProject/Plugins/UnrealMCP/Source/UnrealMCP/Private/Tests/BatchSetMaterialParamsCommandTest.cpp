@@ -48,6 +48,7 @@ public:
 		TextureCalls.Add({Path, Name, Value});
 		return true;
 	}
+	virtual bool BatchSetInstanceParameters(const TArray<FString>&, const FMaterialParameterBatch&, TArray<FMaterialInstanceBatchResult>&, FString&) override { return false; }
 	virtual bool GetScalarParameter(const FString&, const FString&, float&, FString&) override { return false; }
 	virtual bool GetVectorParameter(const FString&, const FString&, FLinearColor&, FString&) override { return false; }
 	virtual bool GetTextureParameter(const FString&, const FString&, FString&, FString&) override { return false; }
@@ -0,0 +1,302 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Commands/Animation/BuildAnimStateMachineCommand.h"
+#include "Services/AnimationBlueprintService.h"
+#include "Services/AnimStateMachineEditSession.h"
+
+#include "Animation/AnimBlueprint.h"
+#include "Animation/AnimBlueprintGeneratedClass.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/Skeleton.h"
+#include "AnimStateEntryNode.h"
+#include "AnimStateNode.h"
+#include "AnimationStateMachineGraph.h"
+#include "AnimGraphNode_StateMachine.h"
+#include "Dom/JsonObject.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/Package.h"
+
+namespace
+{
+/**
+ * Resolves every name to one transient Animation Blueprint and forwards the build to the real
+ * service, so the command runs end to end without assets on disk
+ */
+class FAnimStateMachineFakeService final : public IAnimationBlueprintService
+{
+public:
+	UAnimBlueprint* AnimBlueprint = nullptr;
+	TArray<FString> FindCalls;
+	int32 BuildCalls = 0;
+
+	virtual UAnimBlueprint* CreateAnimBlueprint(const FAnimBlueprintCreationParams&) override { return nullptr; }
+	virtual UAnimBlueprint* FindAnimBlueprint(const FString& AnimBlueprintName) override
+	{
+		FindCalls.Add(AnimBlueprintName);
+		return AnimBlueprint;
+	}
+	virtual bool CompileAnimBlueprint(UAnimBlueprint*, FString&) override { return false; }
+	virtual bool LinkAnimationLayer(UAnimBlueprint*, const FAnimLayerLinkParams&, FString&) override { return false; }
+	virtual bool GetLinkedAnimationLayers(UAnimBlueprint*, TArray<FString>&) override { return false; }
+	virtual bool CreateStateMachine(UAnimBlueprint*, const FString&, FString&) override { return false; }
+	virtual bool AddStateToStateMachine(UAnimBlueprint*, const FString&, const FAnimStateParams&, FString&) override { return false; }
+	virtual bool AddStateTransition(UAnimBlueprint*, const FString&, const FAnimTransitionParams&, FString&) override { return false; }
+	virtual bool GetStateMachineStates(UAnimBlueprint* InAnimBlueprint, const FString& StateMachineName, TArray<FString>& OutStates) override
+	{
+		return FAnimationBlueprintService::Get().GetStateMachineStates(InAnimBlueprint, StateMachineName, OutStates);
+	}
+	virtual bool BuildStateMachine(UAnimBlueprint* InAnimBlueprint, const FAnimStateMachineBuildParams& Params, FAnimStateMachineBuildResult& OutResult, FString& OutError) override
+	{
+		++BuildCalls;
+		return FAnimationBlueprintService::Get().BuildStateMachine(InAnimBlueprint, Params, OutResult, OutError);
+	}
+	virtual bool AddAnimVariable(UAnimBlueprint*, const FString&, const FString&, const FString&, FString&) override { return false; }
+	virtual bool GetAnimVariables(UAnimBlueprint*, TArray<TPair<FString, FString>>&) override { return false; }
+	virtual bool ConfigureAnimSlot(UAnimBlueprint*, const FString&, const FString&, FString&) override { return false; }
+	virtual bool GetAnimBlueprintMetadata(UAnimBlueprint*, TSharedPtr<FJsonObject>&) override { return false; }
+	virtual bool ConnectAnimGraphNodes(UAnimBlueprint*, const FString&, const FString&, const FString&, const FString&, FString&) override { return false; }
+};
+
+UAnimBlueprint* CreateTransientAnimBlueprint()
+{
+	USkeleton* Skeleton = NewObject<USkeleton>(GetTransientPackage(), NAME_None, RF_Transient);
+	UAnimBlueprint* AnimBlueprint = Cast<UAnimBlueprint>(FKismetEditorUtilities::CreateBlueprint(
+		UAnimInstance::StaticClass(),
+		GetTransientPackage(),
+		MakeUniqueObjectName(GetTransientPackage(), UAnimBlueprint::StaticClass(), TEXT("ABP_StateMachineTest")),
+		BPTYPE_Normal,
+		UAnimBlueprint::StaticClass(),
+		UAnimBlueprintGeneratedClass::StaticClass()));
+	if (AnimBlueprint)
+	{
+		AnimBlueprint->TargetSkeleton = Skeleton;
+	}
+	return AnimBlueprint;
+}
+
+TSharedPtr<FJsonObject> ParseResponse(const FString& Json)
+{
+	TSharedPtr<FJsonObject> Result;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+	FJsonSerializer::Deserialize(Reader, Result);
+	return Result;
+}
+
+/** The failed entry of the given kind and index, or null */
+TSharedPtr<FJsonObject> FindFailed(const TSharedPtr<FJsonObject>& Response, const FString& Kind, int32 Index)
+{
+	const TArray<TSharedPtr<FJsonValue>>* Failed = nullptr;
+	if (!Response || !Response->TryGetArrayField(TEXT("failed"), Failed))
+	{
+		return nullptr;
+	}
+	for (const TSharedPtr<FJsonValue>& Value : *Failed)
+	{
+		const TSharedPtr<FJsonObject> Item = Value->AsObject();
+		int32 ItemIndex = INDEX_NONE;
+		if (Item && Item->GetStringField(TEXT("kind")) == Kind && (!Item->TryGetNumberField(TEXT("index"), ItemIndex) || ItemIndex == Index))
+		{
+			return Item;
+		}
+	}
+	return nullptr;
+}
+
+/** State the entry node of the machine is wired to */
+UAnimStateNode* FindEntryState(UAnimBlueprint* AnimBlueprint, const FString& StateMachineName)
+{
+	FAnimStateMachineEditSession Session(AnimBlueprint, StateMachineName);
+	if (!Session.IsValid() || !Session.GetStateMachineNode()->EditorStateMachineGraph->EntryNode)
+	{
+		return nullptr;
+	}
+	for (UEdGraphPin* Pin : Session.GetStateMachineNode()->EditorStateMachineGraph->EntryNode->Pins)
+	{
+		if (Pin && Pin->Direction == EGPD_Output && Pin->LinkedTo.Num() == 1)
+		{
+			return Cast<UAnimStateNode>(Pin->LinkedTo[0]->GetOwningNode());
+		}
+	}
+	return nullptr;
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBuildAnimStateMachineParseTest,
+	"UnrealMCP.Editor.BuildAnimStateMachine.Parse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FBuildAnimStateMachineParseTest::RunTest(const FString& Parameters)
+{
+	FString AnimBlueprintName;
+	FAnimStateMachineBuildParams Params;
+	FString Error;
+
+	const bool bParsed = FBuildAnimStateMachineCommand::ParseParameters(TEXT(R"({
+		"anim_blueprint_name": "ABP_Player",
+		"state_machine_name": "Locomotion",
+		"entry_state": "Idle",
+		"compile": false,
+		"states": [
+			{"state_name": "Idle", "animation_asset_path": "/Game/Anims/Idle"},
+			{"state_name": "Walk", "node_position_x": 300, "node_position_y": 50}
+		],
+		"transitions": [
+			{"from_state": "Idle", "to_state": "Walk", "blend_duration": 0.15},
+			{"from_state": "Walk", "to_state": "Idle", "transition_rule_type": "Inertialization"}
+		]})"), AnimBlueprintName, Params, Error);
+
+	if (!TestTrue(TEXT("Parsed"), bParsed))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Blueprint"), AnimBlueprintName, FString(TEXT("ABP_Player")));
+	TestEqual(TEXT("Entry state"), Params.EntryStateName, FString(TEXT("Idle")));
+	TestFalse(TEXT("Compile disabled"), Params.bCompile);
+	TestTrue(TEXT("Creates the machine by default"), Params.bCreateIfMissing);
+	if (TestEqual(TEXT("State count"), Params.States.Num(), 2))
+	{
+		TestEqual(TEXT("Asset path"), Params.States[0].AnimationAssetPath, FString(TEXT("/Game/Anims/Idle")));
+		TestEqual(TEXT("Position"), Params.States[1].NodePosition, FVector2D(300.0, 50.0));
+	}
+	if (TestEqual(TEXT("Transition count"), Params.Transitions.Num(), 2))
+	{
+		TestEqual(TEXT("Blend duration"), Params.Transitions[0].BlendDuration, 0.15f);
+		TestEqual(TEXT("Default blend duration"), Params.Transitions[1].BlendDuration, 0.2f);
+		TestEqual(TEXT("Rule"), Params.Transitions[1].TransitionRuleType, FString(TEXT("Inertialization")));
+	}
+
+	TestFalse(TEXT("Nothing to build"), FBuildAnimStateMachineCommand::ParseParameters(
+		TEXT(R"({"anim_blueprint_name": "ABP_Player", "state_machine_name": "Locomotion"})"), AnimBlueprintName, Params, Error));
+	TestFalse(TEXT("State name required"), FBuildAnimStateMachineCommand::ParseParameters(
+		TEXT(R"({"anim_blueprint_name": "ABP_Player", "state_machine_name": "Locomotion", "states": [{}]})"), AnimBlueprintName, Params, Error));
+	TestFalse(TEXT("Transition endpoints required"), FBuildAnimStateMachineCommand::ParseParameters(
+		TEXT(R"({"anim_blueprint_name": "ABP_Player", "state_machine_name": "Locomotion", "transitions": [{"from_state": "Idle"}]})"), AnimBlueprintName, Params, Error));
+	TestFalse(TEXT("State machine required"), FBuildAnimStateMachineCommand::ParseParameters(
+		TEXT(R"({"anim_blueprint_name": "ABP_Player", "states": [{"state_name": "Idle"}]})"), AnimBlueprintName, Params, Error));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBuildAnimStateMachineExecuteTest,
+	"UnrealMCP.Editor.BuildAnimStateMachine.Execute",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FBuildAnimStateMachineExecuteTest::RunTest(const FString& Parameters)
+{
+	FAnimStateMachineFakeService Service;
+	Service.AnimBlueprint = CreateTransientAnimBlueprint();
+	if (!TestNotNull(TEXT("Transient Animation Blueprint"), Service.AnimBlueprint))
+	{
+		return false;
+	}
+	FBuildAnimStateMachineCommand Command(Service);
+
+	// Transitions name states created earlier in the same build; one points at a state nobody created
+	const TSharedPtr<FJsonObject> Built = ParseResponse(Command.Execute(TEXT(R"({
+		"anim_blueprint_name": "ABP_StateMachineTest",
+		"state_machine_name": "Locomotion",
+		"entry_state": "Walk",
+		"compile": false,
+		"states": [
+			{"state_name": "Idle", "is_default_state": true},
+			{"state_name": "Walk", "node_position_x": 300}
+		],
+		"transitions": [
+			{"from_state": "Idle", "to_state": "Walk"},
+			{"from_state": "Walk", "to_state": "Sprint"},
+			{"from_state": "Walk", "to_state": "Idle", "transition_rule_type": "Inertialization"}
+		]})")));
+	if (!TestTrue(TEXT("Build succeeds"), Built && Built->GetBoolField(TEXT("success"))))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Blueprint resolved once"), Service.FindCalls.Num(), 1);
+	TestEqual(TEXT("One build for the whole description"), Service.BuildCalls, 1);
+	TestTrue(TEXT("State machine created"), Built->GetBoolField(TEXT("created_state_machine")));
+	TestEqual(TEXT("Both states added"), Built->GetIntegerField(TEXT("states_added")), 2);
+	TestEqual(TEXT("Transitions to states of the same build resolve"), Built->GetIntegerField(TEXT("transitions_added")), 2);
+	TestFalse(TEXT("Compile not requested"), Built->GetBoolField(TEXT("compiled")));
+
+	const TSharedPtr<FJsonObject> MissingTarget = FindFailed(Built, TEXT("transition"), 1);
+	if (TestNotNull(TEXT("Unresolved transition reported"), MissingTarget.Get()))
+	{
+		TestEqual(TEXT("Failed transition source"), MissingTarget->GetStringField(TEXT("from_state")), FString(TEXT("Walk")));
+		TestEqual(TEXT("Failed transition target"), MissingTarget->GetStringField(TEXT("to_state")), FString(TEXT("Sprint")));
+		TestTrue(TEXT("Failed transition names the missing state"), MissingTarget->GetStringField(TEXT("error")).Contains(TEXT("Sprint")));
+	}
+	const TArray<TSharedPtr<FJsonValue>>* Failed = nullptr;
+	TestTrue(TEXT("Only the unresolved transition failed"), Built->TryGetArrayField(TEXT("failed"), Failed) && Failed->Num() == 1);
+
+	TArray<FString> States;
+	TestTrue(TEXT("States readable"), Service.GetStateMachineStates(Service.AnimBlueprint, TEXT("Locomotion"), States));
+	TestTrue(TEXT("Idle in graph"), States.Contains(TEXT("Idle")));
+	TestTrue(TEXT("Walk in graph"), States.Contains(TEXT("Walk")));
+
+	// entry_state wins over is_default_state on the listed states
+	const UAnimStateNode* EntryState = FindEntryState(Service.AnimBlueprint, TEXT("Locomotion"));
+	TestTrue(TEXT("Entry wired to the requested state"), EntryState && EntryState->GetStateName() == TEXT("Walk"));
+
+	// A second build indexes the existing states: duplicates are rejected per item, new
+	// transitions may target them, and an unknown entry state is reported without aborting
+	const TSharedPtr<FJsonObject> Extended = ParseResponse(Command.Execute(TEXT(R"({
+		"anim_blueprint_name": "ABP_StateMachineTest",
+		"state_machine_name": "Locomotion",
+		"entry_state": "Crouch",
+		"compile": false,
+		"states": [
+			{"state_name": "Idle"},
+			{"state_name": "Jump"}
+		],
+		"transitions": [
+			{"from_state": "Jump", "to_state": "Idle"}
+		]})")));
+	if (!TestTrue(TEXT("Extending build succeeds"), Extended && Extended->GetBoolField(TEXT("success"))))
+	{
+		return false;
+	}
+	TestFalse(TEXT("Existing machine reused"), Extended->GetBoolField(TEXT("created_state_machine")));
+	TestEqual(TEXT("Only the new state added"), Extended->GetIntegerField(TEXT("states_added")), 1);
+	TestEqual(TEXT("Transition to an existing state added"), Extended->GetIntegerField(TEXT("transitions_added")), 1);
+
+	const TSharedPtr<FJsonObject> Duplicate = FindFailed(Extended, TEXT("state"), 0);
+	if (TestNotNull(TEXT("Duplicate state reported"), Duplicate.Get()))
+	{
+		TestEqual(TEXT("Duplicate state name"), Duplicate->GetStringField(TEXT("state_name")), FString(TEXT("Idle")));
+		TestTrue(TEXT("Duplicate state error"), Duplicate->GetStringField(TEXT("error")).Contains(TEXT("already exists")));
+	}
+	const TSharedPtr<FJsonObject> Entry = FindFailed(Extended, TEXT("entry"), INDEX_NONE);
+	TestTrue(TEXT("Unknown entry state reported"), Entry && Entry->GetStringField(TEXT("error")).Contains(TEXT("Crouch")));
+
+	EntryState = FindEntryState(Service.AnimBlueprint, TEXT("Locomotion"));
+	TestTrue(TEXT("Failed entry keeps the previous entry state"), EntryState && EntryState->GetStateName() == TEXT("Walk"));
+
+	TestTrue(TEXT("States readable after extension"), Service.GetStateMachineStates(Service.AnimBlueprint, TEXT("Locomotion"), States));
+	TestEqual(TEXT("No duplicate state node created"), States.FilterByPredicate([](const FString& Name) { return Name == TEXT("Idle"); }).Num(), 1);
+
+	// Without create_if_missing an unknown machine fails the whole build
+	const TSharedPtr<FJsonObject> NoMachine = ParseResponse(Command.Execute(TEXT(R"({
+		"anim_blueprint_name": "ABP_StateMachineTest",
+		"state_machine_name": "Combat",
+		"create_if_missing": false,
+		"compile": false,
+		"states": [{"state_name": "Attack"}]})")));
+	TestFalse(TEXT("Missing machine fails"), NoMachine && NoMachine->GetBoolField(TEXT("success")));
+	TestTrue(TEXT("Missing machine named"), NoMachine && NoMachine->GetStringField(TEXT("error")).Contains(TEXT("Combat")));
+
+	Service.AnimBlueprint = nullptr;
+	const int32 BuildsBeforeMissing = Service.BuildCalls;
+	const TSharedPtr<FJsonObject> NotFound = ParseResponse(Command.Execute(TEXT(R"({
+		"anim_blueprint_name": "ABP_Missing",
+		"state_machine_name": "Locomotion",
+		"states": [{"state_name": "Idle"}]})")));
+	TestFalse(TEXT("Unknown blueprint fails"), NotFound && NotFound->GetBoolField(TEXT("success")));
+	TestTrue(TEXT("Unknown blueprint named"), NotFound && NotFound->GetStringField(TEXT("error")).Contains(TEXT("ABP_Missing")));
+	TestEqual(TEXT("No build without a blueprint"), Service.BuildCalls, BuildsBeforeMissing);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,206 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Commands/Editor/BulkImportCommand.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeLock.h"
+#include "Services/BulkImportService.h"
+#include "Tests/MCPJobTestHelpers.h"
+
+namespace
+{
+class FFakeBulkImportBackend final : public IBulkImportBackend
+{
+public:
+	TArray<FString> CreatedOrder;
+	FCriticalSection ReadLock;
+	int32 ReadCalls = 0;
+
+	virtual bool ReadSource(const FBulkImportItem& Item, FBulkImportPayload& OutPayload, FString& OutError) override
+	{
+		{
+			FScopeLock Lock(&ReadLock);
+			++ReadCalls;
+		}
+		if (Item.SourceFilePath.Contains(TEXT("missing")))
+		{
+			OutError = TEXT("Source file does not exist");
+			return false;
+		}
+		OutPayload.Bytes.Add(1);
+		return true;
+	}
+
+	virtual bool CreateAssets(const FBulkImportItem& Item, FBulkImportPayload& Payload, TArray<FString>& OutAssetPaths, FString& OutError) override
+	{
+		check(IsInGameThread());
+		if (Payload.Bytes.Num() != 1)
+		{
+			OutError = TEXT("Payload was not read");
+			return false;
+		}
+		CreatedOrder.Add(Item.AssetName);
+		OutAssetPaths.Add(Item.FolderPath / Item.AssetName);
+		return true;
+	}
+};
+
+FBulkImportItem MakeItem(const FString& Name, const FString& Path)
+{
+	FBulkImportItem Item;
+	Item.Type = EBulkImportAssetType::Texture;
+	Item.SourceFilePath = Path;
+	Item.AssetName = Name;
+	Item.FolderPath = TEXT("/Game/Test");
+	return Item;
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBulkImportParseTest,
+	"UnrealMCP.Editor.BulkImport.Parse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FBulkImportParseTest::RunTest(const FString& Parameters)
+{
+	TArray<FBulkImportItem> Items;
+	FBulkImportJobOptions Options;
+	FString Error;
+
+	const FString Json = TEXT(R"({
+		"files": [
+			"C:/Drop/T_Rock_D.png",
+			{ "source_file_path": "C:/Drop/T_Rock_N.tga", "compression_settings": "Normalmap", "folder_path": "Rocks" },
+			"C:/Drop/SM_Rock.fbx",
+			{ "source_file_path": "C:/Drop/rock impact.wav", "asset_name": "S_RockImpact" }
+		],
+		"import_materials": true,
+		"srgb": false,
+		"frame_budget_ms": 500
+	})");
+
+	TestTrue(TEXT("Parses"), FBulkImportCommand::ParseParameters(Json, Items, Options, Error));
+	if (!TestEqual(TEXT("Item count"), Items.Num(), 4))
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("Budget clamped"), Options.FrameBudgetMs, 100.0);
+
+	TestTrue(TEXT("PNG is a texture"), Items[0].Type == EBulkImportAssetType::Texture);
+	TestEqual(TEXT("Name from file"), Items[0].AssetName, FString(TEXT("T_Rock_D")));
+	TestEqual(TEXT("Default texture folder"), Items[0].FolderPath, FString(TEXT("/Game/Textures")));
+	TestFalse(TEXT("Top-level srgb applies"), Items[0].bSRGB);
+
+	TestEqual(TEXT("Per-file compression"), Items[1].CompressionSettings, FString(TEXT("Normalmap")));
+	TestEqual(TEXT("Folder normalized"), Items[1].FolderPath, FString(TEXT("/Game/Rocks")));
+
+	TestTrue(TEXT("FBX is a mesh"), Items[2].Type == EBulkImportAssetType::StaticMesh);
+	TestEqual(TEXT("Default mesh folder"), Items[2].FolderPath, FString(TEXT("/Game/Meshes")));
+	TestTrue(TEXT("Mesh options forwarded"), Items[2].MeshOptions.IsValid() && Items[2].MeshOptions->GetBoolField(TEXT("import_materials")));
+
+	TestTrue(TEXT("WAV is a sound"), Items[3].Type == EBulkImportAssetType::Sound);
+	TestEqual(TEXT("Explicit asset name"), Items[3].AssetName, FString(TEXT("S_RockImpact")));
+
+	TestFalse(TEXT("Unsupported extension rejected"),
+		FBulkImportCommand::ParseParameters(TEXT(R"({"files":["C:/Drop/readme.txt"]})"), Items, Options, Error));
+	TestFalse(TEXT("Duplicate destination rejected"),
+		FBulkImportCommand::ParseParameters(TEXT(R"({"files":["C:/A/T_X.png","C:/B/T_X.png"]})"), Items, Options, Error));
+	TestFalse(TEXT("Empty files rejected"),
+		FBulkImportCommand::ParseParameters(TEXT(R"({"files":[]})"), Items, Options, Error));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBulkImportSlicesTest,
+	"UnrealMCP.Editor.BulkImport.BudgetedSlices",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FBulkImportSlicesTest::RunTest(const FString& Parameters)
+{
+	TSharedRef<FFakeBulkImportBackend> Backend = MakeShared<FFakeBulkImportBackend>();
+
+	TArray<FBulkImportItem> Items;
+	Items.Add(MakeItem(TEXT("A"), TEXT("C:/Drop/A.png")));
+	Items.Add(MakeItem(TEXT("B"), TEXT("C:/Drop/missing.png")));
+	Items.Add(MakeItem(TEXT("C"), TEXT("C:/Drop/C.png")));
+	Items.Add(MakeItem(TEXT("D"), TEXT("C:/Drop/D.png")));
+	Items.Add(MakeItem(TEXT("E"), TEXT("C:/Drop/E.png")));
+
+	// A zero budget still imports exactly one item per tick
+	FBulkImportJobOptions Options;
+	Options.FrameBudgetMs = 0.0;
+	Options.MaxConcurrentReads = 2;
+
+	FBulkImportJob Job(TEXT("test"), MoveTemp(Items), Options, Backend);
+	const int32 MaxPerTick = MCPJobTest::TickUntilComplete(Job);
+
+	TestTrue(TEXT("Job completes"), Job.IsComplete());
+	TestEqual(TEXT("One item per tick at zero budget"), MaxPerTick, 1);
+	TestEqual(TEXT("Every file read once"), Backend->ReadCalls, 5);
+	TestEqual(TEXT("Created in request order"), FString::Join(Backend->CreatedOrder, TEXT(",")), FString(TEXT("A,C,D,E")));
+
+	FBulkImportJobStatus Status;
+	Job.GetStatus(Status, true);
+	TestTrue(TEXT("Status complete"), Status.bComplete);
+	TestEqual(TEXT("Succeeded count"), Status.Count(EBulkImportItemState::Succeeded), 4);
+	TestEqual(TEXT("Failed count"), Status.Count(EBulkImportItemState::Failed), 1);
+	if (TestEqual(TEXT("Item statuses"), Status.Items.Num(), 5))
+	{
+		TestFalse(TEXT("Read error reported"), Status.Items[1].Error.IsEmpty());
+		TestEqual(TEXT("Asset path reported"), Status.Items[0].AssetPaths.Num() == 1 ? Status.Items[0].AssetPaths[0] : FString(),
+			FString(TEXT("/Game/Test/A")));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBulkImportCancelTest,
+	"UnrealMCP.Editor.BulkImport.Cancel",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FBulkImportCancelTest::RunTest(const FString& Parameters)
+{
+	TSharedRef<FFakeBulkImportBackend> Backend = MakeShared<FFakeBulkImportBackend>();
+
+	TArray<FBulkImportItem> Items;
+	for (const TCHAR* Name : { TEXT("A"), TEXT("B"), TEXT("C"), TEXT("D"), TEXT("E") })
+	{
+		Items.Add(MakeItem(Name, FString::Printf(TEXT("C:/Drop/%s.png"), Name)));
+	}
+
+	FBulkImportJobOptions Options;
+	Options.FrameBudgetMs = 0.0;
+	Options.MaxConcurrentReads = 3;
+
+	FBulkImportJob Job(TEXT("test"), MoveTemp(Items), Options, Backend);
+
+	// Start the first reads and let them land, so some items sit in Ready when the job is cancelled
+	Job.Tick();
+	FBulkImportJobStatus Status;
+	const double ReadDeadline = FPlatformTime::Seconds() + 10.0;
+	do
+	{
+		FPlatformProcess::Sleep(0.001f);
+		Job.GetStatus(Status, false);
+	}
+	while (Status.Count(EBulkImportItemState::Reading) > 0 && FPlatformTime::Seconds() < ReadDeadline);
+
+	Job.Cancel();
+	MCPJobTest::TickUntilComplete(Job);
+
+	Job.GetStatus(Status, true);
+	TestTrue(TEXT("Cancelled job completes"), Status.bComplete);
+	TestEqual(TEXT("Nothing left pending"), Status.Count(EBulkImportItemState::Ready) + Status.Count(EBulkImportItemState::Queued), 0);
+	TestEqual(TEXT("Every item accounted for"), Status.Count(EBulkImportItemState::Succeeded) + Status.Count(EBulkImportItemState::Failed), 5);
+	TestTrue(TEXT("Unimported items failed as cancelled"), Status.Items.Last().Error == TEXT("Cancelled"));
+	TestEqual(TEXT("Only items imported before the cancel were created"), Backend->CreatedOrder.Num(), Status.Count(EBulkImportItemState::Succeeded));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
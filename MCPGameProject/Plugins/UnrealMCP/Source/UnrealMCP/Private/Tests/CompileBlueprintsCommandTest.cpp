@@ -0,0 +1,160 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Commands/Blueprint/CompileBlueprintsCommand.h"
+#include "Services/BlueprintService.h"
+
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "GameFramework/Actor.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+namespace
+{
+UBlueprint* CreateTransientActorBlueprint(const TCHAR* BaseName)
+{
+	return FKismetEditorUtilities::CreateBlueprint(
+		AActor::StaticClass(),
+		GetTransientPackage(),
+		MakeUniqueObjectName(GetTransientPackage(), UBlueprint::StaticClass(), BaseName),
+		BPTYPE_Normal,
+		UBlueprint::StaticClass(),
+		UBlueprintGeneratedClass::StaticClass());
+}
+
+const FBlueprintCompileResult* FindResult(const FBlueprintBatchCompileResult& Batch, const FString& BlueprintName)
+{
+	return Batch.Results.FindByPredicate([&BlueprintName](const FBlueprintCompileResult& Result)
+	{
+		return Result.BlueprintName == BlueprintName;
+	});
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCompileBlueprintsParseTest,
+	"UnrealMCP.Editor.CompileBlueprints.Parse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FCompileBlueprintsParseTest::RunTest(const FString& Parameters)
+{
+	TArray<FString> Names;
+	bool bSkipUpToDate = false;
+	FString Error;
+
+	TestTrue(TEXT("Names parsed"), FCompileBlueprintsCommand::ParseParameters(
+		TEXT(R"({"blueprint_names":["BP_Door","BP_Pickup","BP_Door"]})"), Names, bSkipUpToDate, Error));
+	TestEqual(TEXT("Duplicates dropped"), Names.Num(), 2);
+	TestEqual(TEXT("Request order kept"), Names[1], FString(TEXT("BP_Pickup")));
+	TestTrue(TEXT("Skips up-to-date by default"), bSkipUpToDate);
+
+	TestTrue(TEXT("Skip flag"), FCompileBlueprintsCommand::ParseParameters(
+		TEXT(R"({"blueprint_names":["BP_Door"],"skip_up_to_date":false})"), Names, bSkipUpToDate, Error));
+	TestFalse(TEXT("Skip flag read"), bSkipUpToDate);
+
+	TestFalse(TEXT("Names required"), FCompileBlueprintsCommand::ParseParameters(
+		TEXT(R"({"blueprint_name":"BP_Door"})"), Names, bSkipUpToDate, Error));
+	TestFalse(TEXT("Empty list rejected"), FCompileBlueprintsCommand::ParseParameters(
+		TEXT(R"({"blueprint_names":[]})"), Names, bSkipUpToDate, Error));
+	TestFalse(TEXT("Non-string rejected"), FCompileBlueprintsCommand::ParseParameters(
+		TEXT(R"({"blueprint_names":["BP_Door",3]})"), Names, bSkipUpToDate, Error));
+
+	FString TooMany = TEXT(R"({"blueprint_names":[)");
+	for (int32 Index = 0; Index < 501; ++Index)
+	{
+		TooMany += FString::Printf(TEXT("%s\"BP_%d\""), Index > 0 ? TEXT(",") : TEXT(""), Index);
+	}
+	TooMany += TEXT("]}");
+	TestFalse(TEXT("Batch size capped"), FCompileBlueprintsCommand::ParseParameters(TooMany, Names, bSkipUpToDate, Error));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCompileBlueprintsBatchTest,
+	"UnrealMCP.Editor.CompileBlueprints.Batch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FCompileBlueprintsBatchTest::RunTest(const FString& Parameters)
+{
+	UBlueprint* Edited = CreateTransientActorBlueprint(TEXT("BP_CompileEdited"));
+	UBlueprint* Clean = CreateTransientActorBlueprint(TEXT("BP_CompileClean"));
+	UBlueprint* Broken = CreateTransientActorBlueprint(TEXT("BP_CompileBroken"));
+	if (!TestNotNull(TEXT("Edited Blueprint"), Edited) || !TestNotNull(TEXT("Clean Blueprint"), Clean) || !TestNotNull(TEXT("Broken Blueprint"), Broken))
+	{
+		return false;
+	}
+	TestTrue(TEXT("Created Blueprints start compiled"), Clean->Status == BS_UpToDate);
+
+	FBlueprintEditorUtils::MarkBlueprintAsModified(Edited);
+
+	// A member of a type the compiler cannot create fails the class layout stage
+	FBPVariableDescription& BadVariable = Broken->NewVariables.AddDefaulted_GetRef();
+	BadVariable.VarName = TEXT("MCPUnknownTypeVariable");
+	BadVariable.VarGuid = FGuid::NewGuid();
+	BadVariable.VarType.PinCategory = TEXT("MCPNotAType");
+	FBlueprintEditorUtils::MarkBlueprintAsModified(Broken);
+	AddExpectedError(TEXT("MCPUnknownTypeVariable"), EAutomationExpectedErrorFlags::Contains, 0);
+
+	TArray<TPair<FString, UBlueprint*>> Targets;
+	Targets.Emplace(TEXT("Edited"), Edited);
+	Targets.Emplace(Edited->GetPathName(), Edited);
+	Targets.Emplace(TEXT("Clean"), Clean);
+	Targets.Emplace(TEXT("Broken"), Broken);
+	Targets.Emplace(TEXT("Missing"), nullptr);
+
+	FBlueprintService& Service = FBlueprintService::Get();
+	FBlueprintBatchCompileResult Batch;
+	TestFalse(TEXT("Batch with failures reports failure"), Service.CompileBlueprints(Targets, true, Batch));
+	if (!TestEqual(TEXT("One result per requested name"), Batch.Results.Num(), Targets.Num()))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Compiled count"), Batch.NumCompiled, 1);
+	TestEqual(TEXT("Skipped count"), Batch.NumSkipped, 2);
+	TestEqual(TEXT("Failed count"), Batch.NumFailed, 2);
+
+	const FBlueprintCompileResult& EditedResult = Batch.Results[0];
+	TestFalse(TEXT("Dirty Blueprint compiled"), EditedResult.bSkipped);
+	TestEqual(TEXT("Dirty Blueprint up to date afterwards"), EditedResult.Status, FString(TEXT("UpToDate")));
+	TestTrue(TEXT("Dirty Blueprint status on the asset"), Edited->Status == BS_UpToDate);
+
+	const FBlueprintCompileResult& AliasResult = Batch.Results[1];
+	TestTrue(TEXT("Second name for the same Blueprint is skipped"), AliasResult.bSkipped);
+	TestTrue(TEXT("Skipped alias has no errors"), AliasResult.Errors.IsEmpty());
+
+	const FBlueprintCompileResult* CleanResult = FindResult(Batch, TEXT("Clean"));
+	TestTrue(TEXT("Up-to-date Blueprint skipped"), CleanResult && CleanResult->bSkipped && CleanResult->Status == TEXT("UpToDate"));
+
+	const FBlueprintCompileResult* BrokenResult = FindResult(Batch, TEXT("Broken"));
+	if (TestNotNull(TEXT("Broken result"), BrokenResult))
+	{
+		TestFalse(TEXT("Broken Blueprint was compiled"), BrokenResult->bSkipped);
+		TestEqual(TEXT("Broken Blueprint status"), BrokenResult->Status, FString(TEXT("Error")));
+		TestFalse(TEXT("Broken Blueprint carries its own errors"), BrokenResult->Errors.IsEmpty());
+	}
+
+	const FBlueprintCompileResult* MissingResult = FindResult(Batch, TEXT("Missing"));
+	if (TestNotNull(TEXT("Missing result"), MissingResult))
+	{
+		TestEqual(TEXT("Missing status"), MissingResult->Status, FString(TEXT("NotFound")));
+		TestTrue(TEXT("Missing error names the entry"), MissingResult->Errors.Num() == 1 && MissingResult->Errors[0].Contains(TEXT("Missing")));
+	}
+	TestTrue(TEXT("Errors do not leak to other entries"), EditedResult.Errors.IsEmpty() && CleanResult && CleanResult->Errors.IsEmpty());
+
+	// Nothing changed since: skip_up_to_date leaves the queue empty, forcing recompiles
+	TArray<TPair<FString, UBlueprint*>> Again;
+	Again.Emplace(TEXT("Edited"), Edited);
+	Again.Emplace(TEXT("Clean"), Clean);
+	TestTrue(TEXT("Up-to-date batch succeeds"), Service.CompileBlueprints(Again, true, Batch));
+	TestEqual(TEXT("Up-to-date batch skips everything"), Batch.NumSkipped, 2);
+	TestEqual(TEXT("Up-to-date batch compiles nothing"), Batch.NumCompiled, 0);
+
+	TestTrue(TEXT("Forced batch succeeds"), Service.CompileBlueprints(Again, false, Batch));
+	TestEqual(TEXT("Forced batch compiles everything"), Batch.NumCompiled, 2);
+	TestEqual(TEXT("Forced batch skips nothing"), Batch.NumSkipped, 0);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -44,6 +44,7 @@ public:
 	virtual bool SetScalarParameter(const FString&, const FString&, float, FString&) override { return false; }
 	virtual bool SetVectorParameter(const FString&, const FString&, const FLinearColor&, FString&) override { return false; }
 	virtual bool SetTextureParameter(const FString&, const FString&, const FString&, FString&) override { return false; }
+	virtual bool BatchSetInstanceParameters(const TArray<FString>&, const FMaterialParameterBatch&, TArray<FMaterialInstanceBatchResult>&, FString&) override { return false; }
 	virtual bool GetScalarParameter(const FString&, const FString&, float&, FString&) override { return false; }
 	virtual bool GetVectorParameter(const FString&, const FString&, FLinearColor&, FString&) override { return false; }
 	virtual bool GetTextureParameter(const FString&, const FString&, FString&, FString&) override { return false; }
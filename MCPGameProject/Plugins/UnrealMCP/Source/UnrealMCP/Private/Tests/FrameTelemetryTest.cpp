@@ -0,0 +1,126 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Services/FrameTelemetry.h"
+
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+FFrameTelemetrySample MakeTelemetrySample(uint64 FrameNumber, float FrameMs, float GameMs = 0.0f, float RenderMs = 0.0f, float GPUMs = 0.0f)
+{
+	FFrameTelemetrySample Sample;
+	Sample.FrameNumber = FrameNumber;
+	Sample.TimestampSeconds = static_cast<double>(FrameNumber) / 60.0;
+	Sample.FrameMs = FrameMs;
+	Sample.GameThreadMs = GameMs;
+	Sample.RenderThreadMs = RenderMs;
+	Sample.GPUMs = GPUMs;
+	return Sample;
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FFrameTelemetryPercentilesTest,
+	"UnrealMCP.Editor.FrameTelemetry.Percentiles",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFrameTelemetryPercentilesTest::RunTest(const FString& Parameters)
+{
+	// 1..100 ms so nearest-rank percentiles are exact
+	TArray<FFrameTelemetrySample> Samples;
+	for (int32 Index = 1; Index <= 100; ++Index)
+	{
+		Samples.Add(MakeTelemetrySample(Index, static_cast<float>(Index)));
+	}
+
+	FFrameTelemetryQuery Query;
+	Query.HitchThresholdMs = 90.0;
+	Query.MaxHitches = 3;
+	const FFrameTelemetryReport Report = FFrameTelemetry::BuildReport(Samples, Query);
+
+	TestEqual(TEXT("Sample count"), Report.SampleCount, 100);
+	TestEqual(TEXT("p50"), Report.FrameMs.P50, 50.0);
+	TestEqual(TEXT("p95"), Report.FrameMs.P95, 95.0);
+	TestEqual(TEXT("p99"), Report.FrameMs.P99, 99.0);
+	TestEqual(TEXT("max"), Report.FrameMs.Max, 100.0);
+	TestEqual(TEXT("Average"), Report.FrameMs.Average, 50.5);
+
+	TestEqual(TEXT("Hitch count covers every frame over the threshold"), Report.HitchCount, 11);
+	TestEqual(TEXT("Only the worst hitches are returned"), Report.Hitches.Num(), 3);
+	if (Report.Hitches.Num() == 3)
+	{
+		TestEqual(TEXT("Hitches are newest first"), Report.Hitches[0].Sample.FrameNumber, static_cast<uint64>(100));
+		TestEqual(TEXT("Third worst hitch kept"), Report.Hitches[2].Sample.FrameNumber, static_cast<uint64>(98));
+	}
+
+	int32 HistogramTotal = 0;
+	for (int32 Count : Report.Histogram)
+	{
+		HistogramTotal += Count;
+	}
+	TestEqual(TEXT("Histogram holds every sample"), HistogramTotal, 100);
+	TestEqual(TEXT("Last histogram bucket is open-ended"), Report.Histogram.Last(), 5);
+
+	const FFrameTelemetryReport EmptyReport = FFrameTelemetry::BuildReport(TArray<FFrameTelemetrySample>(), FFrameTelemetryQuery());
+	TestEqual(TEXT("Empty window has no samples"), EmptyReport.SampleCount, 0);
+	TestEqual(TEXT("Empty window uses the minimum hitch threshold"), EmptyReport.HitchThresholdMs, FFrameTelemetry::MinHitchMs);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FFrameTelemetryHitchAttributionTest,
+	"UnrealMCP.Editor.FrameTelemetry.HitchAttribution",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFrameTelemetryHitchAttributionTest::RunTest(const FString& Parameters)
+{
+	TArray<FFrameTelemetrySample> Samples;
+	for (int32 Index = 0; Index < 60; ++Index)
+	{
+		Samples.Add(MakeTelemetrySample(Index, 16.0f, 10.0f, 8.0f, 12.0f));
+	}
+	Samples.Add(MakeTelemetrySample(60, 80.0f, 75.0f, 8.0f, 12.0f));
+	Samples.Add(MakeTelemetrySample(61, 60.0f, 10.0f, 8.0f, 55.0f));
+
+	const FFrameTelemetryReport Report = FFrameTelemetry::BuildReport(Samples, FFrameTelemetryQuery());
+	TestEqual(TEXT("Automatic threshold floors at the minimum"), Report.HitchThresholdMs, FFrameTelemetry::MinHitchMs);
+	TestEqual(TEXT("Both spikes are hitches"), Report.HitchCount, 2);
+	if (Report.Hitches.Num() == 2)
+	{
+		TestEqual(TEXT("GPU-bound spike"), Report.Hitches[0].BoundBy, FString(TEXT("gpu")));
+		TestEqual(TEXT("Game-thread-bound spike"), Report.Hitches[1].BoundBy, FString(TEXT("game")));
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FFrameTelemetryRingWrapTest,
+	"UnrealMCP.Editor.FrameTelemetry.RingWrap",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFrameTelemetryRingWrapTest::RunTest(const FString& Parameters)
+{
+	FFrameTelemetryRing Ring(6);
+	TestEqual(TEXT("Capacity rounds up to a power of two"), Ring.GetCapacity(), 8u);
+
+	for (int32 Index = 0; Index < 20; ++Index)
+	{
+		Ring.Push(MakeTelemetrySample(Index, 16.0f));
+	}
+
+	TArray<FFrameTelemetrySample> Snapshot;
+	Ring.Snapshot(Snapshot);
+	TestEqual(TEXT("Total pushed is not capped"), Ring.GetTotalPushed(), static_cast<uint64>(20));
+	TestEqual(TEXT("Snapshot keeps the newest frames"), Snapshot.Num(), 8);
+	if (Snapshot.Num() == 8)
+	{
+		TestEqual(TEXT("Oldest retained frame"), Snapshot[0].FrameNumber, static_cast<uint64>(12));
+		TestEqual(TEXT("Newest retained frame"), Snapshot.Last().FrameNumber, static_cast<uint64>(19));
+	}
+
+	Ring.Snapshot(Snapshot, MakeTelemetrySample(17, 0.0f).TimestampSeconds);
+	TestEqual(TEXT("Window filter drops older frames"), Snapshot.Num(), 3);
+	return true;
+}
+
+#endif
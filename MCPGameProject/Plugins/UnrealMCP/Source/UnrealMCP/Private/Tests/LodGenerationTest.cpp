@@ -0,0 +1,246 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Commands/Mesh/AutoGenerateLodsCommand.h"
+#include "Commands/Mesh/SetLodCountCommand.h"
+
+#include "HAL/CriticalSection.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeLock.h"
+#include "Services/LodGenerationService.h"
+#include "Tests/MCPJobTestHelpers.h"
+#include <atomic>
+
+namespace
+{
+/** Pretends every mesh has 1000 triangles and two existing LODs; builds take a few ticks */
+class FFakeLodGenerationBackend final : public ILodGenerationBackend
+{
+public:
+	TArray<FString> Committed;
+	TArray<FString> Saved;
+	FCriticalSection ReduceLock;
+	int32 ReduceCalls = 0;
+	bool bReducedOnGameThread = false;
+	mutable TMap<const FLodGenerationPayload*, int32> BuildPollsLeft;
+
+	/** While set, reductions block on their worker so a test can act with them in flight */
+	std::atomic<bool> bHoldReductions{ false };
+
+	virtual bool PrepareSource(const FLodGenerationRequest& Request, FLodGenerationPayload& Payload, FString& OutError) override
+	{
+		check(IsInGameThread());
+		if (Request.MeshPath.Contains(TEXT("Missing")))
+		{
+			OutError = FString::Printf(TEXT("Mesh not found: %s"), *Request.MeshPath);
+			return false;
+		}
+		Payload.PreviousLodCount = 2;
+		Payload.SourceTriangles = 1000;
+		Payload.PlanLods(Request);
+		return true;
+	}
+
+	virtual bool Reduce(const FLodGenerationRequest& Request, FLodGenerationPayload& Payload, FString& OutError) override
+	{
+		{
+			FScopeLock Lock(&ReduceLock);
+			++ReduceCalls;
+			bReducedOnGameThread |= IsInGameThread();
+		}
+		while (bHoldReductions.load())
+		{
+			FPlatformProcess::Sleep(0.001f);
+		}
+		for (FLodGenerationLodStats& Stats : Payload.Lods)
+		{
+			Stats.Triangles = FMath::RoundToInt(Payload.SourceTriangles * Stats.PercentTriangles);
+		}
+		return true;
+	}
+
+	virtual bool Commit(const FLodGenerationRequest& Request, FLodGenerationPayload& Payload, FString& OutError) override
+	{
+		check(IsInGameThread());
+		Committed.Add(Request.MeshPath);
+		BuildPollsLeft.Add(&Payload, 3);
+		return true;
+	}
+
+	virtual bool IsBuilding(const FLodGenerationPayload& Payload) const override
+	{
+		int32* PollsLeft = BuildPollsLeft.Find(&Payload);
+		return PollsLeft && (*PollsLeft)-- > 0;
+	}
+
+	virtual bool Finalize(const FLodGenerationRequest& Request, FLodGenerationPayload& Payload, FString& OutError) override
+	{
+		check(IsInGameThread());
+		check(!IsBuilding(Payload));
+		Saved.Add(Request.MeshPath);
+		return true;
+	}
+};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FLodGenerationParseTest,
+	"UnrealMCP.Editor.LodGeneration.Parse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FLodGenerationParseTest::RunTest(const FString& Parameters)
+{
+	TArray<FLodGenerationRequest> Requests;
+	FLodGenerationJobOptions Options;
+	FString Error;
+
+	TestTrue(TEXT("auto_generate_lods parses"), FAutoGenerateLodsCommand::ParseParameters(TEXT(R"({
+		"mesh_path": "/Game/Meshes/SM_A",
+		"mesh_paths": ["/Game/Meshes/SM_B", "/Game/Meshes/SM_A"],
+		"reduction_percentages": [1.0, 0.4],
+		"frame_budget_ms": 0,
+		"save": false
+	})"), Requests, Options, Error));
+	if (!TestEqual(TEXT("Duplicate mesh dropped"), Requests.Num(), 2))
+	{
+		return false;
+	}
+	TestEqual(TEXT("LOD count from percentages"), Requests[0].LodCount, 2);
+	TestEqual(TEXT("Explicit percentage"), Requests[1].ResolvePercentTriangles(1), 0.4f);
+	TestFalse(TEXT("Save flag"), Requests[0].bSave);
+	TestFalse(TEXT("Regenerates existing LODs"), Requests[0].bKeepExistingLods);
+	TestEqual(TEXT("Budget clamped"), Options.FrameBudgetMs, 1.0);
+
+	FLodGenerationRequest Defaults;
+	Defaults.LodCount = 4;
+	TestEqual(TEXT("Default spacing"), Defaults.ResolvePercentTriangles(2), 0.5f);
+
+	TestFalse(TEXT("Missing mesh rejected"),
+		FAutoGenerateLodsCommand::ParseParameters(TEXT(R"({"target_lod_count":3})"), Requests, Options, Error));
+	TestFalse(TEXT("LOD count range"),
+		FAutoGenerateLodsCommand::ParseParameters(TEXT(R"({"mesh_path":"/Game/A","target_lod_count":9})"), Requests, Options, Error));
+	TestFalse(TEXT("Percentage range"),
+		FAutoGenerateLodsCommand::ParseParameters(TEXT(R"({"mesh_path":"/Game/A","reduction_percentages":[1.0,0.0]})"), Requests, Options, Error));
+
+	TestTrue(TEXT("set_lod_count parses"),
+		FSetLodCountCommand::ParseParameters(TEXT(R"({"mesh_paths":["/Game/A","/Game/B"],"lod_count":4})"), Requests, Options, Error));
+	if (TestEqual(TEXT("set_lod_count requests"), Requests.Num(), 2))
+	{
+		TestTrue(TEXT("Keeps existing LODs"), Requests[0].bKeepExistingLods);
+		TestEqual(TEXT("New slots halve"), Requests[0].ResolvePercentTriangles(3), 0.125f);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FLodGenerationPipelineTest,
+	"UnrealMCP.Editor.LodGeneration.Pipeline",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FLodGenerationPipelineTest::RunTest(const FString& Parameters)
+{
+	TSharedRef<FFakeLodGenerationBackend> Backend = MakeShared<FFakeLodGenerationBackend>();
+
+	TArray<FLodGenerationRequest> Requests;
+	for (const TCHAR* Path : { TEXT("/Game/SM_A"), TEXT("/Game/SM_Missing"), TEXT("/Game/SM_C"), TEXT("/Game/SM_D") })
+	{
+		FLodGenerationRequest& Request = Requests.AddDefaulted_GetRef();
+		Request.MeshPath = Path;
+		Request.LodCount = 4;
+	}
+	// set_lod_count semantics on the last mesh: LOD1 already exists and is kept
+	Requests[3].bKeepExistingLods = true;
+
+	FLodGenerationJobOptions Options;
+	Options.FrameBudgetMs = 0.0;
+	Options.MaxConcurrentReductions = 2;
+
+	FLodGenerationJob Job(TEXT("test"), MoveTemp(Requests), Options, Backend);
+	const int32 MaxStepsPerTick = MCPJobTest::TickUntilComplete(Job);
+
+	TestTrue(TEXT("Job completes"), Job.IsComplete());
+	TestEqual(TEXT("One game-thread step per tick at zero budget"), MaxStepsPerTick, 1);
+	TestFalse(TEXT("Reduction stays off the game thread"), Backend->bReducedOnGameThread);
+	TestEqual(TEXT("Every found mesh reduced once"), Backend->ReduceCalls, 3);
+	TestEqual(TEXT("Every found mesh committed"), Backend->Committed.Num(), 3);
+	TestEqual(TEXT("Every committed mesh saved"), Backend->Saved.Num(), 3);
+
+	FLodGenerationJobStatus Status;
+	Job.GetStatus(Status, true);
+	TestTrue(TEXT("Status complete"), Status.bComplete);
+	TestEqual(TEXT("Succeeded count"), Status.Count(ELodGenerationState::Succeeded), 3);
+	TestEqual(TEXT("Failed count"), Status.Count(ELodGenerationState::Failed), 1);
+	if (TestEqual(TEXT("Mesh statuses"), Status.Meshes.Num(), 4))
+	{
+		TestFalse(TEXT("Load error reported"), Status.Meshes[1].Error.IsEmpty());
+
+		const FLodGenerationMeshStatus& Regenerated = Status.Meshes[0];
+		if (TestEqual(TEXT("Planned LODs"), Regenerated.Lods.Num(), 4))
+		{
+			TestFalse(TEXT("LOD0 never generated"), Regenerated.Lods[0].bGenerated);
+			TestTrue(TEXT("LOD1 regenerated"), Regenerated.Lods[1].bGenerated);
+			TestEqual(TEXT("LOD2 triangle count"), Regenerated.Lods[2].Triangles, 500);
+		}
+
+		const FLodGenerationMeshStatus& Kept = Status.Meshes[3];
+		if (TestEqual(TEXT("Planned LODs when keeping"), Kept.Lods.Num(), 4))
+		{
+			TestFalse(TEXT("Existing LOD1 kept"), Kept.Lods[1].bGenerated);
+			TestTrue(TEXT("New LOD2 generated"), Kept.Lods[2].bGenerated);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FLodGenerationCancelTest,
+	"UnrealMCP.Editor.LodGeneration.Cancel",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FLodGenerationCancelTest::RunTest(const FString& Parameters)
+{
+	TSharedRef<FFakeLodGenerationBackend> Backend = MakeShared<FFakeLodGenerationBackend>();
+	Backend->bHoldReductions = true;
+
+	TArray<FLodGenerationRequest> Requests;
+	for (const TCHAR* Path : { TEXT("/Game/SM_A"), TEXT("/Game/SM_B"), TEXT("/Game/SM_C") })
+	{
+		FLodGenerationRequest& Request = Requests.AddDefaulted_GetRef();
+		Request.MeshPath = Path;
+		Request.LodCount = 3;
+	}
+
+	FLodGenerationJobOptions Options;
+	Options.MaxConcurrentReductions = 2;
+
+	FLodGenerationJob Job(TEXT("test"), MoveTemp(Requests), Options, Backend);
+
+	// Two reductions start and block on their workers
+	Job.Tick();
+	FLodGenerationJobStatus Status;
+	Job.GetStatus(Status, false);
+	TestEqual(TEXT("Reductions in flight"), Status.Count(ELodGenerationState::Reducing), 2);
+
+	Job.Cancel();
+	Job.Tick();
+	Job.GetStatus(Status, false);
+	TestFalse(TEXT("Not complete while reductions are in flight"), Status.bComplete);
+	TestEqual(TEXT("Queued mesh failed at once"), Status.Count(ELodGenerationState::Failed), 1);
+
+	Backend->bHoldReductions = false;
+	MCPJobTest::TickUntilComplete(Job);
+
+	Job.GetStatus(Status, true);
+	TestTrue(TEXT("Cancelled job completes"), Status.bComplete);
+	TestEqual(TEXT("Every mesh failed"), Status.Count(ELodGenerationState::Failed), 3);
+	TestEqual(TEXT("Nothing committed after the cancel"), Backend->Committed.Num(), 0);
+	for (const FLodGenerationMeshStatus& Mesh : Status.Meshes)
+	{
+		TestEqual(TEXT("Cancelled error"), Mesh.Error, FString(TEXT("Cancelled")));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
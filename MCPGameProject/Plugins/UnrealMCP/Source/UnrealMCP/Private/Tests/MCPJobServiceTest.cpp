@@ -0,0 +1,109 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Commands/Editor/CancelJobCommand.h"
+#include "Commands/Editor/GetJobStatusCommand.h"
+
+#include "Dom/JsonObject.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Services/MCPJobService.h"
+
+namespace
+{
+TSharedPtr<FJsonObject> ParseResponse(const FString& Response)
+{
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response);
+	FJsonSerializer::Deserialize(Reader, JsonObject);
+	return JsonObject;
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPJobServiceLifecycleTest,
+	"UnrealMCP.Editor.MCPJobService.Lifecycle",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMCPJobServiceLifecycleTest::RunTest(const FString& Parameters)
+{
+	FMCPJobService& Service = FMCPJobService::Get();
+
+	const FString JobId = Service.CreateJob(TEXT("compile_blueprints"));
+	TestTrue(TEXT("Generated id"), JobId.StartsWith(TEXT("job_")));
+
+	Service.ReportProgress(JobId, 2.0f, TEXT("halfway"));
+	FMCPJobSnapshot Snapshot;
+	if (!TestTrue(TEXT("Job found"), Service.GetJob(JobId, Snapshot)))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Running"), Snapshot.State, EMCPJobState::Running);
+	TestEqual(TEXT("Progress clamped"), Snapshot.Progress, 1.0f);
+	TestTrue(TEXT("No result while running"), Snapshot.Result.IsEmpty());
+
+	Service.Complete(JobId, TEXT(R"({"status":"success","result":{"compiled":3}})"), true);
+	Service.GetJob(JobId, Snapshot);
+	TestEqual(TEXT("Succeeded"), Snapshot.State, EMCPJobState::Succeeded);
+
+	FGetJobStatusCommand GetStatus;
+	TSharedPtr<FJsonObject> Status = ParseResponse(GetStatus.Execute(FString::Printf(TEXT(R"({"job_id":"%s"})"), *JobId)));
+	const TSharedPtr<FJsonObject>* StoredResponse = nullptr;
+	if (TestTrue(TEXT("Status parses"), Status.IsValid()))
+	{
+		TestEqual(TEXT("Status state"), Status->GetStringField(TEXT("state")), FString(TEXT("succeeded")));
+		TestTrue(TEXT("Stored response returned"), Status->TryGetObjectField(TEXT("response"), StoredResponse));
+	}
+
+	FString Error;
+	TestFalse(TEXT("Finished job cannot be cancelled"), Service.Cancel(JobId, Error));
+	TestFalse(TEXT("Unknown job"), Service.GetJob(TEXT("job_does_not_exist"), Snapshot));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPJobServiceCancelTest,
+	"UnrealMCP.Editor.MCPJobService.Cancel",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMCPJobServiceCancelTest::RunTest(const FString& Parameters)
+{
+	FMCPJobService& Service = FMCPJobService::Get();
+
+	int32 CancelCalls = 0;
+	const FString JobId = FString::Printf(TEXT("test_job_%d"), FMath::Rand());
+	Service.RegisterJob(JobId, TEXT("bulk_import"), [&CancelCalls]() { ++CancelCalls; });
+
+	FCancelJobCommand CancelCommand;
+	TSharedPtr<FJsonObject> Response = ParseResponse(CancelCommand.Execute(FString::Printf(TEXT(R"({"job_id":"%s"})"), *JobId)));
+	TestTrue(TEXT("Cancel succeeds"), Response.IsValid() && Response->GetBoolField(TEXT("success")));
+	TestEqual(TEXT("Handler runs once on the game thread"), CancelCalls, 1);
+	TestTrue(TEXT("Cancel flag visible"), Service.IsCancelRequested(JobId));
+
+	// A late result is kept but does not resurrect the job
+	Service.Complete(JobId, TEXT(R"({"status":"success","result":{}})"), true);
+	FMCPJobSnapshot Snapshot;
+	Service.GetJob(JobId, Snapshot);
+	TestEqual(TEXT("Stays cancelled"), Snapshot.State, EMCPJobState::Cancelled);
+	TestFalse(TEXT("Late result kept"), Snapshot.Result.IsEmpty());
+
+	FString Error;
+	TestFalse(TEXT("Second cancel rejected"), Service.Cancel(JobId, Error));
+	TestEqual(TEXT("Handler not rerun"), CancelCalls, 1);
+
+	// Eviction drops the oldest finished jobs only
+	const FString RunningId = Service.CreateJob(TEXT("long_running"));
+	for (int32 Index = 0; Index < 100; ++Index)
+	{
+		const FString FinishedId = Service.CreateJob(TEXT("short"));
+		Service.Complete(FinishedId, TEXT(R"({"status":"success","result":{}})"), true);
+	}
+	TestTrue(TEXT("Running job never evicted"), Service.GetJob(RunningId, Snapshot));
+	TestFalse(TEXT("Oldest finished job evicted"), Service.GetJob(JobId, Snapshot));
+	Service.Complete(RunningId, TEXT(R"({"status":"error","error":"stopped"})"), false);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
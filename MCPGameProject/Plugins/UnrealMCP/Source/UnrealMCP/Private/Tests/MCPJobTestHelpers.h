@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformProcess.h"
+
+namespace MCPJobTest
+{
+/**
+ * Tick a job directly (no core ticker) until it completes or the timeout passes
+ * @return The largest value Tick() returned, i.e. the most game-thread steps run in one tick
+ */
+template <typename JobType>
+int32 TickUntilComplete(JobType& Job, double TimeoutSeconds = 10.0)
+{
+	int32 MaxPerTick = 0;
+	const double Deadline = FPlatformTime::Seconds() + TimeoutSeconds;
+	while (!Job.IsComplete() && FPlatformTime::Seconds() < Deadline)
+	{
+		MaxPerTick = FMath::Max(MaxPerTick, Job.Tick());
+		FPlatformProcess::Sleep(0.001f);
+	}
+	return MaxPerTick;
+}
+}
@@ -0,0 +1,154 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Commands/Editor/GetMeshDrawStatsCommand.h"
+
+#include "Dom/JsonObject.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Services/IMeshDrawStatsCaptureBackend.h"
+
+namespace
+{
+const ANSICHAR* const MeshDrawStatsCsv =
+	"Pass,VisiblePrimitiveCount,VisibleVertices,VisibleInstances,Category,ResourceName,LODIndex,SegmentIndex,MaterialName,PrimitiveCount,VertexCount,TotalInstanceCount,TotalPrimitiveCount,TotalVertexCount\r\n"
+	"BasePass,1000,3000,10,StaticMesh,SM_Rock,0,0,M_Rock,100,300,10,1000,3000\r\n"
+	"BasePass,400,1200,4,StaticMesh,SM_Tree,1,0,M_Foliage,100,300,4,400,1200\r\n"
+	"DepthPass,1000,3000,10,StaticMesh,SM_Rock,0,0,M_Rock,100,300,10,1000,3000\r\n"
+	"BasePass,50,150,1,StaticMesh,SM_Bush,0,0,M_Foliage,50,150,1,50,150\r\n"
+	"\r\n";
+
+TArray64<uint8> MakeCsvBytes(const ANSICHAR* Csv)
+{
+	TArray64<uint8> Bytes;
+	Bytes.Append(reinterpret_cast<const uint8*>(Csv), FCStringAnsi::Strlen(Csv));
+	return Bytes;
+}
+
+class FFakeMeshDrawStatsBackend final : public IMeshDrawStatsCaptureBackend
+{
+public:
+	int32 RequestCalls = 0;
+	bool bCaptureReady = false;
+
+	virtual void RequestCapture() override
+	{
+		++RequestCalls;
+	}
+
+	virtual TSharedPtr<FMeshDrawStatsCapture> TryTakeCapture() override
+	{
+		if (!bCaptureReady)
+		{
+			return nullptr;
+		}
+		bCaptureReady = false;
+		TSharedPtr<FMeshDrawStatsCapture> Capture = MakeShared<FMeshDrawStatsCapture>();
+		Capture->Bytes = MakeCsvBytes(MeshDrawStatsCsv);
+		return Capture;
+	}
+};
+
+TSharedPtr<FJsonObject> ParseMeshDrawResponse(const FString& Json)
+{
+	TSharedPtr<FJsonObject> Result;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+	FJsonSerializer::Deserialize(Reader, Result);
+	return Result;
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMeshDrawStatsParseTest,
+	"UnrealMCP.Editor.MeshDrawStats.Parse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMeshDrawStatsParseTest::RunTest(const FString& Parameters)
+{
+	FMeshDrawStatsTable Table;
+	FString Error;
+	TestTrue(TEXT("Dump parses"), FMeshDrawStatsTable::Parse(MakeCsvBytes(MeshDrawStatsCsv), Table, Error));
+	TestEqual(TEXT("Blank lines are skipped"), Table.Num(), 4);
+	if (Table.Num() == 4)
+	{
+		TestEqual(TEXT("Resource is interned"), Table.Names[Table.Resource[0]], FString(TEXT("SM_Rock")));
+		TestEqual(TEXT("Repeated names share an id"), Table.Resource[0], Table.Resource[2]);
+		TestEqual(TEXT("Material column"), Table.Names[Table.Material[1]], FString(TEXT("M_Foliage")));
+		TestEqual(TEXT("LOD column"), Table.LODIndex[1], 1);
+		TestEqual(TEXT("Visible primitives"), Table.VisiblePrimitives[0], static_cast<int64>(1000));
+		TestEqual(TEXT("Trailing carriage return is trimmed"), Table.TotalVertices[3], static_cast<int64>(150));
+	}
+
+	TestFalse(TEXT("Headerless data is rejected"), FMeshDrawStatsTable::Parse(MakeCsvBytes("1,2,3\n"), Table, Error));
+	TestFalse(TEXT("Empty dump is rejected"), FMeshDrawStatsTable::Parse(TArray64<uint8>(), Table, Error));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMeshDrawStatsAggregateTest,
+	"UnrealMCP.Editor.MeshDrawStats.Aggregate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMeshDrawStatsAggregateTest::RunTest(const FString& Parameters)
+{
+	FMeshDrawStatsTable Table;
+	FString Error;
+	FMeshDrawStatsTable::Parse(MakeCsvBytes(MeshDrawStatsCsv), Table, Error);
+
+	FMeshDrawStatsQuery Query;
+	Query.GroupBy = EMeshDrawStatsGroupBy::Resource;
+	FMeshDrawStatsSummary Summary = AggregateMeshDrawStats(Table, Query);
+	TestEqual(TEXT("Every entry matches without a filter"), Summary.MatchedEntries, 4);
+	TestEqual(TEXT("Three resources"), Summary.GroupCount, 3);
+	TestEqual(TEXT("Totals cover all entries"), Summary.TotalVisiblePrimitives, static_cast<int64>(2450));
+	if (Summary.Rows.Num() == 3)
+	{
+		TestEqual(TEXT("Rock ranks first"), Summary.Rows[0].Resource, FString(TEXT("SM_Rock")));
+		TestEqual(TEXT("Rock sums both passes"), Summary.Rows[0].VisiblePrimitives, static_cast<int64>(2000));
+		TestEqual(TEXT("Rock entry count"), Summary.Rows[0].EntryCount, 2);
+		TestEqual(TEXT("Bush ranks last"), Summary.Rows[2].Resource, FString(TEXT("SM_Bush")));
+	}
+
+	Query.GroupBy = EMeshDrawStatsGroupBy::Material;
+	Query.TopN = 1;
+	Summary = AggregateMeshDrawStats(Table, Query);
+	TestEqual(TEXT("Two materials"), Summary.GroupCount, 2);
+	TestEqual(TEXT("Top-N keeps one row"), Summary.Rows.Num(), 1);
+	TestEqual(TEXT("Heaviest material kept"), Summary.Rows.Num() == 1 ? Summary.Rows[0].Material : FString(), FString(TEXT("M_Rock")));
+
+	Query.GroupBy = EMeshDrawStatsGroupBy::Entry;
+	Query.TopN = 100;
+	Query.MeshFilter = TEXT("tree");
+	Summary = AggregateMeshDrawStats(Table, Query);
+	TestEqual(TEXT("Filter is case-insensitive"), Summary.MatchedEntries, 1);
+	TestEqual(TEXT("Entry rows keep their LOD"), Summary.Rows.Num() == 1 ? Summary.Rows[0].LODIndex : -1, 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMeshDrawStatsCommandPendingTest,
+	"UnrealMCP.Editor.MeshDrawStats.PendingThenReady",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMeshDrawStatsCommandPendingTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FFakeMeshDrawStatsBackend> Backend = MakeShared<FFakeMeshDrawStatsBackend>();
+	FGetMeshDrawStatsCommand Command(Backend);
+
+	TSharedPtr<FJsonObject> Result = ParseMeshDrawResponse(Command.Execute(TEXT("{}")));
+	TestTrue(TEXT("First call reports pending"), Result && Result->GetBoolField(TEXT("stats_pending")));
+	TestEqual(TEXT("First call requests a capture"), Backend->RequestCalls, 1);
+
+	Backend->bCaptureReady = true;
+	Result = ParseMeshDrawResponse(Command.Execute(TEXT(R"({"group_by":"pass","top_n":5})")));
+	TestTrue(TEXT("Second call succeeds"), Result && Result->GetBoolField(TEXT("success")));
+	TestFalse(TEXT("Second call is not pending"), Result && Result->HasField(TEXT("stats_pending")));
+	TestEqual(TEXT("Grouped by pass"), Result ? Result->GetStringField(TEXT("group_by")) : FString(), FString(TEXT("pass")));
+	TestEqual(TEXT("Two passes"), Result ? static_cast<int32>(Result->GetNumberField(TEXT("group_count"))) : 0, 2);
+	TestEqual(TEXT("No extra capture requested"), Backend->RequestCalls, 1);
+
+	TestFalse(TEXT("Unknown group_by is rejected"), Command.ValidateParams(TEXT(R"({"group_by":"shader"})")));
+	return true;
+}
+
+#endif
@@ -0,0 +1,93 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Services/MetaSoundPaletteIndex.h"
+
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+FMetaSoundPaletteEntry MakeEntry(const FString& Name, const FString& Variant, const FString& DisplayName, const FString& Category, const FString& Description)
+{
+	FMetaSoundPaletteEntry Entry;
+	Entry.Namespace = TEXT("UE");
+	Entry.Name = Name;
+	Entry.Variant = Variant;
+	Entry.DisplayName = DisplayName;
+	Entry.Category = Category;
+	Entry.Description = Description;
+	Entry.Inputs.Emplace(TEXT("Frequency"), TEXT("Float"));
+	Entry.Outputs.Emplace(TEXT("Audio"), TEXT("Audio"));
+	return Entry;
+}
+
+TArray<FString> Names(const TArray<TSharedPtr<FJsonObject>>& Results)
+{
+	TArray<FString> Out;
+	for (const TSharedPtr<FJsonObject>& Result : Results)
+	{
+		Out.Add(Result->GetStringField(TEXT("full_name")));
+	}
+	return Out;
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMetaSoundPaletteIndexSearchTest,
+	"UnrealMCP.Editor.MetaSoundPaletteIndex.Search",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetaSoundPaletteIndexSearchTest::RunTest(const FString& Parameters)
+{
+	FMetaSoundPaletteIndex& Index = FMetaSoundPaletteIndex::Get();
+
+	TArray<FMetaSoundPaletteEntry> Entries;
+	Entries.Add(MakeEntry(TEXT("ADSR Envelope"), TEXT("Audio"), TEXT("ADSR Envelope (Audio)"), TEXT("Envelopes"), TEXT("Attack decay sustain release")));
+	Entries.Add(MakeEntry(TEXT("Sine"), TEXT("Audio"), TEXT("Sine"), TEXT("Generators > Oscillators"), TEXT("Emits a sine wave")));
+	Entries.Add(MakeEntry(TEXT("TriggerRepeat"), FString(), TEXT("Trigger Repeat"), TEXT("Triggers"), TEXT("Repeats a trigger at a rate")));
+	Entries.Add(MakeEntry(TEXT("LFO"), FString(), TEXT("LFO"), TEXT("Modulation"), TEXT("Low frequency oscillator, often a sine")));
+	Index.Build(Entries);
+
+	TestEqual(TEXT("All entries indexed"), Index.Num(), 4);
+	TestEqual(TEXT("Empty query lists everything"), Index.Search(FString(), 0).Num(), 4);
+	TestEqual(TEXT("Max results honoured"), Index.Search(FString(), 2).Num(), 2);
+
+	const TArray<FString> Sine = Names(Index.Search(TEXT("sine"), 0));
+	if (TestEqual(TEXT("Name and description matches"), Sine.Num(), 2))
+	{
+		TestEqual(TEXT("Name match ranks first"), Sine[0], FString(TEXT("UE::Sine (Audio)")));
+	}
+
+	TestEqual(TEXT("Category word"), Names(Index.Search(TEXT("oscillators"), 0))[0], FString(TEXT("UE::Sine (Audio)")));
+	TestEqual(TEXT("CamelCase part of a name"), Index.Search(TEXT("repeat"), 0).Num(), 1);
+	TestEqual(TEXT("Prefix match"), Index.Search(TEXT("env"), 0).Num(), 1);
+	TestEqual(TEXT("Substring inside a word"), Index.Search(TEXT("illator"), 0).Num(), 2);
+	TestEqual(TEXT("Every word must match"), Index.Search(TEXT("sine modulation"), 0).Num(), 1);
+	TestEqual(TEXT("Case ignored"), Index.Search(TEXT("LFO"), 0).Num(), 1);
+	TestEqual(TEXT("No match"), Index.Search(TEXT("granular"), 0).Num(), 0);
+
+	const TSharedPtr<FJsonObject> First = Index.Search(TEXT("trigger repeat"), 1)[0];
+	TestEqual(TEXT("Display name kept"), First->GetStringField(TEXT("display_name")), FString(TEXT("Trigger Repeat")));
+	TestEqual(TEXT("Pins kept"), First->GetArrayField(TEXT("inputs")).Num(), 1);
+
+	// Leave the real palette to be rebuilt from the registry
+	Index.Invalidate();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMetaSoundPaletteIndexTokenizeTest,
+	"UnrealMCP.Editor.MetaSoundPaletteIndex.Tokenize",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetaSoundPaletteIndexTokenizeTest::RunTest(const FString& Parameters)
+{
+	TArray<FString> Tokens;
+	FMetaSoundPaletteIndex::Tokenize(TEXT("Generators > WaveTable Player"), Tokens);
+	TestTrue(TEXT("Lowercased words"), Tokens.Contains(TEXT("generators")));
+	TestTrue(TEXT("Whole CamelCase word"), Tokens.Contains(TEXT("wavetable")));
+	TestTrue(TEXT("CamelCase parts"), Tokens.Contains(TEXT("wave")) && Tokens.Contains(TEXT("table")));
+	TestFalse(TEXT("Separators dropped"), Tokens.Contains(TEXT(">")));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,112 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Services/MetadataResponseCache.h"
+
+#include "Materials/Material.h"
+#include "Materials/MaterialInstanceConstant.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/Package.h"
+
+namespace
+{
+TSharedPtr<FJsonObject> ParseResponse(const FString& Response)
+{
+	TSharedPtr<FJsonObject> Object;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response);
+	FJsonSerializer::Deserialize(Reader, Object);
+	return Object;
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMetadataResponseCacheETagTest,
+	"UnrealMCP.Editor.MetadataResponseCache.ETag",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetadataResponseCacheETagTest::RunTest(const FString& Parameters)
+{
+	FMetadataResponseCache& Cache = FMetadataResponseCache::Get();
+	UPackage* Asset = CreatePackage(TEXT("/Temp/UnrealMCP_MetadataResponseCacheTest"));
+
+	int32 Builds = 0;
+	auto Build = [&Builds]()
+	{
+		++Builds;
+		TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
+		Response->SetBoolField(TEXT("success"), true);
+		Response->SetNumberField(TEXT("build"), Builds);
+		return Response;
+	};
+
+	const FString Request = TEXT(R"({"blueprint_name":"BP_Test","fields":["components"]})");
+	TSharedPtr<FJsonObject> First = ParseResponse(Cache.Serve(TEXT("test_metadata"), Request, Asset, Build));
+	FString ETag;
+	TestTrue(TEXT("Response carries an etag"), First.IsValid() && First->TryGetStringField(TEXT("etag"), ETag));
+
+	Cache.Serve(TEXT("test_metadata"), TEXT(R"({"fields":["components"],"blueprint_name":"BP_Test"})"), Asset, Build);
+	TestEqual(TEXT("Same request in another key order is served from cache"), Builds, 1);
+
+	const FString Conditional = FString::Printf(TEXT(R"({"blueprint_name":"BP_Test","fields":["components"],"if_none_match":"%s"})"), *ETag);
+	TSharedPtr<FJsonObject> NotModified = ParseResponse(Cache.Serve(TEXT("test_metadata"), Conditional, Asset, Build));
+	TestTrue(TEXT("Matching etag replies not_modified"), NotModified.IsValid() && NotModified->GetBoolField(TEXT("not_modified")));
+	TestFalse(TEXT("not_modified omits the payload"), NotModified.IsValid() && NotModified->HasField(TEXT("build")));
+
+	Cache.Serve(TEXT("test_metadata"), TEXT(R"({"blueprint_name":"BP_Test","fields":["variables"]})"), Asset, Build);
+	TestEqual(TEXT("Different field set is a separate entry"), Builds, 2);
+
+	// The same notification an editor edit sends
+	Asset->MarkPackageDirty();
+	TestNotEqual(TEXT("Marking the package dirty moves the etag"), Cache.MakeETag(TEXT("test_metadata"), Request, Asset), ETag);
+	TSharedPtr<FJsonObject> Changed = ParseResponse(Cache.Serve(TEXT("test_metadata"), Conditional, Asset, Build));
+	TestEqual(TEXT("Stale etag gets a rebuilt response"), Builds, 3);
+	TestFalse(TEXT("Stale etag is not not_modified"), Changed.IsValid() && Changed->HasField(TEXT("not_modified")));
+
+	int32 FailedBuilds = 0;
+	auto Fail = [&FailedBuilds]()
+	{
+		++FailedBuilds;
+		TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
+		Response->SetBoolField(TEXT("success"), false);
+		Response->SetStringField(TEXT("error"), TEXT("Failed to retrieve metadata"));
+		return Response;
+	};
+	Cache.Serve(TEXT("test_failing"), Request, Asset, Fail);
+	TSharedPtr<FJsonObject> Failed = ParseResponse(Cache.Serve(TEXT("test_failing"), Request, Asset, Fail));
+	TestEqual(TEXT("Failures are not cached"), FailedBuilds, 2);
+	TestFalse(TEXT("Failures carry no etag"), Failed.IsValid() && Failed->HasField(TEXT("etag")));
+
+	Cache.Reset();
+	TestEqual(TEXT("Reset drops entries"), Cache.Num(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMetadataResponseCacheDependencyTest,
+	"UnrealMCP.Editor.MetadataResponseCache.Dependencies",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetadataResponseCacheDependencyTest::RunTest(const FString& Parameters)
+{
+	FMetadataResponseCache& Cache = FMetadataResponseCache::Get();
+	UMaterial* Parent = NewObject<UMaterial>(CreatePackage(TEXT("/Temp/UnrealMCP_MetadataCacheParent")), TEXT("M_Parent"), RF_Transient);
+	UMaterialInstanceConstant* Instance = NewObject<UMaterialInstanceConstant>(CreatePackage(TEXT("/Temp/UnrealMCP_MetadataCacheInstance")), TEXT("MI_Child"), RF_Transient);
+	Instance->SetParentEditorOnly(Parent);
+
+	const FString Request = TEXT(R"({"material_path":"/Temp/UnrealMCP_MetadataCacheInstance"})");
+	const TArray<const UObject*> Dependencies = { Parent };
+	const FString InstanceOnly = Cache.MakeETag(TEXT("test_material"), Request, Instance);
+	const FString WithParent = Cache.MakeETag(TEXT("test_material"), Request, Instance, Dependencies);
+
+	// Modify() broadcasts OnObjectModified for the parent's package only
+	Parent->Modify();
+	TestEqual(TEXT("Parent edit does not touch the instance's own package"), Cache.MakeETag(TEXT("test_material"), Request, Instance), InstanceOnly);
+	TestNotEqual(TEXT("Parent edit moves the etag of a response that depends on it"), Cache.MakeETag(TEXT("test_material"), Request, Instance, Dependencies), WithParent);
+
+	const FString AfterParentEdit = Cache.MakeETag(TEXT("test_material"), Request, Instance, Dependencies);
+	Instance->Modify();
+	TestNotEqual(TEXT("Instance edit moves its etag"), Cache.MakeETag(TEXT("test_material"), Request, Instance, Dependencies), AfterParentEdit);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
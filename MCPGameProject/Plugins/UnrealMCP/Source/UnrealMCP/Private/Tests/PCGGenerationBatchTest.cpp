@@ -0,0 +1,224 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Commands/PCG/ExecutePCGGraphCommand.h"
+
+#include "Containers/Ticker.h"
+#include "Misc/AutomationTest.h"
+#include "PCGComponent.h"
+#include "Services/PCGGenerationBatch.h"
+#include "UObject/Package.h"
+
+namespace
+{
+/** Records scheduled components per listener; the test decides when each one finishes */
+class FFakePCGGenerationBackend final : public IPCGGenerationBackend
+{
+public:
+	TMap<UPCGComponent*, TMap<const void*, TFunction<void(bool)>>> Scheduled;
+	TArray<UPCGComponent*> Cancelled;
+	TArray<UPCGComponent*> Untracked;
+	UPCGComponent* FailToSchedule = nullptr;
+
+	virtual bool StartGeneration(UPCGComponent& Component, const FPCGGenerationOptions& Options, const void* Listener, TFunction<void(bool bGenerated)> OnFinished, FString& OutError) override
+	{
+		if (&Component == FailToSchedule)
+		{
+			OutError = TEXT("PCG Component has no graph assigned");
+			return false;
+		}
+		Scheduled.FindOrAdd(&Component).Add(Listener, MoveTemp(OnFinished));
+		return true;
+	}
+
+	virtual void CollectStats(UPCGComponent& Component, const FPCGGenerationOptions& Options, FPCGComponentGenerationResult& OutResult) override
+	{
+		OutResult.OutputPoints = 100;
+		if (Options.bCollectNodeStats)
+		{
+			FPCGNodeExecutionStats& Stats = OutResult.Nodes.AddDefaulted_GetRef();
+			Stats.NodeName = TEXT("SurfaceSampler");
+			Stats.Executions = 1;
+			Stats.OutputPoints = 100;
+		}
+	}
+
+	virtual void CancelGeneration(UPCGComponent& Component) override
+	{
+		Cancelled.Add(&Component);
+	}
+
+	virtual void StopTracking(UPCGComponent& Component, const void* Listener) override
+	{
+		Untracked.Add(&Component);
+	}
+
+	void Finish(UPCGComponent* Component, bool bGenerated)
+	{
+		TArray<TFunction<void(bool)>> Listeners;
+		if (const TMap<const void*, TFunction<void(bool)>>* ComponentListeners = Scheduled.Find(Component))
+		{
+			ComponentListeners->GenerateValueArray(Listeners);
+		}
+		for (const TFunction<void(bool)>& OnFinished : Listeners)
+		{
+			OnFinished(bGenerated);
+		}
+	}
+};
+
+TArray<UPCGComponent*> MakeComponents(int32 Count)
+{
+	TArray<UPCGComponent*> Components;
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		Components.Add(NewObject<UPCGComponent>(GetTransientPackage()));
+	}
+	return Components;
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGGenerationBatchCompletionTest,
+	"UnrealMCP.Editor.PCGGeneration.Completion",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPCGGenerationBatchCompletionTest::RunTest(const FString& Parameters)
+{
+	TSharedRef<FFakePCGGenerationBackend> Backend = MakeShared<FFakePCGGenerationBackend>();
+	const TArray<UPCGComponent*> Components = MakeComponents(4);
+	Backend->FailToSchedule = Components[1];
+
+	int32 CompleteCalls = 0;
+	TWeakPtr<FPCGGenerationBatch> WeakBatch;
+	{
+		TSharedRef<FPCGGenerationBatch> Batch = MakeShared<FPCGGenerationBatch>(Components, FPCGGenerationOptions(), Backend);
+		WeakBatch = Batch;
+		Batch->Start([&CompleteCalls](const FPCGGenerationBatch&) { ++CompleteCalls; });
+	}
+
+	TestEqual(TEXT("Every schedulable component started at once"), Backend->Scheduled.Num(), 3);
+	TestTrue(TEXT("Batch keeps itself alive while generating"), WeakBatch.IsValid());
+
+	Backend->Finish(Components[0], true);
+	Backend->Finish(Components[2], false);
+	TestEqual(TEXT("Not complete while one is generating"), CompleteCalls, 0);
+
+	// A duplicate notification must not finish the batch early
+	Backend->Finish(Components[0], true);
+	TestEqual(TEXT("Duplicate notification ignored"), CompleteCalls, 0);
+
+	TSharedPtr<FPCGGenerationBatch> Batch = WeakBatch.Pin();
+	Backend->Finish(Components[3], true);
+	TestEqual(TEXT("Completes once"), CompleteCalls, 1);
+
+	if (TestTrue(TEXT("Batch still referenced"), Batch.IsValid()))
+	{
+		const TArray<FPCGComponentGenerationResult>& Results = Batch->GetResults();
+		TestEqual(TEXT("Generated"), Batch->Count(EPCGGenerationState::Generated), 2);
+		TestEqual(TEXT("Cancelled"), Batch->Count(EPCGGenerationState::Cancelled), 1);
+		TestEqual(TEXT("Failed"), Batch->Count(EPCGGenerationState::Failed), 1);
+		TestFalse(TEXT("Schedule error kept"), Results[1].Error.IsEmpty());
+		TestEqual(TEXT("Output points collected"), Results[0].OutputPoints, 100);
+		TestEqual(TEXT("Node stats collected"), Results[3].Nodes.Num(), 1);
+		TestEqual(TEXT("No stats for cancelled"), Results[2].OutputPoints, 0);
+	}
+	TestEqual(TEXT("Subscriptions dropped for every finished component"), Backend->Untracked.Num(), 3);
+
+	Batch.Reset();
+	TestFalse(TEXT("Released after completion"), WeakBatch.IsValid());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGGenerationBatchSharedComponentTest,
+	"UnrealMCP.Editor.PCGGeneration.SharedComponent",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPCGGenerationBatchSharedComponentTest::RunTest(const FString& Parameters)
+{
+	TSharedRef<FFakePCGGenerationBackend> Backend = MakeShared<FFakePCGGenerationBackend>();
+	const TArray<UPCGComponent*> Components = MakeComponents(2);
+
+	// A second batch tracking a component the first one is still waiting for
+	TSharedRef<FPCGGenerationBatch> First = MakeShared<FPCGGenerationBatch>(Components, FPCGGenerationOptions(), Backend);
+	TSharedRef<FPCGGenerationBatch> Second = MakeShared<FPCGGenerationBatch>(TArray<UPCGComponent*>{ Components[1] }, FPCGGenerationOptions(), Backend);
+	First->Start(nullptr);
+	Second->Start(nullptr);
+	TestEqual(TEXT("Each batch subscribed separately"), Backend->Scheduled.FindRef(Components[1]).Num(), 2);
+
+	Backend->Finish(Components[1], true);
+	TestTrue(TEXT("Second batch completed"), Second->IsComplete());
+	TestFalse(TEXT("First batch still waits for its other component"), First->IsComplete());
+	TestEqual(TEXT("First batch saw the shared component finish"), First->Count(EPCGGenerationState::Generated), 1);
+
+	Backend->Finish(Components[0], true);
+	TestTrue(TEXT("First batch completed without a timeout"), First->IsComplete());
+	TestEqual(TEXT("Both components generated"), First->Count(EPCGGenerationState::Generated), 2);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGGenerationBatchTimeoutTest,
+	"UnrealMCP.Editor.PCGGeneration.Timeout",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPCGGenerationBatchTimeoutTest::RunTest(const FString& Parameters)
+{
+	TSharedRef<FFakePCGGenerationBackend> Backend = MakeShared<FFakePCGGenerationBackend>();
+	const TArray<UPCGComponent*> Components = MakeComponents(2);
+
+	FPCGGenerationOptions Options;
+	Options.TimeoutSeconds = 0.05;
+	TSharedRef<FPCGGenerationBatch> Batch = MakeShared<FPCGGenerationBatch>(Components, Options, Backend);
+	Batch->Start(nullptr);
+	Backend->Finish(Components[0], true);
+
+	const double Deadline = FPlatformTime::Seconds() + 5.0;
+	while (!Batch->IsComplete() && FPlatformTime::Seconds() < Deadline)
+	{
+		FPlatformProcess::Sleep(0.05f);
+		FTSTicker::GetCoreTicker().Tick(0.05f);
+	}
+
+	TestTrue(TEXT("Timeout completes the batch"), Batch->IsComplete());
+	TestEqual(TEXT("Finished component kept"), Batch->Count(EPCGGenerationState::Generated), 1);
+	TestEqual(TEXT("Timed out component failed"), Batch->Count(EPCGGenerationState::Failed), 1);
+	TestTrue(TEXT("Timed out generation cancelled"), Backend->Cancelled.Contains(Components[1]));
+
+	// A notification arriving after the timeout changes nothing
+	Backend->Finish(Components[1], true);
+	TestEqual(TEXT("Late notification ignored"), Batch->Count(EPCGGenerationState::Generated), 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FExecutePCGGraphParseTest,
+	"UnrealMCP.Editor.PCGGeneration.Parse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FExecutePCGGraphParseTest::RunTest(const FString& Parameters)
+{
+	TArray<FString> ActorNames;
+	FPCGGenerationOptions Options;
+	bool bWait = false;
+	FString Error;
+
+	TestTrue(TEXT("Single actor"), FExecutePCGGraphCommand::ParseParameters(
+		TEXT(R"({"actor_name":"Forest"})"), ActorNames, Options, bWait, Error));
+	TestTrue(TEXT("Waits by default"), bWait);
+	TestTrue(TEXT("Force by default"), Options.bForce);
+
+	TestTrue(TEXT("Several actors"), FExecutePCGGraphCommand::ParseParameters(
+		TEXT(R"({"actor_name":"Forest","actor_names":["Rocks","Forest"],"force":false,"timeout_seconds":0,"wait_for_completion":false})"),
+		ActorNames, Options, bWait, Error));
+	TestEqual(TEXT("Duplicates dropped"), ActorNames.Num(), 2);
+	TestFalse(TEXT("Force flag"), Options.bForce);
+	TestFalse(TEXT("Wait flag"), bWait);
+	TestEqual(TEXT("Timeout clamped"), Options.TimeoutSeconds, 1.0);
+
+	TestFalse(TEXT("Actor required"), FExecutePCGGraphCommand::ParseParameters(
+		TEXT(R"({"actor_names":[]})"), ActorNames, Options, bWait, Error));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,111 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Services/SceneStatsCache.h"
+
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+TSharedRef<FSceneStatsMeshInfo> MakeSceneStatsMesh(const TCHAR* Name, int32 LOD0Tris)
+{
+	TSharedRef<FSceneStatsMeshInfo> Info = MakeShared<FSceneStatsMeshInfo>();
+	Info->MeshName = Name;
+	Info->MeshPath = FString::Printf(TEXT("/Game/Meshes/%s.%s"), Name, Name);
+	Info->LOD0Tris = LOD0Tris;
+	Info->LODCount = 2;
+	Info->LODTris = {LOD0Tris, LOD0Tris / 4};
+	Info->LODScreenSizes = {1.0f, 0.1f};
+	Info->SphereRadius = 100.0f;
+	return Info;
+}
+
+FSceneStatsComponentRecord MakeInstancedRecord(const TArray<FVector>& Locations, float CullDistance)
+{
+	FSceneStatsComponentRecord Record;
+	Record.bInstanced = true;
+	Record.bCastShadow = true;
+	Record.CullDistance = CullDistance;
+	Record.InstanceCount = Locations.Num();
+	Record.InstanceLocations = MakeShared<TArray<FVector>>(Locations);
+	return Record;
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FSceneStatsCacheAggregateTest,
+	"UnrealMCP.Editor.SceneStatsCache.Aggregate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSceneStatsCacheAggregateTest::RunTest(const FString& Parameters)
+{
+	FSceneStatsSnapshot Snapshot;
+	Snapshot.Generation = 7;
+	Snapshot.TotalComponents = 3;
+	Snapshot.TotalActors = 2;
+
+	// Grass: two ISM components; instances at 50 (LOD0), 5000 (LOD1) and 50000 (culled)
+	FSceneStatsMeshGroup& Grass = Snapshot.Meshes.AddDefaulted_GetRef();
+	Grass.Info = MakeSceneStatsMesh(TEXT("SM_Grass"), 100);
+	Grass.Components.Add(MakeInstancedRecord({FVector(50, 0, 0), FVector(5000, 0, 0)}, 20000.0f));
+	Grass.Components.Add(MakeInstancedRecord({FVector(50000, 0, 0)}, 20000.0f));
+
+	// Rock: one plain component with far more triangles
+	FSceneStatsMeshGroup& Rock = Snapshot.Meshes.AddDefaulted_GetRef();
+	Rock.Info = MakeSceneStatsMesh(TEXT("SM_Rock"), 10000);
+	Rock.Components.AddDefaulted();
+
+	TSharedRef<const FSceneStatsBreakdown> Breakdown = FSceneStatsCache::Aggregate(Snapshot, FVector::ZeroVector, true);
+	TestEqual(TEXT("Generation carried"), Breakdown->Generation, static_cast<uint64>(7));
+	TestEqual(TEXT("Two meshes"), Breakdown->Meshes.Num(), 2);
+	if (Breakdown->Meshes.Num() == 2)
+	{
+		const FSceneStatsMeshBreakdown& First = Breakdown->Meshes[0];
+		const FSceneStatsMeshBreakdown& Second = Breakdown->Meshes[1];
+		TestEqual(TEXT("Sorted by instances x LOD0 tris"), First.Info->MeshName, FString(TEXT("SM_Rock")));
+		TestFalse(TEXT("Plain component is not instanced"), First.bIsISM);
+
+		TestEqual(TEXT("Grass instances summed across components"), Second.InstanceCount, 3);
+		TestEqual(TEXT("Grass components"), Second.ComponentCount, 2);
+		TestEqual(TEXT("Grass shadow casters"), Second.ShadowCasters, 2);
+		TestEqual(TEXT("Far instance culled"), Second.InstancesCulled, 1);
+		TestEqual(TEXT("LOD buckets sized per LOD"), Second.InstancesPerLOD.Num(), 2);
+		if (Second.InstancesPerLOD.Num() == 2)
+		{
+			TestEqual(TEXT("Near instance at LOD0"), Second.InstancesPerLOD[0], 1);
+			TestEqual(TEXT("Mid instance at LOD1"), Second.InstancesPerLOD[1], 1);
+		}
+	}
+
+	const TSharedRef<const FSceneStatsBreakdown> NoCamera = FSceneStatsCache::Aggregate(Snapshot, FVector::ZeroVector, false);
+	TestEqual(TEXT("No LOD bucketing without a camera"),
+		NoCamera->Meshes.Num() == 2 ? NoCamera->Meshes[1].InstancesPerLOD.Num() : -1, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FSceneStatsCacheBreakdownReuseTest,
+	"UnrealMCP.Editor.SceneStatsCache.BreakdownReuse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSceneStatsCacheBreakdownReuseTest::RunTest(const FString& Parameters)
+{
+	FSceneStatsCache& Cache = FSceneStatsCache::Get();
+	Cache.Reset();
+
+	FSceneStatsSnapshot Snapshot;
+	Snapshot.Generation = TNumericLimits<uint64>::Max() - 1;
+	Cache.StoreBreakdown(FSceneStatsCache::Aggregate(Snapshot, FVector(10, 0, 0), true));
+
+	TestTrue(TEXT("Same generation and camera reuses the breakdown"), Cache.FindBreakdown(Snapshot, FVector(10.5, 0, 0), true).IsValid());
+	TestFalse(TEXT("Moved camera recomputes"), Cache.FindBreakdown(Snapshot, FVector(500, 0, 0), true).IsValid());
+
+	FSceneStatsSnapshot Newer = Snapshot;
+	Newer.Generation = Snapshot.Generation + 1;
+	TestFalse(TEXT("Scene edits recompute"), Cache.FindBreakdown(Newer, FVector(10, 0, 0), true).IsValid());
+
+	Cache.Reset();
+	TestFalse(TEXT("Reset drops the breakdown"), Cache.FindBreakdown(Snapshot, FVector(10, 0, 0), true).IsValid());
+	return true;
+}
+
+#endif
@@ -0,0 +1,163 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Commands/Sound/BatchEditSoundCueCommand.h"
+#include "Services/SoundGraphEditSession.h"
+
+#include "Dom/JsonValue.h"
+#include "MetasoundBuilderSubsystem.h"
+#include "MetasoundDocumentBuilderRegistry.h"
+#include "MetasoundSource.h"
+#include "Misc/AutomationTest.h"
+#include "Sound/SoundCue.h"
+#include "Sound/SoundNode.h"
+#include "UObject/Package.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMetaSoundEditSessionTest,
+	"UnrealMCP.Editor.SoundGraphBatchEdit.MetaSoundSession",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetaSoundEditSessionTest::RunTest(const FString& Parameters)
+{
+	UMetaSoundBuilderSubsystem& BuilderSubsystem = UMetaSoundBuilderSubsystem::GetChecked();
+	EMetaSoundBuilderResult BuildResult;
+	FMetaSoundBuilderNodeOutputHandle OnPlayOutput;
+	FMetaSoundBuilderNodeInputHandle OnFinishedInput;
+	TArray<FMetaSoundBuilderNodeInputHandle> AudioOutInputs;
+	UMetaSoundSourceBuilder* SourceBuilder = BuilderSubsystem.CreateSourceBuilder(
+		MakeUniqueObjectName(GetTransientPackage(), UMetaSoundSourceBuilder::StaticClass(), TEXT("MCP_SessionTestBuilder")),
+		OnPlayOutput, OnFinishedInput, AudioOutInputs, BuildResult, EMetaSoundOutputAudioFormat::Mono, true);
+	if (!TestTrue(TEXT("Source builder created"), BuildResult == EMetaSoundBuilderResult::Succeeded && SourceBuilder != nullptr))
+	{
+		return false;
+	}
+	UMetaSoundSource* MetaSound = Cast<UMetaSoundSource>(SourceBuilder->BuildNewMetaSound(TEXT("MS_SessionTest")).GetObject());
+
+	FMetaSoundEditSession Session(MetaSound);
+	if (!TestTrue(TEXT("Session valid"), Session.IsValid()))
+	{
+		return false;
+	}
+
+	FString CarrierId, ModulatorId, Error;
+	if (!TestTrue(TEXT("Carrier added"), Session.AddNode(TEXT("UE"), TEXT("Sine"), TEXT("Audio"), 0, 0, TEXT("carrier"), CarrierId, Error)) ||
+		!TestTrue(TEXT("Modulator added"), Session.AddNode(TEXT("UE"), TEXT("Sine"), TEXT("Audio"), -300, 0, TEXT("mod"), ModulatorId, Error)))
+	{
+		AddError(Error);
+		return false;
+	}
+
+	// A ref from an earlier operation and a returned node ID both resolve later in the batch
+	TestTrue(TEXT("Connect ref to node ID"), Session.Connect(TEXT("mod"), TEXT("Audio"), CarrierId, TEXT("Modulation"), Error));
+	TestTrue(TEXT("Set input by ref"), Session.SetInput(TEXT("carrier"), TEXT("Frequency"), MakeShared<FJsonValueNumber>(220.0), Error));
+
+	FString DuplicateId;
+	TestFalse(TEXT("Duplicate ref rejected"), Session.AddNode(TEXT("UE"), TEXT("Sine"), TEXT("Audio"), 0, 0, TEXT("mod"), DuplicateId, Error));
+	TestTrue(TEXT("Duplicate ref named"), Error.Contains(TEXT("mod")));
+	TestTrue(TEXT("No ID for the duplicate"), DuplicateId.IsEmpty());
+	TestFalse(TEXT("Unknown class rejected"), Session.AddNode(TEXT("UE"), TEXT("NoSuchNode"), FString(), 0, 0, TEXT("bad"), DuplicateId, Error));
+	TestTrue(TEXT("Unknown class points at the palette"), Error.Contains(TEXT("search_metasound_palette")));
+	TestFalse(TEXT("Failed add does not claim its ref"), Session.Connect(TEXT("bad"), TEXT("Audio"), TEXT("carrier"), TEXT("Modulation"), Error));
+	TestFalse(TEXT("Unknown pin rejected"), Session.Connect(TEXT("mod"), TEXT("Missing"), TEXT("carrier"), TEXT("Modulation"), Error));
+	TestTrue(TEXT("Unknown pin named"), Error.Contains(TEXT("Missing")));
+	TestFalse(TEXT("Unsupported value rejected"), Session.SetInput(TEXT("carrier"), TEXT("Frequency"), MakeShared<FJsonValueArray>(TArray<TSharedPtr<FJsonValue>>()), Error));
+
+	TestTrue(TEXT("Edits recorded"), Session.HasChanges());
+	Session.Commit();
+	TestFalse(TEXT("Commit clears changes"), Session.HasChanges());
+
+	// The edits landed in the document the registry hands out for this MetaSound
+	Metasound::Engine::FDocumentBuilderRegistry& BuilderRegistry = Metasound::Engine::FDocumentBuilderRegistry::GetChecked();
+	UMetaSoundSourceBuilder& DocBuilder = BuilderRegistry.FindOrBeginBuilding<UMetaSoundSourceBuilder>(*MetaSound);
+	FMetaSoundNodeHandle Carrier;
+	FMetaSoundNodeHandle Modulator;
+	FGuid::Parse(CarrierId, Carrier.NodeID);
+	FGuid::Parse(ModulatorId, Modulator.NodeID);
+	TestTrue(TEXT("Carrier in document"), DocBuilder.ContainsNode(Carrier));
+	const FMetaSoundBuilderNodeOutputHandle ModulatorOut = DocBuilder.FindNodeOutputByName(Modulator, TEXT("Audio"), BuildResult);
+	const FMetaSoundBuilderNodeInputHandle CarrierModulation = DocBuilder.FindNodeInputByName(Carrier, TEXT("Modulation"), BuildResult);
+	TestTrue(TEXT("Connection in document"), DocBuilder.NodesAreConnected(ModulatorOut, CarrierModulation));
+
+	BuilderSubsystem.UnregisterBuilder(SourceBuilder->GetFName());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBatchEditSoundCueParseTest,
+	"UnrealMCP.Editor.SoundGraphBatchEdit.ParseSoundCue",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FBatchEditSoundCueParseTest::RunTest(const FString& Parameters)
+{
+	FString Path;
+	TArray<FSoundGraphOperation> Operations;
+	FString Error;
+
+	const bool bParsed = FBatchEditSoundCueCommand::ParseParameters(TEXT(R"({
+		"sound_cue_path": "/Game/Audio/SC_Test",
+		"operations": [
+			{"op": "add_node", "ref": "wave", "node_type": "WavePlayer", "sound_wave_path": "/Game/Audio/SW_Hit"},
+			{"op": "connect", "source_node_id": "wave", "target_node_id": "mix", "target_pin_index": 2}
+		]})"), Path, Operations, Error);
+
+	if (!TestTrue(TEXT("Parsed"), bParsed) || !TestEqual(TEXT("Operation count"), Operations.Num(), 2))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Node type"), Operations[0].NodeType, FString(TEXT("WavePlayer")));
+	TestEqual(TEXT("Sound wave"), Operations[0].SoundWavePath, FString(TEXT("/Game/Audio/SW_Hit")));
+	TestEqual(TEXT("Source ref"), Operations[1].SourceNode, FString(TEXT("wave")));
+	TestEqual(TEXT("Target pin index"), Operations[1].TargetPinIndex, 2);
+
+	TestFalse(TEXT("Path required"), FBatchEditSoundCueCommand::ParseParameters(
+		TEXT(R"({"operations": [{"op": "add_node"}]})"), Path, Operations, Error));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FSoundCueEditSessionTest,
+	"UnrealMCP.Editor.SoundGraphBatchEdit.SoundCueSession",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSoundCueEditSessionTest::RunTest(const FString& Parameters)
+{
+	USoundCue* SoundCue = NewObject<USoundCue>(GetTransientPackage(), NAME_None, RF_Transient);
+	FSoundCueEditSession Session(SoundCue);
+	if (!TestTrue(TEXT("Session valid"), Session.IsValid()))
+	{
+		return false;
+	}
+
+	FString WaveId, MixId, Error;
+	if (!TestTrue(TEXT("Wave player added"), Session.AddNode(TEXT("WavePlayer"), nullptr, TEXT("wave"), WaveId, Error)) ||
+		!TestTrue(TEXT("Mixer added"), Session.AddNode(TEXT("Mixer"), nullptr, TEXT("mix"), MixId, Error)))
+	{
+		AddError(Error);
+		return false;
+	}
+	TestTrue(TEXT("Ref and node name find the same node"), Session.FindNode(TEXT("wave")) == Session.FindNode(WaveId));
+
+	// Refs from earlier operations resolve in later ones of the same batch
+	TestTrue(TEXT("Connect by ref"), Session.Connect(TEXT("wave"), TEXT("mix"), 1, Error));
+	TestTrue(TEXT("Root set by ref"), Session.Connect(TEXT("mix"), TEXT("Output"), 0, Error));
+	USoundNode* Mixer = Session.FindNode(MixId);
+	if (TestNotNull(TEXT("Mixer indexed by name"), Mixer) && TestEqual(TEXT("Child slots grown to the pin"), Mixer->ChildNodes.Num(), 2))
+	{
+		TestTrue(TEXT("Wave player linked"), Mixer->ChildNodes[1] == Session.FindNode(TEXT("wave")));
+	}
+	TestTrue(TEXT("Root is the mixer"), SoundCue->FirstNode == Mixer);
+
+	const int32 NodeCount = SoundCue->AllNodes.Num();
+	FString DuplicateId;
+	TestFalse(TEXT("Duplicate ref rejected"), Session.AddNode(TEXT("Random"), nullptr, TEXT("wave"), DuplicateId, Error));
+	TestEqual(TEXT("No node created for the duplicate"), SoundCue->AllNodes.Num(), NodeCount);
+	TestTrue(TEXT("Ref still names the first node"), Session.FindNode(TEXT("wave")) == Session.FindNode(WaveId));
+	TestFalse(TEXT("Unknown ref rejected"), Session.Connect(TEXT("missing"), TEXT("mix"), 0, Error));
+
+	TestTrue(TEXT("Edits recorded"), Session.HasChanges());
+	Session.Commit();
+	TestFalse(TEXT("Commit clears changes"), Session.HasChanges());
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,101 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Services/StateTreeEditSession.h"
+
+#include "Misc/AutomationTest.h"
+#include "StateTree.h"
+#include "StateTreeEditorData.h"
+#include "StateTreeState.h"
+#include "UObject/Package.h"
+
+namespace
+{
+/** Transient tree with Root -> Idle */
+UStateTree* MakeStateTree()
+{
+	UStateTree* StateTree = NewObject<UStateTree>(GetTransientPackage(), NAME_None, RF_Transient);
+	UStateTreeEditorData* EditorData = NewObject<UStateTreeEditorData>(StateTree, NAME_None, RF_Transient);
+	StateTree->EditorData = EditorData;
+
+	UStateTreeState* Root = NewObject<UStateTreeState>(EditorData, TEXT("Root"));
+	Root->Name = TEXT("Root");
+	EditorData->SubTrees.Add(Root);
+
+	UStateTreeState* Idle = NewObject<UStateTreeState>(EditorData, TEXT("Idle"));
+	Idle->Name = TEXT("Idle");
+	Idle->Parent = Root;
+	Root->Children.Add(Idle);
+	return StateTree;
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FStateTreeEditSessionStatesTest,
+	"UnrealMCP.Editor.StateTreeEditSession.States",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FStateTreeEditSessionStatesTest::RunTest(const FString& Parameters)
+{
+	FStateTreeEditSession Session(MakeStateTree());
+	if (!TestTrue(TEXT("Session valid"), Session.IsValid()))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Existing states indexed"), Session.NumStates(), 2);
+	TestNotNull(TEXT("Nested state found"), Session.FindState(TEXT("Idle")));
+	TestFalse(TEXT("No changes before an edit"), Session.HasChanges());
+
+	FString Error;
+	UStateTreeState* Patrol = Session.AddState(TEXT("Patrol"), TEXT("Root"), Error);
+	if (TestNotNull(TEXT("State added"), Patrol))
+	{
+		TestEqual(TEXT("Parent set"), Patrol->Parent.Get(), Session.FindState(TEXT("Root")));
+		TestEqual(TEXT("New state indexed"), Session.FindState(TEXT("Patrol")), Patrol);
+	}
+	TestTrue(TEXT("Edit recorded"), Session.HasChanges());
+
+	TestNotNull(TEXT("Child of a state added in the same session"), Session.AddState(TEXT("Walk"), TEXT("Patrol"), Error));
+	TestNotNull(TEXT("New root"), Session.AddState(TEXT("Combat"), FString(), Error));
+	TestEqual(TEXT("Root added to subtrees"), Session.GetEditorData()->SubTrees.Num(), 2);
+
+	TestNull(TEXT("Duplicate rejected"), Session.AddState(TEXT("Idle"), TEXT("Root"), Error));
+	TestNull(TEXT("Missing parent rejected"), Session.AddState(TEXT("Flee"), TEXT("Missing"), Error));
+	TestTrue(TEXT("Parent named in error"), Error.Contains(TEXT("Missing")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FStateTreeEditSessionTransitionsTest,
+	"UnrealMCP.Editor.StateTreeEditSession.Transitions",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FStateTreeEditSessionTransitionsTest::RunTest(const FString& Parameters)
+{
+	FStateTreeEditSession Session(MakeStateTree());
+	FString Error;
+	UStateTreeState* Patrol = Session.AddState(TEXT("Patrol"), TEXT("Root"), Error);
+	if (!TestNotNull(TEXT("State added"), Patrol))
+	{
+		return false;
+	}
+
+	FStateTreeTransition Transition;
+	Transition.Trigger = EStateTreeTransitionTrigger::OnStateFailed;
+	TestTrue(TEXT("Transition added"), Session.AddTransition(TEXT("Idle"), TEXT("Patrol"), Transition, Error));
+
+	const UStateTreeState* Idle = Session.FindState(TEXT("Idle"));
+	if (TestEqual(TEXT("One transition"), Idle->Transitions.Num(), 1))
+	{
+		const FStateTreeTransition& Added = Idle->Transitions[0];
+		TestEqual(TEXT("Target linked by id"), Added.State.ID, Patrol->ID);
+		TestTrue(TEXT("Goto link"), Added.State.LinkType == EStateTreeTransitionType::GotoState);
+		TestTrue(TEXT("Trigger kept"), Added.Trigger == EStateTreeTransitionTrigger::OnStateFailed);
+	}
+
+	TestFalse(TEXT("Missing source"), Session.AddTransition(TEXT("Missing"), TEXT("Patrol"), Transition, Error));
+	TestFalse(TEXT("Missing target"), Session.AddTransition(TEXT("Idle"), TEXT("Missing"), Transition, Error));
+	TestEqual(TEXT("Failed transitions not appended"), Idle->Transitions.Num(), 1);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,205 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Commands/StateTree/BatchAddStatesCommand.h"
+#include "Commands/StateTree/CompileStateTreeCommand.h"
+#include "Services/StateTreeEditSession.h"
+#include "Services/StateTreeService.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/PackageName.h"
+#include "PackageTools.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "StateTree.h"
+#include "StateTreeState.h"
+#include "UObject/Package.h"
+
+namespace
+{
+const TCHAR* AutomationFolder = TEXT("/Game/Automation");
+
+TSharedPtr<FJsonObject> ParseResponse(const FString& Json)
+{
+	TSharedPtr<FJsonObject> Result;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+	FJsonSerializer::Deserialize(Reader, Result);
+	return Result;
+}
+
+FString GetPackageFilename(const FString& Name)
+{
+	return FPackageName::LongPackageNameToFilename(FString(AutomationFolder) / Name, FPackageName::GetAssetPackageExtension());
+}
+
+/** Unload the automation package (left over from an earlier run, or created by this one) and delete its file */
+void DeleteAutomationStateTree(FAutomationTestBase& Test, const FString& Name)
+{
+	if (UPackage* ExistingPackage = FindPackage(nullptr, *(FString(AutomationFolder) / Name)))
+	{
+		ExistingPackage->SetDirtyFlag(false);
+		TArray<UPackage*> PackagesToUnload{ ExistingPackage };
+		FText UnloadError;
+		Test.TestTrue(TEXT("Automation StateTree package unloads"), UPackageTools::UnloadPackages(PackagesToUnload, UnloadError, true));
+	}
+	IFileManager::Get().Delete(*GetPackageFilename(Name), false, true, true);
+}
+
+/** Saved tree under /Game/Automation; the service only skips recompiles of trees it could save */
+UStateTree* CreateAutomationStateTree(FAutomationTestBase& Test, const FString& Name)
+{
+	DeleteAutomationStateTree(Test, Name);
+
+	FStateTreeCreationParams Params;
+	Params.Name = Name;
+	Params.FolderPath = AutomationFolder;
+	FString Error;
+	UStateTree* StateTree = FStateTreeService::Get().CreateStateTree(Params, Error);
+	Test.TestNotNull(TEXT("Automation StateTree created"), StateTree);
+	return StateTree;
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FStateTreeServiceCompileSkipTest,
+	"UnrealMCP.Editor.StateTreeService.CompileSkip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FStateTreeServiceCompileSkipTest::RunTest(const FString& Parameters)
+{
+	const FString Name = TEXT("ST_MCPCompileSkipTest");
+	UStateTree* StateTree = CreateAutomationStateTree(*this, Name);
+	if (!StateTree)
+	{
+		return false;
+	}
+
+	{
+		FStateTreeEditSession Session(StateTree);
+		FString Error;
+		TestNotNull(TEXT("Root added"), Session.AddState(TEXT("Root"), FString(), Error));
+		TestNotNull(TEXT("Idle added"), Session.AddState(TEXT("Idle"), TEXT("Root"), Error));
+	}
+
+	FCompileStateTreeCommand Command(FStateTreeService::Get());
+	const FString Request = FString::Printf(TEXT(R"({"state_tree_path":"%s"})"), *StateTree->GetPathName());
+	const FString ForcedRequest = FString::Printf(TEXT(R"({"state_tree_path":"%s","force":true})"), *StateTree->GetPathName());
+
+	const TSharedPtr<FJsonObject> First = ParseResponse(Command.Execute(Request));
+	if (TestTrue(TEXT("First compile succeeds"), First && First->GetBoolField(TEXT("success"))))
+	{
+		TestFalse(TEXT("First compile runs the compiler"), First->GetBoolField(TEXT("skipped")));
+
+		const TSharedPtr<FJsonObject> Second = ParseResponse(Command.Execute(Request));
+		if (TestTrue(TEXT("Second compile succeeds"), Second && Second->GetBoolField(TEXT("success"))))
+		{
+			TestTrue(TEXT("Unchanged tree is skipped"), Second->GetBoolField(TEXT("skipped")));
+			TestEqual(TEXT("Skipped compile takes no time"), Second->GetNumberField(TEXT("compile_ms")), 0.0);
+			TestEqual(TEXT("Skipped compile reports the same hash"),
+				Second->GetStringField(TEXT("editor_data_hash")), First->GetStringField(TEXT("editor_data_hash")));
+		}
+
+		const TSharedPtr<FJsonObject> Forced = ParseResponse(Command.Execute(ForcedRequest));
+		if (TestTrue(TEXT("Forced compile succeeds"), Forced && Forced->GetBoolField(TEXT("success"))))
+		{
+			TestFalse(TEXT("Force recompiles an unchanged tree"), Forced->GetBoolField(TEXT("skipped")));
+		}
+
+		{
+			FStateTreeEditSession Session(StateTree);
+			FString Error;
+			TestNotNull(TEXT("Patrol added"), Session.AddState(TEXT("Patrol"), TEXT("Root"), Error));
+		}
+
+		const TSharedPtr<FJsonObject> Edited = ParseResponse(Command.Execute(Request));
+		if (TestTrue(TEXT("Compile after an edit succeeds"), Edited && Edited->GetBoolField(TEXT("success"))))
+		{
+			TestFalse(TEXT("Edited tree is recompiled"), Edited->GetBoolField(TEXT("skipped")));
+			TestNotEqual(TEXT("Edit changes the hash"),
+				Edited->GetStringField(TEXT("editor_data_hash")), First->GetStringField(TEXT("editor_data_hash")));
+		}
+
+		const TSharedPtr<FJsonObject> AfterEdit = ParseResponse(Command.Execute(Request));
+		TestTrue(TEXT("Recompiled tree is skipped again"), AfterEdit && AfterEdit->GetBoolField(TEXT("skipped")));
+	}
+
+	StateTree = nullptr;
+	DeleteAutomationStateTree(*this, Name);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FStateTreeServiceBatchAddStatesTest,
+	"UnrealMCP.Editor.StateTreeService.BatchAddStates",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FStateTreeServiceBatchAddStatesTest::RunTest(const FString& Parameters)
+{
+	const FString Name = TEXT("ST_MCPBatchAddStatesTest");
+	UStateTree* StateTree = CreateAutomationStateTree(*this, Name);
+	if (!StateTree)
+	{
+		return false;
+	}
+
+	{
+		FStateTreeEditSession Session(StateTree);
+		FString Error;
+		TestNotNull(TEXT("Root added"), Session.AddState(TEXT("Root"), FString(), Error));
+	}
+
+	// Walk is listed before its parent Patrol; Flee's parent is never defined
+	FBatchAddStatesCommand Command(FStateTreeService::Get());
+	const TSharedPtr<FJsonObject> Response = ParseResponse(Command.Execute(FString::Printf(TEXT(R"({
+		"state_tree_path": "%s",
+		"compile": false,
+		"states": [
+			{ "state_name": "Walk", "parent_state_name": "Patrol" },
+			{ "state_name": "Patrol", "parent_state_name": "Root" },
+			{ "state_name": "Flee", "parent_state_name": "Missing" },
+			{ "state_name": "Guard", "parent_state_name": "Root" }
+		]
+	})"), *StateTree->GetPathName())));
+
+	if (TestTrue(TEXT("Batch succeeds"), Response && Response->GetBoolField(TEXT("success"))))
+	{
+		TestEqual(TEXT("Resolvable states added"), Response->GetIntegerField(TEXT("states_added")), 3);
+
+		const TArray<TSharedPtr<FJsonValue>>& Failed = Response->GetArrayField(TEXT("failed"));
+		if (TestEqual(TEXT("Unresolved parent fails"), Failed.Num(), 1))
+		{
+			const TSharedPtr<FJsonObject> Item = Failed[0]->AsObject();
+			TestEqual(TEXT("Failed index"), Item->GetIntegerField(TEXT("index")), 2);
+			TestEqual(TEXT("Failed state name"), Item->GetStringField(TEXT("state_name")), FString(TEXT("Flee")));
+			TestTrue(TEXT("Missing parent named in error"), Item->GetStringField(TEXT("error")).Contains(TEXT("Missing")));
+		}
+	}
+
+	FStateTreeEditSession Session(StateTree);
+	const UStateTreeState* Patrol = Session.FindState(TEXT("Patrol"));
+	const UStateTreeState* Walk = Session.FindState(TEXT("Walk"));
+	if (TestNotNull(TEXT("Child listed before its parent added"), Walk))
+	{
+		TestTrue(TEXT("Child attached to the parent defined later"), Patrol && Walk->Parent.Get() == Patrol);
+	}
+	TestNull(TEXT("State with unresolved parent not added"), Session.FindState(TEXT("Flee")));
+
+	// Nothing resolves: the request fails and reports the first item error
+	const TSharedPtr<FJsonObject> AllFailed = ParseResponse(Command.Execute(FString::Printf(TEXT(R"({
+		"state_tree_path": "%s",
+		"compile": false,
+		"states": [ { "state_name": "Orphan", "parent_state_name": "Nowhere" } ]
+	})"), *StateTree->GetPathName())));
+	if (TestTrue(TEXT("All-failed response parsed"), AllFailed.IsValid()))
+	{
+		TestFalse(TEXT("Batch with nothing applied fails"), AllFailed->GetBoolField(TEXT("success")));
+		TestTrue(TEXT("Item error surfaced"), AllFailed->GetStringField(TEXT("error")).Contains(TEXT("Nowhere")));
+	}
+
+	StateTree = nullptr;
+	DeleteAutomationStateTree(*this, Name);
+	return true;
+}
+
+#endif
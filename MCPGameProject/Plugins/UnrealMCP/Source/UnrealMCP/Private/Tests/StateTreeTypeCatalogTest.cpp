@@ -0,0 +1,80 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Services/StateTreeTypeCatalog.h"
+
+#include "Misc/AutomationTest.h"
+#include "Services/ReflectionCatalog.h"
+#include "StateTreeTaskBase.h"
+
+namespace
+{
+bool ContainsName(const TArray<TPair<FString, FString>>& Types, const FString& Name)
+{
+	return Types.ContainsByPredicate([&Name](const TPair<FString, FString>& Type) { return Type.Value == Name; });
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FStateTreeTypeCatalogLookupTest,
+	"UnrealMCP.Editor.StateTreeTypeCatalog.Lookup",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FStateTreeTypeCatalogLookupTest::RunTest(const FString& Parameters)
+{
+	FStateTreeTypeCatalog& Catalog = FStateTreeTypeCatalog::Get();
+
+	const TArray<TPair<FString, FString>>& Tasks = Catalog.GetTypes(EStateTreeNodeKind::Task);
+	TestTrue(TEXT("Engine delay task listed"), ContainsName(Tasks, TEXT("StateTreeDelayTask")));
+	TestFalse(TEXT("Base struct not listed"), ContainsName(Tasks, TEXT("StateTreeTaskBase")));
+	TestTrue(TEXT("Engine compare condition listed"),
+		ContainsName(Catalog.GetTypes(EStateTreeNodeKind::Condition), TEXT("StateTreeCompareIntCondition")));
+
+	EStateTreeNodeKind Kind = EStateTreeNodeKind::Evaluator;
+	UScriptStruct* ByName = Catalog.FindType(TEXT("StateTreeDelayTask"), &Kind);
+	if (TestNotNull(TEXT("Found by name"), ByName))
+	{
+		TestTrue(TEXT("Kind reported"), Kind == EStateTreeNodeKind::Task);
+		TestTrue(TEXT("Derives from task base"), ByName->IsChildOf(FStateTreeTaskBase::StaticStruct()));
+		TestEqual(TEXT("Found by full path"), Catalog.FindType(ByName->GetPathName()), ByName);
+	}
+	TestEqual(TEXT("F prefix and case ignored"), Catalog.FindType(TEXT("fstatetreedelaytask")), ByName);
+
+	TestNull(TEXT("Non-node struct is not a node type"), Catalog.FindType(TEXT("Vector")));
+	TestNull(TEXT("Unknown path"), Catalog.FindType(TEXT("/Script/StateTreeModule.NoSuchTask")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FStateTreeTypeCatalogRefreshTest,
+	"UnrealMCP.Editor.StateTreeTypeCatalog.Refresh",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FStateTreeTypeCatalogRefreshTest::RunTest(const FString& Parameters)
+{
+	FStateTreeTypeCatalog& Catalog = FStateTreeTypeCatalog::Get();
+	const TArray<TPair<FString, FString>>* First = &Catalog.GetTypes(EStateTreeNodeKind::Task);
+	const int32 NumTasks = First->Num();
+	TestEqual(TEXT("Repeated listing reuses the cached array"), &Catalog.GetTypes(EStateTreeNodeKind::Task), First);
+
+	// Module load / hot reload invalidate the reflection snapshot; the catalog follows it
+	FReflectionCatalog::Get().Invalidate();
+	TestEqual(TEXT("Rebuilt after invalidation"), Catalog.GetTypes(EStateTreeNodeKind::Task).Num(), NumTasks);
+	TestNotNull(TEXT("Lookups work after rebuild"), Catalog.FindType(TEXT("StateTreeDelayTask")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FReflectionCatalogNormalizeTypeNameTest,
+	"UnrealMCP.Editor.ReflectionCatalog.NormalizeTypeName",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FReflectionCatalogNormalizeTypeNameTest::RunTest(const FString& Parameters)
+{
+	TestEqual(TEXT("Lowercased"), FReflectionCatalog::NormalizeTypeName(TEXT("StaticMeshActor")), FString(TEXT("staticmeshactor")));
+	TestEqual(TEXT("Blueprint suffix removed"), FReflectionCatalog::NormalizeTypeName(TEXT("BP_Door_C")), FString(TEXT("bp_door")));
+	TestEqual(TEXT("Lowercase suffix kept"), FReflectionCatalog::NormalizeTypeName(TEXT("Sync_c")), FString(TEXT("sync_c")));
+	TestEqual(TEXT("Suffix without underscore kept"), FReflectionCatalog::NormalizeTypeName(TEXT("ArcC")), FString(TEXT("arcc")));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
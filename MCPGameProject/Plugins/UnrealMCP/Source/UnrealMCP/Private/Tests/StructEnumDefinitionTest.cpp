@@ -0,0 +1,153 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Services/Project/ProjectStructService.h"
+#include "Services/Project/ProjectEnumService.h"
+
+#include "EdGraphSchema_K2.h"
+#include "Engine/UserDefinedEnum.h"
+#include "Kismet2/EnumEditorUtils.h"
+#include "Kismet2/StructureEditorUtils.h"
+#include "Misc/AutomationTest.h"
+#include "StructUtils/UserDefinedStruct.h"
+#include "UObject/Package.h"
+#include "UserDefinedStructure/UserDefinedStructEditorData.h"
+
+namespace
+{
+TSharedPtr<FJsonObject> MakeProperty(const FString& Name, const FString& Type, const FString& Description = FString())
+{
+	TSharedPtr<FJsonObject> Property = MakeShared<FJsonObject>();
+	Property->SetStringField(TEXT("name"), Name);
+	Property->SetStringField(TEXT("type"), Type);
+	if (!Description.IsEmpty())
+	{
+		Property->SetStringField(TEXT("description"), Description);
+	}
+	return Property;
+}
+
+const FStructVariableDescription* FindMember(UUserDefinedStruct* Struct, const FString& Name)
+{
+	return FStructureEditorUtils::GetVarDesc(Struct).FindByPredicate([&Name](const FStructVariableDescription& Desc)
+	{
+		return Desc.FriendlyName == Name;
+	});
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FStructDefinitionTest,
+	"UnrealMCP.Editor.StructEnumDefinition.Struct",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FStructDefinitionTest::RunTest(const FString& Parameters)
+{
+	UUserDefinedStruct* Struct = FStructureEditorUtils::CreateUserDefinedStruct(GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UUserDefinedStruct::StaticClass(), TEXT("S_McpDefinitionTest")), RF_Transient);
+	if (!TestNotNull(TEXT("Struct created"), Struct))
+	{
+		return false;
+	}
+
+	// A wide struct in one pass, plus entries that must be skipped without aborting the rest
+	TArray<TSharedPtr<FJsonObject>> Properties;
+	for (int32 Index = 0; Index < 60; ++Index)
+	{
+		Properties.Add(MakeProperty(FString::Printf(TEXT("Field%d"), Index), Index % 2 ? TEXT("Float") : TEXT("Integer")));
+	}
+	Properties.Add(MakeProperty(TEXT("Field0"), TEXT("String")));
+	Properties.Add(MakeProperty(TEXT("Broken"), TEXT("NotAType")));
+
+	TArray<FString> Skipped;
+	FString Error;
+	if (!TestTrue(TEXT("Definition applied"), FProjectStructService::Get().ApplyStructDefinition(Struct, TEXT("Test struct"), Properties, Skipped, Error)))
+	{
+		AddError(Error);
+		return false;
+	}
+	TestEqual(TEXT("Placeholder replaced by the definition"), FStructureEditorUtils::GetVarDesc(Struct).Num(), 60);
+	TestEqual(TEXT("Duplicate and unknown type skipped"), Skipped.Num(), 2);
+	TestEqual(TEXT("Struct compiled"), Struct->Status.GetValue(), EUserDefinedStructureStatus::UDSS_UpToDate);
+
+	const FStructVariableDescription* Field1 = FindMember(Struct, TEXT("Field1"));
+	if (!TestNotNull(TEXT("Member found by display name"), Field1))
+	{
+		return false;
+	}
+	const FGuid Field1Guid = Field1->VarGuid;
+	TestTrue(TEXT("Editor member naming"), Field1->VarName.ToString().StartsWith(TEXT("Field1_")));
+
+	// Redefine: keep Field1 with a new type, drop the rest, add a new member
+	Skipped.Reset();
+	TArray<TSharedPtr<FJsonObject>> Redefinition;
+	Redefinition.Add(MakeProperty(TEXT("Field1"), TEXT("String"), TEXT("Now a string")));
+	Redefinition.Add(MakeProperty(TEXT("Extra"), TEXT("Boolean")));
+	TestTrue(TEXT("Redefinition applied"), FProjectStructService::Get().ApplyStructDefinition(Struct, FString(), Redefinition, Skipped, Error));
+	TestEqual(TEXT("Removed members dropped"), FStructureEditorUtils::GetVarDesc(Struct).Num(), 2);
+
+	Field1 = FindMember(Struct, TEXT("Field1"));
+	if (TestNotNull(TEXT("Kept member"), Field1))
+	{
+		TestEqual(TEXT("Kept member keeps its GUID"), Field1->VarGuid, Field1Guid);
+		TestEqual(TEXT("Type changed"), Field1->Category, UEdGraphSchema_K2::PC_String);
+		TestEqual(TEXT("Tooltip set"), Field1->ToolTip, FString(TEXT("Now a string")));
+	}
+
+	// A bad type for an existing member skips it without removing the member or its data
+	Skipped.Reset();
+	TArray<TSharedPtr<FJsonObject>> BadType;
+	BadType.Add(MakeProperty(TEXT("Field1"), TEXT("NotAType")));
+	BadType.Add(MakeProperty(TEXT("Extra"), TEXT("Boolean")));
+	TestTrue(TEXT("Definition with a bad type applied"), FProjectStructService::Get().ApplyStructDefinition(Struct, FString(), BadType, Skipped, Error));
+	TestEqual(TEXT("Bad type reported"), Skipped.Num(), 1);
+	TestEqual(TEXT("No member removed"), FStructureEditorUtils::GetVarDesc(Struct).Num(), 2);
+	Field1 = FindMember(Struct, TEXT("Field1"));
+	if (TestNotNull(TEXT("Member with a bad type kept"), Field1))
+	{
+		TestEqual(TEXT("Kept member keeps its GUID"), Field1->VarGuid, Field1Guid);
+		TestEqual(TEXT("Kept member keeps its type"), Field1->Category, UEdGraphSchema_K2::PC_String);
+	}
+
+	TestFalse(TEXT("Empty definition rejected"), FProjectStructService::Get().ApplyStructDefinition(Struct, FString(), TArray<TSharedPtr<FJsonObject>>(), Skipped, Error));
+	TestEqual(TEXT("Rejected definition leaves the struct alone"), FStructureEditorUtils::GetVarDesc(Struct).Num(), 2);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FEnumDefinitionTest,
+	"UnrealMCP.Editor.StructEnumDefinition.Enum",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEnumDefinitionTest::RunTest(const FString& Parameters)
+{
+	UUserDefinedEnum* Enum = Cast<UUserDefinedEnum>(FEnumEditorUtils::CreateUserDefinedEnum(GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UUserDefinedEnum::StaticClass(), TEXT("E_McpDefinitionTest")), RF_Transient));
+	if (!TestNotNull(TEXT("Enum created"), Enum))
+	{
+		return false;
+	}
+
+	TMap<FString, FString> Descriptions;
+	Descriptions.Add(TEXT("Walk"), TEXT("Slow movement"));
+
+	FString Error;
+	if (!TestTrue(TEXT("Definition applied"), FProjectEnumService::Get().ApplyEnumDefinition(Enum, TEXT("Movement"), { TEXT("Idle"), TEXT("Walk"), TEXT("Run") }, Descriptions, Error)))
+	{
+		AddError(Error);
+		return false;
+	}
+	TestEqual(TEXT("Three values plus MAX"), Enum->NumEnums(), 4);
+	TestEqual(TEXT("First value kept"), Enum->GetDisplayNameTextByIndex(0).ToString(), FString(TEXT("Idle")));
+	TestEqual(TEXT("Value tooltip"), Enum->GetMetaData(TEXT("ToolTip"), 1), FString(TEXT("Slow movement")));
+
+	// Reorder and drop a value: surviving values keep their internal names
+	const FName RunName = Enum->GetNameByIndex(2);
+	TestTrue(TEXT("Redefinition applied"), FProjectEnumService::Get().ApplyEnumDefinition(Enum, FString(), { TEXT("Run"), TEXT("Sprint") }, TMap<FString, FString>(), Error));
+	TestEqual(TEXT("Two values plus MAX"), Enum->NumEnums(), 3);
+	TestEqual(TEXT("Internal name preserved"), Enum->GetNameByIndex(0), RunName);
+	TestEqual(TEXT("New value displayed"), Enum->GetDisplayNameTextByIndex(1).ToString(), FString(TEXT("Sprint")));
+
+	TestFalse(TEXT("Duplicate values rejected"), FProjectEnumService::Get().ApplyEnumDefinition(Enum, FString(), { TEXT("A"), TEXT("A") }, TMap<FString, FString>(), Error));
+	TestFalse(TEXT("Empty definition rejected"), FProjectEnumService::Get().ApplyEnumDefinition(Enum, FString(), TArray<FString>(), TMap<FString, FString>(), Error));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,208 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Utils/TextureProcessingUtils.h"
+
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+FImage MakeImage(int32 Width, int32 Height, const FColor& Fill)
+{
+	FImage Image(Width, Height, ERawImageFormat::BGRA8, EGammaSpace::sRGB);
+	for (FColor& Pixel : Image.AsBGRA8())
+	{
+		Pixel = Fill;
+	}
+	return Image;
+}
+
+/** Foliage-like cutout: scattered opaque blades of varying color on a transparent background */
+FImage MakeFoliageImage(int32 Size, int32 Seed)
+{
+	FImage Image = MakeImage(Size, Size, FColor(0, 0, 0, 0));
+	const TArrayView64<FColor> Pixels = Image.AsBGRA8();
+	FRandomStream Random(Seed);
+
+	for (int32 Blade = 0; Blade < Size / 8; ++Blade)
+	{
+		const int32 BaseX = Random.RandRange(0, Size - 1);
+		const int32 Length = Random.RandRange(Size / 8, Size / 2);
+		const float Lean = Random.FRandRange(-0.5f, 0.5f);
+		const FColor Color(Random.RandRange(20, 90), Random.RandRange(90, 200), Random.RandRange(10, 60), 255);
+
+		for (int32 Step = 0; Step < Length; ++Step)
+		{
+			const int32 Y = Size - 1 - Step;
+			const int32 CenterX = BaseX + FMath::RoundToInt(Lean * Step);
+			for (int32 X = CenterX - 2; X <= CenterX + 2; ++X)
+			{
+				if (X >= 0 && X < Size && Y >= 0)
+				{
+					Pixels[int64(Y) * Size + X] = Color;
+				}
+			}
+		}
+	}
+	return Image;
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FTextureProcessingMipFloodTest,
+	"UnrealMCP.Editor.TextureProcessing.MipFlood",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTextureProcessingMipFloodTest::RunTest(const FString& Parameters)
+{
+	// Left half opaque red, right half transparent black
+	FImage Image = MakeImage(16, 8, FColor(0, 0, 0, 0));
+	const TArrayView64<FColor> Pixels = Image.AsBGRA8();
+	for (int32 Y = 0; Y < 8; ++Y)
+	{
+		for (int32 X = 0; X < 8; ++X)
+		{
+			Pixels[Y * 16 + X] = FColor(255, 0, 0, 255);
+		}
+	}
+
+	FTextureProcessingSettings Settings;
+	const int64 Flooded = FTextureProcessingUtils::MipFlood(Image, Settings);
+	TestEqual(TEXT("Every transparent texel flooded"), Flooded, int64(64));
+
+	bool bOpaqueUntouched = true;
+	bool bTransparentFilled = true;
+	for (int32 Y = 0; Y < 8; ++Y)
+	{
+		for (int32 X = 0; X < 16; ++X)
+		{
+			const FColor& Pixel = Pixels[Y * 16 + X];
+			if (X < 8)
+			{
+				bOpaqueUntouched &= Pixel == FColor(255, 0, 0, 255);
+			}
+			else
+			{
+				bTransparentFilled &= Pixel == FColor(255, 0, 0, 0);
+			}
+		}
+	}
+	TestTrue(TEXT("Opaque texels untouched"), bOpaqueUntouched);
+	TestTrue(TEXT("Transparent texels take the opaque color and keep zero alpha"), bTransparentFilled);
+
+	TestEqual(TEXT("Coverage of half-opaque image"), FTextureProcessingUtils::ComputeAlphaCoverage(Image, Settings), 0.5);
+
+	// Fully transparent images have nothing to flood from and stay black
+	FImage Empty = MakeImage(8, 8, FColor(0, 0, 0, 0));
+	FTextureProcessingUtils::MipFlood(Empty, Settings);
+	TestTrue(TEXT("Empty image stays black"), Empty.AsBGRA8()[0] == FColor(0, 0, 0, 0));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FTextureProcessingAtlasTest,
+	"UnrealMCP.Editor.TextureProcessing.Atlas",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTextureProcessingAtlasTest::RunTest(const FString& Parameters)
+{
+	TArray<FImage> Tiles;
+	Tiles.Add(MakeImage(64, 128, FColor(255, 0, 0, 255)));
+	Tiles.Add(MakeImage(64, 128, FColor(0, 255, 0, 255)));
+	Tiles.Add(MakeImage(32, 32, FColor(0, 0, 255, 255)));
+
+	FTextureAtlasLayout Layout;
+	FTextureProcessingSettings Settings;
+	FImage Atlas;
+	TArray<FIntRect> Cells;
+	FString Error;
+	TestTrue(TEXT("Packs"), FTextureProcessingUtils::PackAtlas(Tiles, Layout, Settings, Atlas, Cells, Error));
+
+	TestEqual(TEXT("Derived columns"), Layout.Columns, 2);
+	TestEqual(TEXT("Derived rows"), Layout.Rows, 2);
+	TestEqual(TEXT("Atlas width from largest tile"), Atlas.SizeX, 128);
+	TestEqual(TEXT("Atlas height from largest tile"), Atlas.SizeY, 256);
+	if (!TestEqual(TEXT("One cell per tile"), Cells.Num(), 3))
+	{
+		return false;
+	}
+
+	TestTrue(TEXT("Second tile in second column"), Cells[1] == FIntRect(64, 0, 128, 128));
+	// 32x32 scaled to fit 64x128 keeps its aspect and is centered
+	TestTrue(TEXT("Small tile fitted and centered"), Cells[2] == FIntRect(0, 160, 64, 224));
+
+	const TArrayView64<FColor> Pixels = Atlas.AsBGRA8();
+	TestTrue(TEXT("First tile copied"), Pixels[10 * 128 + 10] == FColor(255, 0, 0, 255));
+	TestTrue(TEXT("Empty cell transparent"), Pixels[200 * 128 + 100].A == 0);
+
+	FTextureAtlasLayout TooSmall;
+	TooSmall.Columns = 1;
+	TooSmall.Rows = 2;
+	TestFalse(TEXT("Grid too small rejected"), FTextureProcessingUtils::PackAtlas(Tiles, TooSmall, Settings, Atlas, Cells, Error));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FTextureProcessingBenchmarkTest,
+	"UnrealMCP.Editor.TextureProcessing.Benchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FTextureProcessingBenchmarkTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 Size = 2048;
+	const FImage Source = MakeFoliageImage(Size, 1234);
+	const double Megapixels = double(Size) * Size / 1.0e6;
+
+	auto TimeFlood = [&Source](bool bSingleThread, FImage& OutImage)
+	{
+		OutImage = Source;
+		FTextureProcessingSettings Settings;
+		Settings.bForceSingleThread = bSingleThread;
+		const double Start = FPlatformTime::Seconds();
+		FTextureProcessingUtils::MipFlood(OutImage, Settings);
+		return (FPlatformTime::Seconds() - Start) * 1000.0;
+	};
+
+	FImage SingleThreaded;
+	FImage Parallel;
+	const double SingleMs = TimeFlood(true, SingleThreaded);
+	const double ParallelMs = TimeFlood(false, Parallel);
+	AddInfo(FString::Printf(TEXT("MipFlood %dx%d: %.1f ms single-thread, %.1f ms parallel (%.0f MPix/s)"),
+		Size, Size, SingleMs, ParallelMs, Megapixels / FMath::Max(ParallelMs / 1000.0, 1e-6)));
+	TestTrue(TEXT("Parallel and single-thread results match"), SingleThreaded.RawData == Parallel.RawData);
+
+	// No texel that carried color in the source neighborhood may remain black after flooding
+	int64 BlackTransparent = 0;
+	for (const FColor& Pixel : Parallel.AsBGRA8())
+	{
+		BlackTransparent += (Pixel.A == 0 && Pixel.R == 0 && Pixel.G == 0 && Pixel.B == 0) ? 1 : 0;
+	}
+	TestEqual(TEXT("No black halo texels remain"), BlackTransparent, int64(0));
+
+	FTextureProcessingSettings Settings;
+	const double CoverageStart = FPlatformTime::Seconds();
+	const double Coverage = FTextureProcessingUtils::ComputeAlphaCoverage(Source, Settings);
+	AddInfo(FString::Printf(TEXT("AlphaCoverage %dx%d: %.2f ms (coverage %.3f)"),
+		Size, Size, (FPlatformTime::Seconds() - CoverageStart) * 1000.0, Coverage));
+
+	TArray<FImage> Tiles;
+	for (int32 Index = 0; Index < 16; ++Index)
+	{
+		Tiles.Add(MakeFoliageImage(1024, Index));
+	}
+	FTextureAtlasLayout Layout;
+	Layout.Width = 4096;
+	Layout.Height = 4096;
+	FImage Atlas;
+	TArray<FIntRect> Cells;
+	FString Error;
+	const double AtlasStart = FPlatformTime::Seconds();
+	TestTrue(TEXT("Atlas packs"), FTextureProcessingUtils::PackAtlas(Tiles, Layout, Settings, Atlas, Cells, Error));
+	AddInfo(FString::Printf(TEXT("PackAtlas 16x 1024^2 -> 4096^2: %.1f ms"), (FPlatformTime::Seconds() - AtlasStart) * 1000.0));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -23,6 +23,9 @@
 #include "Kismet/GameplayStatics.h"
 #include "Async/Async.h"
 #include "Containers/Ticker.h"
+#include "Misc/ScopeLock.h"
+#include "Services/MCPJobService.h"
+#include <atomic>
 // Add Blueprint related includes
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
@@ -226,22 +229,203 @@ bool UUnrealMCPBridge::ShouldDispatchViaTicker(const FString& CommandType)
         CommandType == TEXT("import_lod");
 }
 
+bool UUnrealMCPBridge::ShouldExecuteOnSocketThread(const FString& CommandType)
+{
+    // Job queries only touch the thread-safe FMCPJobService. Answering them here keeps
+    // polling responsive while the game thread is busy with the very job being polled.
+    return CommandType == TEXT("get_job_status") ||
+        CommandType == TEXT("cancel_job") ||
+        CommandType == TEXT("list_jobs");
+}
+
+namespace
+{
+    /** Serialize the response envelope handed back to the socket thread */
+    FString SerializeBridgeResponse(const TSharedPtr<FJsonObject>& ResponseJson)
+    {
+        FString ResultString;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ResultString);
+        FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer.Get());
+        return ResultString;
+    }
+
+    /** Parse a registry command's JSON result string back into an object */
+    TSharedPtr<FJsonObject> ParseCommandResult(const FString& CommandResult)
+    {
+        TSharedPtr<FJsonObject> ParsedResult;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(CommandResult);
+        if (FJsonSerializer::Deserialize(Reader, ParsedResult) && ParsedResult.IsValid())
+        {
+            return ParsedResult;
+        }
+
+        // If parsing fails, create error response
+        TSharedPtr<FJsonObject> ErrorResult = MakeShared<FJsonObject>();
+        ErrorResult->SetBoolField(TEXT("success"), false);
+        ErrorResult->SetStringField(TEXT("error"), TEXT("Failed to parse command result"));
+        return ErrorResult;
+    }
+
+    /** Wrap a command result into the bridge's {status, result} / {status, error, ...} envelope */
+    TSharedPtr<FJsonObject> WrapCommandResult(const TSharedPtr<FJsonObject>& ResultJson)
+    {
+        TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
+
+        // Check if the result contains an error
+        bool bSuccess = true;
+        FString ErrorMessage;
+        
+        if (ResultJson->HasField(TEXT("success")))
+        {
+            bSuccess = ResultJson->GetBoolField(TEXT("success"));
+            if (!bSuccess && ResultJson->HasField(TEXT("error")))
+            {
+                ErrorMessage = ResultJson->GetStringField(TEXT("error"));
+            }
+        }
+        
+        if (bSuccess)
+        {
+            // Set success status and include the result
+            ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+            ResponseJson->SetObjectField(TEXT("result"), ResultJson);
+        }
+        else
+        {
+            // Set error status and preserve ALL fields from the command result
+            ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+            ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
+            
+            // Copy all additional fields from ResultJson to ResponseJson (e.g., compilation_errors)
+            for (const auto& Pair : ResultJson->Values)
+            {
+                const FString Key = FString(Pair.Key.ToView());
+                // Skip 'success' and 'error' as we already handled them
+                if (Key != TEXT("success") && Key != TEXT("error"))
+                {
+                    ResponseJson->SetField(Key, Pair.Value);
+                }
+            }
+        }
+        return ResponseJson;
+    }
+
+    /** Whether a serialized bridge envelope reports success */
+    bool IsSuccessEnvelope(const FString& Envelope)
+    {
+        TSharedPtr<FJsonObject> EnvelopeJson;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Envelope);
+        FString Status;
+        return FJsonSerializer::Deserialize(Reader, EnvelopeJson) && EnvelopeJson.IsValid() &&
+            EnvelopeJson->TryGetStringField(TEXT("status"), Status) && Status == TEXT("success");
+    }
+
+    /**
+     * Shared between the socket thread waiting on a command and the game thread running it.
+     * Once the socket thread stops waiting, the command is handed to FMCPJobService and the
+     * game thread stores its response there instead of it being discarded.
+     */
+    struct FPendingCommand
+    {
+        TPromise<FString> Promise;
+        FCriticalSection Lock;
+        FString JobId;
+        bool bFulfilled = false;
+        std::atomic<bool> bCancelled{false};
+
+        /** Game thread: stops registry commands that are already running (see FMCPCommandCancellation) */
+        TSharedRef<FMCPCommandCancellation> Cancellation = MakeShared<FMCPCommandCancellation>();
+
+        /** Game thread: deliver the response to whoever is still interested */
+        void Fulfil(const FString& Response)
+        {
+            FString HandedOffJobId;
+            {
+                FScopeLock ScopeLock(&Lock);
+                bFulfilled = true;
+                HandedOffJobId = JobId;
+            }
+            if (!HandedOffJobId.IsEmpty())
+            {
+                FMCPJobService::Get().Complete(HandedOffJobId, Response, IsSuccessEnvelope(Response));
+            }
+            Promise.SetValue(Response);
+        }
+    };
+
+    /**
+     * Socket thread: turn a command that is still running into a job
+     * @return The job id, or empty when the command finished in the meantime
+     */
+    FString HandOffToJob(const TSharedRef<FPendingCommand>& Pending, const FString& CommandType)
+    {
+        FScopeLock ScopeLock(&Pending->Lock);
+        if (Pending->bFulfilled)
+        {
+            return FString();
+        }
+        // Work that has not started yet is skipped; registry commands already running are cancelled
+        // through their hook, and anything else finishes and is discarded
+        Pending->JobId = FMCPJobService::Get().CreateJob(CommandType, [Pending]()
+        {
+            Pending->bCancelled.store(true, std::memory_order_relaxed);
+            Pending->Cancellation->Cancel();
+        });
+        return Pending->JobId;
+    }
+
+    FString MakeJobPendingResponse(const FString& CommandType, const FString& JobId)
+    {
+        TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+        ResultJson->SetBoolField(TEXT("success"), true);
+        ResultJson->SetBoolField(TEXT("job_pending"), true);
+        ResultJson->SetStringField(TEXT("job_id"), JobId);
+        ResultJson->SetStringField(TEXT("command"), CommandType);
+        ResultJson->SetStringField(TEXT("state"), FMCPJobSnapshot::StateToString(EMCPJobState::Running));
+        ResultJson->SetStringField(TEXT("message"), FString::Printf(
+            TEXT("'%s' is still running. Poll get_job_status with job_id '%s' for its result."), *CommandType, *JobId));
+        return SerializeBridgeResponse(WrapCommandResult(ResultJson));
+    }
+}
+
 // Execute a command received from a client
-FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const FMCPDispatchOptions& Options)
 {
     UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Executing command: %s"), *CommandType);
 
+    if (ShouldExecuteOnSocketThread(CommandType))
+    {
+        FString ParamsString;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ParamsString);
+        FJsonSerializer::Serialize(Params.ToSharedRef(), Writer.Get());
+
+        FString CommandResult;
+        FUnrealMCPCommandRegistry::Get().ExecuteCommandDeferred(CommandType, ParamsString, [&CommandResult](const FString& Result)
+        {
+            CommandResult = Result;
+        });
+        return SerializeBridgeResponse(WrapCommandResult(ParseCommandResult(CommandResult)));
+    }
+
     // Commands whose downstream work requires a normal game-thread context run via
     // FTSTicker, outside TaskGraph. See ShouldDispatchViaTicker for each reason.
     const bool bUseTicker = ShouldDispatchViaTicker(CommandType);
 
-    // Use TSharedPtr<TPromise> so lambda is copyable (required by FTickerDelegate)
-    TSharedPtr<TPromise<FString>> PromisePtr = MakeShared<TPromise<FString>>();
-    TFuture<FString> Future = PromisePtr->GetFuture();
+    // Shared state keeps the lambda copyable (required by FTickerDelegate)
+    TSharedRef<FPendingCommand> Pending = MakeShared<FPendingCommand>();
+    TFuture<FString> Future = Pending->Promise.GetFuture();
 
-    auto ExecuteLambda = [this, CommandType, Params, PromisePtr]() mutable
+    auto ExecuteLambda = [this, CommandType, Params, Pending]() mutable
     {
         TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
+
+        if (Pending->bCancelled.load(std::memory_order_relaxed))
+        {
+            ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+            ResponseJson->SetStringField(TEXT("error"), TEXT("Cancelled before it started"));
+            Pending->Fulfil(SerializeBridgeResponse(ResponseJson));
+            return;
+        }
         
         try
         {
@@ -339,23 +523,14 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                     TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ParamsString);
                     FJsonSerializer::Serialize(Params.ToSharedRef(), Writer.Get());
                     
-                    // Execute command through new registry
-                    FString CommandResult = CommandRegistry.ExecuteCommand(CommandType, ParamsString);
-                    
-                    // Parse result back to JSON object
-                    TSharedPtr<FJsonObject> ParsedResult;
-                    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(CommandResult);
-                    if (FJsonSerializer::Deserialize(Reader, ParsedResult) && ParsedResult.IsValid())
-                    {
-                        ResultJson = ParsedResult;
-                    }
-                    else
+                    // Execute command through new registry. Deferred commands (GPU readback,
+                    // worker-thread encoding) return here immediately and fulfil the promise
+                    // from a later game-thread tick; synchronous ones complete inline.
+                    CommandRegistry.ExecuteCommandDeferred(CommandType, ParamsString, [Pending](const FString& CommandResult)
                     {
-                        // If parsing fails, create error response
-                        ResultJson = MakeShared<FJsonObject>();
-                        ResultJson->SetBoolField(TEXT("success"), false);
-                        ResultJson->SetStringField(TEXT("error"), TEXT("Failed to parse command result"));
-                    }
+                        Pending->Fulfil(SerializeBridgeResponse(WrapCommandResult(ParseCommandResult(CommandResult))));
+                    }, Pending->Cancellation);
+                    return;
                 }
                 // Fall back to legacy command handlers
                 else if (EditorCommandsList.Contains(CommandType))
@@ -386,51 +561,12 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                 {
                     ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
                     ResponseJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown command: %s"), *CommandType));
-                    
-                    FString ResultString;
-                    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ResultString);
-                    FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer.Get());
-                    PromisePtr->SetValue(ResultString);
+                    Pending->Fulfil(SerializeBridgeResponse(ResponseJson));
                     return;
                 }
             }
             
-            // Check if the result contains an error
-            bool bSuccess = true;
-            FString ErrorMessage;
-            
-            if (ResultJson->HasField(TEXT("success")))
-            {
-                bSuccess = ResultJson->GetBoolField(TEXT("success"));
-                if (!bSuccess && ResultJson->HasField(TEXT("error")))
-                {
-                    ErrorMessage = ResultJson->GetStringField(TEXT("error"));
-                }
-            }
-            
-            if (bSuccess)
-            {
-                // Set success status and include the result
-                ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-                ResponseJson->SetObjectField(TEXT("result"), ResultJson);
-            }
-            else
-            {
-                // Set error status and preserve ALL fields from the command result
-                ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-                ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
-                
-                // Copy all additional fields from ResultJson to ResponseJson (e.g., compilation_errors)
-                for (const auto& Pair : ResultJson->Values)
-                {
-                    const FString Key = FString(Pair.Key.ToView());
-                    // Skip 'success' and 'error' as we already handled them
-                    if (Key != TEXT("success") && Key != TEXT("error"))
-                    {
-                        ResponseJson->SetField(Key, Pair.Value);
-                    }
-                }
-            }
+            ResponseJson = WrapCommandResult(ResultJson);
         }
         catch (const std::exception& e)
         {
@@ -438,10 +574,7 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
             ResponseJson->SetStringField(TEXT("error"), UTF8_TO_TCHAR(e.what()));
         }
         
-        FString ResultString;
-        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ResultString);
-        FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer.Get());
-        PromisePtr->SetValue(ResultString);
+        Pending->Fulfil(SerializeBridgeResponse(ResponseJson));
     };
 
     if (bUseTicker)
@@ -462,12 +595,24 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
         AsyncTask(ENamedThreads::GameThread, MoveTemp(ExecuteLambda));
     }
 
-    static constexpr double CommandTimeoutSeconds = 120.0;
-    if (Future.WaitFor(FTimespan::FromSeconds(CommandTimeoutSeconds)))
+    // The socket thread never waits for the whole command: past the inline window the
+    // command becomes a job and keeps running, and its response is kept for get_job_status
+    if (!Options.bAsync)
+    {
+        const double WaitSeconds = FMath::Clamp(Options.InlineWaitSeconds, 0.0, FMCPDispatchOptions::MaxInlineWaitSeconds);
+        if (Future.WaitFor(FTimespan::FromSeconds(WaitSeconds)))
+        {
+            return Future.Get();
+        }
+    }
+
+    const FString JobId = HandOffToJob(Pending, CommandType);
+    if (JobId.IsEmpty())
     {
+        // Finished while being handed off; the response is about to be set
         return Future.Get();
     }
 
-    UE_LOG(LogTemp, Error, TEXT("UnrealMCPBridge: Command '%s' timed out after %.0f seconds"), *CommandType, CommandTimeoutSeconds);
-    return TEXT("{\"status\":\"error\",\"error\":\"Command timed out after 120 seconds\"}");
+    UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Command '%s' continues as %s"), *CommandType, *JobId);
+    return MakeJobPendingResponse(CommandType, JobId);
 }
@@ -3,6 +3,16 @@
 #include "Factories/ComponentFactory.h"
 #include "Factories/WidgetFactory.h"
 #include "Services/ObjectPoolManager.h"
+#include "Services/ReflectionCatalog.h"
+#include "Services/ImageCaptureService.h"
+#include "Services/FrameTelemetry.h"
+#include "Services/SceneStatsCache.h"
+#include "Services/MetadataResponseCache.h"
+#include "Services/MetaSoundPaletteIndex.h"
+#include "Services/BulkImportService.h"
+#include "Services/LodGenerationService.h"
+#include "Services/MCPJobService.h"
+#include "Services/NiagaraService.h"
 #include "Commands/UnrealMCPMainDispatcher.h"
 #include "MCPLogging.h"
 #include "Modules/ModuleManager.h"
@@ -25,6 +35,23 @@ void FUnrealMCPModule::StartupModule()
 	
 	UE_LOG_MCP_INFO("ObjectPoolManager initialized with object pools");
 	
+	// Subscribe the shared reflection catalog to hot reload / module / Blueprint compile events
+	FReflectionCatalog::Get().Initialize();
+	
+	UE_LOG_MCP_INFO("ReflectionCatalog initialized");
+	
+	// Start the always-on frame-time sampler queried by get_frame_telemetry
+	FFrameTelemetry::Get().Initialize();
+	
+	// Track editor scene edits so get_scene_breakdown only re-reads what changed
+	FSceneStatsCache::Get().Initialize();
+	
+	// Track asset changes so repeated get_*_metadata calls can be answered from cache
+	FMetadataResponseCache::Get().Initialize();
+	
+	// Rebuild the MetaSound palette index only when node classes are registered or removed
+	FMetaSoundPaletteIndex::Get().Initialize();
+	
 	// Initialize the ComponentFactory with default types
 	FComponentFactory& ComponentFactory = FComponentFactory::Get();
 	ComponentFactory.InitializeDefaultTypes();
@@ -49,12 +76,25 @@ void FUnrealMCPModule::ShutdownModule()
 {
 	UE_LOG_MCP_INFO("Unreal MCP Module shutting down");
 	
+	// Abandon in-flight screenshot readbacks before the commands waiting on them go away
+	FImageCaptureService::Get().Shutdown();
+	
 	// Shutdown the command dispatcher and registry
 	FUnrealMCPMainDispatcher& Dispatcher = FUnrealMCPMainDispatcher::Get();
 	Dispatcher.Shutdown();
 	
 	UE_LOG_MCP_INFO("Command dispatcher shut down and commands unregistered");
 	
+	FReflectionCatalog::Get().Shutdown();
+	FFrameTelemetry::Get().Shutdown();
+	FSceneStatsCache::Get().Shutdown();
+	FMetadataResponseCache::Get().Shutdown();
+	FMetaSoundPaletteIndex::Get().Shutdown();
+	FBulkImportService::Get().Shutdown();
+	FLodGenerationService::Get().Shutdown();
+	FMCPJobService::Get().Shutdown();
+	FNiagaraService::Get().Shutdown();
+	
 	// Shutdown the ObjectPoolManager
 	FObjectPoolManager& PoolManager = FObjectPoolManager::Get();
 	PoolManager.Shutdown();
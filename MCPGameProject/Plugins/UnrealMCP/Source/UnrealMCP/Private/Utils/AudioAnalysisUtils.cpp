@@ -0,0 +1,361 @@
+#include "Utils/AudioAnalysisUtils.h"
+
+#include "Async/ParallelFor.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+    /** Short waveforms are cheaper to walk on one thread than to dispatch */
+    constexpr int32 MinParallelFrames = 16384;
+
+    /** Float lanes are flushed into double totals this often so long files keep their precision */
+    constexpr int32 AccumulateBlockSize = 4096;
+
+    /** BS.1770 block length and hop, in seconds */
+    constexpr double LoudnessBlockSeconds = 0.4;
+    constexpr double LoudnessHopSeconds = 0.1;
+    constexpr double AbsoluteGateLufs = -70.0;
+    constexpr double RelativeGateLu = -10.0;
+
+    EParallelForFlags ChannelFlags(const TArray<TArray<float>>& Channels, const FAudioAnalysisSettings& Settings)
+    {
+        const bool bSmall = Channels.Num() < 2 || Channels[0].Num() < MinParallelFrames;
+        return (Settings.bForceSingleThread || bSmall) ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+    }
+
+    /** Transposed direct form II biquad, coefficients normalized by a0 */
+    struct FBiquad
+    {
+        double B0 = 1.0;
+        double B1 = 0.0;
+        double B2 = 0.0;
+        double A1 = 0.0;
+        double A2 = 0.0;
+        double Z1 = 0.0;
+        double Z2 = 0.0;
+
+        FBiquad(double InB0, double InB1, double InB2, double A0, double InA1, double InA2)
+            : B0(InB0 / A0), B1(InB1 / A0), B2(InB2 / A0), A1(InA1 / A0), A2(InA2 / A0)
+        {
+        }
+
+        double Process(double X)
+        {
+            const double Y = B0 * X + Z1;
+            Z1 = B1 * X - A1 * Y + Z2;
+            Z2 = B2 * X - A2 * Y;
+            return Y;
+        }
+    };
+
+    /**
+     * K-weighting stage 1: high shelf modelling the acoustic effect of the head (+4 dB above ~1.7 kHz)
+     * Derived through the bilinear transform so any sample rate reproduces the BS.1770 48 kHz coefficients
+     */
+    FBiquad MakeHighShelf(double SampleRate)
+    {
+        const double Frequency = 1681.974450955533;
+        const double GainDb = 3.999843853973347;
+        const double Q = 0.7071752369554196;
+
+        const double K = FMath::Tan(UE_DOUBLE_PI * Frequency / SampleRate);
+        const double Vh = FMath::Pow(10.0, GainDb / 20.0);
+        const double Vb = FMath::Pow(Vh, 0.4996667741545416);
+
+        return FBiquad(
+            Vh + Vb * K / Q + K * K,
+            2.0 * (K * K - Vh),
+            Vh - Vb * K / Q + K * K,
+            1.0 + K / Q + K * K,
+            2.0 * (K * K - 1.0),
+            1.0 - K / Q + K * K);
+    }
+
+    /** K-weighting stage 2: the RLB high-pass (~38 Hz) */
+    FBiquad MakeHighPass(double SampleRate)
+    {
+        const double Frequency = 38.13547087602444;
+        const double Q = 0.5003270373238773;
+
+        const double K = FMath::Tan(UE_DOUBLE_PI * Frequency / SampleRate);
+        const double A0 = 1.0 + K / Q + K * K;
+
+        // The numerator stays unnormalized (1, -2, 1) as in the standard
+        return FBiquad(
+            A0,
+            -2.0 * A0,
+            A0,
+            A0,
+            2.0 * (K * K - 1.0),
+            1.0 - K / Q + K * K);
+    }
+
+    /** 5.1 and 7.1 (L R C LFE Ls Rs [Lb Rb]): the LFE is excluded and surrounds weigh +1.5 dB */
+    double ChannelWeight(int32 Channel, int32 NumChannels)
+    {
+        if (NumChannels == 6 || NumChannels == 8)
+        {
+            if (Channel == 3)
+            {
+                return 0.0;
+            }
+            if (Channel >= 4)
+            {
+                return 1.41;
+            }
+        }
+        return 1.0;
+    }
+
+    double HorizontalSum(VectorRegister4Float Vector)
+    {
+        alignas(16) float Lanes[4];
+        VectorStoreAligned(Vector, Lanes);
+        return double(Lanes[0]) + double(Lanes[1]) + double(Lanes[2]) + double(Lanes[3]);
+    }
+}
+
+void FAudioAnalysisUtils::DeinterleavePcm16(TConstArrayView<int16> Interleaved, int32 NumChannels, TArray<TArray<float>>& OutChannels)
+{
+    OutChannels.SetNum(FMath::Max(NumChannels, 0));
+    if (NumChannels <= 0)
+    {
+        return;
+    }
+
+    const int32 NumFrames = Interleaved.Num() / NumChannels;
+    const int16* Source = Interleaved.GetData();
+    constexpr float Scale = 1.0f / 32768.0f;
+    for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+    {
+        TArray<float>& Dest = OutChannels[Channel];
+        Dest.SetNumUninitialized(NumFrames);
+        float* DestData = Dest.GetData();
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            DestData[Frame] = float(Source[Frame * NumChannels + Channel]) * Scale;
+        }
+    }
+}
+
+FAudioChannelStats FAudioAnalysisUtils::ComputeChannelStats(TConstArrayView<float> Samples, float ClipThreshold)
+{
+    FAudioChannelStats Stats;
+    const int32 NumSamples = Samples.Num();
+    if (NumSamples == 0)
+    {
+        return Stats;
+    }
+
+    const float* Data = Samples.GetData();
+    const int32 NumVectorSamples = NumSamples & ~3;
+    const VectorRegister4Float Threshold = VectorSetFloat1(ClipThreshold);
+    VectorRegister4Float PeakVector = GlobalVectorConstants::FloatZero;
+
+    double Sum = 0.0;
+    double SumSquares = 0.0;
+    int64 Clipped = 0;
+
+    for (int32 BlockStart = 0; BlockStart < NumVectorSamples; BlockStart += AccumulateBlockSize)
+    {
+        const int32 BlockEnd = FMath::Min(BlockStart + AccumulateBlockSize, NumVectorSamples);
+        VectorRegister4Float SumVector = GlobalVectorConstants::FloatZero;
+        VectorRegister4Float SquaresVector = GlobalVectorConstants::FloatZero;
+
+        for (int32 Index = BlockStart; Index < BlockEnd; Index += 4)
+        {
+            const VectorRegister4Float Value = VectorLoad(Data + Index);
+            const VectorRegister4Float Magnitude = VectorAbs(Value);
+            SumVector = VectorAdd(SumVector, Value);
+            SquaresVector = VectorMultiplyAdd(Value, Value, SquaresVector);
+            PeakVector = VectorMax(PeakVector, Magnitude);
+            Clipped += FMath::CountBits(uint64(VectorMaskBits(VectorCompareGE(Magnitude, Threshold))));
+        }
+
+        Sum += HorizontalSum(SumVector);
+        SumSquares += HorizontalSum(SquaresVector);
+    }
+
+    alignas(16) float PeakLanes[4];
+    VectorStoreAligned(PeakVector, PeakLanes);
+    float Peak = FMath::Max(FMath::Max(PeakLanes[0], PeakLanes[1]), FMath::Max(PeakLanes[2], PeakLanes[3]));
+
+    for (int32 Index = NumVectorSamples; Index < NumSamples; ++Index)
+    {
+        const float Value = Data[Index];
+        const float Magnitude = FMath::Abs(Value);
+        Sum += Value;
+        SumSquares += double(Value) * Value;
+        Peak = FMath::Max(Peak, Magnitude);
+        Clipped += Magnitude >= ClipThreshold ? 1 : 0;
+    }
+
+    Stats.Peak = Peak;
+    Stats.Rms = float(FMath::Sqrt(SumSquares / NumSamples));
+    Stats.DcOffset = float(Sum / NumSamples);
+    Stats.ClippedSamples = Clipped;
+    return Stats;
+}
+
+bool FAudioAnalysisUtils::ComputeIntegratedLoudness(const TArray<TArray<float>>& Channels, int32 SampleRate, const FAudioAnalysisSettings& Settings, float& OutLoudness)
+{
+    if (Channels.Num() == 0 || SampleRate <= 0)
+    {
+        return false;
+    }
+
+    const int32 NumFrames = Channels[0].Num();
+    const int32 HopFrames = FMath::RoundToInt32(SampleRate * LoudnessHopSeconds);
+    const int32 HopsPerBlock = FMath::RoundToInt32(LoudnessBlockSeconds / LoudnessHopSeconds);
+    const int32 NumHops = HopFrames > 0 ? NumFrames / HopFrames : 0;
+    const int32 NumBlocks = NumHops - HopsPerBlock + 1;
+    if (NumBlocks <= 0)
+    {
+        return false;
+    }
+
+    // K-weighted energy of every 100 ms hop, per channel; the filters are recursive, so each
+    // channel runs on its own worker
+    const int32 NumChannels = Channels.Num();
+    TArray<TArray<double>> HopEnergy;
+    HopEnergy.SetNum(NumChannels);
+    ParallelFor(NumChannels, [&](int32 Channel)
+    {
+        TArray<double>& Energy = HopEnergy[Channel];
+        Energy.SetNumZeroed(NumHops);
+        if (ChannelWeight(Channel, NumChannels) == 0.0)
+        {
+            return;
+        }
+
+        FBiquad Shelf = MakeHighShelf(SampleRate);
+        FBiquad HighPass = MakeHighPass(SampleRate);
+        const float* Data = Channels[Channel].GetData();
+        for (int32 Hop = 0; Hop < NumHops; ++Hop)
+        {
+            double Sum = 0.0;
+            const int32 Start = Hop * HopFrames;
+            for (int32 Frame = Start; Frame < Start + HopFrames; ++Frame)
+            {
+                const double Filtered = HighPass.Process(Shelf.Process(Data[Frame]));
+                Sum += Filtered * Filtered;
+            }
+            Energy[Hop] = Sum;
+        }
+    }, ChannelFlags(Channels, Settings));
+
+    // Weighted mean square of each 400 ms block (75% overlap)
+    TArray<double> BlockPower;
+    BlockPower.SetNumUninitialized(NumBlocks);
+    const double BlockFrames = double(HopFrames) * HopsPerBlock;
+    for (int32 Block = 0; Block < NumBlocks; ++Block)
+    {
+        double Power = 0.0;
+        for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+        {
+            double Energy = 0.0;
+            for (int32 Hop = Block; Hop < Block + HopsPerBlock; ++Hop)
+            {
+                Energy += HopEnergy[Channel][Hop];
+            }
+            Power += ChannelWeight(Channel, NumChannels) * Energy / BlockFrames;
+        }
+        BlockPower[Block] = Power;
+    }
+
+    auto ToLoudness = [](double Power) { return -0.691 + 10.0 * FMath::LogX(10.0, FMath::Max(Power, 1e-20)); };
+    auto GatedMean = [&BlockPower, &ToLoudness](double GateLufs, double& OutMean)
+    {
+        double Sum = 0.0;
+        int32 Count = 0;
+        for (double Power : BlockPower)
+        {
+            if (ToLoudness(Power) > GateLufs)
+            {
+                Sum += Power;
+                ++Count;
+            }
+        }
+        OutMean = Count > 0 ? Sum / Count : 0.0;
+        return Count > 0;
+    };
+
+    double AbsoluteGatedPower = 0.0;
+    if (!GatedMean(AbsoluteGateLufs, AbsoluteGatedPower))
+    {
+        return false;
+    }
+
+    const double RelativeGate = FMath::Max(AbsoluteGateLufs, ToLoudness(AbsoluteGatedPower) + RelativeGateLu);
+    double GatedPower = 0.0;
+    if (!GatedMean(RelativeGate, GatedPower))
+    {
+        return false;
+    }
+
+    OutLoudness = float(ToLoudness(GatedPower));
+    return true;
+}
+
+void FAudioAnalysisUtils::FindTrimPoints(const TArray<TArray<float>>& Channels, float Threshold, int64& OutStartFrame, int64& OutEndFrame)
+{
+    const int32 NumFrames = Channels.Num() > 0 ? Channels[0].Num() : 0;
+    auto IsAudible = [&Channels, Threshold](int32 Frame)
+    {
+        for (const TArray<float>& Channel : Channels)
+        {
+            if (FMath::Abs(Channel[Frame]) >= Threshold)
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    int32 Start = 0;
+    while (Start < NumFrames && !IsAudible(Start))
+    {
+        ++Start;
+    }
+
+    int32 End = NumFrames;
+    while (End > Start && !IsAudible(End - 1))
+    {
+        --End;
+    }
+
+    OutStartFrame = Start;
+    OutEndFrame = End;
+}
+
+FAudioAnalysisResult FAudioAnalysisUtils::Analyze(const TArray<TArray<float>>& Channels, int32 SampleRate, const FAudioAnalysisSettings& Settings)
+{
+    FAudioAnalysisResult Result;
+    Result.SampleRate = SampleRate;
+    Result.NumChannels = Channels.Num();
+    Result.NumFrames = Channels.Num() > 0 ? Channels[0].Num() : 0;
+    Result.Channels.SetNum(Channels.Num());
+
+    ParallelFor(Channels.Num(), [&](int32 Channel)
+    {
+        Result.Channels[Channel] = ComputeChannelStats(Channels[Channel], Settings.ClipThreshold);
+    }, ChannelFlags(Channels, Settings));
+
+    double MeanSquareSum = 0.0;
+    for (const FAudioChannelStats& Stats : Result.Channels)
+    {
+        Result.Peak = FMath::Max(Result.Peak, Stats.Peak);
+        Result.ClippedSamples += Stats.ClippedSamples;
+        MeanSquareSum += double(Stats.Rms) * Stats.Rms;
+    }
+    Result.Rms = Result.NumChannels > 0 ? float(FMath::Sqrt(MeanSquareSum / Result.NumChannels)) : 0.0f;
+
+    Result.bHasLoudness = ComputeIntegratedLoudness(Channels, SampleRate, Settings, Result.IntegratedLoudness);
+    FindTrimPoints(Channels, FMath::Pow(10.0f, Settings.SilenceThresholdDb / 20.0f), Result.TrimStartFrame, Result.TrimEndFrame);
+    return Result;
+}
+
+float FAudioAnalysisUtils::ToDecibels(float Linear)
+{
+    return Linear > 0.0f ? FMath::Max(20.0f * FMath::LogX(10.0f, Linear), MinDecibels) : MinDecibels;
+}
@@ -0,0 +1,361 @@
+#include "Utils/TextureProcessingUtils.h"
+
+#include "Async/ParallelFor.h"
+#include "EditorFramework/AssetImportData.h"
+#include "Engine/Texture2D.h"
+#include "Math/VectorRegister.h"
+#include "UObject/Package.h"
+
+namespace
+{
+    constexpr int32 MaxAtlasDimension = 16384;
+
+    /** Small mips are cheaper to walk on one thread than to dispatch */
+    constexpr int32 MinParallelRows = 64;
+
+    EParallelForFlags RowFlags(int32 NumRows, const FTextureProcessingSettings& Settings)
+    {
+        return (Settings.bForceSingleThread || NumRows < MinParallelRows) ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+    }
+
+    /** One level of the flood pyramid: premultiplied color in XYZ, opaque-texel weight in W */
+    struct FFloodLevel
+    {
+        int32 Width = 0;
+        int32 Height = 0;
+        TArray64<FVector4f> Texels;
+
+        FVector4f* Row(int32 Y) { return Texels.GetData() + int64(Y) * Width; }
+        const FVector4f* Row(int32 Y) const { return Texels.GetData() + int64(Y) * Width; }
+    };
+
+    /** Mip 1 straight from the BGRA8 source: opaque texels weigh 1, the rest 0 */
+    void DownsampleSource(const FImage& Source, FFloodLevel& Out, const FTextureProcessingSettings& Settings)
+    {
+        const TArrayView64<const FColor> Pixels = const_cast<FImage&>(Source).AsBGRA8();
+        const int32 SrcW = Source.SizeX;
+        const int32 SrcH = Source.SizeY;
+        const VectorRegister4Float Threshold = VectorSetFloat1(Settings.AlphaThreshold * 255.0f);
+
+        ParallelFor(Out.Height, [&](int32 Y)
+        {
+            const int32 Y0 = FMath::Min(Y * 2, SrcH - 1);
+            const int32 Y1 = FMath::Min(Y * 2 + 1, SrcH - 1);
+            const FColor* Row0 = Pixels.GetData() + int64(Y0) * SrcW;
+            const FColor* Row1 = Pixels.GetData() + int64(Y1) * SrcW;
+            FVector4f* Dest = Out.Row(Y);
+
+            for (int32 X = 0; X < Out.Width; ++X)
+            {
+                const int32 X0 = FMath::Min(X * 2, SrcW - 1);
+                const int32 X1 = FMath::Min(X * 2 + 1, SrcW - 1);
+                const FColor* Samples[4] = { Row0 + X0, Row0 + X1, Row1 + X0, Row1 + X1 };
+
+                VectorRegister4Float Sum = GlobalVectorConstants::FloatZero;
+                for (const FColor* Sample : Samples)
+                {
+                    const VectorRegister4Float Color = VectorLoadByte4(Sample);
+                    const VectorRegister4Float Weight = VectorSelect(
+                        VectorCompareGE(VectorReplicate(Color, 3), Threshold),
+                        GlobalVectorConstants::FloatOne,
+                        GlobalVectorConstants::FloatZero);
+                    Sum = VectorAdd(Sum, VectorSelect(GlobalVectorConstants::XYZMask(), VectorMultiply(Color, Weight), Weight));
+                }
+                VectorStore(Sum, &Dest[X].X);
+            }
+        }, RowFlags(Out.Height, Settings));
+    }
+
+    /** Sum 2x2 premultiplied texels of the finer level */
+    void DownsampleLevel(const FFloodLevel& Source, FFloodLevel& Out, const FTextureProcessingSettings& Settings)
+    {
+        ParallelFor(Out.Height, [&](int32 Y)
+        {
+            const FVector4f* Row0 = Source.Row(FMath::Min(Y * 2, Source.Height - 1));
+            const FVector4f* Row1 = Source.Row(FMath::Min(Y * 2 + 1, Source.Height - 1));
+            FVector4f* Dest = Out.Row(Y);
+
+            for (int32 X = 0; X < Out.Width; ++X)
+            {
+                const int32 X0 = FMath::Min(X * 2, Source.Width - 1);
+                const int32 X1 = FMath::Min(X * 2 + 1, Source.Width - 1);
+                VectorRegister4Float Sum = VectorAdd(VectorLoad(&Row0[X0].X), VectorLoad(&Row0[X1].X));
+                Sum = VectorAdd(Sum, VectorAdd(VectorLoad(&Row1[X0].X), VectorLoad(&Row1[X1].X)));
+                VectorStore(Sum, &Dest[X].X);
+            }
+        }, RowFlags(Out.Height, Settings));
+    }
+
+    /**
+     * Turn a level's premultiplied sums into colors in place; texels with no opaque
+     * coverage take the already-resolved coarser level's color
+     */
+    void ResolveLevel(FFloodLevel& Level, const FFloodLevel* Coarser, const FTextureProcessingSettings& Settings)
+    {
+        ParallelFor(Level.Height, [&](int32 Y)
+        {
+            FVector4f* Row = Level.Row(Y);
+            const FVector4f* CoarseRow = Coarser ? Coarser->Row(FMath::Min(Y / 2, Coarser->Height - 1)) : nullptr;
+
+            for (int32 X = 0; X < Level.Width; ++X)
+            {
+                const VectorRegister4Float Sum = VectorLoad(&Row[X].X);
+                const VectorRegister4Float Weight = VectorReplicate(Sum, 3);
+                const VectorRegister4Float Color = VectorDivide(Sum, VectorMax(Weight, GlobalVectorConstants::SmallNumber));
+                const VectorRegister4Float Fallback = CoarseRow
+                    ? VectorLoad(&CoarseRow[FMath::Min(X / 2, Coarser->Width - 1)].X)
+                    : GlobalVectorConstants::FloatZero;
+                const VectorRegister4Float Resolved = VectorSelect(VectorCompareGT(Weight, GlobalVectorConstants::FloatZero), Color, Fallback);
+                VectorStore(Resolved, &Row[X].X);
+            }
+        }, RowFlags(Level.Height, Settings));
+    }
+}
+
+int64 FTextureProcessingUtils::MipFlood(FImage& Image, const FTextureProcessingSettings& Settings)
+{
+    check(Image.Format == ERawImageFormat::BGRA8);
+    if (Image.SizeX <= 1 && Image.SizeY <= 1)
+    {
+        return 0;
+    }
+
+    // Build the coverage-weighted pyramid down to 1x1
+    TArray<FFloodLevel> Levels;
+    int32 Width = Image.SizeX;
+    int32 Height = Image.SizeY;
+    while (Width > 1 || Height > 1)
+    {
+        Width = FMath::Max(1, (Width + 1) / 2);
+        Height = FMath::Max(1, (Height + 1) / 2);
+
+        FFloodLevel& Level = Levels.AddDefaulted_GetRef();
+        Level.Width = Width;
+        Level.Height = Height;
+        Level.Texels.SetNumUninitialized(int64(Width) * Height);
+
+        if (Levels.Num() == 1)
+        {
+            DownsampleSource(Image, Level, Settings);
+        }
+        else
+        {
+            DownsampleLevel(Levels[Levels.Num() - 2], Level, Settings);
+        }
+    }
+
+    // Resolve from the coarsest level up; each level only depends on the next coarser one
+    for (int32 Index = Levels.Num() - 1; Index >= 0; --Index)
+    {
+        ResolveLevel(Levels[Index], Levels.IsValidIndex(Index + 1) ? &Levels[Index + 1] : nullptr, Settings);
+    }
+
+    // Write flooded color into transparent mip-0 texels, keeping their alpha
+    const FFloodLevel& Mip1 = Levels[0];
+    const TArrayView64<FColor> Pixels = Image.AsBGRA8();
+    const uint8 AlphaCutoff = static_cast<uint8>(FMath::Clamp(FMath::CeilToInt(Settings.AlphaThreshold * 255.0f), 0, 255));
+    const int32 SrcW = Image.SizeX;
+    TArray<int64> FilledPerRow;
+    FilledPerRow.SetNumZeroed(Image.SizeY);
+
+    ParallelFor(Image.SizeY, [&](int32 Y)
+    {
+        FColor* Row = Pixels.GetData() + int64(Y) * SrcW;
+        const FVector4f* CoarseRow = Mip1.Row(FMath::Min(Y / 2, Mip1.Height - 1));
+        int64 Filled = 0;
+
+        for (int32 X = 0; X < SrcW; ++X)
+        {
+            if (Row[X].A >= AlphaCutoff)
+            {
+                continue;
+            }
+            const VectorRegister4Float Flooded = VectorAdd(
+                VectorLoad(&CoarseRow[FMath::Min(X / 2, Mip1.Width - 1)].X),
+                GlobalVectorConstants::FloatOneHalf);
+            VectorStoreByte4(VectorSelect(GlobalVectorConstants::XYZMask(), Flooded, VectorLoadByte4(&Row[X])), &Row[X]);
+            ++Filled;
+        }
+        FilledPerRow[Y] = Filled;
+    }, RowFlags(Image.SizeY, Settings));
+
+    int64 TotalFilled = 0;
+    for (int64 Filled : FilledPerRow)
+    {
+        TotalFilled += Filled;
+    }
+    return TotalFilled;
+}
+
+double FTextureProcessingUtils::ComputeAlphaCoverage(const FImage& Image, const FTextureProcessingSettings& Settings)
+{
+    check(Image.Format == ERawImageFormat::BGRA8);
+    const int64 NumPixels = Image.GetNumPixels();
+    if (NumPixels == 0)
+    {
+        return 0.0;
+    }
+
+    const TArrayView64<const FColor> Pixels = const_cast<FImage&>(Image).AsBGRA8();
+    const uint8 AlphaCutoff = static_cast<uint8>(FMath::Clamp(FMath::CeilToInt(Settings.AlphaThreshold * 255.0f), 0, 255));
+    TArray<int64> CoveredPerRow;
+    CoveredPerRow.SetNumZeroed(Image.SizeY);
+
+    ParallelFor(Image.SizeY, [&](int32 Y)
+    {
+        const FColor* Row = Pixels.GetData() + int64(Y) * Image.SizeX;
+        int64 Covered = 0;
+        for (int32 X = 0; X < Image.SizeX; ++X)
+        {
+            Covered += Row[X].A >= AlphaCutoff ? 1 : 0;
+        }
+        CoveredPerRow[Y] = Covered;
+    }, RowFlags(Image.SizeY, Settings));
+
+    int64 Covered = 0;
+    for (int64 RowCovered : CoveredPerRow)
+    {
+        Covered += RowCovered;
+    }
+    return double(Covered) / double(NumPixels);
+}
+
+bool FTextureProcessingUtils::PackAtlas(
+    const TArray<FImage>& Tiles,
+    FTextureAtlasLayout& InOutLayout,
+    const FTextureProcessingSettings& Settings,
+    FImage& OutAtlas,
+    TArray<FIntRect>& OutCells,
+    FString& OutError)
+{
+    const int32 NumTiles = Tiles.Num();
+    if (NumTiles == 0)
+    {
+        OutError = TEXT("Atlas needs at least one image");
+        return false;
+    }
+
+    if (InOutLayout.Columns <= 0)
+    {
+        InOutLayout.Columns = InOutLayout.Rows > 0
+            ? FMath::DivideAndRoundUp(NumTiles, InOutLayout.Rows)
+            : FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumTiles)));
+    }
+    if (InOutLayout.Rows <= 0)
+    {
+        InOutLayout.Rows = FMath::DivideAndRoundUp(NumTiles, InOutLayout.Columns);
+    }
+    if (InOutLayout.Columns * InOutLayout.Rows < NumTiles)
+    {
+        OutError = FString::Printf(TEXT("A %dx%d atlas grid cannot hold %d images"), InOutLayout.Columns, InOutLayout.Rows, NumTiles);
+        return false;
+    }
+
+    if (InOutLayout.Width <= 0 || InOutLayout.Height <= 0)
+    {
+        int32 MaxTileWidth = 1;
+        int32 MaxTileHeight = 1;
+        for (const FImage& Tile : Tiles)
+        {
+            MaxTileWidth = FMath::Max(MaxTileWidth, Tile.SizeX);
+            MaxTileHeight = FMath::Max(MaxTileHeight, Tile.SizeY);
+        }
+        if (InOutLayout.Width <= 0)
+        {
+            InOutLayout.Width = InOutLayout.Columns * MaxTileWidth;
+        }
+        if (InOutLayout.Height <= 0)
+        {
+            InOutLayout.Height = InOutLayout.Rows * MaxTileHeight;
+        }
+    }
+    if (InOutLayout.Width > MaxAtlasDimension || InOutLayout.Height > MaxAtlasDimension)
+    {
+        OutError = FString::Printf(TEXT("Atlas %dx%d exceeds the %d texel limit"), InOutLayout.Width, InOutLayout.Height, MaxAtlasDimension);
+        return false;
+    }
+
+    const int32 CellWidth = InOutLayout.Width / InOutLayout.Columns;
+    const int32 CellHeight = InOutLayout.Height / InOutLayout.Rows;
+    if (CellWidth < 1 || CellHeight < 1)
+    {
+        OutError = TEXT("Atlas cells would be smaller than one texel");
+        return false;
+    }
+
+    OutAtlas.Init(InOutLayout.Width, InOutLayout.Height, ERawImageFormat::BGRA8, EGammaSpace::sRGB);
+    FMemory::Memzero(OutAtlas.RawData.GetData(), OutAtlas.RawData.Num());
+    OutCells.SetNum(NumTiles);
+
+    // Tiles land in disjoint cells, so they are scaled and copied concurrently
+    const TArrayView64<FColor> AtlasPixels = OutAtlas.AsBGRA8();
+    ParallelFor(NumTiles, [&](int32 Index)
+    {
+        const FImage& Tile = Tiles[Index];
+        const float Scale = FMath::Min(float(CellWidth) / FMath::Max(Tile.SizeX, 1), float(CellHeight) / FMath::Max(Tile.SizeY, 1));
+        const int32 FitWidth = FMath::Clamp(FMath::FloorToInt(Tile.SizeX * Scale), 1, CellWidth);
+        const int32 FitHeight = FMath::Clamp(FMath::FloorToInt(Tile.SizeY * Scale), 1, CellHeight);
+
+        FImage Fitted;
+        if (FitWidth == Tile.SizeX && FitHeight == Tile.SizeY)
+        {
+            Tile.CopyTo(Fitted, ERawImageFormat::BGRA8, EGammaSpace::sRGB);
+        }
+        else
+        {
+            Tile.ResizeTo(Fitted, FitWidth, FitHeight, ERawImageFormat::BGRA8, EGammaSpace::sRGB);
+        }
+
+        const int32 CellX = (Index % InOutLayout.Columns) * CellWidth;
+        const int32 CellY = (Index / InOutLayout.Columns) * CellHeight;
+        const int32 OffsetX = CellX + (CellWidth - FitWidth) / 2;
+        const int32 OffsetY = CellY + (CellHeight - FitHeight) / 2;
+
+        const TArrayView64<const FColor> FittedPixels = Fitted.AsBGRA8();
+        for (int32 Y = 0; Y < FitHeight; ++Y)
+        {
+            FMemory::Memcpy(
+                AtlasPixels.GetData() + int64(OffsetY + Y) * InOutLayout.Width + OffsetX,
+                FittedPixels.GetData() + int64(Y) * FitWidth,
+                sizeof(FColor) * FitWidth);
+        }
+        OutCells[Index] = FIntRect(OffsetX, OffsetY, OffsetX + FitWidth, OffsetY + FitHeight);
+    }, Settings.bForceSingleThread ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+    return true;
+}
+
+UTexture2D* FTextureProcessingUtils::WriteTextureSource(
+    UPackage* Package,
+    const FString& AssetName,
+    const FImage& Image,
+    const FString& SourceFilePath,
+    bool& bOutCreated,
+    FString& OutError)
+{
+    bOutCreated = false;
+    UTexture2D* Texture = nullptr;
+
+    if (UObject* Existing = FindObject<UObject>(Package, *AssetName))
+    {
+        Texture = Cast<UTexture2D>(Existing);
+        if (!Texture)
+        {
+            OutError = FString::Printf(TEXT("%s already exists as a %s"), *Existing->GetPathName(), *Existing->GetClass()->GetName());
+            return nullptr;
+        }
+        Texture->PreEditChange(nullptr);
+    }
+    else
+    {
+        Texture = NewObject<UTexture2D>(Package, FName(*AssetName), RF_Public | RF_Standalone | RF_Transactional);
+        bOutCreated = true;
+    }
+
+    Texture->Source.Init(Image);
+    if (Texture->AssetImportData && !SourceFilePath.IsEmpty())
+    {
+        Texture->AssetImportData->Update(SourceFilePath);
+    }
+    return Texture;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IAnimationBlueprintService.h"
+
+/**
+ * Command for building a whole state machine (states, transitions and their rules) in one call
+ */
+class UNREALMCP_API FBuildAnimStateMachineCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FBuildAnimStateMachineCommand(IAnimationBlueprintService& InService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+    /**
+     * Parse the machine description
+     * @param OutAnimBlueprintName - Target Animation Blueprint
+     * @param OutParams - States, transitions and build options
+     */
+    static bool ParseParameters(const FString& JsonString, FString& OutAnimBlueprintName, FAnimStateMachineBuildParams& OutParams, FString& OutError);
+
+private:
+    IAnimationBlueprintService& Service;
+
+    FString CreateSuccessResponse(const FAnimStateMachineBuildParams& Params, const FAnimStateMachineBuildResult& Result) const;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -33,6 +33,7 @@ private:
     static void RegisterCreateAnimStateMachineCommand();
     static void RegisterAddAnimStateCommand();
     static void RegisterAddAnimTransitionCommand();
+    static void RegisterBuildAnimStateMachineCommand();
     static void RegisterAddAnimVariableCommand();
     static void RegisterGetAnimBlueprintMetadataCommand();
     static void RegisterConfigureAnimSlotCommand();
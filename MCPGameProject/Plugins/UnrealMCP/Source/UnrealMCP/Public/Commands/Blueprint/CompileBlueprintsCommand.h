@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IBlueprintService.h"
+
+/**
+ * Command for compiling many Blueprint assets in one pass
+ * Queues every target into the compilation manager and flushes once, so shared dependents
+ * are reinstanced once per batch rather than once per Blueprint
+ */
+class UNREALMCP_API FCompileBlueprintsCommand : public IUnrealMCPCommand
+{
+public:
+    /**
+     * Constructor
+     * @param InBlueprintService - Reference to the blueprint service for operations
+     */
+    explicit FCompileBlueprintsCommand(IBlueprintService& InBlueprintService);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+    /**
+     * Parse JSON parameters for a batch compile
+     * @param JsonString - JSON string containing parameters
+     * @param OutBlueprintNames - blueprint_names with duplicates removed, in request order
+     * @param bOutSkipUpToDate - skip_up_to_date (default true)
+     * @param OutError - Error message if parsing fails
+     * @return true if parsing succeeded
+     */
+    static bool ParseParameters(const FString& JsonString, TArray<FString>& OutBlueprintNames, bool& bOutSkipUpToDate, FString& OutError);
+
+private:
+    /** Reference to the blueprint service */
+    IBlueprintService& BlueprintService;
+};
@@ -11,6 +11,7 @@ class IBlueprintService;
 /**
  * Command to retrieve comprehensive metadata about a Blueprint
  * Supports selective field querying for performance optimization
+ * Responses are cached and carry an etag; if_none_match returns not_modified while unchanged
  *
  * Uses BlueprintMetadataBuilderService for building the actual metadata JSON objects.
  */
@@ -59,9 +60,9 @@ private:
     /**
      * Create success response
      * @param Metadata - Metadata JSON object
-     * @return JSON response string
+     * @return JSON response object, serialized by the metadata response cache
      */
-    FString CreateSuccessResponse(const TSharedPtr<FJsonObject>& Metadata) const;
+    TSharedPtr<FJsonObject> CreateSuccessResponse(const TSharedPtr<FJsonObject>& Metadata) const;
 
     /**
      * Create error response
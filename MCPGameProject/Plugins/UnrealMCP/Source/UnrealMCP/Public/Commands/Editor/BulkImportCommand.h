@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+class IBulkImportBackend;
+struct FBulkImportItem;
+struct FBulkImportJobOptions;
+
+/**
+ * Command to import many meshes, textures and sounds in one call.
+ * Source files are read and decoded on worker threads; assets are created on the game
+ * thread within a per-tick budget. Returns a job id immediately; poll get_bulk_import_status.
+ */
+class UNREALMCP_API FBulkImportCommand : public IUnrealMCPCommand
+{
+public:
+	FBulkImportCommand() = default;
+	explicit FBulkImportCommand(TSharedRef<IBulkImportBackend> InBackend);
+
+	//~ IUnrealMCPCommand interface
+	virtual FString Execute(const FString& Parameters) override;
+	virtual FString GetCommandName() const override;
+	virtual bool ValidateParams(const FString& Parameters) const override;
+	//~ End IUnrealMCPCommand interface
+
+	/**
+	 * Parse the request into import items
+	 * Each entry of "files" is a path or an object with source_file_path and optional type,
+	 * asset_name, folder_path and per-type settings; top-level settings act as defaults.
+	 */
+	static bool ParseParameters(const FString& JsonString, TArray<FBulkImportItem>& OutItems, FBulkImportJobOptions& OutOptions, FString& OutError);
+
+private:
+	TSharedPtr<IBulkImportBackend> Backend;
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command to cancel a running job. Queued work is skipped; work already running on the game
+ * thread finishes and its result is kept but the job stays cancelled.
+ */
+class UNREALMCP_API FCancelJobCommand : public IUnrealMCPCommand
+{
+public:
+	//~ IUnrealMCPCommand interface
+	virtual FString Execute(const FString& Parameters) override;
+	virtual FString GetCommandName() const override;
+	virtual bool ValidateParams(const FString& Parameters) const override;
+	//~ End IUnrealMCPCommand interface
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command to report progress of a bulk_import job: per-state counts, per-item asset paths
+ * and errors, and how many asset builds are still compiling in the background.
+ */
+class UNREALMCP_API FGetBulkImportStatusCommand : public IUnrealMCPCommand
+{
+public:
+	//~ IUnrealMCPCommand interface
+	virtual FString Execute(const FString& Parameters) override;
+	virtual FString GetCommandName() const override;
+	virtual bool ValidateParams(const FString& Parameters) const override;
+	//~ End IUnrealMCPCommand interface
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Query the always-on frame telemetry ring (see FFrameTelemetry).
+ * Returns p50/p95/p99/max per timing channel, the worst hitches and a frame-time
+ * histogram over a recent window, without pausing or reconfiguring the editor.
+ */
+class UNREALMCP_API FGetFrameTelemetryCommand : public IUnrealMCPCommand
+{
+public:
+	FGetFrameTelemetryCommand() = default;
+
+	virtual FString Execute(const FString& Parameters) override;
+	virtual FString GetCommandName() const override;
+	virtual bool ValidateParams(const FString& Parameters) const override;
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command to report a job's state, progress and, once finished, the command's full response.
+ * Answered on the socket thread so polling works while the game thread runs the job.
+ */
+class UNREALMCP_API FGetJobStatusCommand : public IUnrealMCPCommand
+{
+public:
+	//~ IUnrealMCPCommand interface
+	virtual FString Execute(const FString& Parameters) override;
+	virtual FString GetCommandName() const override;
+	virtual bool ValidateParams(const FString& Parameters) const override;
+	//~ End IUnrealMCPCommand interface
+};
@@ -3,15 +3,31 @@
 #include "CoreMinimal.h"
 #include "Commands/IUnrealMCPCommand.h"
 
+class IMeshDrawStatsCaptureBackend;
+struct FMeshDrawStatsQuery;
+
 /**
  * Per-mesh draw count breakdown per render pass.
- * Triggers r.MeshDrawCommands.DumpStats CSV and parses results.
+ * Requests a mesh draw command stats capture for the next rendered frame, then parses,
+ * groups (by entry, resource, material or pass) and ranks it on a worker thread.
  */
 class UNREALMCP_API FGetMeshDrawStatsCommand : public IUnrealMCPCommand
 {
 public:
-	FGetMeshDrawStatsCommand() = default;
+	FGetMeshDrawStatsCommand();
+	explicit FGetMeshDrawStatsCommand(TSharedRef<IMeshDrawStatsCaptureBackend> InBackend);
+
+	/** Returns stats_pending if no capture has landed yet; a later call picks it up */
 	virtual FString Execute(const FString& Parameters) override;
+
+	/** Waits for the requested capture across frames, then aggregates off the game thread */
+	virtual void ExecuteDeferred(const FString& Parameters, TFunction<void(const FString&)> OnComplete) override;
+
 	virtual FString GetCommandName() const override;
 	virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+	bool ParseQuery(const FString& Parameters, FMeshDrawStatsQuery& OutQuery, double& OutTimeoutSeconds, FString& OutError) const;
+
+	TSharedRef<IMeshDrawStatsCaptureBackend> Backend;
 };
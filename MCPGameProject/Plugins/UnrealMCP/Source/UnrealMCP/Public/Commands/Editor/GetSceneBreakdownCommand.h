@@ -3,16 +3,35 @@
 #include "CoreMinimal.h"
 #include "Commands/IUnrealMCPCommand.h"
 
+struct FSceneStatsBreakdown;
+struct FSceneStatsSnapshot;
+
 /**
  * Diagnostic command: per-mesh breakdown of scene rendering cost.
- * Iterates all StaticMesh/ISM/HISM components, aggregates by mesh,
- * returns sorted by total triangle cost (instances * tris).
+ * Reads StaticMesh/ISM/HISM components from the incrementally maintained FSceneStatsCache,
+ * aggregates by mesh on worker threads and returns sorted by total triangle cost (instances * tris).
  */
 class UNREALMCP_API FGetSceneBreakdownCommand : public IUnrealMCPCommand
 {
 public:
 	FGetSceneBreakdownCommand() = default;
 	virtual FString Execute(const FString& Parameters) override;
+	virtual void ExecuteDeferred(const FString& Parameters, TFunction<void(const FString&)> OnComplete) override;
 	virtual FString GetCommandName() const override;
 	virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+	struct FRequest
+	{
+		FString MeshFilter;
+		int32 MaxResults = 50;
+		FVector CameraLocation = FVector::ZeroVector;
+		bool bHasCamera = false;
+	};
+
+	/** Parse parameters, refresh the cache and return the cached breakdown if it is still current */
+	bool PrepareRequest(const FString& Parameters, FRequest& OutRequest, TSharedPtr<const FSceneStatsSnapshot>& OutSnapshot,
+		TSharedPtr<const FSceneStatsBreakdown>& OutCachedBreakdown, FString& OutError) const;
+
+	static FString SerializeBreakdown(const FSceneStatsBreakdown& Breakdown, const FRequest& Request, bool bFromCache);
 };
@@ -2,10 +2,38 @@
 
 #include "CoreMinimal.h"
 #include "Commands/IUnrealMCPCommand.h"
+#include "Engine/TextureDefines.h"
+
+/**
+ * Optional in-process processing applied before the texture source is written
+ */
+struct FImportTextureProcessing
+{
+	/** Fill transparent texels' color from surrounding opaque texels */
+	bool bMipFlood = false;
+
+	/** Scale mip alpha so cutout coverage stays constant with distance */
+	bool bPreserveAlphaCoverage = false;
+
+	/** Opacity threshold (0-1) for flooding and coverage */
+	float AlphaThreshold = 0.333f;
+
+	/** When set, these files are packed into one atlas instead of importing source_file_path */
+	TArray<FString> AtlasSources;
+	int32 AtlasColumns = 0;
+	int32 AtlasRows = 0;
+	int32 AtlasWidth = 0;
+	int32 AtlasHeight = 0;
+
+	/** Whether the source must be decoded and processed in memory */
+	bool RequiresDecode() const { return bMipFlood || AtlasSources.Num() > 0; }
+};
 
 /**
  * Command to import a texture file (PNG, TGA, TIF, JPEG, EXR, HDR) from disk into the Unreal project.
  * Self-contained — uses UTextureFactory directly, no service layer needed.
+ * Mip flooding and atlas packing decode the sources in memory and write the processed
+ * pixels straight into the texture source (see FTextureProcessingUtils).
  */
 class UNREALMCP_API FImportTextureCommand : public IUnrealMCPCommand
 {
@@ -27,8 +55,18 @@ private:
 		FString& OutCompressionSettings,
 		bool& OutSRGB,
 		bool& OutPreserveAlpha,
+		FImportTextureProcessing& OutProcessing,
 		FString& OutError) const;
 
+	FString ExecuteProcessed(
+		const FString& SourceFilePath,
+		const FString& AssetName,
+		const FString& DestinationPath,
+		TextureCompressionSettings Compression,
+		bool bSRGB,
+		bool bPreserveAlpha,
+		const FImportTextureProcessing& Processing) const;
+
 	FString CreateSuccessResponse(const FString& AssetPath, const FString& AssetName, int32 SizeX, int32 SizeY, bool bHasAlpha) const;
 	FString CreateErrorResponse(const FString& ErrorMessage) const;
 };
@@ -3,6 +3,47 @@
 #include "CoreMinimal.h"
 #include "Engine/Engine.h"
 
+/**
+ * Cancellation hook for one deferred command execution
+ *
+ * cancel_job triggers it for a command the bridge has handed off to a job. A command whose
+ * work can be stopped installs a handler that stops it and then reports its (cancelled)
+ * result as usual. Game thread only.
+ */
+class FMCPCommandCancellation
+{
+public:
+    /** Replace the handler run on cancellation; pass nullptr once there is nothing left to stop */
+    void SetHandler(TFunction<void()> InHandler)
+    {
+        Handler = MoveTemp(InHandler);
+    }
+
+    /** Run the handler once; later calls do nothing */
+    void Cancel()
+    {
+        if (bCancelled)
+        {
+            return;
+        }
+        bCancelled = true;
+
+        // The handler typically completes the command, which clears the handler
+        TFunction<void()> Run = MoveTemp(Handler);
+        Handler.Reset();
+        if (Run)
+        {
+            Run();
+        }
+    }
+
+    bool IsCancelled() const { return bCancelled; }
+
+private:
+    TFunction<void()> Handler;
+    bool bCancelled = false;
+};
+
 /**
  * Interface for all MCP commands that can be executed by the UnrealMCP system.
  * Provides a standardized way to execute commands, validate parameters, and get command metadata.
@@ -19,6 +60,30 @@ public:
      */
     virtual FString Execute(const FString& Parameters) = 0;
 
+    /**
+     * Execute the command and report the result through a callback.
+     * Commands that wait on the GPU or worker tasks override this so the game thread is not
+     * blocked while they finish; OnComplete is then invoked later on the game thread.
+     * The default implementation runs Execute synchronously.
+     * @param Parameters JSON string containing command parameters
+     * @param OnComplete Callback receiving the JSON result string; must be invoked exactly once
+     */
+    virtual void ExecuteDeferred(const FString& Parameters, TFunction<void(const FString&)> OnComplete)
+    {
+        OnComplete(Execute(Parameters));
+    }
+
+    /**
+     * ExecuteDeferred for callers that can cancel the execution while it is still running.
+     * Commands whose work can be stopped override this and install a handler on Cancellation;
+     * by default cancelling completes the command with an error and drops its late result.
+     * @param Cancellation Cancellation hook for this execution; outlives OnComplete
+     */
+    virtual void ExecuteCancellable(const FString& Parameters, TFunction<void(const FString&)> OnComplete, FMCPCommandCancellation& Cancellation)
+    {
+        ExecuteDeferred(Parameters, MoveTemp(OnComplete));
+    }
+
     /**
      * Get the name/identifier of this command
      * @return Command name used for registration and lookup
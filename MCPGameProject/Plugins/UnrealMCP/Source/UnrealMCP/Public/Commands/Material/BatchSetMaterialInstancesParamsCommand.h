@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+class IMaterialService;
+struct FMaterialInstanceBatchResult;
+
+/**
+ * Command for applying the same parameter set to many Material Instances in a single operation.
+ * Each instance is loaded once and updated once, instead of one round trip per instance.
+ */
+class UNREALMCP_API FBatchSetMaterialInstancesParamsCommand : public IUnrealMCPCommand
+{
+public:
+    FBatchSetMaterialInstancesParamsCommand(IMaterialService& InMaterialService);
+    virtual ~FBatchSetMaterialInstancesParamsCommand() = default;
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override { return TEXT("batch_set_material_instances_params"); }
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    IMaterialService& MaterialService;
+
+    FString CreateResponse(const TArray<FMaterialInstanceBatchResult>& Results, const FString& Error) const;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -4,6 +4,8 @@
 #include "Commands/IUnrealMCPCommand.h"
 
 class IMaterialService;
+class FJsonObject;
+struct FMaterialParameterBatch;
 
 /**
  * Command for setting multiple parameters on a Material Instance in a single operation.
@@ -18,6 +20,13 @@ public:
     virtual FString GetCommandName() const override { return TEXT("batch_set_material_params"); }
     virtual bool ValidateParams(const FString& Parameters) const override;
 
+    /**
+     * Parse and validate the scalar_params / vector_params / texture_params objects.
+     * Shared with the multi-instance variant so both accept the same parameter format.
+     * @return false with OutError set if a map is malformed or none is present
+     */
+    static bool ParseParameterMaps(const TSharedPtr<FJsonObject>& JsonObject, FMaterialParameterBatch& OutBatch, FString& OutError);
+
 private:
     IMaterialService& MaterialService;
 
@@ -3,11 +3,28 @@
 #include "CoreMinimal.h"
 #include "Commands/IUnrealMCPCommand.h"
 
+class ILodGenerationBackend;
+struct FLodGenerationRequest;
+struct FLodGenerationJobOptions;
+
+/**
+ * Command to generate reduced LODs for one or many static meshes.
+ * LOD0 is reduced on worker threads; the game thread only commits, builds and saves.
+ * Returns a job id immediately; poll get_lod_job_status.
+ */
 class UNREALMCP_API FAutoGenerateLodsCommand : public IUnrealMCPCommand
 {
 public:
 	FAutoGenerateLodsCommand() = default;
+	explicit FAutoGenerateLodsCommand(TSharedRef<ILodGenerationBackend> InBackend);
+
 	virtual FString Execute(const FString& Parameters) override;
 	virtual FString GetCommandName() const override;
 	virtual bool ValidateParams(const FString& Parameters) const override;
+
+	/** Parse mesh_path/mesh_paths, target_lod_count and reduction_percentages into one request per mesh */
+	static bool ParseParameters(const FString& JsonString, TArray<FLodGenerationRequest>& OutRequests, FLodGenerationJobOptions& OutOptions, FString& OutError);
+
+private:
+	TSharedPtr<ILodGenerationBackend> Backend;
 };
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command to report progress of an auto_generate_lods / set_lod_count job: per-state counts
+ * and, per mesh, stage timings and triangle counts of every LOD.
+ */
+class UNREALMCP_API FGetLodJobStatusCommand : public IUnrealMCPCommand
+{
+public:
+	//~ IUnrealMCPCommand interface
+	virtual FString Execute(const FString& Parameters) override;
+	virtual FString GetCommandName() const override;
+	virtual bool ValidateParams(const FString& Parameters) const override;
+	//~ End IUnrealMCPCommand interface
+};
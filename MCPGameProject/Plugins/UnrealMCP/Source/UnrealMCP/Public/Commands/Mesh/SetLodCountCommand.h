@@ -3,11 +3,28 @@
 #include "CoreMinimal.h"
 #include "Commands/IUnrealMCPCommand.h"
 
+class ILodGenerationBackend;
+struct FLodGenerationRequest;
+struct FLodGenerationJobOptions;
+
+/**
+ * Command to change the LOD count of one or many static meshes.
+ * Existing LODs are kept; added slots are reduced from LOD0 through the LOD generation job.
+ * Returns a job id immediately; poll get_lod_job_status.
+ */
 class UNREALMCP_API FSetLodCountCommand : public IUnrealMCPCommand
 {
 public:
 	FSetLodCountCommand() = default;
+	explicit FSetLodCountCommand(TSharedRef<ILodGenerationBackend> InBackend);
+
 	virtual FString Execute(const FString& Parameters) override;
 	virtual FString GetCommandName() const override;
 	virtual bool ValidateParams(const FString& Parameters) const override;
+
+	/** Parse mesh_path/mesh_paths and lod_count into one request per mesh */
+	static bool ParseParameters(const FString& JsonString, TArray<FLodGenerationRequest>& OutRequests, FLodGenerationJobOptions& OutOptions, FString& OutError);
+
+private:
+	TSharedPtr<ILodGenerationBackend> Backend;
 };
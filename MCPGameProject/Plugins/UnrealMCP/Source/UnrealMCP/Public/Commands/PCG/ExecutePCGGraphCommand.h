@@ -2,22 +2,48 @@
 
 #include "CoreMinimal.h"
 #include "Commands/IUnrealMCPCommand.h"
+#include "Services/IPCGGenerationBackend.h"
 
 /**
- * Command for executing/regenerating a PCG Graph on an actor's PCG Component.
- * Finds an actor by name/label, locates its UPCGComponent, and triggers generation.
+ * Command for executing/regenerating PCG Graphs on one or more actors' PCG Components.
+ * All components are scheduled together so the PCG scheduler runs them concurrently; the
+ * response is sent once every component reports generation complete, with per-node
+ * timings and point counts.
  */
 class UNREALMCP_API FExecutePCGGraphCommand : public IUnrealMCPCommand
 {
 public:
-    FExecutePCGGraphCommand() = default;
+    FExecutePCGGraphCommand();
+    explicit FExecutePCGGraphCommand(TSharedRef<IPCGGenerationBackend> InBackend);
 
+    /** Schedules generation and returns without waiting for it to finish */
     virtual FString Execute(const FString& Parameters) override;
+
+    /** Answers once every component has finished generating (or timed out) */
+    virtual void ExecuteDeferred(const FString& Parameters, TFunction<void(const FString&)> OnComplete) override;
+
+    /** As ExecuteDeferred; cancelling stops the batch and answers with the components cancelled so far */
+    virtual void ExecuteCancellable(const FString& Parameters, TFunction<void(const FString&)> OnComplete, FMCPCommandCancellation& Cancellation) override;
+
     virtual FString GetCommandName() const override;
     virtual bool ValidateParams(const FString& Parameters) const override;
 
+    /**
+     * Read actor_name or actor_names (duplicates dropped), force, wait_for_completion,
+     * collect_node_stats and timeout_seconds
+     */
+    static bool ParseParameters(const FString& JsonString, TArray<FString>& OutActorNames, FPCGGenerationOptions& OutOptions,
+                                bool& bOutWaitForCompletion, FString& OutError);
+
 private:
-    bool ParseParameters(const FString& JsonString, FString& OutActorName, bool& OutForce, FString& OutError) const;
-    FString CreateSuccessResponse(const FString& Message) const;
+    /**
+     * Start a batch for the requested actors; OnComplete receives the JSON response
+     * @param Cancellation - When set and the response waits for completion, cancels the batch
+     */
+    void StartGeneration(const FString& Parameters, bool bForceNoWait, TFunction<void(const FString&)> OnComplete,
+                         FMCPCommandCancellation* Cancellation = nullptr);
+
     FString CreateErrorResponse(const FString& ErrorMessage) const;
+
+    TSharedRef<IPCGGenerationBackend> Backend;
 };
@@ -3,9 +3,13 @@
 #include "CoreMinimal.h"
 #include "Commands/IUnrealMCPCommand.h"
 
+class FViewport;
+
 /**
  * Command for capturing a screenshot of the active editor viewport.
  * Saves the image to a specified path and returns the file location.
+ * Runs deferred: the viewport texture is read back asynchronously and PNG encoding and
+ * the file write happen on a worker task, so the game thread is not stalled on the GPU.
  */
 class UNREALMCP_API FCaptureViewportScreenshotCommand : public IUnrealMCPCommand
 {
@@ -15,6 +19,18 @@ public:
 
 	// IUnrealMCPCommand interface
 	virtual FString Execute(const FString& Parameters) override;
+	virtual void ExecuteDeferred(const FString& Parameters, TFunction<void(const FString&)> OnComplete) override;
 	virtual FString GetCommandName() const override { return TEXT("capture_viewport_screenshot"); }
 	virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+	/**
+	 * Resolve the output path and active viewport, then render a fresh frame into it
+	 * @param Parameters - JSON parameters (optional output_path)
+	 * @param OutViewport - Viewport that was drawn
+	 * @param OutOutputPath - Absolute path the PNG will be written to
+	 * @param OutError - Error message if the capture cannot proceed
+	 * @return true if the viewport is ready to be read back
+	 */
+	bool PrepareCapture(const FString& Parameters, FViewport*& OutViewport, FString& OutOutputPath, FString& OutError) const;
 };
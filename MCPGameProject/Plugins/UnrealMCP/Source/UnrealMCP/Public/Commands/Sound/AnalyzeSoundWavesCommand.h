@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+class ISoundService;
+
+/**
+ * Command to analyze many sound waves in one request for audio QA
+ * Each wave is decoded once and measured for peak, RMS, integrated loudness, DC offset,
+ * silence trim points and clipping; waves are analyzed in parallel and cached by source hash.
+ */
+class UNREALMCP_API FAnalyzeSoundWavesCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FAnalyzeSoundWavesCommand(ISoundService& InSoundService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+    /** Read sound_wave_paths (or a single sound_wave_path); duplicates are dropped */
+    static bool ParseParameters(const FString& JsonString, TArray<FString>& OutSoundWavePaths, FString& OutError);
+
+private:
+    ISoundService& SoundService;
+
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
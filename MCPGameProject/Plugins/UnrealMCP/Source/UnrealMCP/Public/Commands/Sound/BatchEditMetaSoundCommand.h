@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/ISoundService.h"
+
+/**
+ * Command to apply many node, edge and input edits to one MetaSound through a single
+ * document builder, registering the graph and saving once
+ */
+class UNREALMCP_API FBatchEditMetaSoundCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FBatchEditMetaSoundCommand(ISoundService& InSoundService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+    /** Read metasound_path and the operations array; unknown ops are left for the service to report */
+    static bool ParseParameters(const FString& JsonString, FString& OutAssetPath, TArray<FSoundGraphOperation>& OutOperations, FString& OutError);
+
+private:
+    ISoundService& SoundService;
+
+    FString CreateSuccessResponse(const TArray<FSoundGraphOperation>& Operations, const TArray<FSoundGraphOperationResult>& Results) const;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -8,7 +8,8 @@ class ISoundService;
 
 /**
  * Command to get metadata about a sound wave asset
- * Returns duration, sample rate, channels, and other audio properties
+ * Returns duration, sample rate, channels, and other audio properties; with analyze set,
+ * also decodes the waveform and reports levels, loudness, silence and clipping
  */
 class UNREALMCP_API FGetSoundWaveMetadataCommand : public IUnrealMCPCommand
 {
@@ -33,10 +34,11 @@ private:
      * Parse command parameters from JSON
      * @param JsonString - JSON parameters string
      * @param OutSoundWavePath - Extracted sound wave path
+     * @param bOutAnalyze - Whether to add the waveform analysis (optional "analyze", default false)
      * @param OutError - Error message if parsing fails
      * @return true if parsing succeeded
      */
-    bool ParseParameters(const FString& JsonString, FString& OutSoundWavePath, FString& OutError) const;
+    bool ParseParameters(const FString& JsonString, FString& OutSoundWavePath, bool& bOutAnalyze, FString& OutError) const;
 
     /**
      * Create a success response with metadata
@@ -5,7 +5,8 @@
 #include "Services/IStateTreeService.h"
 
 /**
- * Command for compiling a StateTree for runtime use
+ * Command for compiling a StateTree for runtime use.
+ * Skips the compile when the editor data is unchanged since the last successful compile unless "force" is set.
  */
 class UNREALMCP_API FCompileStateTreeCommand : public IUnrealMCPCommand
 {
@@ -19,6 +20,6 @@ public:
 private:
     IStateTreeService& Service;
 
-    FString CreateSuccessResponse(const FString& StateTreeName) const;
+    FString CreateSuccessResponse(const FString& StateTreeName, const FStateTreeCompileStats& Stats) const;
     FString CreateErrorResponse(const FString& ErrorMessage) const;
 };
@@ -17,12 +17,15 @@ struct FWidgetScreenshotParams
 	int32 Width;
 	int32 Height;
 	FString Format;  // "png" or "jpg"
+	FString OutputMode;  // "base64" (inline image_base64) or "file" (written to OutputPath, returns path + sha1)
+	FString OutputPath;  // Absolute path, resolved when OutputMode is "file"
 };
 
 /**
  * Command for capturing a screenshot of a UMG Widget Blueprint preview
  * Renders the widget to a texture and returns as base64-encoded image data
  * This allows AI to visually inspect the widget layout
+ * Runs deferred: the game thread only enqueues the draw; GPU readback and encoding finish later
  */
 class UNREALMCP_API FCaptureWidgetScreenshotCommand : public IUnrealMCPCommand
 {
@@ -35,6 +38,7 @@ public:
 
 	// IUnrealMCPCommand interface
 	virtual FString Execute(const FString& Parameters) override;
+	virtual void ExecuteDeferred(const FString& Parameters, TFunction<void(const FString&)> OnComplete) override;
 	virtual FString GetCommandName() const override;
 	virtual bool ValidateParams(const FString& Parameters) const override;
 
@@ -49,6 +53,15 @@ private:
 	 */
 	TSharedPtr<FJsonObject> ExecuteInternal(const TSharedPtr<FJsonObject>& Params);
 
+	/**
+	 * Parse and validate the request, shared by the synchronous and deferred paths
+	 * @param Parameters - JSON string to parse
+	 * @param OutParams - Extracted screenshot parameters
+	 * @param OutErrorResponse - Serialized error response if the request is rejected
+	 * @return true if the capture can proceed
+	 */
+	bool PrepareRequest(const FString& Parameters, FWidgetScreenshotParams& OutParams, FString& OutErrorResponse) const;
+
 	/**
 	 * Internal validation with JSON objects
 	 * @param Params - JSON parameters
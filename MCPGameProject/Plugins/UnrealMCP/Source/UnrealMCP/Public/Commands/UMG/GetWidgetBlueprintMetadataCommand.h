@@ -27,6 +27,9 @@ class IUMGService;
  * - "graph_warnings" - Cast nodes with disconnected exec pins and other issues
  * - "*" - Return all available fields
  *
+ * Responses are cached and carry an etag; pass it back as if_none_match to get a
+ * not_modified reply while the widget blueprint is unchanged.
+ *
  * Uses WidgetMetadataBuilderService for building the actual metadata JSON objects.
  */
 class UNREALMCP_API FGetWidgetBlueprintMetadataCommand : public IUnrealMCPCommand
@@ -47,8 +50,8 @@ private:
 	/** Metadata builder service */
 	FWidgetMetadataBuilderService MetadataBuilder;
 
-	/** Internal execution with parsed JSON */
-	TSharedPtr<FJsonObject> ExecuteInternal(const TSharedPtr<FJsonObject>& Params);
+	/** Build the response for an already resolved widget blueprint */
+	TSharedPtr<FJsonObject> ExecuteInternal(const TSharedPtr<FJsonObject>& Params, class UWidgetBlueprint* WidgetBlueprint);
 
 	/** Parameter validation with error output */
 	bool ValidateParamsInternal(const TSharedPtr<FJsonObject>& Params, FString& OutError) const;
@@ -38,6 +38,18 @@ public:
      */
     FString ExecuteCommand(const FString& CommandName, const FString& Parameters);
     
+    /**
+     * Execute a command by name, reporting the result through a callback
+     * Synchronous commands complete before this returns; deferred commands
+     * (see IUnrealMCPCommand::ExecuteDeferred) complete on a later game-thread tick.
+     * @param CommandName - Name of the command to execute
+     * @param Parameters - JSON parameters for the command
+     * @param OnComplete - Receives the JSON response; invoked exactly once
+     * @param Cancellation - Optional hook for cancelling the execution while it is still running
+     */
+    void ExecuteCommandDeferred(const FString& CommandName, const FString& Parameters, TFunction<void(const FString&)> OnComplete,
+                                TSharedPtr<FMCPCommandCancellation> Cancellation = nullptr);
+    
     /**
      * Check if a command is registered
      * @param CommandName - Name of the command to check
@@ -79,6 +91,15 @@ private:
     /** Critical section for thread safety */
     mutable FCriticalSection RegistryLock;
     
+    /**
+     * Look up and validate a command, then run it, turning lookup/validation failures and exceptions into error responses
+     * @param CommandName - Name of the command to run
+     * @param Parameters - JSON parameters, validated before Run is called
+     * @param Run - Executes the found command
+     * @param OnError - Receives the error response when the command could not be run or threw
+     */
+    void DispatchCommand(const FString& CommandName, const FString& Parameters, TFunctionRef<void(IUnrealMCPCommand&)> Run, TFunctionRef<void(const FString&)> OnError);
+    
     /**
      * Create error response JSON
      * @param ErrorMessage - Error message
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UAnimBlueprint;
+class UAnimationAsset;
+class UAnimationGraph;
+class UAnimationStateMachineGraph;
+class UAnimGraphNode_StateMachine;
+class UAnimStateNode;
+class UAnimStateTransitionNode;
+struct FAnimStateParams;
+struct FAnimTransitionParams;
+
+/**
+ * A batch of edits against one state machine of an Animation Blueprint
+ *
+ * The AnimGraph and the state machine node are resolved once, and every state is indexed by
+ * name up front, so each edit is a map lookup instead of a scan of the graph. States created
+ * through the session are indexed as they are added, which lets transitions later in the same
+ * batch refer to them. Animation assets are loaded once per path. Commit notifies the graph
+ * and marks the blueprint modified once; the session never compiles or saves.
+ */
+class UNREALMCP_API FAnimStateMachineEditSession
+{
+public:
+    /**
+     * Resolve the state machine and index its states
+     * @param InAnimBlueprint - Target Animation Blueprint; may be null, in which case IsValid is false
+     * @param StateMachineName - Name of the state machine
+     * @param bCreateIfMissing - Add the state machine to the AnimGraph when it does not exist yet
+     */
+    FAnimStateMachineEditSession(UAnimBlueprint* InAnimBlueprint, const FString& StateMachineName, bool bCreateIfMissing = false);
+
+    /** True when the state machine and its graph exist */
+    bool IsValid() const { return StateMachineGraph != nullptr; }
+
+    /** Why the session is not valid */
+    const FString& GetError() const { return Error; }
+
+    /** True when the state machine was added by this session */
+    bool WasCreated() const { return bCreated; }
+
+    UAnimBlueprint* GetAnimBlueprint() const { return AnimBlueprint; }
+    UAnimGraphNode_StateMachine* GetStateMachineNode() const { return StateMachineNode; }
+
+    /** State by name */
+    UAnimStateNode* FindState(const FString& StateName) const;
+
+    /**
+     * Create a state and index it; binds a sequence player when an animation asset is given
+     * and makes it the entry state when Params.bIsDefaultState is set
+     * @return The new state, or nullptr when the name is taken or the node could not be built
+     */
+    UAnimStateNode* AddState(const FAnimStateParams& Params, FString& OutError);
+
+    /** Connect the entry node to a state, replacing the current entry state */
+    bool SetEntryState(const FString& StateName, FString& OutError);
+
+    /** Add a transition between two indexed states and apply its rule */
+    bool AddTransition(const FAnimTransitionParams& Params, FString& OutError);
+
+    /** Notify the graph and mark the blueprint modified; a no-op without changes */
+    void Commit();
+
+    /** True once any edit has been made */
+    bool HasChanges() const { return bModified; }
+
+    /** Number of indexed states */
+    int32 NumStates() const { return StatesByName.Num(); }
+
+    /**
+     * Add a state machine node and its graph to an AnimGraph
+     * @param StateMachineName - Requested name; the graph is renamed with a suggestion if it is taken
+     * @return The new node, or nullptr
+     */
+    static UAnimGraphNode_StateMachine* CreateStateMachineNode(UAnimationGraph* AnimGraph, const FString& StateMachineName, FString& OutError);
+
+private:
+    /** Blend logic and automatic rule of a transition from its rule type */
+    static void ApplyTransitionRule(UAnimStateTransitionNode* TransitionNode, const FAnimTransitionParams& Params);
+
+    /** Load an animation asset, reusing earlier loads in this session */
+    UAnimationAsset* LoadAnimationAsset(const FString& AssetPath);
+
+    UAnimBlueprint* AnimBlueprint = nullptr;
+    UAnimGraphNode_StateMachine* StateMachineNode = nullptr;
+    UAnimationStateMachineGraph* StateMachineGraph = nullptr;
+    TMap<FString, UAnimStateNode*> StatesByName;
+    TMap<FString, UAnimationAsset*> AssetsByPath;
+    FString Error;
+    bool bCreated = false;
+    bool bModified = false;
+};
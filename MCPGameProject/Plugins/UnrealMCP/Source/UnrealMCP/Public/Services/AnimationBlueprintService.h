@@ -33,6 +33,7 @@ public:
     virtual bool AddStateToStateMachine(UAnimBlueprint* AnimBlueprint, const FString& StateMachineName, const FAnimStateParams& Params, FString& OutError) override;
     virtual bool AddStateTransition(UAnimBlueprint* AnimBlueprint, const FString& StateMachineName, const FAnimTransitionParams& Params, FString& OutError) override;
     virtual bool GetStateMachineStates(UAnimBlueprint* AnimBlueprint, const FString& StateMachineName, TArray<FString>& OutStates) override;
+    virtual bool BuildStateMachine(UAnimBlueprint* AnimBlueprint, const FAnimStateMachineBuildParams& Params, FAnimStateMachineBuildResult& OutResult, FString& OutError) override;
 
     // Animation Variables
     virtual bool AddAnimVariable(UAnimBlueprint* AnimBlueprint, const FString& VariableName, const FString& VariableType, const FString& DefaultValue, FString& OutError) override;
@@ -82,14 +83,6 @@ private:
      */
     class UAnimGraphNode_StateMachine* FindStateMachineNode(UAnimBlueprint* AnimBlueprint, const FString& StateMachineName) const;
 
-    /**
-     * Find a state node within a state machine
-     * @param StateMachineGraph - The state machine graph
-     * @param StateName - Name of the state
-     * @return State node or nullptr
-     */
-    class UAnimStateNode* FindStateNode(class UAnimationStateMachineGraph* StateMachineGraph, const FString& StateName) const;
-
     /** Singleton instance */
     static TUniquePtr<FAnimationBlueprintService> Instance;
 };
@@ -29,6 +29,7 @@ public:
     virtual UBlueprint* CreateBlueprint(const FBlueprintCreationParams& Params) override;
     virtual bool AddComponentToBlueprint(UBlueprint* Blueprint, const FComponentCreationParams& Params, FString& OutErrorMessage) override;
     virtual bool CompileBlueprint(UBlueprint* Blueprint, FString& OutError) override;
+    virtual bool CompileBlueprints(const TArray<TPair<FString, UBlueprint*>>& Blueprints, bool bSkipUpToDate, FBlueprintBatchCompileResult& OutResult) override;
     virtual UBlueprint* FindBlueprint(const FString& BlueprintName) override;
     virtual bool AddVariableToBlueprint(UBlueprint* Blueprint, const FString& VariableName, const FString& VariableType, bool bIsExposed = false) override;
     virtual bool SetBlueprintProperty(UBlueprint* Blueprint, const FString& PropertyName, const TSharedPtr<FJsonValue>& PropertyValue, FString& OutErrorMessage) override;
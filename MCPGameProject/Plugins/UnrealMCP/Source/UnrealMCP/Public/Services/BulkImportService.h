@@ -0,0 +1,156 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Services/IBulkImportBackend.h"
+#include "Services/MCPTickedJobRegistry.h"
+#include <atomic>
+
+enum class EBulkImportItemState : uint8
+{
+	Queued,
+	Reading,
+	Ready,
+	Importing,
+	Succeeded,
+	Failed
+};
+
+struct FBulkImportJobOptions
+{
+	/** Game-thread time spent creating assets per tick; at least one item is imported per tick */
+	double FrameBudgetMs = 8.0;
+
+	/** Source files being read/decoded at once; also bounds how many decoded payloads wait in memory */
+	int32 MaxConcurrentReads = 4;
+};
+
+/** Copy of one item's progress for status queries */
+struct FBulkImportItemStatus
+{
+	FBulkImportItem Item;
+	EBulkImportItemState State = EBulkImportItemState::Queued;
+	FString Error;
+	TArray<FString> AssetPaths;
+	double ReadMs = 0.0;
+	double ImportMs = 0.0;
+};
+
+struct FBulkImportJobStatus
+{
+	FString JobId;
+	bool bComplete = false;
+	int32 Total = 0;
+	int32 Counts[6] = {};
+	double ElapsedMs = 0.0;
+	double ReadMs = 0.0;
+	double ImportMs = 0.0;
+	int32 Ticks = 0;
+	TArray<FBulkImportItemStatus> Items;
+
+	int32 Count(EBulkImportItemState State) const { return Counts[static_cast<int32>(State)]; }
+};
+
+/**
+ * One bulk import: source files are read and decoded on worker threads while the game
+ * thread creates assets from whatever has landed, within a per-tick time budget.
+ * Items are created in request order so output is deterministic.
+ */
+class UNREALMCP_API FBulkImportJob
+{
+public:
+	FBulkImportJob(FString InJobId, TArray<FBulkImportItem>&& InItems, const FBulkImportJobOptions& InOptions, TSharedRef<IBulkImportBackend> InBackend);
+
+	/**
+	 * Start reads up to the concurrency limit, then create ready assets until the budget runs out (game thread)
+	 * @return Number of items imported this tick
+	 */
+	int32 Tick();
+
+	bool IsComplete() const { return NextToImport >= Items.Num(); }
+
+	/**
+	 * Stop starting reads and fail every item not yet imported. Reads already running finish
+	 * and are discarded; the job completes on the tick after the last one lands.
+	 */
+	void Cancel();
+
+	const FString& GetJobId() const { return JobId; }
+
+	void GetStatus(FBulkImportJobStatus& OutStatus, bool bIncludeItems) const;
+
+	/** Item counts for FMCPJobService */
+	FMCPBatchJobCounts GetCounts() const;
+
+private:
+	/** Per-item state shared with the worker reading it */
+	struct FItemRecord
+	{
+		FBulkImportItem Item;
+		FBulkImportPayload Payload;
+		std::atomic<uint8> State{ static_cast<uint8>(EBulkImportItemState::Queued) };
+		FString Error;
+		TArray<FString> AssetPaths;
+		double ReadMs = 0.0;
+		double ImportMs = 0.0;
+
+		EBulkImportItemState GetState() const { return static_cast<EBulkImportItemState>(State.load(std::memory_order_acquire)); }
+		void SetState(EBulkImportItemState NewState) { State.store(static_cast<uint8>(NewState), std::memory_order_release); }
+	};
+
+	void StartReads();
+
+	FString JobId;
+	FBulkImportJobOptions Options;
+	TSharedRef<IBulkImportBackend> Backend;
+	TArray<TSharedRef<FItemRecord>> Items;
+
+	int32 NextToRead = 0;
+	int32 NextToImport = 0;
+	int32 TickCount = 0;
+	double StartSeconds = 0.0;
+	double EndSeconds = 0.0;
+	TSharedRef<std::atomic<bool>> bCancelled;
+};
+
+/**
+ * Owns running bulk import jobs and drives them from the core ticker
+ *
+ * Ticking from FTSTicker keeps FBX imports outside TaskGraph, the same context
+ * import_static_mesh is dispatched in.
+ */
+class UNREALMCP_API FBulkImportService
+{
+public:
+	/**
+	 * Get the singleton instance
+	 * @return Reference to the singleton instance
+	 */
+	static FBulkImportService& Get();
+
+	/** Cancel running jobs and stop ticking. Called from FUnrealMCPModule::ShutdownModule */
+	void Shutdown();
+
+	/**
+	 * Queue a bulk import (game thread)
+	 * @param Items - Files to import, in creation order
+	 * @param Options - Per-tick budget and read concurrency
+	 * @param Backend - Importer; null uses CreateBulkImportBackend()
+	 * @return Job id for GetJobStatus
+	 */
+	FString StartJob(TArray<FBulkImportItem>&& Items, const FBulkImportJobOptions& Options, TSharedPtr<IBulkImportBackend> Backend = nullptr);
+
+	/** Cancel a running job (game thread); false for unknown or finished ids */
+	bool CancelJob(const FString& JobId);
+
+	/** Snapshot a job's progress; false for unknown (or long-evicted) ids */
+	bool GetJobStatus(const FString& JobId, FBulkImportJobStatus& OutStatus, bool bIncludeItems) const;
+
+	/** Asset builds still running in the background after creation */
+	int32 GetNumPendingCompiles() const;
+
+private:
+	FBulkImportService();
+
+	TMCPTickedJobRegistry<FBulkImportJob> Jobs;
+	TSharedPtr<IBulkImportBackend> DefaultBackend;
+};
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * One frame's timing and render counters, as recorded at end of frame
+ */
+struct UNREALMCP_API FFrameTelemetrySample
+{
+	uint64 FrameNumber = 0;
+	double TimestampSeconds = 0.0;
+	float FrameMs = 0.0f;
+	float GameThreadMs = 0.0f;
+	float RenderThreadMs = 0.0f;
+	float RHIThreadMs = 0.0f;
+	float GPUMs = 0.0f;
+	uint32 DrawCalls = 0;
+	uint32 Primitives = 0;
+};
+
+/**
+ * Fixed-capacity single-producer ring of frame samples
+ *
+ * The game thread pushes one sample per frame; readers on any thread take a snapshot
+ * without locking. Each slot carries a sequence number (odd while being written), so a
+ * reader skips slots that are mid-write or were overwritten while it was copying.
+ */
+class UNREALMCP_API FFrameTelemetryRing
+{
+public:
+	/** @param InCapacity - Number of frames kept; rounded up to a power of two */
+	explicit FFrameTelemetryRing(uint32 InCapacity = 8192);
+
+	/** Append a sample, overwriting the oldest once full. Single producer only. */
+	void Push(const FFrameTelemetrySample& Sample);
+
+	/**
+	 * Copy retained samples, oldest first
+	 * @param OutSamples - Receives the samples
+	 * @param MinTimestampSeconds - Samples recorded before this time are skipped
+	 */
+	void Snapshot(TArray<FFrameTelemetrySample>& OutSamples, double MinTimestampSeconds = 0.0) const;
+
+	uint32 GetCapacity() const { return Capacity; }
+
+	/** Total samples ever pushed (not capped by capacity) */
+	uint64 GetTotalPushed() const { return WriteIndex.load(std::memory_order_acquire); }
+
+private:
+	struct FSlot
+	{
+		std::atomic<uint64> Sequence{0};
+		FFrameTelemetrySample Sample;
+	};
+
+	uint32 Capacity;
+	uint32 Mask;
+	TUniquePtr<FSlot[]> Slots;
+	std::atomic<uint64> WriteIndex{0};
+};
+
+/** Percentile summary of one channel over a window */
+struct UNREALMCP_API FFrameTelemetryChannelStats
+{
+	double P50 = 0.0;
+	double P95 = 0.0;
+	double P99 = 0.0;
+	double Max = 0.0;
+	double Average = 0.0;
+};
+
+/** A frame that exceeded the hitch threshold */
+struct UNREALMCP_API FFrameTelemetryHitch
+{
+	FFrameTelemetrySample Sample;
+
+	/** Which of game / render / rhi / gpu took longest that frame */
+	FString BoundBy;
+};
+
+/**
+ * Aggregated view over a window of samples
+ */
+struct UNREALMCP_API FFrameTelemetryReport
+{
+	int32 SampleCount = 0;
+	double WindowSeconds = 0.0;
+	double HitchThresholdMs = 0.0;
+
+	FFrameTelemetryChannelStats FrameMs;
+	FFrameTelemetryChannelStats GameThreadMs;
+	FFrameTelemetryChannelStats RenderThreadMs;
+	FFrameTelemetryChannelStats RHIThreadMs;
+	FFrameTelemetryChannelStats GPUMs;
+	FFrameTelemetryChannelStats DrawCalls;
+	FFrameTelemetryChannelStats Primitives;
+
+	/** Total hitches in the window; Hitches holds the worst ones, newest first */
+	int32 HitchCount = 0;
+	TArray<FFrameTelemetryHitch> Hitches;
+
+	/** Frame-time histogram: bucket i covers [i * BucketMs, (i + 1) * BucketMs); the last bucket is open-ended */
+	double HistogramBucketMs = 0.0;
+	TArray<int32> Histogram;
+};
+
+/** Query options for FFrameTelemetry::BuildReport */
+struct UNREALMCP_API FFrameTelemetryQuery
+{
+	/** Window ending now; <= 0 means everything retained */
+	double WindowSeconds = 10.0;
+
+	/** Frames at or above this are hitches; <= 0 picks max(MinHitchMs, 2 x median frame time) */
+	double HitchThresholdMs = 0.0;
+
+	int32 MaxHitches = 20;
+	double HistogramBucketMs = 4.0;
+	int32 HistogramBuckets = 25;
+};
+
+/**
+ * Always-on frame-time sampler
+ *
+ * Records game/render/RHI/GPU times and draw/primitive counts once per frame from
+ * FCoreDelegates::OnEndFrame into a lock-free ring (about two minutes at 60 fps).
+ * Recording costs a handful of global reads per frame; percentiles and hitches are only
+ * computed when queried, so the editor keeps running while it is being profiled.
+ */
+class UNREALMCP_API FFrameTelemetry
+{
+public:
+	/**
+	 * Get the singleton instance
+	 * @return Reference to the singleton instance
+	 */
+	static FFrameTelemetry& Get();
+
+	/** Start sampling. Called from FUnrealMCPModule::StartupModule */
+	void Initialize();
+
+	/** Stop sampling. Called from FUnrealMCPModule::ShutdownModule */
+	void Shutdown();
+
+	const FFrameTelemetryRing& GetRing() const { return Ring; }
+
+	/**
+	 * Summarize retained samples
+	 * @param Query - Window, hitch threshold and histogram layout
+	 * @param NowSeconds - Current FPlatformTime::Seconds() (the window ends here)
+	 * @return Report over the samples in the window
+	 */
+	FFrameTelemetryReport BuildReport(const FFrameTelemetryQuery& Query, double NowSeconds) const;
+
+	/**
+	 * Summarize an explicit set of samples (oldest first)
+	 * Pure function so the statistics can be tested without a running frame loop.
+	 */
+	static FFrameTelemetryReport BuildReport(const TArray<FFrameTelemetrySample>& Samples, const FFrameTelemetryQuery& Query);
+
+	/** Lower bound for the automatic hitch threshold (two frames at 60 fps) */
+	static constexpr double MinHitchMs = 33.3;
+
+private:
+	FFrameTelemetry() = default;
+
+	void HandleEndFrame();
+
+	FFrameTelemetryRing Ring;
+	FDelegateHandle EndFrameHandle;
+	double LastFrameTimestamp = 0.0;
+};
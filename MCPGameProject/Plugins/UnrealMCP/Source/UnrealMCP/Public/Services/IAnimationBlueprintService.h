@@ -104,6 +104,70 @@ struct UNREALMCP_API FAnimTransitionParams
     }
 };
 
+/**
+ * Full description of a state machine built in one pass
+ */
+struct UNREALMCP_API FAnimStateMachineBuildParams
+{
+    /** Name of the state machine */
+    FString StateMachineName;
+
+    /** States to add; existing states can be referenced by transitions without being listed */
+    TArray<FAnimStateParams> States;
+
+    /** Transitions to add, each with its rule */
+    TArray<FAnimTransitionParams> Transitions;
+
+    /** Entry state; overrides bIsDefaultState on the listed states when set */
+    FString EntryStateName;
+
+    /** Add the state machine to the AnimGraph when it does not exist yet */
+    bool bCreateIfMissing = true;
+
+    /** Compile the blueprint once after the whole machine is built */
+    bool bCompile = true;
+
+    /** Default constructor */
+    FAnimStateMachineBuildParams()
+    {
+    }
+};
+
+/**
+ * Item of a state machine build that could not be applied
+ */
+struct UNREALMCP_API FAnimStateMachineBuildItemError
+{
+    /** "state", "transition" or "entry" */
+    FString Kind;
+
+    /** Index into the States or Transitions array */
+    int32 Index = INDEX_NONE;
+
+    FString Error;
+};
+
+/**
+ * Outcome of a state machine build
+ */
+struct UNREALMCP_API FAnimStateMachineBuildResult
+{
+    /** True when the state machine was created by the build */
+    bool bCreatedStateMachine = false;
+
+    int32 NumStatesAdded = 0;
+    int32 NumTransitionsAdded = 0;
+
+    /** Items that were skipped */
+    TArray<FAnimStateMachineBuildItemError> ItemErrors;
+
+    /** Whether the blueprint compiled after the build (false when compile was not requested) */
+    bool bCompiled = false;
+
+    /** Compiler error when compile was requested and failed */
+    FString CompileError;
+};
+
 /**
  * Interface for Animation Blueprint service operations
  */
@@ -201,6 +265,19 @@ public:
      */
     virtual bool GetStateMachineStates(UAnimBlueprint* AnimBlueprint, const FString& StateMachineName, TArray<FString>& OutStates) = 0;
 
+    /**
+     * Build a state machine from a full description of its states and transitions
+     * The state machine and its states are resolved once and indexed by name; the blueprint is
+     * marked modified and compiled once at the end. Items that fail are reported in OutResult
+     * and do not stop the rest of the build.
+     * @param AnimBlueprint - Target Animation Blueprint
+     * @param Params - States, transitions and entry state
+     * @param OutResult - Counts, per-item errors and compile outcome
+     * @param OutError - Error message if the state machine could not be resolved
+     * @return true if the state machine was resolved (individual items may still have failed)
+     */
+    virtual bool BuildStateMachine(UAnimBlueprint* AnimBlueprint, const FAnimStateMachineBuildParams& Params, FAnimStateMachineBuildResult& OutResult, FString& OutError) = 0;
+
     // ============================================================================
     // Animation Variables
     // ============================================================================
@@ -36,6 +36,45 @@ struct UNREALMCP_API FBlueprintCreationParams
     bool IsValid(FString& OutError) const;
 };
 
+/**
+ * Outcome of one Blueprint in a batch compile
+ */
+struct UNREALMCP_API FBlueprintCompileResult
+{
+    /** Name the Blueprint was requested by */
+    FString BlueprintName;
+    
+    /** Status after the batch (BS_* without the prefix, e.g. "UpToDate", "Error") */
+    FString Status;
+    
+    /** True when the Blueprint was already up to date and was not queued */
+    bool bSkipped = false;
+    
+    /** Compiler messages collected from annotated nodes */
+    TArray<FString> Errors;
+    TArray<FString> Warnings;
+};
+
+/**
+ * Result of compiling several Blueprints through one compilation manager flush
+ */
+struct UNREALMCP_API FBlueprintBatchCompileResult
+{
+    TArray<FBlueprintCompileResult> Results;
+    
+    /** Blueprints the compilation manager recompiled because they depend on a requested one */
+    TArray<FString> DependentsRecompiled;
+    
+    /** Time spent queueing, in the single flush (all stages, all Blueprints), and collecting messages */
+    double QueueMs = 0.0;
+    double CompileMs = 0.0;
+    double CollectMs = 0.0;
+    
+    int32 NumCompiled = 0;
+    int32 NumSkipped = 0;
+    int32 NumFailed = 0;
+};
+
 /**
  * Interface for Blueprint service operations
  * Provides abstraction for Blueprint creation, modification, and management
@@ -69,6 +108,16 @@ public:
      */
     virtual bool CompileBlueprint(UBlueprint* Blueprint, FString& OutError) = 0;
     
+    /**
+     * Compile several Blueprints in one pass of the compilation manager queue
+     * Dependents shared by several targets are reinstanced once instead of once per target.
+     * @param Blueprints - Blueprints to compile, paired with the names they were requested by
+     * @param bSkipUpToDate - Leave Blueprints whose status is already up to date out of the queue
+     * @param OutResult - Per-Blueprint status and messages plus batch timing
+     * @return true if no Blueprint ended in an error state
+     */
+    virtual bool CompileBlueprints(const TArray<TPair<FString, UBlueprint*>>& Blueprints, bool bSkipUpToDate, FBlueprintBatchCompileResult& OutResult) = 0;
+    
     /**
      * Find a Blueprint by name
      * @param BlueprintName - Name of the Blueprint to find
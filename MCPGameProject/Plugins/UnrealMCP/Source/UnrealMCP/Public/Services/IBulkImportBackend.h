@@ -0,0 +1,88 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ImageCore.h"
+
+class FJsonObject;
+
+enum class EBulkImportAssetType : uint8
+{
+	StaticMesh,
+	Texture,
+	Sound
+};
+
+/** One source file to import and where it should land */
+struct UNREALMCP_API FBulkImportItem
+{
+	EBulkImportAssetType Type = EBulkImportAssetType::Texture;
+	FString SourceFilePath;
+	FString AssetName;
+
+	/** Destination content folder, already normalized under /Game */
+	FString FolderPath;
+
+	/** Texture settings, same meaning as import_texture */
+	FString CompressionSettings = TEXT("Default");
+	bool bSRGB = true;
+	bool bPreserveAlpha = true;
+
+	/** Remaining import_static_mesh options for meshes (import_materials, collision, vertex colors) */
+	TSharedPtr<FJsonObject> MeshOptions;
+
+	/**
+	 * Infer the asset type from a file extension
+	 * @return false for extensions none of the importers accept
+	 */
+	static bool ResolveType(const FString& Extension, EBulkImportAssetType& OutType);
+
+	/** Default destination folder for a type, matching the single-file import commands */
+	static FString DefaultFolder(EBulkImportAssetType Type);
+
+	static const TCHAR* TypeToString(EBulkImportAssetType Type);
+};
+
+/**
+ * Source data read (and for textures, decoded) on a worker thread
+ * Owned by one item; the game thread only touches it once the read has finished.
+ */
+struct UNREALMCP_API FBulkImportPayload
+{
+	/** Raw file bytes, kept only when the game-thread stage still needs them */
+	TArray64<uint8> Bytes;
+
+	/** Decoded texture pixels */
+	FImage Image;
+	bool bImageDecoded = false;
+
+	void Reset()
+	{
+		Bytes.Empty();
+		Image = FImage();
+		bImageDecoded = false;
+	}
+};
+
+class UNREALMCP_API IBulkImportBackend
+{
+public:
+	virtual ~IBulkImportBackend() = default;
+
+	/**
+	 * Read and decode one source file. Called concurrently from worker threads.
+	 * @return false with OutError when the file cannot be used
+	 */
+	virtual bool ReadSource(const FBulkImportItem& Item, FBulkImportPayload& OutPayload, FString& OutError) = 0;
+
+	/**
+	 * Create the asset(s) from a read payload (game thread)
+	 * Must not wait for texture compression or DDC builds; those finish asynchronously.
+	 * @param OutAssetPaths - Package paths of every asset created
+	 */
+	virtual bool CreateAssets(const FBulkImportItem& Item, FBulkImportPayload& Payload, TArray<FString>& OutAssetPaths, FString& OutError) = 0;
+
+	/** Asset builds (texture compression, mesh builds) still running in the background (game thread) */
+	virtual int32 GetNumPendingCompiles() const { return 0; }
+};
+
+UNREALMCP_API TSharedRef<IBulkImportBackend> CreateBulkImportBackend();
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MeshDescription.h"
+
+class UStaticMesh;
+
+/** LODs to build for one static mesh */
+struct UNREALMCP_API FLodGenerationRequest
+{
+	FString MeshPath;
+
+	/** Total LOD count including LOD0 (1-8) */
+	int32 LodCount = 3;
+
+	/**
+	 * Fraction of LOD0 triangles to keep, indexed by LOD; missing entries use DefaultPercentTriangles
+	 * Index 0 is applied as build-time reduction of LOD0 itself, the source geometry is never replaced.
+	 */
+	TArray<float> PercentTriangles;
+
+	/** Keep LODs that already exist below LodCount and only generate the new slots (set_lod_count) */
+	bool bKeepExistingLods = false;
+
+	/** Save the package once the mesh build has finished */
+	bool bSave = true;
+
+	/** Retention for a LOD, from PercentTriangles or evenly spaced down to 5% */
+	float ResolvePercentTriangles(int32 LodIndex) const;
+};
+
+struct FLodGenerationLodStats
+{
+	int32 LodIndex = 0;
+	float PercentTriangles = 1.0f;
+
+	/** True when this job reduced the LOD; false for LOD0 and kept LODs */
+	bool bGenerated = false;
+
+	/** Source geometry of the LOD (reduced output for generated LODs) */
+	int32 Triangles = 0;
+	int32 Vertices = 0;
+	float MaxDeviation = 0.0f;
+
+	/** Render data after the build, filled when the mesh is finalized */
+	int32 RenderTriangles = 0;
+	int32 RenderVertices = 0;
+};
+
+/**
+ * Data carried between the stages of one mesh
+ * The game thread copies LOD0 into Source, one worker reduces it into Reduced, and the game
+ * thread moves the results into the mesh. Only one thread touches it at a time.
+ */
+struct UNREALMCP_API FLodGenerationPayload
+{
+	TWeakObjectPtr<UStaticMesh> Mesh;
+	int32 PreviousLodCount = 0;
+	int32 SourceTriangles = 0;
+
+	/** Copy of LOD0, only taken when at least one LOD is generated */
+	FMeshDescription Source;
+
+	/** Reduced geometry indexed by LOD; only generated entries hold data */
+	TArray<FMeshDescription> Reduced;
+
+	TArray<FLodGenerationLodStats> Lods;
+
+	/** Fill Lods from the request once PreviousLodCount is known */
+	void PlanLods(const FLodGenerationRequest& Request);
+
+	int32 NumGenerated() const;
+
+	void ReleaseMeshData()
+	{
+		Source = FMeshDescription();
+		Reduced.Empty();
+	}
+};
+
+class UNREALMCP_API ILodGenerationBackend
+{
+public:
+	virtual ~ILodGenerationBackend() = default;
+
+	/**
+	 * Load the mesh, plan its LODs and copy LOD0 for reduction (game thread)
+	 * @return false with OutError when the mesh cannot be used
+	 */
+	virtual bool PrepareSource(const FLodGenerationRequest& Request, FLodGenerationPayload& Payload, FString& OutError) = 0;
+
+	/** Reduce the source copy into every generated LOD. Called concurrently from worker threads. */
+	virtual bool Reduce(const FLodGenerationRequest& Request, FLodGenerationPayload& Payload, FString& OutError) = 0;
+
+	/**
+	 * Move reduced geometry into the mesh and start its build (game thread)
+	 * Must not wait for the build; IsBuilding is polled until it finishes.
+	 */
+	virtual bool Commit(const FLodGenerationRequest& Request, FLodGenerationPayload& Payload, FString& OutError) = 0;
+
+	/** Whether the mesh build started by Commit is still running (game thread) */
+	virtual bool IsBuilding(const FLodGenerationPayload& Payload) const = 0;
+
+	/** Save the package if requested and read back render stats (game thread) */
+	virtual bool Finalize(const FLodGenerationRequest& Request, FLodGenerationPayload& Payload, FString& OutError) = 0;
+};
+
+UNREALMCP_API TSharedRef<ILodGenerationBackend> CreateLodGenerationBackend();
@@ -149,6 +149,47 @@ struct UNREALMCP_API FMaterialParameterSetParams
     }
 };
 
+/**
+ * A set of parameter writes to apply to one or more material instances
+ */
+struct UNREALMCP_API FMaterialParameterBatch
+{
+    /** Scalar parameters (name, value) */
+    TArray<TPair<FString, float>> ScalarParameters;
+
+    /** Vector parameters (name, RGBA value) */
+    TArray<TPair<FString, FLinearColor>> VectorParameters;
+
+    /** Texture parameters (name, texture asset path) */
+    TArray<TPair<FString, FString>> TextureParameters;
+
+    /** Returns true if the batch contains no writes */
+    bool IsEmpty() const
+    {
+        return ScalarParameters.IsEmpty() && VectorParameters.IsEmpty() && TextureParameters.IsEmpty();
+    }
+};
+
+/**
+ * Per-instance outcome of a multi-instance parameter batch
+ */
+struct UNREALMCP_API FMaterialInstanceBatchResult
+{
+    /** Path of the material instance as requested */
+    FString InstancePath;
+
+    /** True if every parameter write was applied to this instance */
+    bool bSuccess = false;
+
+    /** Failure reason(s), empty on success */
+    FString Error;
+
+    /** Names of the parameters that were applied, per type */
+    TArray<FString> AppliedScalars;
+    TArray<FString> AppliedVectors;
+    TArray<FString> AppliedTextures;
+};
+
 /**
  * Interface for Material service operations
  * Provides abstraction for material creation, modification, and parameter management
@@ -222,6 +263,18 @@ public:
      */
     virtual bool SetTextureParameter(const FString& MaterialPath, const FString& ParameterName, const FString& TexturePath, FString& OutError) = 0;
 
+    /**
+     * Apply the same parameter writes to many material instances in one pass.
+     * Each instance is resolved once, receives all writes, and gets a single PostEditChange;
+     * dependent render-state updates run once after the last instance.
+     * @param InstancePaths - Paths to the material instances
+     * @param Batch - Parameter writes to apply to every instance
+     * @param OutResults - Per-instance results, in the order of InstancePaths
+     * @param OutError - Error message if the batch could not start (e.g. a texture failed to load)
+     * @return true if every instance received every write
+     */
+    virtual bool BatchSetInstanceParameters(const TArray<FString>& InstancePaths, const FMaterialParameterBatch& Batch, TArray<FMaterialInstanceBatchResult>& OutResults, FString& OutError) = 0;
+
     /**
      * Get a scalar parameter value from a material
      * @param MaterialPath - Path to the material
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Mesh draw command stats held column-wise
+ *
+ * Pass/resource/category/material names are interned once into Names and each row stores
+ * indices into it, so grouping and filtering compare integers instead of strings.
+ */
+struct UNREALMCP_API FMeshDrawStatsTable
+{
+	TArray<FString> Names;
+
+	TArray<int32> Pass;
+	TArray<int32> Resource;
+	TArray<int32> Category;
+	TArray<int32> Material;
+	TArray<int32> LODIndex;
+
+	TArray<int64> VisiblePrimitives;
+	TArray<int64> VisibleVertices;
+	TArray<int64> VisibleInstances;
+	TArray<int64> TotalInstances;
+	TArray<int64> TotalPrimitives;
+	TArray<int64> TotalVertices;
+
+	int32 Num() const { return Pass.Num(); }
+
+	/**
+	 * Parse the renderer's stats dump (UTF-8 CSV, header row first) in a single pass
+	 * Columns are located by header name, so reordered or extra columns are tolerated.
+	 * Safe to call from any thread.
+	 * @param Utf8Csv - Raw dump bytes
+	 * @param OutTable - Receives the parsed rows
+	 * @param OutError - Set when the data has no recognizable header
+	 * @return true if a header was found (the table may still be empty)
+	 */
+	static bool Parse(const TArray64<uint8>& Utf8Csv, FMeshDrawStatsTable& OutTable, FString& OutError);
+};
+
+enum class EMeshDrawStatsGroupBy : uint8
+{
+	/** One row per draw command entry (no aggregation) */
+	Entry,
+	Resource,
+	Material,
+	Pass
+};
+
+struct FMeshDrawStatsQuery
+{
+	/** Case-insensitive resource-name substring; empty matches everything */
+	FString MeshFilter;
+	EMeshDrawStatsGroupBy GroupBy = EMeshDrawStatsGroupBy::Entry;
+
+	/** Rows kept after ranking by visible primitives */
+	int32 TopN = 100;
+};
+
+/** One ranked row; for grouped queries only the grouping name is set and counts are summed */
+struct FMeshDrawStatsRow
+{
+	FString Pass;
+	FString Resource;
+	FString Category;
+	FString Material;
+	int32 LODIndex = -1;
+	int32 EntryCount = 0;
+
+	int64 VisiblePrimitives = 0;
+	int64 VisibleVertices = 0;
+	int64 VisibleInstances = 0;
+	int64 TotalInstances = 0;
+	int64 TotalPrimitives = 0;
+	int64 TotalVertices = 0;
+};
+
+struct FMeshDrawStatsSummary
+{
+	/** Top rows, most visible primitives first */
+	TArray<FMeshDrawStatsRow> Rows;
+
+	/** Entries that passed the filter, and how many groups they formed */
+	int32 MatchedEntries = 0;
+	int32 GroupCount = 0;
+
+	int64 TotalVisiblePrimitives = 0;
+	int64 TotalVisibleVertices = 0;
+	int64 TotalVisibleInstances = 0;
+};
+
+/**
+ * Filter, group and rank a parsed table. Safe to call from any thread.
+ * Ranking keeps a bounded heap of TopN groups instead of sorting every group.
+ */
+UNREALMCP_API FMeshDrawStatsSummary AggregateMeshDrawStats(const FMeshDrawStatsTable& Table, const FMeshDrawStatsQuery& Query);
+
+/**
+ * A finished capture handed from the game thread to a worker
+ */
+struct UNREALMCP_API FMeshDrawStatsCapture
+{
+	/** Raw dump bytes, when the backend already holds them in memory */
+	TArray64<uint8> Bytes;
+
+	/** Otherwise the dump file the renderer wrote; it is read and deleted by ReadBytes */
+	FString FilePath;
+
+	/** Move the raw bytes out of the capture. Safe to call from any thread. */
+	bool ReadBytes(TArray64<uint8>& OutBytes, FString& OutError);
+};
+
+class UNREALMCP_API IMeshDrawStatsCaptureBackend
+{
+public:
+	virtual ~IMeshDrawStatsCaptureBackend() = default;
+
+	/** Ask the renderer to collect mesh draw command stats for the next rendered frame (game thread) */
+	virtual void RequestCapture() = 0;
+
+	/** Return the most recent capture if one has landed since the last request, else null (game thread) */
+	virtual TSharedPtr<FMeshDrawStatsCapture> TryTakeCapture() = 0;
+};
+
+UNREALMCP_API TSharedRef<IMeshDrawStatsCaptureBackend> CreateMeshDrawStatsCaptureBackend();
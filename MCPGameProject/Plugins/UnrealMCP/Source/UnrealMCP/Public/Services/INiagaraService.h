@@ -121,6 +121,28 @@ public:
      */
     virtual bool CompileAsset(const FString& AssetPath, FString& OutError) = 0;
 
+    /**
+     * Queue a recompile of a system after an edit.
+     * Requests are coalesced per system and start once edits have settled; nothing blocks on them.
+     * @param System - System that was edited
+     * @param bForce - Force a recompile even if the system considers itself up to date
+     */
+    virtual void QueueSystemCompile(UNiagaraSystem* System, bool bForce = false) = 0;
+
+    /**
+     * Start any queued compile for a system immediately
+     * @param System - System to flush
+     * @param bWaitForCompletion - Block until all outstanding compiles for the system have finished
+     */
+    virtual void FlushSystemCompile(UNiagaraSystem* System, bool bWaitForCompletion) = 0;
+
+    /**
+     * Get the compile state of a system
+     * @param System - System to query
+     * @return "queued", "compiling" or "up_to_date"
+     */
+    virtual FString GetSystemCompileStatus(const UNiagaraSystem* System) const = 0;
+
     /**
      * Duplicate a Niagara System
      * @param SourcePath - Path to the source system
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UPCGComponent;
+
+enum class EPCGGenerationState : uint8
+{
+	Generating,
+	Generated,
+	Cancelled,
+	Failed
+};
+
+struct FPCGGenerationOptions
+{
+	/** Regenerate even when the component considers itself up to date */
+	bool bForce = true;
+
+	/** Enable graph inspection while generating so per-node timings and outputs can be reported */
+	bool bCollectNodeStats = true;
+
+	/** Components still generating after this are cancelled and reported as failed */
+	double TimeoutSeconds = 300.0;
+};
+
+/** Aggregated over every execution of one node (loops and subgraph instances run it more than once) */
+struct FPCGNodeExecutionStats
+{
+	FString NodeName;
+	FString NodeTitle;
+	int32 Executions = 0;
+	double ExecutionMs = 0.0;
+	double PrepareMs = 0.0;
+	int32 OutputPoints = 0;
+	int32 OutputDataCount = 0;
+};
+
+struct FPCGComponentGenerationResult
+{
+	FString ActorLabel;
+	FString GraphPath;
+	EPCGGenerationState State = EPCGGenerationState::Generating;
+	FString Error;
+	double GenerationMs = 0.0;
+
+	/** Points and data items in the graph's final output */
+	int32 OutputPoints = 0;
+	int32 OutputDataCount = 0;
+
+	/** Slowest first; empty unless node stats were requested */
+	TArray<FPCGNodeExecutionStats> Nodes;
+
+	static const TCHAR* StateToString(EPCGGenerationState State);
+};
+
+/** Engine calls made by FPCGGenerationBatch, replaceable in tests */
+class UNREALMCP_API IPCGGenerationBackend
+{
+public:
+	virtual ~IPCGGenerationBackend() = default;
+
+	/**
+	 * Subscribe to the component's generated/cancelled notifications and schedule generation (game thread)
+	 * Generation itself runs on the PCG scheduler, so several components progress concurrently.
+	 * A component that is already generating for another listener is not rescheduled; the new
+	 * listener is notified when that generation finishes.
+	 * @param Listener - Identifies the subscription for StopTracking; one per batch
+	 * @param OnFinished - Called on the game thread with true when generated, false when cancelled
+	 * @return false with OutError when generation could not be scheduled
+	 */
+	virtual bool StartGeneration(UPCGComponent& Component, const FPCGGenerationOptions& Options, const void* Listener, TFunction<void(bool bGenerated)> OnFinished, FString& OutError) = 0;
+
+	/** Read output and per-node stats of a finished generation (game thread) */
+	virtual void CollectStats(UPCGComponent& Component, const FPCGGenerationOptions& Options, FPCGComponentGenerationResult& OutResult) = 0;
+
+	/** Cancel a generation that is still running, unless another listener still tracks it (game thread) */
+	virtual void CancelGeneration(UPCGComponent& Component) = 0;
+
+	/** Drop one listener's subscription; the last one also removes the inspection state added by StartGeneration (game thread) */
+	virtual void StopTracking(UPCGComponent& Component, const void* Listener) = 0;
+};
+
+/** Create the backend driving real PCG components */
+UNREALMCP_API TSharedRef<IPCGGenerationBackend> CreatePCGGenerationBackend();
@@ -389,6 +389,66 @@ struct UNREALMCP_API FMetaSoundOutputParams
     }
 };
 
+/**
+ * One node or edge edit in a batched graph edit (batch_edit_metasound / batch_edit_sound_cue)
+ *
+ * Node references (SourceNode, TargetNode, NodeId) accept either an existing node ID or the
+ * Ref of a node added earlier in the same batch.
+ */
+struct UNREALMCP_API FSoundGraphOperation
+{
+    /** "add_node", "connect" or "set_input" (set_input is MetaSound only) */
+    FString Op;
+
+    /** Alias for the node created by add_node, usable by later operations in the batch */
+    FString Ref;
+
+    /** MetaSound add_node: node class, namespace and variant */
+    FString NodeClassName;
+    FString NodeNamespace = TEXT("UE");
+    FString NodeVariant;
+
+    /** Sound Cue add_node: node type and optional sound wave (for WavePlayer nodes) */
+    FString NodeType;
+    FString SoundWavePath;
+
+    /** add_node: position in the graph editor */
+    int32 PosX = 0;
+    int32 PosY = 0;
+
+    /** connect: source and target nodes; a Sound Cue target of "Output" sets the root node */
+    FString SourceNode;
+    FString TargetNode;
+
+    /** MetaSound connect: pin names */
+    FString SourcePin;
+    FString TargetPin;
+
+    /** Sound Cue connect: child slot on the target node */
+    int32 TargetPinIndex = 0;
+
+    /** MetaSound set_input: node, input name and value */
+    FString NodeId;
+    FString InputName;
+    TSharedPtr<FJsonValue> Value;
+};
+
+/**
+ * Outcome of one FSoundGraphOperation
+ */
+struct UNREALMCP_API FSoundGraphOperationResult
+{
+    /** Index of the operation in the batch */
+    int32 Index = INDEX_NONE;
+
+    bool bSuccess = false;
+
+    /** ID of the node created by add_node */
+    FString NodeId;
+
+    FString Error;
+};
+
 /**
  * Interface for Sound service operations
  * Provides abstraction for audio asset creation, modification, and management
@@ -420,6 +480,16 @@ public:
      */
     virtual bool GetSoundWaveMetadata(const FString& SoundWavePath, TSharedPtr<FJsonObject>& OutMetadata, FString& OutError) = 0;
 
+    /**
+     * Decode sound waves and measure peak, RMS, integrated loudness, DC offset, silence trim points and clipping
+     * Waves are analyzed in parallel; results are cached against the hash of the imported source data
+     * @param SoundWavePaths - Paths of the sound waves to analyze
+     * @param OutResults - One JSON object per path, in order, with success and either the analysis or an error
+     * @param OutError - Error message if no paths were given
+     * @return true if the batch ran
+     */
+    virtual bool AnalyzeSoundWaves(const TArray<FString>& SoundWavePaths, TArray<TSharedPtr<FJsonObject>>& OutResults, FString& OutError) = 0;
+
     /**
      * Set properties on a sound wave
      * @param SoundWavePath - Path to the sound wave
@@ -549,6 +619,16 @@ public:
      */
     virtual bool CompileSoundCue(const FString& SoundCuePath, FString& OutError) = 0;
 
+    /**
+     * Apply many node and edge edits to one Sound Cue, relinking the editor graph and saving once
+     * @param SoundCuePath - Path to the Sound Cue
+     * @param Operations - add_node and connect operations, applied in order
+     * @param OutResults - One result per operation; failed operations do not stop the batch
+     * @param OutError - Error message if the Sound Cue could not be edited at all
+     * @return true if the Sound Cue was found and the batch was applied
+     */
+    virtual bool BatchEditSoundCue(const FString& SoundCuePath, const TArray<FSoundGraphOperation>& Operations, TArray<FSoundGraphOperationResult>& OutResults, FString& OutError) = 0;
+
     // ========================================================================
     // Sound Class/Mix Operations (Phase 4 - Music System)
     // ========================================================================
@@ -663,8 +743,8 @@ public:
     virtual bool CompileMetaSound(const FString& MetaSoundPath, FString& OutError) = 0;
 
     /**
-     * Search the MetaSound node palette for available node classes
-     * @param SearchQuery - Query string to filter nodes (searches name, namespace, keywords, category)
+     * Search the MetaSound node palette for available node classes, best match first
+     * @param SearchQuery - Words to match (searches name, display name, namespace, keywords, category, description)
      * @param MaxResults - Maximum number of results to return
      * @param OutResults - Array of JSON objects with node class info (namespace, name, variant, display_name, description, category)
      * @param OutError - Error message if operation fails
@@ -672,6 +752,17 @@ public:
      */
     virtual bool SearchMetaSoundPalette(const FString& SearchQuery, int32 MaxResults, TArray<TSharedPtr<FJsonObject>>& OutResults, FString& OutError) = 0;
 
+    /**
+     * Apply many node and edge edits to one MetaSound through a single document builder,
+     * registering the graph and saving once at the end
+     * @param MetaSoundPath - Path to the MetaSound
+     * @param Operations - add_node, connect and set_input operations, applied in order
+     * @param OutResults - One result per operation; failed operations do not stop the batch
+     * @param OutError - Error message if the MetaSound could not be edited at all
+     * @return true if the MetaSound was found and the batch was applied
+     */
+    virtual bool BatchEditMetaSound(const FString& MetaSoundPath, const TArray<FSoundGraphOperation>& Operations, TArray<FSoundGraphOperationResult>& OutResults, FString& OutError) = 0;
+
     /**
      * Find a MetaSound Source by path
      * @param MetaSoundPath - Path to the MetaSound
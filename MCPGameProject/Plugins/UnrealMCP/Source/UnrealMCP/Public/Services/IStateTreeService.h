@@ -29,6 +29,21 @@ struct UNREALMCP_API FStateTreeCreationParams
     bool IsValid(FString& OutError) const;
 };
 
+/**
+ * Outcome of a StateTree compile request
+ */
+struct UNREALMCP_API FStateTreeCompileStats
+{
+    /** The editor data was unchanged since the last successful compile, so the compiler did not run */
+    bool bSkipped = false;
+
+    /** Time spent compiling and saving (0 when skipped) */
+    double CompileMs = 0.0;
+
+    /** Hash of the editor data the compiled tree corresponds to */
+    uint32 EditorDataHash = 0;
+};
+
 /**
  * Parameters for adding a state to a StateTree
  */
@@ -832,9 +847,12 @@ struct UNREALMCP_API FBatchAddStatesParams
     /** Path to the StateTree asset */
     FString StateTreePath;
 
-    /** Array of state definitions to add */
+    /** Array of state definitions to add; a parent may be defined later in the same batch */
     TArray<FBatchStateDefinition> States;
 
+    /** Compile the tree once after all states are added */
+    bool bCompile = true;
+
     FBatchAddStatesParams() = default;
 
     bool IsValid(FString& OutError) const;
@@ -850,6 +868,7 @@ struct UNREALMCP_API FBatchTransitionDefinition
     FString Trigger = TEXT("OnStateCompleted");
     FString TransitionType = TEXT("GotoState");
     FString Priority = TEXT("Normal");
+    FString EventTag;
 };
 
 /**
@@ -863,11 +882,46 @@ struct UNREALMCP_API FBatchAddTransitionsParams
     /** Array of transition definitions to add */
     TArray<FBatchTransitionDefinition> Transitions;
 
+    /** Compile the tree once after all transitions are added */
+    bool bCompile = true;
+
     FBatchAddTransitionsParams() = default;
 
     bool IsValid(FString& OutError) const;
 };
 
+/**
+ * Item that could not be applied in a batch operation
+ */
+struct UNREALMCP_API FStateTreeBatchItemError
+{
+    /** Index into the batch's definitions */
+    int32 Index = INDEX_NONE;
+
+    FString Error;
+};
+
+/**
+ * Outcome of a batch operation; the asset is saved once for the whole batch
+ */
+struct UNREALMCP_API FStateTreeBatchResult
+{
+    /** Number of items applied */
+    int32 NumApplied = 0;
+
+    /** Items that were skipped */
+    TArray<FStateTreeBatchItemError> ItemErrors;
+
+    /** Whether the tree compiled after the batch (false when compile was not requested) */
+    bool bCompiled = false;
+
+    /** Compiler error when compile was requested and failed */
+    FString CompileError;
+
+    /** Compile timing, and whether the compile was skipped */
+    FStateTreeCompileStats CompileStats;
+};
+
 /**
  * Interface for StateTree service operations
  */
@@ -896,13 +950,23 @@ public:
     virtual UStateTree* FindStateTree(const FString& PathOrName) = 0;
 
     /**
-     * Compile a StateTree for runtime use
+     * Compile a StateTree for runtime use; skipped when the editor data is unchanged since the last successful compile
      * @param StateTree - StateTree to compile
      * @param OutError - Error message if compilation fails
-     * @return true if compilation succeeded
+     * @return true if compilation succeeded (or was already up to date)
      */
     virtual bool CompileStateTree(UStateTree* StateTree, FString& OutError) = 0;
 
+    /**
+     * Compile a StateTree for runtime use, reporting whether the compile ran and how long it took
+     * @param StateTree - StateTree to compile
+     * @param bForce - Compile even if the editor data hash matches the last successful compile
+     * @param OutStats - Skipped flag, compile duration and editor data hash
+     * @param OutError - Error message if compilation fails
+     * @return true if compilation succeeded (or was already up to date)
+     */
+    virtual bool CompileStateTree(UStateTree* StateTree, bool bForce, FStateTreeCompileStats& OutStats, FString& OutError) = 0;
+
     /**
      * Duplicate a StateTree asset
      * @param SourcePath - Path to source StateTree
@@ -1370,20 +1434,22 @@ public:
     // ============================================================================
 
     /**
-     * Add multiple states in a single operation
+     * Add multiple states in a single operation; the asset is resolved, saved and compiled once
      * @param Params - Batch add states parameters
-     * @param OutError - Error message if addition fails
-     * @return true if all states were added successfully
+     * @param OutResult - Applied count, per-item errors and compile outcome
+     * @param OutError - Error message if no state could be added
+     * @return true if at least one state was added
      */
-    virtual bool BatchAddStates(const FBatchAddStatesParams& Params, FString& OutError) = 0;
+    virtual bool BatchAddStates(const FBatchAddStatesParams& Params, FStateTreeBatchResult& OutResult, FString& OutError) = 0;
 
     /**
-     * Add multiple transitions in a single operation
+     * Add multiple transitions in a single operation; the asset is resolved, saved and compiled once
      * @param Params - Batch add transitions parameters
-     * @param OutError - Error message if addition fails
-     * @return true if all transitions were added successfully
+     * @param OutResult - Applied count, per-item errors and compile outcome
+     * @param OutError - Error message if no transition could be added
+     * @return true if at least one transition was added
      */
-    virtual bool BatchAddTransitions(const FBatchAddTransitionsParams& Params, FString& OutError) = 0;
+    virtual bool BatchAddTransitions(const FBatchAddTransitionsParams& Params, FStateTreeBatchResult& OutResult, FString& OutError) = 0;
 
     // ============================================================================
     // Section 16: Validation and Debugging
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "PixelFormat.h"
+#include "RHIFwd.h"
+#include "UObject/StrongObjectPtr.h"
+
+class UTextureRenderTarget2D;
+
+/**
+ * Encoding options for an asynchronous image capture
+ */
+struct UNREALMCP_API FImageCaptureOptions
+{
+    /** "png" (default) or "jpg"/"jpeg" */
+    FString Format = TEXT("png");
+
+    /** Force alpha to 255 before encoding (viewport back buffers carry scene depth/coverage in alpha) */
+    bool bForceOpaque = false;
+
+    /** Also produce a Base64 string of the encoded bytes on the worker thread */
+    bool bEncodeBase64 = false;
+
+    /** If set, the encoded bytes are written to this file on the worker thread */
+    FString OutputFilePath;
+
+    /** Hash the encoded bytes (SHA-1) so a client reading OutputFilePath can verify what it got */
+    bool bComputeHash = false;
+};
+
+/**
+ * Result of an asynchronous image capture, delivered on the game thread
+ */
+struct UNREALMCP_API FImageCaptureResult
+{
+    bool bSuccess = false;
+    FString Error;
+
+    int32 Width = 0;
+    int32 Height = 0;
+
+    /** Normalized format actually used: "png" or "jpg" */
+    FString Format;
+
+    TArray64<uint8> EncodedBytes;
+
+    /** Filled when FImageCaptureOptions::bEncodeBase64 is set */
+    FString Base64;
+
+    /** Lowercase hex SHA-1 of EncodedBytes, filled when FImageCaptureOptions::bComputeHash is set */
+    FString Sha1;
+
+    /** Time from enqueue to completion, for logging */
+    double ElapsedMs = 0.0;
+};
+
+using FOnImageCaptured = TFunction<void(FImageCaptureResult&& Result)>;
+
+/**
+ * Shared screenshot pipeline for widget and viewport captures
+ *
+ * Captures used to allocate a fresh render target per call, FlushRenderingCommands, then
+ * ReadPixels + compress + Base64 on the game thread. This service keeps a small pool of
+ * render targets keyed by (size, format), copies the GPU texture through an
+ * FRHIGPUTextureReadback polled from the core ticker, and does pixel conversion, image
+ * compression, Base64 and file writes on a background task. The game thread only
+ * enqueues the copy and later receives the finished bytes.
+ *
+ * All public methods must be called on the game thread; OnComplete always runs there too.
+ */
+class UNREALMCP_API FImageCaptureService
+{
+public:
+    /**
+     * Get the singleton instance
+     * @return Reference to the singleton instance
+     */
+    static FImageCaptureService& Get();
+
+    /**
+     * Drop pooled render targets and abandon in-flight captures, completing them with an error
+     * Called from FUnrealMCPModule::ShutdownModule
+     */
+    void Shutdown();
+
+    /**
+     * Take a render target of the given size and format from the pool (created on a miss)
+     * The target stays rooted until it is handed back with ReleaseRenderTarget.
+     * @param Width - Target width in pixels
+     * @param Height - Target height in pixels
+     * @param Format - Pixel format; only 8-bit BGRA/RGBA formats can be read back
+     * @return Render target ready to draw into
+     */
+    UTextureRenderTarget2D* AcquireRenderTarget(int32 Width, int32 Height, EPixelFormat Format = PF_B8G8R8A8);
+
+    /**
+     * Return a render target to the pool. Readbacks started with ReadbackRenderTarget
+     * release their target automatically.
+     * @param RenderTarget - Target previously returned by AcquireRenderTarget
+     */
+    void ReleaseRenderTarget(UTextureRenderTarget2D* RenderTarget);
+
+    /**
+     * Asynchronously read back a pooled render target and encode it
+     * The readback is ordered after any render commands already enqueued for the target
+     * (e.g. an FWidgetRenderer draw). The target goes back to the pool once the copy lands.
+     * @param RenderTarget - Target from AcquireRenderTarget
+     * @param Options - Encoding options
+     * @param OnComplete - Receives the encoded image on the game thread
+     * @param KeepAlive - Optional payload kept alive until the GPU copy has been consumed
+     */
+    void ReadbackRenderTarget(UTextureRenderTarget2D* RenderTarget, const FImageCaptureOptions& Options,
+                              FOnImageCaptured OnComplete, TSharedPtr<void> KeepAlive = nullptr);
+
+    /**
+     * Asynchronously read back an arbitrary RHI texture (e.g. a viewport's render target) and encode it
+     * @param Texture - Texture to copy; must be an 8-bit BGRA/RGBA format
+     * @param Options - Encoding options
+     * @param OnComplete - Receives the encoded image on the game thread
+     * @return false if the texture cannot be read back asynchronously (caller should fall back)
+     */
+    bool ReadbackTexture(const FTextureRHIRef& Texture, const FImageCaptureOptions& Options, FOnImageCaptured OnComplete);
+
+    /**
+     * Encode CPU pixels on a background task (used when a GPU readback is not possible)
+     * @param Pixels - BGRA pixels, row-major, Width * Height entries
+     * @param Width - Image width
+     * @param Height - Image height
+     * @param Options - Encoding options
+     * @param OnComplete - Receives the encoded image on the game thread
+     */
+    void EncodeAsync(TArray<FColor>&& Pixels, int32 Width, int32 Height, const FImageCaptureOptions& Options,
+                     FOnImageCaptured OnComplete);
+
+    /**
+     * Encode pixels synchronously on the calling thread
+     * @param Pixels - BGRA pixels, row-major, Width * Height entries (alpha is overwritten when forcing opaque)
+     * @param Width - Image width
+     * @param Height - Image height
+     * @param Options - Encoding options
+     * @param OutResult - Encoded image (bSuccess/Error set accordingly)
+     */
+    static void EncodePixels(TArray<FColor>& Pixels, int32 Width, int32 Height, const FImageCaptureOptions& Options,
+                             FImageCaptureResult& OutResult);
+
+private:
+    FImageCaptureService() = default;
+
+    struct FPendingReadback;
+
+    /** Start polling pending readbacks from the core ticker if not already doing so */
+    void EnsureTicking();
+
+    /** Poll in-flight readbacks; returns false once none remain */
+    bool TickReadbacks(float DeltaTime);
+
+    /**
+     * Start an async copy and track it until the data is available
+     * @param ResolveSourceTexture - Evaluated on the render thread (render target RHI resources are created there)
+     */
+    void StartReadback(TFunction<FRHITexture*()> ResolveSourceTexture, int32 Width, int32 Height, EPixelFormat Format,
+                       const FImageCaptureOptions& Options, FOnImageCaptured OnComplete,
+                       UTextureRenderTarget2D* PooledTarget, TSharedPtr<void> KeepAlive);
+
+    /** Whether pixels of this format can be converted to FColor by a plain copy/swizzle */
+    static bool IsReadableFormat(EPixelFormat Format);
+
+    static uint64 MakePoolKey(int32 Width, int32 Height, EPixelFormat Format);
+
+    /** Idle render targets per (size, format) */
+    TMap<uint64, TArray<TStrongObjectPtr<UTextureRenderTarget2D>>> FreeRenderTargets;
+
+    /** Targets currently handed out, kept rooted until released */
+    TMap<UTextureRenderTarget2D*, TStrongObjectPtr<UTextureRenderTarget2D>> RenderTargetsInUse;
+
+    TArray<TSharedPtr<FPendingReadback>> PendingReadbacks;
+
+    FTSTicker::FDelegateHandle TickerHandle;
+};
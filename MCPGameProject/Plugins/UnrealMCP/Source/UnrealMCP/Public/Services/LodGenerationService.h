@@ -0,0 +1,170 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Services/ILodGenerationBackend.h"
+#include "Services/MCPTickedJobRegistry.h"
+#include <atomic>
+
+class FJsonObject;
+
+enum class ELodGenerationState : uint8
+{
+	Queued,
+	Reducing,
+	Reduced,
+	Building,
+	Succeeded,
+	Failed
+};
+
+struct FLodGenerationJobOptions
+{
+	/** Game-thread time spent copying, committing and saving per tick; at least one step runs per tick */
+	double FrameBudgetMs = 8.0;
+
+	/** Meshes being reduced at once; also bounds how many mesh description copies are held in memory */
+	int32 MaxConcurrentReductions = 4;
+};
+
+/** Copy of one mesh's progress for status queries */
+struct FLodGenerationMeshStatus
+{
+	FLodGenerationRequest Request;
+	ELodGenerationState State = ELodGenerationState::Queued;
+	FString Error;
+	int32 PreviousLodCount = 0;
+	int32 SourceTriangles = 0;
+	TArray<FLodGenerationLodStats> Lods;
+	double PrepareMs = 0.0;
+	double ReduceMs = 0.0;
+	double CommitMs = 0.0;
+	double BuildMs = 0.0;
+	double FinalizeMs = 0.0;
+};
+
+struct FLodGenerationJobStatus
+{
+	FString JobId;
+	bool bComplete = false;
+	int32 Total = 0;
+	int32 Counts[6] = {};
+	double ElapsedMs = 0.0;
+	double ReduceMs = 0.0;
+	double GameThreadMs = 0.0;
+	int32 Ticks = 0;
+	TArray<FLodGenerationMeshStatus> Meshes;
+
+	int32 Count(ELodGenerationState State) const { return Counts[static_cast<int32>(State)]; }
+};
+
+/**
+ * One LOD generation batch: LOD0 is copied on the game thread, reduced on worker threads,
+ * and the results are committed, built and saved back on the game thread within a per-tick
+ * time budget. Mesh builds run asynchronously between commit and save.
+ */
+class UNREALMCP_API FLodGenerationJob
+{
+public:
+	FLodGenerationJob(FString InJobId, TArray<FLodGenerationRequest>&& InRequests, const FLodGenerationJobOptions& InOptions, TSharedRef<ILodGenerationBackend> InBackend);
+
+	/**
+	 * Finalize built meshes, commit reduced ones and start new reductions until the budget runs out (game thread)
+	 * @return Number of game-thread steps run this tick
+	 */
+	int32 Tick();
+
+	bool IsComplete() const { return bComplete; }
+
+	/**
+	 * Stop starting work and fail every mesh not yet saved. Reductions already running finish
+	 * and are discarded; the job completes on the tick after the last one lands.
+	 */
+	void Cancel();
+
+	const FString& GetJobId() const { return JobId; }
+
+	void GetStatus(FLodGenerationJobStatus& OutStatus, bool bIncludeMeshes) const;
+
+	/** Mesh counts for FMCPJobService */
+	FMCPBatchJobCounts GetCounts() const;
+
+private:
+	/** Per-mesh state shared with the worker reducing it */
+	struct FMeshRecord
+	{
+		FLodGenerationRequest Request;
+		FLodGenerationPayload Payload;
+		std::atomic<uint8> State{ static_cast<uint8>(ELodGenerationState::Queued) };
+		FString Error;
+		double PrepareMs = 0.0;
+		double ReduceMs = 0.0;
+		double CommitMs = 0.0;
+		double BuildMs = 0.0;
+		double FinalizeMs = 0.0;
+		double BuildStartSeconds = 0.0;
+
+		ELodGenerationState GetState() const { return static_cast<ELodGenerationState>(State.load(std::memory_order_acquire)); }
+		void SetState(ELodGenerationState NewState) { State.store(static_cast<uint8>(NewState), std::memory_order_release); }
+	};
+
+	void StartReduction(const TSharedRef<FMeshRecord>& Record);
+	void Fail(FMeshRecord& Record, const FString& Error);
+
+	FString JobId;
+	FLodGenerationJobOptions Options;
+	TSharedRef<ILodGenerationBackend> Backend;
+	TArray<TSharedRef<FMeshRecord>> Meshes;
+
+	int32 NextToPrepare = 0;
+	int32 TickCount = 0;
+	bool bComplete = false;
+	double StartSeconds = 0.0;
+	double EndSeconds = 0.0;
+	TSharedRef<std::atomic<bool>> bCancelled;
+};
+
+/**
+ * Owns running LOD generation jobs and drives them from the core ticker
+ *
+ * auto_generate_lods and set_lod_count return a job id immediately instead of reducing
+ * and saving inside the command, so large batches never hit the bridge's command timeout.
+ */
+class UNREALMCP_API FLodGenerationService
+{
+public:
+	/**
+	 * Get the singleton instance
+	 * @return Reference to the singleton instance
+	 */
+	static FLodGenerationService& Get();
+
+	/** Cancel running jobs and stop ticking. Called from FUnrealMCPModule::ShutdownModule */
+	void Shutdown();
+
+	/**
+	 * Queue LOD generation for a batch of meshes (game thread)
+	 * @param Requests - One entry per mesh
+	 * @param Options - Per-tick budget and reduction concurrency
+	 * @param Backend - Reducer; null uses CreateLodGenerationBackend()
+	 * @return Job id for GetJobStatus
+	 */
+	FString StartJob(TArray<FLodGenerationRequest>&& Requests, const FLodGenerationJobOptions& Options, TSharedPtr<ILodGenerationBackend> Backend = nullptr);
+
+	/** Cancel a running job (game thread); false for unknown or finished ids */
+	bool CancelJob(const FString& JobId);
+
+	/** Snapshot a job's progress; false for unknown (or long-evicted) ids */
+	bool GetJobStatus(const FString& JobId, FLodGenerationJobStatus& OutStatus, bool bIncludeMeshes) const;
+
+	/**
+	 * Read the parameters shared by the LOD commands: mesh_path or mesh_paths (duplicates dropped),
+	 * save, frame_budget_ms and max_concurrent_reductions
+	 */
+	static bool ParseJobTargets(const FJsonObject& JsonObject, TArray<FString>& OutMeshPaths, FLodGenerationJobOptions& OutOptions, bool& bOutSave, FString& OutError);
+
+private:
+	FLodGenerationService();
+
+	TMCPTickedJobRegistry<FLodGenerationJob> Jobs;
+	TSharedPtr<ILodGenerationBackend> DefaultBackend;
+};
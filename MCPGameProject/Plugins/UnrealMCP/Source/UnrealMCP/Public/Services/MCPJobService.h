@@ -0,0 +1,136 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+class FJsonObject;
+
+enum class EMCPJobState : uint8
+{
+	Running,
+	Succeeded,
+	Failed,
+	Cancelled
+};
+
+/** Copy of a job's state for status queries */
+struct UNREALMCP_API FMCPJobSnapshot
+{
+	FString JobId;
+	FString CommandName;
+	EMCPJobState State = EMCPJobState::Running;
+
+	/** 0-1, or negative when the job does not report progress */
+	float Progress = -1.0f;
+	FString ProgressMessage;
+
+	double ElapsedMs = 0.0;
+	bool bCancelRequested = false;
+
+	/** Final response, exactly as the command would have returned it inline. Empty while running. */
+	FString Result;
+
+	static const TCHAR* StateToString(EMCPJobState State);
+};
+
+/** Progress of a service-owned job that works through a fixed list of items */
+struct UNREALMCP_API FMCPBatchJobCounts
+{
+	int32 Total = 0;
+	int32 Succeeded = 0;
+	int32 Failed = 0;
+	double ElapsedMs = 0.0;
+	bool bComplete = false;
+};
+
+/**
+ * Registry of long-running work the bridge answers through job handles
+ *
+ * Two kinds of jobs land here. Bridge commands still running when the socket thread stops
+ * waiting are handed off as "job_N"; their result is stored when the game thread finishes
+ * instead of being discarded. Services that already run their own jobs (bulk_import, LOD
+ * generation) register them under their own ids and push progress from their ticks.
+ *
+ * Every method is thread-safe: the socket thread answers get_job_status, cancel_job and
+ * list_jobs directly, so polling works while the game thread is busy with the job itself.
+ */
+class UNREALMCP_API FMCPJobService
+{
+public:
+	/**
+	 * Get the singleton instance
+	 * @return Reference to the singleton instance
+	 */
+	static FMCPJobService& Get();
+
+	/** Drop every job. Called from FUnrealMCPModule::ShutdownModule */
+	void Shutdown();
+
+	/**
+	 * Create a job with a generated "job_N" id
+	 * @param CommandName - Command the job runs, for status output
+	 * @param OnCancel - Called once on the game thread when cancellation is requested; may be null
+	 */
+	FString CreateJob(const FString& CommandName, TFunction<void()> OnCancel = nullptr);
+
+	/** Register a job under an id owned by another service (game thread) */
+	void RegisterJob(const FString& JobId, const FString& CommandName, TFunction<void()> OnCancel = nullptr);
+
+	/** Update progress of a running job; ignored once it has finished */
+	void ReportProgress(const FString& JobId, float Progress, const FString& Message);
+
+	/**
+	 * Store the final response of a job
+	 * A job cancelled before it finished stays cancelled; the late result is still kept.
+	 */
+	void Complete(const FString& JobId, const FString& Result, bool bSucceeded);
+
+	/** Complete with a command-style result object, wrapped in the bridge's status envelope */
+	void CompleteWithResult(const FString& JobId, const TSharedRef<FJsonObject>& Result);
+
+	/**
+	 * Mirror a batch job's counts: progress while it runs, then a summary result with total,
+	 * succeeded, failed and elapsed_ms once it is complete
+	 * @param ItemNoun - Plural noun used in messages, e.g. "items"
+	 * @param ProgressVerb - Used in the progress message, e.g. "imported" for "3/10 items imported"
+	 */
+	void PublishBatchJob(const FString& JobId, const FMCPBatchJobCounts& Counts, const TCHAR* ItemNoun, const TCHAR* ProgressVerb);
+
+	/**
+	 * Request cancellation. Running jobs are marked cancelled immediately and their OnCancel
+	 * runs on the game thread; work that cannot be interrupted finishes and is discarded.
+	 * @return false with OutError for unknown or already finished jobs
+	 */
+	bool Cancel(const FString& JobId, FString& OutError);
+
+	/** Cooperative check for work that runs in steps */
+	bool IsCancelRequested(const FString& JobId) const;
+
+	/** Snapshot a job; false for unknown (or evicted) ids */
+	bool GetJob(const FString& JobId, FMCPJobSnapshot& OutSnapshot) const;
+
+	/** Snapshot every retained job, newest first, without results */
+	TArray<FMCPJobSnapshot> ListJobs() const;
+
+private:
+	FMCPJobService() = default;
+
+	struct FJobRecord
+	{
+		FMCPJobSnapshot Snapshot;
+		double StartSeconds = 0.0;
+		double EndSeconds = 0.0;
+		TFunction<void()> OnCancel;
+	};
+
+	FJobRecord& AddRecord(const FString& JobId, const FString& CommandName, TFunction<void()>&& OnCancel);
+	void EvictFinished();
+	static void FillElapsed(const FJobRecord& Record, FMCPJobSnapshot& OutSnapshot);
+
+	/** Finished jobs kept for result retrieval, oldest dropped first */
+	static constexpr int32 MaxFinishedJobs = 64;
+
+	mutable FCriticalSection Lock;
+	TArray<TSharedRef<FJobRecord>> Jobs;
+	int32 NextJobNumber = 1;
+};
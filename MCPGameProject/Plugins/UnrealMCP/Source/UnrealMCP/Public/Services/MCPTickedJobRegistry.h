@@ -0,0 +1,144 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Services/MCPJobService.h"
+
+/**
+ * Running and recently finished jobs of one service, driven from the core ticker
+ *
+ * JobType provides GetJobId(), IsComplete(), Tick(), Cancel() and GetCounts(). Every job is
+ * registered with FMCPJobService so get_job_status and cancel_job reach it, and its counts are
+ * mirrored there after each tick. Ticking from FTSTicker keeps the game-thread steps outside
+ * TaskGraph. Finished jobs are kept for status queries until MaxFinishedJobs newer ones have
+ * completed. Game thread only.
+ */
+template <typename JobType>
+class TMCPTickedJobRegistry
+{
+public:
+	/**
+	 * @param InJobIdPrefix - Job ids are "<prefix>_N"
+	 * @param InCommandName - Command name reported by FMCPJobService
+	 * @param InItemNoun - Plural noun for progress messages, e.g. "items"
+	 * @param InProgressVerb - Verb for progress messages, e.g. "imported"
+	 */
+	TMCPTickedJobRegistry(const TCHAR* InJobIdPrefix, const TCHAR* InCommandName, const TCHAR* InItemNoun, const TCHAR* InProgressVerb)
+		: JobIdPrefix(InJobIdPrefix)
+		, CommandName(InCommandName)
+		, ItemNoun(InItemNoun)
+		, ProgressVerb(InProgressVerb)
+	{
+	}
+
+	/** Next unused job id */
+	FString MakeJobId()
+	{
+		return FString::Printf(TEXT("%s_%d"), *JobIdPrefix, NextJobNumber++);
+	}
+
+	/** Track a job, register it with FMCPJobService and start ticking */
+	void Add(const TSharedRef<JobType>& Job)
+	{
+		check(IsInGameThread());
+		RunningJobs.Add(Job);
+
+		const FString JobId = Job->GetJobId();
+		FMCPJobService::Get().RegisterJob(JobId, CommandName, [this, JobId]()
+		{
+			Cancel(JobId);
+		});
+
+		if (!TickerHandle.IsValid())
+		{
+			TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &TMCPTickedJobRegistry::HandleTick));
+		}
+	}
+
+	/** Cancel a running job; false for unknown or finished ids */
+	bool Cancel(const FString& JobId)
+	{
+		for (const TSharedRef<JobType>& Job : RunningJobs)
+		{
+			if (Job->GetJobId() == JobId && !Job->IsComplete())
+			{
+				Job->Cancel();
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** A running or retained finished job; null for unknown (or long-evicted) ids */
+	const JobType* Find(const FString& JobId) const
+	{
+		for (const TArray<TSharedRef<JobType>>* Jobs : { &RunningJobs, &FinishedJobs })
+		{
+			for (const TSharedRef<JobType>& Job : *Jobs)
+			{
+				if (Job->GetJobId() == JobId)
+				{
+					return &Job.Get();
+				}
+			}
+		}
+		return nullptr;
+	}
+
+	/** Cancel running jobs, stop ticking and drop every job */
+	void Shutdown()
+	{
+		if (TickerHandle.IsValid())
+		{
+			FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+			TickerHandle.Reset();
+		}
+		for (const TSharedRef<JobType>& Job : RunningJobs)
+		{
+			Job->Cancel();
+		}
+		RunningJobs.Empty();
+		FinishedJobs.Empty();
+	}
+
+private:
+	bool HandleTick(float DeltaTime)
+	{
+		for (int32 Index = 0; Index < RunningJobs.Num();)
+		{
+			TSharedRef<JobType> Job = RunningJobs[Index];
+			Job->Tick();
+			FMCPJobService::Get().PublishBatchJob(Job->GetJobId(), Job->GetCounts(), *ItemNoun, *ProgressVerb);
+			if (!Job->IsComplete())
+			{
+				++Index;
+				continue;
+			}
+
+			RunningJobs.RemoveAt(Index);
+			FinishedJobs.Add(Job);
+			if (FinishedJobs.Num() > MaxFinishedJobs)
+			{
+				FinishedJobs.RemoveAt(0);
+			}
+		}
+
+		if (RunningJobs.Num() == 0)
+		{
+			TickerHandle.Reset();
+			return false;
+		}
+		return true;
+	}
+
+	static constexpr int32 MaxFinishedJobs = 16;
+
+	FString JobIdPrefix;
+	FString CommandName;
+	FString ItemNoun;
+	FString ProgressVerb;
+	TArray<TSharedRef<JobType>> RunningJobs;
+	TArray<TSharedRef<JobType>> FinishedJobs;
+	FTSTicker::FDelegateHandle TickerHandle;
+	int32 NextJobNumber = 1;
+};
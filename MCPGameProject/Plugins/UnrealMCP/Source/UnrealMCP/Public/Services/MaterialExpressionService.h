@@ -252,10 +252,47 @@ public:
      */
     UMaterialExpression* FindExpressionInFunction(UMaterialFunction* Function, const FGuid& ExpressionId);
 
+    /**
+     * Drop the cached GUID index for a material or material function.
+     * Must be called whenever expressions are added to or removed from its collection.
+     * @param Owner - Material or MaterialFunction that owns the expression collection
+     */
+    void InvalidateExpressionIndex(const UObject* Owner);
+
 private:
     /** Singleton instance */
     static TUniquePtr<FMaterialExpressionService> Instance;
 
+    /**
+     * GUID -> expression lookup for one expression collection.
+     * Built lazily on first lookup; the count/tail fingerprint detects nodes added
+     * or removed by the Material Editor UI without going through this service.
+     */
+    struct FExpressionGuidIndex
+    {
+        TMap<FGuid, TWeakObjectPtr<UMaterialExpression>> ByGuid;
+        int32 ExpressionCount = INDEX_NONE;
+        TWeakObjectPtr<UMaterialExpression> LastExpression;
+    };
+
+    /** Per-owner GUID indices, keyed by the Material/MaterialFunction that owns the collection */
+    TMap<TWeakObjectPtr<const UObject>, FExpressionGuidIndex> ExpressionGuidIndices;
+
+    /**
+     * Resolve an expression by GUID through the owner's cached index
+     * @param Owner - Material or MaterialFunction that owns the collection
+     * @param Expressions - The owner's expression collection
+     * @param ExpressionId - GUID to find
+     * @return Expression or nullptr if not found
+     */
+    UMaterialExpression* FindIndexedExpression(
+        const UObject* Owner,
+        const TArray<TObjectPtr<UMaterialExpression>>& Expressions,
+        const FGuid& ExpressionId);
+
+    /** Rebuild the GUID index for a collection from scratch */
+    static void RebuildExpressionIndex(FExpressionGuidIndex& Index, const TArray<TObjectPtr<UMaterialExpression>>& Expressions);
+
     /**
      * Find and validate a material by path
      * @param MaterialPath - Path to the material
@@ -30,6 +30,7 @@ public:
     virtual bool SetScalarParameter(const FString& MaterialPath, const FString& ParameterName, float Value, FString& OutError) override;
     virtual bool SetVectorParameter(const FString& MaterialPath, const FString& ParameterName, const FLinearColor& Value, FString& OutError) override;
     virtual bool SetTextureParameter(const FString& MaterialPath, const FString& ParameterName, const FString& TexturePath, FString& OutError) override;
+    virtual bool BatchSetInstanceParameters(const TArray<FString>& InstancePaths, const FMaterialParameterBatch& Batch, TArray<FMaterialInstanceBatchResult>& OutResults, FString& OutError) override;
     virtual bool GetScalarParameter(const FString& MaterialPath, const FString& ParameterName, float& OutValue, FString& OutError) override;
     virtual bool GetVectorParameter(const FString& MaterialPath, const FString& ParameterName, FLinearColor& OutValue, FString& OutError) override;
     virtual bool GetTextureParameter(const FString& MaterialPath, const FString& ParameterName, FString& OutTexturePath, FString& OutError) override;
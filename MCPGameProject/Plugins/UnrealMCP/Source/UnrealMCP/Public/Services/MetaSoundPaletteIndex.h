@@ -0,0 +1,138 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "MetasoundFrontendRegistryTransaction.h"
+
+/**
+ * One registered MetaSound node class, flattened to plain strings
+ */
+struct UNREALMCP_API FMetaSoundPaletteEntry
+{
+    FString Namespace;
+    FString Name;
+    FString Variant;
+    FString DisplayName;
+    FString Description;
+
+    /** Category hierarchy joined with " > " */
+    FString Category;
+
+    TArray<FString> Keywords;
+
+    /** (name, type) pairs of the default interface */
+    TArray<TPair<FString, FString>> Inputs;
+    TArray<TPair<FString, FString>> Outputs;
+};
+
+/**
+ * Search index over the MetaSound node palette
+ *
+ * The frontend search engine returns copies of every registered node class, and the
+ * palette search used to convert each class's names, description and category FText
+ * hierarchy to strings on every query. The index does that once: it keeps lowercase
+ * search fields, the distinct words with the entries they appear in, a sorted array of
+ * every word suffix and the response JSON for every class. Each query word is then one
+ * binary search over the suffixes, which yields its exact, prefix and substring matches.
+ *
+ * Staleness follows the frontend node registry's transaction stream: any class registered
+ * or unregistered since the last build (native nodes at module startup or hot reload,
+ * MetaSound assets on registration or recompile) makes the next query rebuild the index.
+ * Game thread only.
+ */
+class UNREALMCP_API FMetaSoundPaletteIndex
+{
+public:
+    /** Get the singleton instance */
+    static FMetaSoundPaletteIndex& Get();
+
+    /** Open the node registry transaction stream. Called from FUnrealMCPModule::StartupModule */
+    void Initialize();
+
+    /** Close the transaction stream and drop the index. Called from FUnrealMCPModule::ShutdownModule */
+    void Shutdown();
+
+    /** Mark the index stale; the next search rebuilds it */
+    void Invalidate();
+
+    /** Replace the index contents with these entries; registry changes until now count as applied */
+    void Build(TArray<FMetaSoundPaletteEntry> InEntries);
+
+    /**
+     * Find node classes matching every word of the query, best match first
+     * Exact and prefix matches on name or display name rank above category, keyword and description matches.
+     * @param SearchQuery - Words to match (case-insensitive); empty lists every class
+     * @param MaxResults - Maximum number of results (0 or less for no limit)
+     * @return Response objects for the matches; shared with the index, do not modify
+     */
+    TArray<TSharedPtr<FJsonObject>> Search(const FString& SearchQuery, int32 MaxResults);
+
+    /** Number of indexed classes (builds the index if stale) */
+    int32 Num();
+
+    /** Split text into lowercase alphanumeric words, also splitting CamelCase names */
+    static void Tokenize(const FString& Text, TArray<FString>& OutTokens);
+
+private:
+    FMetaSoundPaletteIndex() = default;
+
+    /** Field weights, highest first */
+    enum class EField : uint8
+    {
+        Name,
+        DisplayName,
+        Category,
+        Keyword,
+        Namespace,
+        Description
+    };
+
+    struct FIndexedEntry
+    {
+        FString NameLower;
+        FString DisplayNameLower;
+        FString SortKey;
+        TSharedPtr<FJsonObject> Response;
+    };
+
+    /** Word starting at Offset; a suffix at offset 0 is the whole word */
+    struct FWordSuffix
+    {
+        int32 WordIndex = 0;
+        int32 Offset = 0;
+    };
+
+    /** Rebuild from the frontend registry if the index is stale */
+    void EnsureBuilt();
+
+    /** Consume pending registry transactions; true if there were any */
+    bool ConsumeRegistryTransactions();
+
+    FStringView GetSuffix(const FWordSuffix& Suffix) const
+    {
+        return FStringView(Words[Suffix.WordIndex]).RightChop(Suffix.Offset);
+    }
+
+    /** Read every registered node class from the frontend search engine */
+    static TArray<FMetaSoundPaletteEntry> CollectRegisteredClasses();
+
+    static TSharedPtr<FJsonObject> MakeResponse(const FMetaSoundPaletteEntry& Entry);
+
+    void AddTokens(int32 EntryIndex, const FString& Text, EField Field, TMap<FString, int32>& InOutWordIndices);
+
+    bool bIsBuilt = false;
+
+    TArray<FIndexedEntry> Entries;
+
+    /** Distinct lowercase words */
+    TArray<FString> Words;
+
+    /** Per word: (entry index, best field the word appears in) */
+    TArray<TMap<int32, uint8>> EntriesByWord;
+
+    /** Every suffix of every word in ordinal order */
+    TArray<FWordSuffix> Suffixes;
+
+    /** Changes to the frontend node registry since the last build */
+    TUniquePtr<Metasound::Frontend::FNodeRegistryTransactionStream> RegistryTransactions;
+};
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Templates/Function.h"
+#include "UObject/UObjectGlobals.h"
+
+class UObject;
+class UPackage;
+struct FPropertyChangedEvent;
+
+/**
+ * Response cache for the heavy get_*_metadata commands
+ *
+ * Agents poll metadata far more often than assets change, and every call used to rebuild
+ * the full JSON tree. Responses are cached per command, asset and request parameters, and
+ * tagged with an ETag derived from the asset package's change counter, plus those of any
+ * assets the response also reads from (e.g. a material instance's parents). The counter is
+ * bumped whenever an object in the package is modified, edited or marked dirty; undo/redo,
+ * Blueprint compiles, reloads and object replacement bump a global epoch instead, since
+ * they can change what other assets report.
+ *
+ * Clients send the ETag back as if_none_match and get a small not_modified reply while
+ * the asset is unchanged. Game thread only.
+ */
+class UNREALMCP_API FMetadataResponseCache
+{
+public:
+	/** Entries kept before the least recently used one is evicted */
+	static constexpr int32 MaxEntries = 256;
+
+	/** Serialized bytes kept before least recently used entries are evicted */
+	static constexpr int64 MaxBytes = 64 * 1024 * 1024;
+
+	/**
+	 * Get the singleton instance
+	 * @return Reference to the singleton instance
+	 */
+	static FMetadataResponseCache& Get();
+
+	/** Subscribe to change notifications. Called from FUnrealMCPModule::StartupModule */
+	void Initialize();
+
+	/** Unsubscribe and drop all entries. Called from FUnrealMCPModule::ShutdownModule */
+	void Shutdown();
+
+	/**
+	 * Answer a metadata request from the cache, or build and remember it
+	 * @param CommandName - Command being served; part of the cache key
+	 * @param Parameters - Raw request parameters; if_none_match is read from here and excluded from the key
+	 * @param Asset - Asset the response describes; null bypasses the cache
+	 * @param BuildResponse - Builds the full response object on a miss. Responses with success=false are not cached.
+	 * @param Dependencies - Other assets whose data the response includes; their changes move the ETag too
+	 * @return Serialized response: the cached or freshly built one with an "etag" field, or a not_modified reply
+	 */
+	FString Serve(const FString& CommandName, const FString& Parameters, const UObject* Asset, TFunctionRef<TSharedPtr<FJsonObject>()> BuildResponse,
+		TConstArrayView<const UObject*> Dependencies = {});
+
+	/** Current ETag for this request; changes whenever the asset's or a dependency's package, or the global epoch, changes */
+	FString MakeETag(const FString& CommandName, const FString& Parameters, const UObject* Asset, TConstArrayView<const UObject*> Dependencies = {}) const;
+
+	/** Drop all entries and bump the global epoch */
+	void Reset();
+
+	/** Number of cached responses */
+	int32 Num() const { return Entries.Num(); }
+
+private:
+	struct FEntry
+	{
+		FString ETag;
+		FString Response;
+		uint64 LastUsed = 0;
+	};
+
+	FMetadataResponseCache();
+
+	/** Split parameters into a canonical key (sorted, without if_none_match) and the client's ETag */
+	static void ParseRequest(const FString& Parameters, FString& OutRequestKey, FString& OutIfNoneMatch);
+	static FString MakeCacheKey(const FString& CommandName, const FString& RequestKey, const UObject* Asset);
+	FString MakeETagForKey(const FString& CacheKey, const UObject* Asset, TConstArrayView<const UObject*> Dependencies) const;
+	void Store(const FString& CacheKey, const FString& ETag, const FString& Response);
+	void EvictIfNeeded();
+
+	void BumpPackage(const UObject* Object);
+	void BumpEpoch();
+
+	void HandleObjectModified(UObject* Object);
+	void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+	void HandlePackageMarkedDirty(UPackage* Package, bool bWasDirty);
+	void HandleObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap);
+	void HandleReloadComplete(EReloadCompleteReason Reason);
+	void BindEditorDelegates();
+
+	/** Random per-session value so ETags from a previous editor session never match */
+	uint32 SessionSalt = 0;
+	uint64 Epoch = 0;
+	uint64 UseCounter = 0;
+	int64 TotalBytes = 0;
+
+	TMap<FName, uint64> PackageGenerations;
+	TMap<FString, FEntry> Entries;
+
+	FDelegateHandle ObjectModifiedHandle;
+	FDelegateHandle PropertyChangedHandle;
+	FDelegateHandle PackageDirtyHandle;
+	FDelegateHandle ObjectsReplacedHandle;
+	FDelegateHandle ReloadCompleteHandle;
+	FDelegateHandle BlueprintCompiledHandle;
+	FDelegateHandle UndoRedoHandle;
+	FDelegateHandle PostEngineInitHandle;
+};
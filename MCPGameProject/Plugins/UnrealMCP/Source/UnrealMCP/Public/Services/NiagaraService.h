@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Services/INiagaraService.h"
+#include "Containers/Ticker.h"
 
 // Log category for Niagara service - shared across all split implementation files
 DECLARE_LOG_CATEGORY_EXTERN(LogNiagaraService, Log, All);
@@ -34,6 +35,9 @@ public:
      */
     static FNiagaraService& Get();
 
+    /** Remove the compile queue ticker and drop queued compiles; called on module shutdown */
+    void Shutdown();
+
     // ========================================================================
     // INiagaraService interface implementation - Core Asset Management
     // ========================================================================
@@ -49,6 +53,9 @@ public:
     virtual bool GetModuleInputs(const FString& SystemPath, const FString& EmitterName, const FString& ModuleName, const FString& Stage, TSharedPtr<FJsonObject>& OutInputs) override;
     virtual bool GetEmitterModules(const FString& SystemPath, const FString& EmitterName, TSharedPtr<FJsonObject>& OutModules) override;
     virtual bool CompileAsset(const FString& AssetPath, FString& OutError) override;
+    virtual void QueueSystemCompile(UNiagaraSystem* System, bool bForce = false) override;
+    virtual void FlushSystemCompile(UNiagaraSystem* System, bool bWaitForCompletion) override;
+    virtual FString GetSystemCompileStatus(const UNiagaraSystem* System) const override;
     virtual bool DuplicateSystem(const FString& SourcePath, const FString& NewName, const FString& FolderPath, FString& OutNewPath, FString& OutError) override;
 
     // ========================================================================
@@ -106,6 +113,18 @@ private:
     /** Singleton instance */
     static TUniquePtr<FNiagaraService> Instance;
 
+    /** Systems with a pending (not yet started) compile, mapped to whether the compile must be forced */
+    TMap<TWeakObjectPtr<UNiagaraSystem>, bool> PendingCompiles;
+
+    /** Time of the most recent QueueSystemCompile call; the queue flushes once edits have settled */
+    double LastCompileQueueTime = 0.0;
+
+    /** Ticker that flushes PendingCompiles; valid while anything is queued */
+    FTSTicker::FDelegateHandle CompileQueueTickerHandle;
+
+    /** Ticker callback: start queued compiles once no new edit arrived for the settle delay */
+    bool TickCompileQueue(float DeltaTime);
+
     // ========================================================================
     // Internal Helper Methods
     // ========================================================================
@@ -150,6 +169,13 @@ private:
      */
     FVersionedNiagaraEmitterData* GetEmitterData(const FNiagaraEmitterHandle& Handle) const;
 
+    /**
+     * Drop cached module input schemas of an emitter whose settings changed; its compile
+     * constants decide which static-switch-gated inputs exist
+     * @param Emitter - Emitter that was edited
+     */
+    void InvalidateModuleInputSchemas(const UNiagaraEmitter* Emitter);
+
     /**
      * Create renderer properties by type string
      * @param RendererType - "Sprite", "Mesh", "Ribbon", "Light", "Decal", "Component"
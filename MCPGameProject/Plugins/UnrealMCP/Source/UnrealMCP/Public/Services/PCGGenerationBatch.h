@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Services/IPCGGenerationBackend.h"
+
+/**
+ * Generates a set of PCG components together and reports once all of them have finished
+ *
+ * Every component is scheduled up front so the PCG scheduler can spread their graphs across
+ * worker threads; completion is driven by each component's generated/cancelled notification
+ * rather than polling. A core ticker only enforces the timeout.
+ *
+ * Start keeps the batch alive until it completes, so callers may drop their reference.
+ */
+class UNREALMCP_API FPCGGenerationBatch : public TSharedFromThis<FPCGGenerationBatch>
+{
+public:
+	FPCGGenerationBatch(const TArray<UPCGComponent*>& InComponents, const FPCGGenerationOptions& InOptions, TSharedRef<IPCGGenerationBackend> InBackend);
+	~FPCGGenerationBatch();
+
+	/**
+	 * Schedule every component (game thread)
+	 * @param InOnComplete - Called once on the game thread when no component is still generating
+	 */
+	void Start(TFunction<void(const FPCGGenerationBatch&)> InOnComplete);
+
+	/** Cancel components still generating; completes the batch */
+	void Cancel();
+
+	bool IsComplete() const { return bComplete; }
+
+	const TArray<FPCGComponentGenerationResult>& GetResults() const { return Results; }
+
+	int32 Count(EPCGGenerationState State) const;
+
+	double GetElapsedMs() const;
+
+private:
+	void HandleFinished(int32 Index, bool bGenerated);
+	void FinishComponent(int32 Index, EPCGGenerationState State, const FString& Error);
+	bool HandleTick(float DeltaTime);
+	void CompleteIfDone();
+
+	TArray<TWeakObjectPtr<UPCGComponent>> Components;
+	TArray<FPCGComponentGenerationResult> Results;
+	FPCGGenerationOptions Options;
+	TSharedRef<IPCGGenerationBackend> Backend;
+	TFunction<void(const FPCGGenerationBatch&)> OnComplete;
+
+	/** Self reference held from Start until completion */
+	TSharedPtr<FPCGGenerationBatch> KeepAlive;
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	int32 Pending = 0;
+	bool bStarted = false;
+	bool bComplete = false;
+	double StartSeconds = 0.0;
+	double EndSeconds = 0.0;
+};
@@ -54,6 +54,24 @@ public:
         const TMap<FString, FString>& ValueDescriptions,
         FString& OutError);
 
+    /**
+     * Replace the values of an enum with a full definition in a single edit.
+     * Values whose display name already exists keep their internal name, so saved data and
+     * pins that use them stay valid. Dependents are notified once, inside one transaction.
+     * @param Enum - The enum to define
+     * @param Description - Optional enum description; left unchanged when empty
+     * @param Values - Display names in order; must be unique and non-empty
+     * @param ValueDescriptions - Map of value name to description
+     * @param OutError - Output: error message if failed
+     * @return true if the enum was updated
+     */
+    bool ApplyEnumDefinition(
+        UUserDefinedEnum* Enum,
+        const FString& Description,
+        const TArray<FString>& Values,
+        const TMap<FString, FString>& ValueDescriptions,
+        FString& OutError);
+
 private:
     FProjectEnumService() = default;
 };
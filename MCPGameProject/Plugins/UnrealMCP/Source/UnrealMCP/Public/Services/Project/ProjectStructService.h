@@ -4,6 +4,8 @@
 #include "Dom/JsonObject.h"
 
 class UUserDefinedStruct;
+class UUserDefinedStructEditorData;
+struct FStructVariableDescription;
 
 /**
  * Service for creating and managing user-defined structs.
@@ -65,16 +67,32 @@ public:
         bool& bOutSuccess,
         FString& OutError);
 
-private:
-    FProjectStructService() = default;
-
     /**
-     * Create a property on a struct.
-     * @param Struct - The struct to add property to
-     * @param PropertyObj - JSON object with property definition
-     * @return true if property was created successfully
+     * Replace the members of a struct with a full definition in a single edit.
+     * Members whose name matches a definition keep their GUID (so existing data and pins stay
+     * valid) and get the new type and tooltip; the rest are removed; new names are appended.
+     * A definition that fails to resolve is skipped, and an existing member it names is kept unchanged.
+     * The struct is recompiled and dependents are notified once, inside one transaction.
+     * @param Struct - The struct to define
+     * @param Description - Optional struct tooltip; left unchanged when empty
+     * @param Properties - Definitions with "name", "type" and optional "description"
+     * @param OutSkipped - Output: definitions that were ignored, with the reason
+     * @param OutError - Output: error message if nothing could be applied
+     * @return true if the struct was updated
      */
-    bool CreateStructProperty(
+    bool ApplyStructDefinition(
         UUserDefinedStruct* Struct,
-        const TSharedPtr<FJsonObject>& PropertyObj) const;
+        const FString& Description,
+        const TArray<TSharedPtr<FJsonObject>>& Properties,
+        TArray<FString>& OutSkipped,
+        FString& OutError);
+
+private:
+    FProjectStructService() = default;
+
+    /** Display name of a member, recovered from its generated name when FriendlyName is empty */
+    static FString GetVariableBaseName(const FStructVariableDescription& VarDesc);
+
+    /** Member name in the editor's <Name>_<UniqueId>_<Guid> form */
+    static FName MakeMemberVariableName(UUserDefinedStructEditorData* EditorData, const FString& FriendlyName, const FGuid& VarGuid);
 };
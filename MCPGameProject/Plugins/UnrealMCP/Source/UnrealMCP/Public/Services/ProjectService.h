@@ -53,8 +53,4 @@ public:
     // Offline Font operations (for SDF atlas-based fonts)
     virtual bool CreateOfflineFont(const FString& FontName, const FString& Path, const FString& TexturePath, const FString& MetricsFilePath, FString& OutAssetPath, FString& OutError) override;
     virtual TSharedPtr<FJsonObject> GetFontMetadata(const FString& FontPath, FString& OutError) override;
-
-private:
-    // Helper methods for struct operations
-    bool CreateStructProperty(class UUserDefinedStruct* Struct, const TSharedPtr<FJsonObject>& PropertyObj) const;
 };
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Class.h"
+#include "UObject/UObjectGlobals.h"
+#include "Modules/ModuleManager.h"
+
+class UBlueprint;
+
+/**
+ * Shared index of loaded reflection types (UClass / UScriptStruct)
+ *
+ * Palette searches and type-name resolution used to walk every UClass or UScriptStruct
+ * in memory per request. The catalog takes one snapshot per module load, then serves
+ * derived-type lists (per base) and normalized-name lookups from cached maps.
+ *
+ * The snapshot is marked stale on hot reload / live coding, when a module that registers
+ * reflected types loads or unloads, and when a Blueprint compile produces a class the
+ * snapshot has not indexed. It is rebuilt lazily on the next query.
+ * All methods must be called on the game thread.
+ */
+class UNREALMCP_API FReflectionCatalog
+{
+public:
+    /**
+     * Get the singleton instance
+     * @return Reference to the singleton instance
+     */
+    static FReflectionCatalog& Get();
+
+    /**
+     * Subscribe to module/reload/Blueprint-compile notifications
+     * Called from FUnrealMCPModule::StartupModule
+     */
+    void Initialize();
+
+    /**
+     * Unsubscribe from notifications and drop the snapshot
+     * Called from FUnrealMCPModule::ShutdownModule
+     */
+    void Shutdown();
+
+    /** Mark the snapshot stale; the next query rebuilds it */
+    void Invalidate();
+
+    /**
+     * Monotonic counter bumped every time the snapshot is rebuilt.
+     * Callers that derive their own caches from the catalog compare this to know when to refresh.
+     */
+    uint32 GetGeneration();
+
+    /**
+     * Get all loaded classes derived from a base class (the base itself is excluded)
+     * @param BaseClass - Base class to filter by
+     * @param ExcludedFlags - Classes with any of these flags are skipped (e.g. CLASS_Abstract)
+     * @return Derived classes, in snapshot order
+     */
+    TArray<UClass*> GetDerivedClasses(const UClass* BaseClass, EClassFlags ExcludedFlags = CLASS_None);
+
+    /**
+     * Get all loaded script structs derived from a base struct (the base itself is excluded)
+     * @param BaseStruct - Base struct to filter by
+     * @return Derived structs, in snapshot order
+     */
+    TArray<UScriptStruct*> GetDerivedStructs(const UScriptStruct* BaseStruct);
+
+    /**
+     * Find a class by name (case-insensitive, without the U/A prefix; "_C" suffix optional)
+     * Falls back to a hashed FindFirstObject lookup for classes created after the snapshot.
+     * @param ClassName - Class name to find
+     * @param BaseClass - Optional base class the result must derive from
+     * @param ExcludedFlags - Classes with any of these flags are skipped
+     * @return The class or nullptr if not found
+     */
+    UClass* FindClassByName(const FString& ClassName, const UClass* BaseClass = nullptr, EClassFlags ExcludedFlags = CLASS_None);
+
+    /**
+     * Find a script struct by name (case-insensitive, without the F prefix)
+     * @param StructName - Struct name to find
+     * @param BaseStruct - Optional base struct the result must derive from
+     * @return The struct or nullptr if not found
+     */
+    UScriptStruct* FindStructByName(const FString& StructName, const UScriptStruct* BaseStruct = nullptr);
+
+    /** Normalize a type name for lookups: lowercase, Blueprint "_C" suffix (exact case) removed */
+    static FString NormalizeTypeName(const FString& TypeName);
+
+private:
+    FReflectionCatalog() = default;
+
+    /** Rebuild the snapshot if it has been invalidated */
+    void EnsureBuilt();
+
+    /** Walk all loaded classes and structs once and fill the name indices */
+    void Build();
+
+    void HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+    void HandleReloadComplete(EReloadCompleteReason Reason);
+    void HandleBlueprintPreCompile(UBlueprint* Blueprint);
+    void HandleBlueprintCompiled();
+    void BindEditorDelegates();
+
+    /** Whether the snapshot's name index holds this exact class */
+    bool IsIndexed(const UClass* Class) const;
+
+    bool bIsBuilt = false;
+    uint32 Generation = 0;
+
+    TArray<TWeakObjectPtr<UClass>> AllClasses;
+    TArray<TWeakObjectPtr<UScriptStruct>> AllStructs;
+
+    /** Normalized name -> classes/structs with that name (usually one entry) */
+    TMap<FString, TArray<TWeakObjectPtr<UClass>>> ClassesByName;
+    TMap<FString, TArray<TWeakObjectPtr<UScriptStruct>>> StructsByName;
+
+    /** Derived-type lists, filled lazily per requested base */
+    TMap<TWeakObjectPtr<const UClass>, TArray<TWeakObjectPtr<UClass>>> DerivedClassesByBase;
+    TMap<TWeakObjectPtr<const UScriptStruct>, TArray<TWeakObjectPtr<UScriptStruct>>> DerivedStructsByBase;
+
+    /** Blueprints announced by pre-compile since the last compiled notification */
+    TArray<TWeakObjectPtr<UBlueprint>> CompilingBlueprints;
+
+    FDelegateHandle ModulesChangedHandle;
+    FDelegateHandle ReloadCompleteHandle;
+    FDelegateHandle BlueprintPreCompileHandle;
+    FDelegateHandle BlueprintCompiledHandle;
+    FDelegateHandle PostEngineInitHandle;
+};
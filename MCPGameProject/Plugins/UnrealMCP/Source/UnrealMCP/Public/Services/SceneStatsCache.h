@@ -0,0 +1,189 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class AActor;
+class UStaticMesh;
+class UStaticMeshComponent;
+class UWorld;
+class ULevel;
+class UInstancedStaticMeshComponent;
+struct FPropertyChangedEvent;
+
+/** Per-mesh data that does not depend on how the mesh is placed */
+struct UNREALMCP_API FSceneStatsMeshInfo
+{
+	FString MeshPath;
+	FString MeshName;
+	int32 LOD0Tris = 0;
+	int32 LODCount = 0;
+	TArray<int32> LODTris;
+	TArray<float> LODScreenSizes;
+	float SphereRadius = 0.0f;
+	bool bHasNanite = false;
+};
+
+/** One registered static mesh component as last seen by the cache */
+struct UNREALMCP_API FSceneStatsComponentRecord
+{
+	TObjectKey<UStaticMesh> Mesh;
+	TObjectKey<AActor> Owner;
+	bool bInstanced = false;
+	bool bCastShadow = false;
+	int32 WPODisableDistance = 0;
+	float CullDistance = 0.0f;
+
+	/** ISM/HISM instance count, 1 for a plain component */
+	int32 InstanceCount = 1;
+
+	/** World-space instance locations (instanced components only); immutable once captured */
+	TSharedPtr<const TArray<FVector>> InstanceLocations;
+};
+
+/** Components grouped under the mesh they render */
+struct UNREALMCP_API FSceneStatsMeshGroup
+{
+	TSharedPtr<const FSceneStatsMeshInfo> Info;
+	TArray<FSceneStatsComponentRecord> Components;
+};
+
+/**
+ * Immutable view of the cache at one generation
+ * Safe to hand to worker threads; later scene edits produce a new snapshot.
+ */
+struct UNREALMCP_API FSceneStatsSnapshot
+{
+	uint64 Generation = 0;
+	TArray<FSceneStatsMeshGroup> Meshes;
+	int32 TotalComponents = 0;
+	int32 TotalActors = 0;
+};
+
+/** Aggregated cost of one mesh */
+struct UNREALMCP_API FSceneStatsMeshBreakdown
+{
+	TSharedPtr<const FSceneStatsMeshInfo> Info;
+	int32 InstanceCount = 0;
+	int32 ComponentCount = 0;
+	int32 ShadowCasters = 0;
+	int32 WPODisableDistance = 0;
+	bool bIsISM = false;
+
+	/** How many instances render at each LOD from the query camera */
+	TArray<int32> InstancesPerLOD;
+
+	/** Instances beyond their component's cull distance */
+	int32 InstancesCulled = 0;
+};
+
+/** Scene breakdown for one snapshot and camera position, sorted by instances x LOD0 tris */
+struct UNREALMCP_API FSceneStatsBreakdown
+{
+	uint64 Generation = 0;
+	FVector CameraLocation = FVector::ZeroVector;
+	bool bHasCamera = false;
+
+	TArray<FSceneStatsMeshBreakdown> Meshes;
+	int32 TotalComponents = 0;
+	int32 TotalActors = 0;
+	double AggregateMs = 0.0;
+};
+
+/**
+ * Incrementally maintained static mesh statistics for the editor world
+ *
+ * get_scene_breakdown used to walk every actor, every LOD and every ISM instance per call.
+ * The cache keeps one record per static mesh component (including a snapshot of instance
+ * locations) and one info entry per mesh. Actor add/delete/move, property edits, ISM
+ * instance updates and level streaming only mark the affected actors dirty; the next
+ * query re-reads just those. The first query in a world gathers components in parallel.
+ *
+ * Camera-dependent LOD bucketing runs over the immutable snapshot on worker threads, and
+ * the last breakdown is reused while neither the scene nor the camera has changed.
+ * All methods except Aggregate must be called on the game thread.
+ */
+class UNREALMCP_API FSceneStatsCache
+{
+public:
+	/**
+	 * Get the singleton instance
+	 * @return Reference to the singleton instance
+	 */
+	static FSceneStatsCache& Get();
+
+	/** Subscribe to editor scene notifications. Called from FUnrealMCPModule::StartupModule */
+	void Initialize();
+
+	/** Unsubscribe and drop all records. Called from FUnrealMCPModule::ShutdownModule */
+	void Shutdown();
+
+	/** Drop everything; the next Update performs a full parallel gather */
+	void Reset();
+
+	/**
+	 * Apply pending dirty actors (or gather the whole world on first use) and return a snapshot
+	 * @param World - Editor world to describe
+	 * @return Snapshot shared with any aggregation still in flight
+	 */
+	TSharedRef<const FSceneStatsSnapshot> Update(UWorld* World);
+
+	/**
+	 * Compute per-mesh instance/LOD/cull counts. Pure; safe on any thread.
+	 * Meshes are processed in parallel.
+	 * @param Snapshot - Snapshot from Update
+	 * @param CameraLocation - Viewpoint for LOD bucketing
+	 * @param bHasCamera - Skip LOD bucketing when false
+	 */
+	static TSharedRef<const FSceneStatsBreakdown> Aggregate(const FSceneStatsSnapshot& Snapshot, const FVector& CameraLocation, bool bHasCamera);
+
+	/** Last breakdown if it matches this snapshot generation and camera, else null */
+	TSharedPtr<const FSceneStatsBreakdown> FindBreakdown(const FSceneStatsSnapshot& Snapshot, const FVector& CameraLocation, bool bHasCamera) const;
+
+	/** Remember a breakdown for FindBreakdown */
+	void StoreBreakdown(TSharedRef<const FSceneStatsBreakdown> Breakdown);
+
+private:
+	FSceneStatsCache() = default;
+
+	void GatherWorld(UWorld* World);
+	void RefreshActor(AActor* Actor, const TObjectKey<AActor>& ActorKey);
+	void RemoveActorRecords(const TObjectKey<AActor>& ActorKey);
+	void AddComponentRecord(UStaticMeshComponent* Component, FSceneStatsComponentRecord&& Record);
+	void EnsureMeshInfo(UStaticMesh* Mesh);
+
+	static bool CaptureComponent(UStaticMeshComponent* Component, FSceneStatsComponentRecord& OutRecord);
+	static TSharedRef<FSceneStatsMeshInfo> BuildMeshInfo(UStaticMesh* Mesh);
+
+	void MarkActorDirty(AActor* Actor);
+	void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+	void HandleInstanceIndexUpdated(UInstancedStaticMeshComponent* Component);
+	void HandleLevelChanged(ULevel* Level, UWorld* World);
+	void HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+	void HandleObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap);
+	void BindEditorDelegates();
+
+	TWeakObjectPtr<UWorld> CachedWorld;
+	bool bGathered = false;
+	uint64 Generation = 0;
+
+	TMap<TObjectKey<UStaticMeshComponent>, FSceneStatsComponentRecord> Components;
+	TMap<TObjectKey<AActor>, TArray<TObjectKey<UStaticMeshComponent>>> ComponentsByActor;
+	TMap<TObjectKey<UStaticMesh>, TSharedPtr<const FSceneStatsMeshInfo>> MeshInfos;
+	TMap<TObjectKey<AActor>, TWeakObjectPtr<AActor>> DirtyActors;
+	TMap<TObjectKey<UStaticMesh>, TWeakObjectPtr<UStaticMesh>> DirtyMeshes;
+
+	TSharedPtr<const FSceneStatsSnapshot> CachedSnapshot;
+	TSharedPtr<const FSceneStatsBreakdown> CachedBreakdown;
+
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorMovedHandle;
+	FDelegateHandle PropertyChangedHandle;
+	FDelegateHandle InstanceIndexUpdatedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+	FDelegateHandle WorldCleanupHandle;
+	FDelegateHandle ObjectsReplacedHandle;
+	FDelegateHandle PostEngineInitHandle;
+};
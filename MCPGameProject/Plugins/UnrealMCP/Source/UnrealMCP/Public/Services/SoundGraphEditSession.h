@@ -0,0 +1,117 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonValue;
+class UMetaSoundSource;
+class UMetaSoundSourceBuilder;
+class USoundCue;
+class USoundNode;
+class USoundWave;
+
+/**
+ * A batch of graph edits against one MetaSound Source
+ *
+ * The document builder is resolved once and reused for every edit. Nodes added through the
+ * session can be given an alias so later edits in the same batch can refer to them before
+ * their IDs are known to the caller. Edits only touch the builder's document; Commit flags
+ * the changed nodes, conforms the asset and registers the graph with the frontend once. The
+ * session never saves; the owner saves once after Commit.
+ */
+class UNREALMCP_API FMetaSoundEditSession
+{
+public:
+    /**
+     * Resolve the document builder for a MetaSound
+     * @param InMetaSound - Resolved MetaSound; may be null, in which case IsValid is false
+     */
+    explicit FMetaSoundEditSession(UMetaSoundSource* InMetaSound);
+
+    /** True when the MetaSound and its builder exist */
+    bool IsValid() const { return MetaSound != nullptr && Builder != nullptr; }
+
+    UMetaSoundSource* GetMetaSound() const { return MetaSound; }
+
+    /**
+     * Add a node by class name and place it in the editor graph
+     * @param Ref - Optional alias for the new node within this session
+     * @param OutNodeId - GUID of the new node
+     */
+    bool AddNode(const FString& Namespace, const FString& ClassName, const FString& Variant, int32 PosX, int32 PosY,
+                 const FString& Ref, FString& OutNodeId, FString& OutError);
+
+    /** Connect an output pin to an input pin; nodes are IDs or session aliases */
+    bool Connect(const FString& SourceNode, const FString& SourcePin, const FString& TargetNode, const FString& TargetPin, FString& OutError);
+
+    /** Set the default of a node input from a number, boolean or string */
+    bool SetInput(const FString& Node, const FString& InputName, const TSharedPtr<FJsonValue>& Value, FString& OutError);
+
+    /** Push the accumulated edits to the asset and the editor graph; a no-op without changes */
+    void Commit();
+
+    /** True once any edit has been made */
+    bool HasChanges() const { return bGraphChanged || bInputsChanged; }
+
+private:
+    /** Node GUID from a session alias or a GUID string */
+    bool ResolveNode(const FString& NodeRef, FGuid& OutNodeId, FString& OutError) const;
+
+    /** Record the asset in the transaction buffer before the first edit */
+    void BeginChange();
+
+    UMetaSoundSource* MetaSound = nullptr;
+    UMetaSoundSourceBuilder* Builder = nullptr;
+    TMap<FString, FGuid> NodesByRef;
+    TSet<FGuid> ModifiedNodes;
+    bool bGraphChanged = false;
+    bool bInputsChanged = false;
+};
+
+/**
+ * A batch of graph edits against one Sound Cue
+ *
+ * Every node is indexed by name up front so each edit is a map lookup instead of a scan of
+ * AllNodes. Nodes added through the session are indexed as they are created and may be given
+ * an alias. Commit relinks the editor graph once; the owner saves once after Commit.
+ */
+class UNREALMCP_API FSoundCueEditSession
+{
+public:
+    /**
+     * Index all nodes of the Sound Cue
+     * @param InSoundCue - Resolved Sound Cue; may be null, in which case IsValid is false
+     */
+    explicit FSoundCueEditSession(USoundCue* InSoundCue);
+
+    bool IsValid() const { return SoundCue != nullptr; }
+
+    USoundCue* GetSoundCue() const { return SoundCue; }
+
+    /**
+     * Construct a node of the given type ("WavePlayer", "Mixer", "Random", ...)
+     * @param SoundWave - Wave for WavePlayer nodes; may be null
+     * @param Ref - Optional alias for the new node within this session
+     * @param OutNodeId - Name of the new node
+     */
+    bool AddNode(const FString& NodeType, USoundWave* SoundWave, const FString& Ref, FString& OutNodeId, FString& OutError);
+
+    /** Make Source a child of Target at TargetPinIndex, or the root when Target is "Output" */
+    bool Connect(const FString& SourceNode, const FString& TargetNode, int32 TargetPinIndex, FString& OutError);
+
+    /** Node by name or session alias */
+    USoundNode* FindNode(const FString& NodeRef) const;
+
+    /** Relink the editor graph from the sound nodes; a no-op without changes */
+    void Commit();
+
+    /** True once any edit has been made */
+    bool HasChanges() const { return bModified; }
+
+private:
+    /** Record the asset in the transaction buffer before the first edit */
+    void BeginChange();
+
+    USoundCue* SoundCue = nullptr;
+    TMap<FString, USoundNode*> NodesByName;
+    bool bModified = false;
+};
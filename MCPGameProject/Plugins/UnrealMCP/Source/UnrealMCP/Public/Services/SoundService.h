@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 #include "Services/ISoundService.h"
+#include "IO/IoHash.h"
+#include "Utils/AudioAnalysisUtils.h"
 
 // Log category for Sound service
 DECLARE_LOG_CATEGORY_EXTERN(LogSoundService, Log, All);
@@ -31,6 +33,7 @@ public:
 
     virtual bool ImportSoundFile(const FSoundWaveImportParams& Params, FString& OutAssetPath, FString& OutError) override;
     virtual bool GetSoundWaveMetadata(const FString& SoundWavePath, TSharedPtr<FJsonObject>& OutMetadata, FString& OutError) override;
+    virtual bool AnalyzeSoundWaves(const TArray<FString>& SoundWavePaths, TArray<TSharedPtr<FJsonObject>>& OutResults, FString& OutError) override;
     virtual bool SetSoundWaveProperties(const FString& SoundWavePath, bool bLooping, float Volume, float Pitch, const FString& SoundClassPath, FString& OutError) override;
 
     // ========================================================================
@@ -58,6 +61,7 @@ public:
     virtual bool SetSoundCueNodeProperty(const FString& SoundCuePath, const FString& NodeId, const FString& PropertyName, const TSharedPtr<FJsonValue>& PropertyValue, FString& OutError) override;
     virtual bool RemoveSoundCueNode(const FString& SoundCuePath, const FString& NodeId, FString& OutError) override;
     virtual bool CompileSoundCue(const FString& SoundCuePath, FString& OutError) override;
+    virtual bool BatchEditSoundCue(const FString& SoundCuePath, const TArray<FSoundGraphOperation>& Operations, TArray<FSoundGraphOperationResult>& OutResults, FString& OutError) override;
 
     // ========================================================================
     // ISoundService interface implementation - Sound Class/Mix Operations
@@ -80,6 +84,7 @@ public:
     virtual bool AddMetaSoundOutput(const FMetaSoundOutputParams& Params, FString& OutOutputNodeId, FString& OutError) override;
     virtual bool CompileMetaSound(const FString& MetaSoundPath, FString& OutError) override;
     virtual bool SearchMetaSoundPalette(const FString& SearchQuery, int32 MaxResults, TArray<TSharedPtr<FJsonObject>>& OutResults, FString& OutError) override;
+    virtual bool BatchEditMetaSound(const FString& MetaSoundPath, const TArray<FSoundGraphOperation>& Operations, TArray<FSoundGraphOperationResult>& OutResults, FString& OutError) override;
     virtual UMetaSoundSource* FindMetaSoundSource(const FString& MetaSoundPath) override;
 
     // ========================================================================
@@ -93,6 +98,9 @@ private:
     /** Singleton instance */
     static TUniquePtr<FSoundService> Instance;
 
+    /** Waveform analyses keyed by the hash of the imported source data, so re-imports miss naturally */
+    TMap<FIoHash, FAudioAnalysisResult> AnalysisCache;
+
     // ========================================================================
     // Internal Helper Methods
     // ========================================================================
@@ -115,6 +123,13 @@ private:
      */
     bool SaveAsset(UObject* Asset, FString& OutError) const;
 
+    /**
+     * Resolve the optional sound wave of a WavePlayer node, warning when the path does not resolve
+     * @param SoundWavePath - Path to the sound wave, or empty for none
+     * @return Sound wave or nullptr
+     */
+    USoundWave* FindWavePlayerSound(const FString& SoundWavePath);
+
     /**
      * Get attenuation function enum from string
      * @param FunctionName - "Linear", "Logarithmic", etc.
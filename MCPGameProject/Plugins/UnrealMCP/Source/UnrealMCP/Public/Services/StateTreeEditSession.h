@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UStateTree;
+class UStateTreeEditorData;
+class UStateTreeState;
+struct FStateTreeTransition;
+
+/**
+ * A batch of edits against one StateTree asset
+ *
+ * The asset is resolved once by the caller and every state is indexed by name up front, so
+ * each edit is a map lookup instead of a recursive walk over all subtrees. States created
+ * through the session are indexed as they are added, which lets later items in the same
+ * batch refer to them. The session never saves; the owner saves (and compiles) once when
+ * all items have been applied.
+ */
+class UNREALMCP_API FStateTreeEditSession
+{
+public:
+    /**
+     * Index all states of the tree
+     * @param InStateTree - Resolved StateTree asset; may be null, in which case IsValid is false
+     */
+    explicit FStateTreeEditSession(UStateTree* InStateTree);
+
+    /** True when the tree and its editor data exist */
+    bool IsValid() const { return StateTree != nullptr && EditorData != nullptr; }
+
+    UStateTree* GetStateTree() const { return StateTree; }
+    UStateTreeEditorData* GetEditorData() const { return EditorData; }
+
+    /** State by name; the first match in depth-first order when names repeat */
+    UStateTreeState* FindState(const FString& StateName) const;
+
+    /**
+     * Create a state under a parent (or as a new subtree root) and index it
+     * @param StateName - Name of the new state; must not already exist in the tree
+     * @param ParentStateName - Parent state, or empty for a root
+     * @param OutError - Error message if the state could not be added
+     * @return The new state, or nullptr
+     */
+    UStateTreeState* AddState(const FString& StateName, const FString& ParentStateName, FString& OutError);
+
+    /**
+     * Append a transition to a state, linking it to the target state when one is named
+     * @param SourceStateName - State that owns the transition
+     * @param TargetStateName - GotoState target, or empty to keep Transition's link as is
+     * @param Transition - Trigger, priority and other settings
+     * @param OutError - Error message if either state is missing
+     */
+    bool AddTransition(const FString& SourceStateName, const FString& TargetStateName, const FStateTreeTransition& Transition, FString& OutError);
+
+    /** Call before changing a state obtained from FindState so the change is recorded */
+    void MarkModified();
+
+    /** True once any edit has been made */
+    bool HasChanges() const { return bModified; }
+
+    /** Number of indexed states */
+    int32 NumStates() const { return StatesByName.Num(); }
+
+private:
+    void IndexState(UStateTreeState* State);
+
+    UStateTree* StateTree = nullptr;
+    UStateTreeEditorData* EditorData = nullptr;
+    TMap<FString, UStateTreeState*> StatesByName;
+    bool bModified = false;
+};
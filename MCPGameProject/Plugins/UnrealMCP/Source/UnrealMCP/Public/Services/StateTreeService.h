@@ -2,6 +2,9 @@
 
 #include "CoreMinimal.h"
 #include "Services/IStateTreeService.h"
+#include "UObject/ObjectKey.h"
+
+class FStateTreeEditSession;
 
 /**
  * Implementation of StateTree service operations
@@ -22,6 +25,7 @@ public:
     virtual UStateTree* CreateStateTree(const FStateTreeCreationParams& Params, FString& OutError) override;
     virtual UStateTree* FindStateTree(const FString& PathOrName) override;
     virtual bool CompileStateTree(UStateTree* StateTree, FString& OutError) override;
+    virtual bool CompileStateTree(UStateTree* StateTree, bool bForce, FStateTreeCompileStats& OutStats, FString& OutError) override;
     virtual UStateTree* DuplicateStateTree(const FString& SourcePath, const FString& DestPath, const FString& NewName, FString& OutError) override;
 
     // ============================================================================
@@ -165,8 +169,8 @@ public:
     // IStateTreeService Implementation - Batch Operations (Section 15)
     // ============================================================================
 
-    virtual bool BatchAddStates(const FBatchAddStatesParams& Params, FString& OutError) override;
-    virtual bool BatchAddTransitions(const FBatchAddTransitionsParams& Params, FString& OutError) override;
+    virtual bool BatchAddStates(const FBatchAddStatesParams& Params, FStateTreeBatchResult& OutResult, FString& OutError) override;
+    virtual bool BatchAddTransitions(const FBatchAddTransitionsParams& Params, FStateTreeBatchResult& OutResult, FString& OutError) override;
 
     // ============================================================================
     // IStateTreeService Implementation - Validation and Debugging (Section 16)
@@ -205,4 +209,16 @@ private:
 
     /** Helper to save an asset to disk */
     bool SaveAsset(UObject* Asset, FString& OutError);
+
+    /** Create and configure one state through an edit session (no save) */
+    bool ApplyAddState(FStateTreeEditSession& Session, const FAddStateParams& Params, FString& OutError);
+
+    /** Build and append one transition through an edit session (no save) */
+    bool ApplyAddTransition(FStateTreeEditSession& Session, const FAddTransitionParams& Params, FString& OutError);
+
+    /** Save the session's tree once, compiling first when requested; compile failures still save */
+    bool CommitEditSession(FStateTreeEditSession& Session, bool bCompile, FStateTreeBatchResult& OutResult, FString& OutError);
+
+    /** Editor data hash recorded after each successful compile, used to skip unchanged recompiles */
+    TMap<TObjectKey<UStateTree>, uint32> LastCompiledHashes;
 };
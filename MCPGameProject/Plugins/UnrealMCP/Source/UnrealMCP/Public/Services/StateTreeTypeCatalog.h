@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UScriptStruct;
+
+/** Kinds of StateTree node structs offered in the palette */
+enum class EStateTreeNodeKind : uint8
+{
+    Task,
+    Condition,
+    Evaluator,
+    Consideration,
+    Num
+};
+
+/**
+ * Index of StateTree node structs (tasks, conditions, evaluators, considerations)
+ *
+ * Built from the shared FReflectionCatalog snapshot and rebuilt whenever its generation
+ * changes (module load or unload, hot reload, Blueprint compile). Palette lists are kept
+ * ready to return, and lookups by full path or short name are single map finds.
+ * All methods must be called on the game thread.
+ */
+class UNREALMCP_API FStateTreeTypeCatalog
+{
+public:
+    /** Get the singleton instance */
+    static FStateTreeTypeCatalog& Get();
+
+    /**
+     * Get all node structs of a kind
+     * @param Kind - Node kind to list
+     * @return (path, name) pairs, in snapshot order
+     */
+    const TArray<TPair<FString, FString>>& GetTypes(EStateTreeNodeKind Kind);
+
+    /**
+     * Find a node struct by full path ("/Script/Module.Struct") or short name
+     * Names are case-insensitive and may carry the F prefix.
+     * @param PathOrName - Struct path or name
+     * @param OutKind - Optional kind of the found struct
+     * @return The struct or nullptr if it is not a known node type
+     */
+    UScriptStruct* FindType(const FString& PathOrName, EStateTreeNodeKind* OutKind = nullptr);
+
+    /** Base struct a kind derives from */
+    static const UScriptStruct* GetBaseStruct(EStateTreeNodeKind Kind);
+
+private:
+    FStateTreeTypeCatalog() = default;
+
+    struct FEntry
+    {
+        TWeakObjectPtr<UScriptStruct> Struct;
+        EStateTreeNodeKind Kind = EStateTreeNodeKind::Task;
+    };
+
+    /** Rebuild from the reflection catalog if its snapshot changed */
+    void EnsureCurrent();
+
+    UScriptStruct* ResolveEntry(const int32* EntryIndex, EStateTreeNodeKind* OutKind) const;
+
+    uint32 BuiltGeneration = 0;
+
+    TArray<FEntry> Entries;
+    TArray<TPair<FString, FString>> TypesByKind[static_cast<int32>(EStateTreeNodeKind::Num)];
+
+    /** Lowercased path / name -> index into Entries (first match wins for repeated names) */
+    TMap<FString, int32> EntriesByPath;
+    TMap<FString, int32> EntriesByName;
+};
@@ -159,6 +159,21 @@ public:
     virtual bool CaptureWidgetScreenshot(const FString& BlueprintName, int32 Width, int32 Height,
                                         const FString& Format, TSharedPtr<FJsonObject>& OutScreenshotData) = 0;
 
+    /**
+     * Capture a screenshot of a widget blueprint preview without blocking the game thread
+     * The draw is enqueued immediately; GPU readback and image encoding complete later.
+     * @param BlueprintName - Name of the target widget blueprint
+     * @param Width - Width of the screenshot in pixels
+     * @param Height - Height of the screenshot in pixels
+     * @param Format - Image format ("png" or "jpg")
+     * @param OutputFilePath - If set, the image is written to this file and only its path and SHA-1 are
+     *                         returned instead of image_base64
+     * @param OnComplete - Called on the game thread with the same JSON data as CaptureWidgetScreenshot (nullptr on failure)
+     */
+    virtual void CaptureWidgetScreenshotAsync(const FString& BlueprintName, int32 Width, int32 Height,
+                                              const FString& Format, const FString& OutputFilePath,
+                                              TFunction<void(TSharedPtr<FJsonObject>)> OnComplete) = 0;
+
     /**
      * Create an input event handler in a Widget Blueprint
      *
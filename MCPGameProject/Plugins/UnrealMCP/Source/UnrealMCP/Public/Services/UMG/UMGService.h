@@ -59,6 +59,10 @@ public:
     virtual bool CaptureWidgetScreenshot(const FString& BlueprintName, int32 Width, int32 Height,
                                         const FString& Format, TSharedPtr<FJsonObject>& OutScreenshotData) override;
 
+    virtual void CaptureWidgetScreenshotAsync(const FString& BlueprintName, int32 Width, int32 Height,
+                                              const FString& Format, const FString& OutputFilePath,
+                                              TFunction<void(TSharedPtr<FJsonObject>)> OnComplete) override;
+
     virtual bool CreateWidgetInputHandler(const FString& WidgetName, const FString& ComponentName,
                                          const FString& InputType, const FString& InputEvent,
                                          const FString& Trigger, const FString& HandlerName,
@@ -6,6 +6,7 @@
 // Forward declarations
 class UWidgetBlueprint;
 class UWidget;
+class UTextureRenderTarget2D;
 
 /**
  * Service for widget layout inspection and screenshot capture
@@ -34,7 +35,34 @@ public:
     static bool CaptureWidgetScreenshot(UWidgetBlueprint* WidgetBlueprint, int32 Width, int32 Height,
                                        const FString& Format, TSharedPtr<FJsonObject>& OutScreenshotData);
 
+    /**
+     * Capture a screenshot of a widget blueprint without blocking the game thread
+     * Draws into a pooled render target; GPU readback, compression and Base64 happen off the game thread.
+     * @param WidgetBlueprint - Widget blueprint to capture
+     * @param Width - Screenshot width in pixels
+     * @param Height - Screenshot height in pixels
+     * @param Format - Image format ("png" or "jpg")
+     * @param OutputFilePath - If set, write the image here and return file_path + sha1 instead of image_base64
+     * @param OnComplete - Called on the game thread with the screenshot JSON, or nullptr on failure
+     */
+    static void CaptureWidgetScreenshotAsync(UWidgetBlueprint* WidgetBlueprint, int32 Width, int32 Height,
+                                             const FString& Format, const FString& OutputFilePath,
+                                             TFunction<void(TSharedPtr<FJsonObject>)> OnComplete);
+
 private:
+    /**
+     * Create a preview instance of the widget and draw it into a pooled render target
+     * The draw is only enqueued on the render thread; nothing is flushed.
+     * @param WidgetBlueprint - Widget blueprint to draw
+     * @param Width - Target width in pixels
+     * @param Height - Target height in pixels
+     * @param OutRenderTarget - Pooled render target the widget was drawn into
+     * @param OutDrawPayload - Preview widget and renderer; must stay alive until the draw has been read back
+     * @return true if the draw was enqueued
+     */
+    static bool DrawWidgetToPooledTarget(UWidgetBlueprint* WidgetBlueprint, int32 Width, int32 Height,
+                                         UTextureRenderTarget2D*& OutRenderTarget, TSharedPtr<void>& OutDrawPayload);
+
     /**
      * Build hierarchical widget information recursively
      * @param Widget - Widget to build hierarchy for
@@ -20,6 +20,19 @@
 
 class FMCPServerRunnable;
 
+/** How long the socket thread waits on a command before handing it to the job service */
+struct FMCPDispatchOptions
+{
+	static constexpr double DefaultInlineWaitSeconds = 10.0;
+	static constexpr double MaxInlineWaitSeconds = 120.0;
+
+	/** Return a job handle immediately instead of waiting at all */
+	bool bAsync = false;
+
+	/** Commands still running after this are answered with a job handle; their result is kept */
+	double InlineWaitSeconds = DefaultInlineWaitSeconds;
+};
+
 /**
  * Editor subsystem for MCP Bridge
  * Handles communication between external tools and the Unreal Editor
@@ -45,8 +58,9 @@ public:
 	bool IsRunning() const { return bIsRunning; }
 
 	// Command execution
-	FString ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+	FString ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const FMCPDispatchOptions& Options = FMCPDispatchOptions());
 	static bool ShouldDispatchViaTicker(const FString& CommandType);
+	static bool ShouldExecuteOnSocketThread(const FString& CommandType);
 
 private:
 	// Server state
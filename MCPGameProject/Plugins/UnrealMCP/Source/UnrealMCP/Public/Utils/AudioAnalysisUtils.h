@@ -0,0 +1,107 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Settings shared by the audio analysis kernels
+ */
+struct FAudioAnalysisSettings
+{
+    /** Samples whose magnitude (0-1 full scale) reaches this count as clipped; 0.999 is about -0.01 dBFS */
+    float ClipThreshold = 0.999f;
+
+    /** Frames where every channel stays below this level (dBFS) count as silence for the trim points */
+    float SilenceThresholdDb = -60.0f;
+
+    /** Run every kernel on the calling thread (benchmarks compare against this) */
+    bool bForceSingleThread = false;
+};
+
+/**
+ * Level statistics of one channel
+ */
+struct FAudioChannelStats
+{
+    /** Largest sample magnitude, 0-1 full scale */
+    float Peak = 0.0f;
+
+    /** Root mean square level, 0-1 full scale */
+    float Rms = 0.0f;
+
+    /** Mean sample value */
+    float DcOffset = 0.0f;
+
+    /** Samples at or above the clip threshold */
+    int64 ClippedSamples = 0;
+};
+
+/**
+ * Analysis of one decoded waveform
+ */
+struct FAudioAnalysisResult
+{
+    int32 SampleRate = 0;
+    int32 NumChannels = 0;
+    int64 NumFrames = 0;
+
+    TArray<FAudioChannelStats> Channels;
+
+    /** Largest peak and combined RMS over all channels */
+    float Peak = 0.0f;
+    float Rms = 0.0f;
+
+    /** Clipped samples over all channels */
+    int64 ClippedSamples = 0;
+
+    /** ITU-R BS.1770 integrated loudness; only set when at least one gated block passed */
+    bool bHasLoudness = false;
+    float IntegratedLoudness = 0.0f;
+
+    /** First non-silent frame and one past the last; equal when the whole waveform is silent */
+    int64 TrimStartFrame = 0;
+    int64 TrimEndFrame = 0;
+};
+
+/**
+ * Waveform analysis for get_sound_wave_metadata and analyze_sound_waves
+ * Works on deinterleaved float channels. Level statistics use the engine's portable vector
+ * registers; loudness filtering is recursive per channel, so channels are processed on
+ * worker threads instead.
+ */
+class UNREALMCP_API FAudioAnalysisUtils
+{
+public:
+    /**
+     * Split interleaved 16-bit PCM into one float buffer per channel
+     * @param Interleaved - Frames of NumChannels samples
+     * @param OutChannels - Resized to NumChannels buffers in -1..1
+     */
+    static void DeinterleavePcm16(TConstArrayView<int16> Interleaved, int32 NumChannels, TArray<TArray<float>>& OutChannels);
+
+    /**
+     * Peak, RMS, DC offset and clip count of one channel in a single pass
+     * @param ClipThreshold - Magnitude at which a sample counts as clipped
+     */
+    static FAudioChannelStats ComputeChannelStats(TConstArrayView<float> Samples, float ClipThreshold);
+
+    /**
+     * Gated integrated loudness (LUFS) per ITU-R BS.1770-4: K-weighting, 400 ms blocks with
+     * 75% overlap, -70 LUFS absolute and -10 LU relative gates
+     * @return false when the waveform is shorter than one block or every block is gated out
+     */
+    static bool ComputeIntegratedLoudness(const TArray<TArray<float>>& Channels, int32 SampleRate, const FAudioAnalysisSettings& Settings, float& OutLoudness);
+
+    /**
+     * First and one-past-last frame where any channel reaches the threshold
+     * @param Threshold - Linear magnitude, 0-1 full scale
+     */
+    static void FindTrimPoints(const TArray<TArray<float>>& Channels, float Threshold, int64& OutStartFrame, int64& OutEndFrame);
+
+    /** Every statistic above; channels are analyzed in parallel */
+    static FAudioAnalysisResult Analyze(const TArray<TArray<float>>& Channels, int32 SampleRate, const FAudioAnalysisSettings& Settings);
+
+    /** Linear magnitude to dBFS, floored at MinDecibels so silence stays a finite number */
+    static float ToDecibels(float Linear);
+
+    static constexpr float MinDecibels = -144.0f;
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ImageCore.h"
+
+class UPackage;
+class UTexture2D;
+
+/**
+ * Settings shared by the texture processing kernels
+ */
+struct FTextureProcessingSettings
+{
+    /** Texels with alpha at or above this (0-1) count as opaque. Matches the default opacity mask clip value. */
+    float AlphaThreshold = 0.333f;
+
+    /** Run every kernel on the calling thread (benchmarks compare against this) */
+    bool bForceSingleThread = false;
+};
+
+/**
+ * Grid used to pack several images into one atlas
+ * Zero fields are derived: a near-square grid, and cells as large as the largest tile.
+ */
+struct FTextureAtlasLayout
+{
+    int32 Columns = 0;
+    int32 Rows = 0;
+    int32 Width = 0;
+    int32 Height = 0;
+};
+
+/**
+ * In-process texture processing for import_texture
+ * Replaces the external mip-flooding tool and the PIL atlas scripts: images stay in memory
+ * from decode to UTexture source. Kernels work on BGRA8 images, use the engine's portable
+ * vector registers per texel and split rows/tiles across worker threads.
+ */
+class UNREALMCP_API FTextureProcessingUtils
+{
+public:
+    /**
+     * Fill the color of transparent texels from a coverage-weighted mip pyramid (mip flooding)
+     * Opaque texels and the alpha channel are left untouched, so cutouts look identical while
+     * mips and block compression no longer bleed black halos into the edges.
+     * @param Image - BGRA8 image, modified in place
+     * @param Settings - Opacity threshold and threading
+     * @return Number of texels whose color was replaced
+     */
+    static int64 MipFlood(FImage& Image, const FTextureProcessingSettings& Settings);
+
+    /**
+     * Fraction of texels at or above the alpha threshold
+     * @param Image - BGRA8 image
+     * @return Coverage in 0-1
+     */
+    static double ComputeAlphaCoverage(const FImage& Image, const FTextureProcessingSettings& Settings);
+
+    /**
+     * Pack tiles into a grid atlas; each tile is scaled to fit its cell (keeping aspect) and centered
+     * @param Tiles - Decoded images in any format, placed row-major
+     * @param InOutLayout - Requested grid; zero fields are filled in
+     * @param OutAtlas - BGRA8 atlas, transparent outside the tiles
+     * @param OutCells - Pixel rect of each tile inside the atlas
+     * @param OutError - Set when the grid cannot hold every tile or is too large
+     */
+    static bool PackAtlas(
+        const TArray<FImage>& Tiles,
+        FTextureAtlasLayout& InOutLayout,
+        const FTextureProcessingSettings& Settings,
+        FImage& OutAtlas,
+        TArray<FIntRect>& OutCells,
+        FString& OutError);
+
+    /**
+     * Write an image into a texture asset's source (game thread)
+     * Reuses an existing UTexture2D in place; PostEditChange is left to the caller so settings
+     * can be applied first, after which the platform build runs asynchronously.
+     * @param bOutCreated - True when a new asset was created (the caller notifies the asset registry)
+     * @return The texture, or null with OutError when another asset type occupies the name
+     */
+    static UTexture2D* WriteTextureSource(
+        UPackage* Package,
+        const FString& AssetName,
+        const FImage& Image,
+        const FString& SourceFilePath,
+        bool& bOutCreated,
+        FString& OutError);
+};
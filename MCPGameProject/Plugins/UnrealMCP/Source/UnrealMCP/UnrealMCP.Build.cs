@@ -101,6 +101,7 @@ public class UnrealMCP : ModuleRules
 				"BlueprintEditorLibrary",
 				"SubobjectDataInterface",  // For UE 5.7 USubobjectDataSubsystem API
 				"ImageWrapper",            // For PNG/JPEG compression
+				"ImageCore",               // For FImage (bulk import decodes textures off the game thread)
 				"RenderCore",              // For render targets
 				"RHI",                     // For reading pixels from GPU
 				"NavigationSystem",        // For ANavMeshBoundsVolume
@@ -131,6 +132,7 @@ public class UnrealMCP : ModuleRules
 					"MetasoundFrontend",   // FMetaSoundFrontendDocumentBuilder
 					"MetasoundGraphCore",  // Core graph types
 					"MetasoundEditor",      // Editor-specific utilities
+					"AudioEditor",          // USoundFactory for bulk sound import
 					// StateTree AI support
 					"StateTreeModule",         // Core StateTree runtime
 					"StateTreeEditorModule",   // StateTree editor utilities (factories, compilation)
@@ -139,6 +141,10 @@ public class UnrealMCP : ModuleRules
 					"PCG",                     // Core PCG runtime (graphs, nodes, elements)
 					// Static Mesh editor support (LOD management)
 					"StaticMeshEditor",        // UStaticMeshEditorSubsystem
+					"MeshDescription",         // FMeshDescription copies reduced off the game thread
+					"StaticMeshDescription",   // FStaticMeshAttributes, FStaticMeshOperations
+					"MeshReductionInterface",  // IMeshReduction for worker-thread LOD reduction
+					"MeshUtilitiesCommon",     // FOverlappingCorners
 					// PIE (Play In Editor) control
 					"LevelEditor"              // FLevelEditorModule for PIE viewport access
 				}
@@ -276,6 +276,63 @@ async def add_anim_transition(
     return await send_tcp_command("add_anim_transition", params)
 
 
+@app.tool()
+async def build_anim_state_machine(
+    anim_blueprint_name: str,
+    state_machine_name: str,
+    states: List[Dict[str, Any]] = None,
+    transitions: List[Dict[str, Any]] = None,
+    entry_state: str = "",
+    create_if_missing: bool = True,
+    compile: bool = True
+) -> Dict[str, Any]:
+    """
+    Build a whole state machine (states, transitions and their rules) in one call.
+
+    Prefer this over many add_anim_state / add_anim_transition calls: the state machine
+    is resolved once, states are looked up by name, and the blueprint is compiled once
+    at the end. Items that fail are reported without stopping the rest of the build.
+
+    Args:
+        anim_blueprint_name: Name of the target Animation Blueprint
+        state_machine_name: Name of the state machine (created if missing unless create_if_missing is False)
+        states: State definitions, each with:
+            - state_name: Name of the state (required)
+            - animation_asset_path: Optional animation asset to play in the state
+            - is_default_state: Make this the entry state
+            - node_position_x / node_position_y: Position of the state node
+        transitions: Transition definitions, each with:
+            - from_state / to_state: State names (required); may name states from this call or existing ones
+            - transition_rule_type: "TimeRemaining", "BoolVariable", "CrossfadeBlend" (default), "Inertialization", "Custom"
+            - blend_duration: Blend duration in seconds (default: 0.2)
+            - condition_variable: Variable name for bool-based transitions
+        entry_state: Entry state; overrides is_default_state on the listed states
+        create_if_missing: Create the state machine when it does not exist yet
+        compile: Compile the Animation Blueprint after the build
+
+    Returns:
+        Dictionary containing:
+        - success: Whether the state machine was resolved
+        - created_state_machine: Whether the state machine was created by this call
+        - states_added / transitions_added: Number of items applied
+        - failed: Items that were skipped, each with kind, index and error
+        - compiled: Whether the blueprint compiled
+        - compile_error: Compiler error, if any
+    """
+    params = {
+        "anim_blueprint_name": anim_blueprint_name,
+        "state_machine_name": state_machine_name,
+        "states": states or [],
+        "transitions": transitions or [],
+        "create_if_missing": create_if_missing,
+        "compile": compile
+    }
+    if entry_state:
+        params["entry_state"] = entry_state
+
+    return await send_tcp_command("build_anim_state_machine", params)
+
+
 # ============================================================================
 # Animation Variables
 # ============================================================================
@@ -108,6 +108,34 @@ async def compile_blueprint(blueprint_name: str) -> Dict[str, Any]:
     return await send_tcp_command("compile_blueprint", params)
 
 
+@app.tool()
+async def compile_blueprints(
+    blueprint_names: List[str],
+    skip_up_to_date: bool = True
+) -> Dict[str, Any]:
+    """
+    Compile several Blueprints in one batch.
+
+    All targets are queued into the engine's compilation manager and compiled in a
+    single flush, so shared dependents are reinstanced once for the whole batch.
+    Prefer this over calling compile_blueprint in a loop after editing many assets.
+
+    Args:
+        blueprint_names: Names of the Blueprints to compile (duplicates ignored, max 500)
+        skip_up_to_date: Skip Blueprints that are already compiled and unmodified
+
+    Returns:
+        Dictionary with compiled/skipped/failed counts, batch timing (queue_ms,
+        compile_ms, collect_ms), dependents_recompiled, and a results array with
+        status, errors and warnings for each Blueprint
+    """
+    params = {
+        "blueprint_names": blueprint_names,
+        "skip_up_to_date": skip_up_to_date
+    }
+    return await send_tcp_command("compile_blueprints", params)
+
+
 @app.tool()
 async def add_blueprint_variable(
     blueprint_name: str,
@@ -345,7 +373,8 @@ async def get_blueprint_metadata(
     node_type: str = None,
     event_type: str = None,
     detail_level: str = None,
-    component_name: str = None
+    component_name: str = None,
+    if_none_match: str = None
 ) -> Dict[str, Any]:
     """
     Get comprehensive metadata about a Blueprint with selective field querying.
@@ -387,9 +416,11 @@ async def get_blueprint_metadata(
                      - "full": Everything including all data pin connections and default values
         component_name: Required when using "component_properties" field. Specifies which
                        component to get properties for (e.g., "ProjectileMovement", "CollisionSphere").
+        if_none_match: Optional etag from a previous response. If the Blueprint has not
+                       changed, the reply is just {"success": true, "not_modified": true, "etag": ...}.
 
     Returns:
-        Dictionary containing requested metadata fields
+        Dictionary containing requested metadata fields and an etag for if_none_match
 
     Example:
         get_blueprint_metadata(blueprint_name="BP_MyActor", fields=["components"])
@@ -407,6 +438,8 @@ async def get_blueprint_metadata(
         params["detail_level"] = detail_level
     if component_name is not None:
         params["component_name"] = component_name
+    if if_none_match:
+        params["if_none_match"] = if_none_match
     return await send_tcp_command("get_blueprint_metadata", params)
 
 
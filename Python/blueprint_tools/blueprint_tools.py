@@ -563,7 +563,8 @@ def register_blueprint_tools(mcp: FastMCP):
         graph_name: str = None,
         node_type: str = None,
         event_type: str = None,
-        detail_level: str = None
+        detail_level: str = None,
+        if_none_match: str = None
     ) -> Dict[str, Any]:
         """
         Get comprehensive metadata about a Blueprint with selective field querying.
@@ -597,9 +598,11 @@ def register_blueprint_tools(mcp: FastMCP):
                          - "summary": Node IDs and titles only (minimal output)
                          - "flow": Node IDs, titles, and exec pin connections only (DEFAULT)
                          - "full": Everything including all data pin connections and default values
+            if_none_match: Optional etag from a previous response. If the Blueprint has not
+                          changed, the reply is just {"success": true, "not_modified": true, "etag": ...}.
 
         Returns:
-            Dictionary containing requested metadata fields
+            Dictionary containing requested metadata fields and an etag for if_none_match
 
         Examples:
             # Get components
@@ -660,7 +663,7 @@ def register_blueprint_tools(mcp: FastMCP):
                 event_type="BeginPlay"
             )
         """
-        return get_blueprint_metadata_impl(ctx, blueprint_name, fields, graph_name, node_type, event_type, detail_level)
+        return get_blueprint_metadata_impl(ctx, blueprint_name, fields, graph_name, node_type, event_type, detail_level, if_none_match)
 
     @mcp.tool()
     def modify_blueprint_function_properties(
@@ -25,6 +25,11 @@ from utils.editor.editor_operations import (
     batch_spawn_actors as batch_spawn_actors_impl,
     import_static_mesh as import_static_mesh_impl,
     import_texture as import_texture_impl,
+    bulk_import as bulk_import_impl,
+    get_bulk_import_status as get_bulk_import_status_impl,
+    get_job_status as get_job_status_impl,
+    cancel_job as cancel_job_impl,
+    list_jobs as list_jobs_impl,
     create_level as create_level_impl,
     set_level_world_settings as set_level_world_settings_impl
 )
@@ -916,7 +921,15 @@ def register_editor_tools(mcp: FastMCP):
         folder_path: str = "/Game/Textures",
         compression_settings: str = "Default",
         srgb: bool = True,
-        preserve_alpha: bool = True
+        preserve_alpha: bool = True,
+        mip_flood: bool = False,
+        alpha_threshold: float = None,
+        preserve_alpha_coverage: bool = False,
+        atlas_sources: List[str] = None,
+        atlas_columns: int = 0,
+        atlas_rows: int = 0,
+        atlas_width: int = 0,
+        atlas_height: int = 0
     ) -> Dict[str, Any]:
         """
         Import a texture from disk into the Unreal Engine project.
@@ -939,6 +952,14 @@ def register_editor_tools(mcp: FastMCP):
                 Automatically disabled for Normalmap, Masks, and Grayscale compression.
             preserve_alpha: Whether to preserve the alpha channel (default: True).
                 Set to False for opaque textures to save memory.
+            mip_flood: Fill the color of transparent texels from nearby opaque texels in-process
+                (replaces tools/mipflooding). Removes dark halos on foliage cutouts (default: False)
+            alpha_threshold: Opacity cutoff 0-1 for flooding and coverage (default: 0.333)
+            preserve_alpha_coverage: Keep cutout coverage constant across mips (default: False)
+            atlas_sources: Pack these files into one atlas instead of importing source_file_path
+                (replaces scripts/generate_*_atlas*.py). Tiles are fitted and centered row-major.
+            atlas_columns/atlas_rows: Grid size; 0 derives a near-square grid
+            atlas_width/atlas_height: Atlas size; 0 sizes cells to the largest tile
 
         Returns:
             Dictionary containing:
@@ -948,6 +969,8 @@ def register_editor_tools(mcp: FastMCP):
             - size_x: Texture width in pixels
             - size_y: Texture height in pixels
             - has_alpha: Whether the texture has an alpha channel
+            - processing: With mip_flood/atlas_sources: alpha_coverage, flooded_texels, decode_ms,
+              process_ms and atlas.cells [{source, x, y, width, height, uv}]
             - message: Success/error message
 
         Example:
@@ -960,7 +983,126 @@ def register_editor_tools(mcp: FastMCP):
                 preserve_alpha=True
             )
         """
-        return import_texture_impl(ctx, source_file_path, asset_name, folder_path, compression_settings, srgb, preserve_alpha)
+        return import_texture_impl(
+            ctx, source_file_path, asset_name, folder_path, compression_settings, srgb, preserve_alpha,
+            mip_flood, alpha_threshold, preserve_alpha_coverage,
+            atlas_sources, atlas_columns, atlas_rows, atlas_width, atlas_height,
+        )
+
+    @mcp.tool()
+    def bulk_import(
+        ctx: Context,
+        files: List[Any],
+        folder_path: str = "",
+        frame_budget_ms: float = 8.0,
+        max_concurrent_reads: int = 4,
+        options: Dict[str, Any] = None,
+    ) -> Dict[str, Any]:
+        """
+        Import many static meshes, textures and sounds in one call.
+
+        Source files are read (and textures decoded) on worker threads while the editor
+        creates assets in small game-thread slices, so the editor stays responsive.
+        Texture compression and mesh builds continue in the background after creation.
+        Returns immediately with a job_id; poll get_bulk_import_status for progress.
+
+        Args:
+            files: List of absolute file paths, or objects with "source_file_path" and optional
+                "type" (static_mesh/texture/sound, inferred from the extension otherwise),
+                "asset_name" (defaults to the file name), "folder_path", and the per-type
+                settings of import_static_mesh / import_texture.
+            folder_path: Default destination folder for every file. When empty, meshes go to
+                /Game/Meshes, textures to /Game/Textures and sounds to /Game/Audio.
+            frame_budget_ms: Editor time spent creating assets per frame (1-100, default 8).
+                At least one file is imported per frame.
+            max_concurrent_reads: Files read/decoded ahead of creation (1-16, default 4)
+            options: Default settings applied to every file, e.g. {"srgb": false,
+                "compression_settings": "Masks", "import_materials": true}
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the job was queued
+            - job_id: Id for get_bulk_import_status
+            - item_count: Number of files queued
+
+        Example:
+            bulk_import(
+                files=["E:/drop/T_Rock_D.png",
+                       {"source_file_path": "E:/drop/T_Rock_N.png", "compression_settings": "Normalmap"},
+                       "E:/drop/SM_Rock.fbx", "E:/drop/S_Impact.wav"],
+                folder_path="/Game/Environment/Rocks"
+            )
+        """
+        return bulk_import_impl(ctx, files, folder_path, frame_budget_ms, max_concurrent_reads, options)
+
+    @mcp.tool()
+    def get_bulk_import_status(ctx: Context, job_id: str, include_items: bool = True) -> Dict[str, Any]:
+        """
+        Report progress of a bulk_import job.
+
+        Args:
+            job_id: Id returned by bulk_import
+            include_items: Include per-file state, asset paths and errors (default: True)
+
+        Returns:
+            Dictionary containing:
+            - state: "running" or "completed"
+            - total/queued/reading/ready/succeeded/failed: File counts per state
+            - elapsed_ms, read_ms_total, import_ms_total, game_thread_slices: Timing
+            - pending_compiles: Asset builds (texture compression, mesh builds) still running
+            - items: Per-file {source_file_path, type, state, asset_paths, error, read_ms, import_ms}
+        """
+        return get_bulk_import_status_impl(ctx, job_id, include_items)
+
+    @mcp.tool()
+    def get_job_status(ctx: Context, job_id: str) -> Dict[str, Any]:
+        """
+        Report the state of a long-running job.
+
+        Commands still running after the editor's inline wait (10 seconds by default) answer
+        with {"job_pending": true, "job_id": ...} instead of blocking; bulk_import and LOD
+        generation jobs are listed here under their own ids too. Tools poll this
+        automatically, so it is mainly useful for jobs started elsewhere.
+
+        Args:
+            job_id: Id from a job_pending response, bulk_import or a LOD command
+
+        Returns:
+            Dictionary containing:
+            - state: "running", "succeeded", "failed" or "cancelled"
+            - progress: 0-1 when the job reports progress, with progress_message
+            - elapsed_ms, cancel_requested
+            - response: Once finished, the command's full response as it would have been returned inline
+        """
+        return get_job_status_impl(ctx, job_id)
+
+    @mcp.tool()
+    def cancel_job(ctx: Context, job_id: str) -> Dict[str, Any]:
+        """
+        Cancel a running job.
+
+        Queued commands are skipped and batch jobs stop at the next item; work already
+        inside the engine finishes, and its result stays retrievable through get_job_status.
+
+        Args:
+            job_id: Id of a running job
+        """
+        return cancel_job_impl(ctx, job_id)
+
+    @mcp.tool()
+    def list_jobs(ctx: Context, running_only: bool = False) -> Dict[str, Any]:
+        """
+        List jobs known to the editor, newest first (the last 64 finished jobs are kept).
+
+        Args:
+            running_only: Only list jobs that are still running
+
+        Returns:
+            Dictionary containing:
+            - jobs: {job_id, command, state, progress, progress_message, elapsed_ms}
+            - running: Number of running jobs
+        """
+        return list_jobs_impl(ctx, running_only)
 
     register_runtime_tools(mcp)
     # Register all tools with the help system
@@ -980,4 +1122,9 @@ def register_editor_tools(mcp: FastMCP):
     _help_registry.register(spawn_actors, category="actors")
     _help_registry.register(import_static_mesh, category="assets")
     _help_registry.register(import_texture, category="assets")
+    _help_registry.register(bulk_import, category="assets")
+    _help_registry.register(get_bulk_import_status, category="assets")
+    _help_registry.register(get_job_status, category="jobs")
+    _help_registry.register(cancel_job, category="jobs")
+    _help_registry.register(list_jobs, category="jobs")
     logger.info("Editor tools registered successfully")
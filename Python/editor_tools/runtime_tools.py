@@ -158,21 +158,29 @@ def register_runtime_tools(mcp: FastMCP):
         ctx: Context,
         mesh_filter: str = "",
         max_results: int = 50,
+        refresh: bool = False,
     ) -> Dict[str, Any]:
         """Return a per-mesh scene rendering-cost breakdown.
 
         Args:
             mesh_filter: Optional case-insensitive mesh-name substring.
             max_results: Maximum meshes returned, sorted by total LOD0 cost.
+            refresh: Discard the editor-side scene cache and re-gather the
+                whole level (only needed after edits made without editor
+                notifications).
 
         Results include instance/component counts, LOD0 triangles, aggregate
         triangle cost, shadow casters, Nanite state, and instancing state.
+        Repeat calls reuse an incrementally updated cache; ``cache.reused`` is
+        true when neither the scene nor the camera changed since the last call.
         """
         params = {}
         if mesh_filter:
             params["mesh_filter"] = mesh_filter
         if max_results != 50:
             params["max_results"] = max_results
+        if refresh:
+            params["refresh"] = True
         return send_unreal_command("get_scene_breakdown", params)
 
     @mcp.tool()
@@ -190,21 +198,59 @@ def register_runtime_tools(mcp: FastMCP):
         return send_unreal_command("get_rendering_stats", {"action": "snapshot"})
 
     @mcp.tool()
-    def get_mesh_draw_stats(ctx: Context, mesh_filter: str = None) -> Dict[str, Any]:
+    def get_mesh_draw_stats(
+        ctx: Context,
+        mesh_filter: str = None,
+        group_by: str = "entry",
+        top_n: int = 100,
+    ) -> Dict[str, Any]:
         """Return per-resource mesh draw counts by render pass.
 
         Args:
             mesh_filter: Optional case-insensitive resource-name substring.
+            group_by: "entry" (one row per draw command), "resource",
+                "material" or "pass". Grouped rows sum their entries.
+            top_n: Number of rows to return, ranked by visible primitives.
 
         Entries include pass, resource, material, visible primitives/vertices/
-        instances, LOD index, and aggregate totals. Collection may require a
-        rendered frame before data becomes available.
+        instances, LOD index, and aggregate totals. The editor captures the next
+        rendered frame and aggregates it off the game thread; if no frame renders
+        in time the result reports ``stats_pending`` and a later call returns it.
         """
-        params = {}
+        params = {"group_by": group_by, "top_n": top_n}
         if mesh_filter:
             params["mesh_filter"] = mesh_filter
         return send_unreal_command("get_mesh_draw_stats", params)
 
+    @mcp.tool()
+    def get_frame_telemetry(
+        ctx: Context,
+        window_seconds: float = 10.0,
+        hitch_threshold_ms: float = 0.0,
+        max_hitches: int = 20,
+    ) -> Dict[str, Any]:
+        """Summarize recent frame times from the editor's always-on sampler.
+
+        Args:
+            window_seconds: How far back to look (up to ~8192 frames are kept).
+            hitch_threshold_ms: Frames at or above this count as hitches. 0 picks
+                max(33.3 ms, 2 x median frame time).
+            max_hitches: Maximum number of worst hitches to return.
+
+        Returns p50/p95/p99/max for frame, game, render, RHI and GPU time plus
+        draw calls and primitives, the worst hitches (newest first, each tagged
+        with the thread it was bound by) and a frame-time histogram. Sampling
+        runs every frame; this query never pauses or reconfigures the editor.
+        """
+        return send_unreal_command(
+            "get_frame_telemetry",
+            {
+                "window_seconds": window_seconds,
+                "hitch_threshold_ms": hitch_threshold_ms,
+                "max_hitches": max_hitches,
+            },
+        )
+
     @mcp.tool()
     def start_pie(ctx: Context) -> Dict[str, Any]:
         """Queue a Play In Editor session.
@@ -231,6 +277,7 @@ def register_runtime_tools(mcp: FastMCP):
         get_scene_breakdown,
         get_rendering_stats,
         get_mesh_draw_stats,
+        get_frame_telemetry,
         start_pie,
         stop_pie,
     ):
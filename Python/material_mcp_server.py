@@ -397,6 +397,55 @@ async def batch_set_material_params(
     return await send_tcp_command("batch_set_material_params", params)
 
 
+@app.tool()
+async def batch_set_material_instances_params(
+    material_instances: List[str],
+    scalar_params: dict = None,
+    vector_params: dict = None,
+    texture_params: dict = None
+) -> Dict[str, Any]:
+    """
+    Apply the same parameters to many Material Instances in a single operation.
+
+    Each instance is loaded and updated once, and viewport/render updates run once
+    for the whole batch. Use this instead of calling batch_set_material_params in a
+    loop when re-tinting or re-tuning a family of instances.
+
+    Args:
+        material_instances: List of Material Instance paths or names
+        scalar_params: Dictionary of scalar parameters {"ParamName": 0.5, ...}
+        vector_params: Dictionary of vector parameters {"ParamName": [R, G, B, A], ...}
+        texture_params: Dictionary of texture parameters {"ParamName": "/Game/Textures/T_Name", ...}
+
+    Returns:
+        Dictionary containing:
+        - success: Whether every instance received every parameter
+        - instances: Per-instance results (material_instance, success, error, scalar, vector, texture)
+        - instance_count / failed_count: Totals for the batch
+        - partial_update: Present on failure; true if some instances were still updated
+        - message: Summary message
+
+    Example:
+        batch_set_material_instances_params(
+            material_instances=["MI_Crystal_Red", "MI_Crystal_Blue", "MI_Crystal_Green"],
+            scalar_params={"Roughness": 0.1, "EmissiveIntensity": 2.0},
+            texture_params={"NormalMap": "/Game/Textures/T_Crystal_N"}
+        )
+    """
+    params = {
+        "material_instances": material_instances
+    }
+    # Same parameter-map contract as batch_set_material_params
+    if scalar_params:
+        params["scalar_params"] = scalar_params
+    if vector_params:
+        params["vector_params"] = vector_params
+    if texture_params:
+        params["texture_params"] = texture_params
+
+    return await send_tcp_command("batch_set_material_instances_params", params)
+
+
 # ============================================================================
 # Metadata and Discovery
 # ============================================================================
@@ -67,7 +67,8 @@ def register_material_tools(mcp: FastMCP):
     def get_material_metadata(
         ctx: Context,
         material_path: str,
-        fields: List[str] = None
+        fields: List[str] = None,
+        if_none_match: str = None
     ) -> Dict[str, Any]:
         """
         Get metadata about a material including parameters.
@@ -75,15 +76,16 @@ def register_material_tools(mcp: FastMCP):
         Args:
             material_path: Full path to the material
             fields: Filter fields: "basic"|"parameters"|"properties"|"*" (default all)
+            if_none_match: etag from a previous response; replies not_modified if unchanged
 
         Returns:
             Dict with: name, path, type, parent_material, scalar_parameters[],
-            vector_parameters[], texture_parameters[], blend_mode, shading_model
+            vector_parameters[], texture_parameters[], blend_mode, shading_model, etag
 
         Example:
             get_material_metadata("/Game/Materials/M_WoodFloor")
         """
-        return get_material_metadata_impl(ctx, material_path, fields)
+        return get_material_metadata_impl(ctx, material_path, fields, if_none_match)
 
     @mcp.tool()
     def set_material_parameter(
@@ -52,26 +52,34 @@ async def get_static_mesh_metadata(
 
 @app.tool()
 async def set_lod_count(
-    mesh_path: str,
-    lod_count: int
+    lod_count: int,
+    mesh_path: str = None,
+    mesh_paths: List[str] = None,
+    save: bool = True
 ) -> Dict[str, Any]:
     """
-    Set the number of LOD levels on a Static Mesh.
+    Set the number of LOD levels on one or many Static Meshes.
 
-    This adds or removes LOD source models. New LODs are empty until
-    populated via import_lod or auto-reduction.
+    Existing LODs below lod_count are kept; extra LODs are removed. Added slots
+    are reduced from LOD0 on worker threads (each keeps half the triangles of
+    the previous one). Returns immediately with a job_id; poll
+    get_lod_job_status until state is "completed".
 
     Args:
-        mesh_path: Path to the Static Mesh
         lod_count: Desired number of LODs (1-8)
+        mesh_path: Path to a single Static Mesh
+        mesh_paths: Paths to many Static Meshes (combined with mesh_path)
+        save: Save each package once its build finishes (default: True)
 
     Example:
         set_lod_count(mesh_path="/Game/Meshes/SM_Grass_01", lod_count=3)
     """
-    return await send_tcp_command("set_lod_count", {
-        "mesh_path": mesh_path,
-        "lod_count": lod_count
-    })
+    params: Dict[str, Any] = {"lod_count": lod_count, "save": save}
+    if mesh_path:
+        params["mesh_path"] = mesh_path
+    if mesh_paths:
+        params["mesh_paths"] = mesh_paths
+    return await send_tcp_command("set_lod_count", params)
 
 
 @app.tool()
@@ -136,40 +144,88 @@ async def set_lod_screen_sizes(
 
 @app.tool()
 async def auto_generate_lods(
-    mesh_path: str,
+    mesh_path: str = None,
+    mesh_paths: List[str] = None,
     target_lod_count: int = 3,
-    reduction_percentages: list = None
+    reduction_percentages: list = None,
+    save: bool = True,
+    frame_budget_ms: float = None,
+    max_concurrent_reductions: int = None
 ) -> Dict[str, Any]:
     """
     Auto-generate LODs using UE's built-in mesh reduction.
 
     Creates simplified versions of LOD0 at specified reduction percentages.
-    Much faster than manually creating LOD meshes in Blender.
+    Reduction runs on worker threads against copies of LOD0; the editor only
+    commits, builds and saves each mesh, a few milliseconds per frame. Returns
+    immediately with a job_id; poll get_lod_job_status for per-mesh timings
+    and triangle counts.
 
     Args:
-        mesh_path: Path to the Static Mesh
+        mesh_path: Path to a single Static Mesh
+        mesh_paths: Paths to many Static Meshes (combined with mesh_path)
         target_lod_count: Total number of LODs to have (including LOD0)
         reduction_percentages: Triangle reduction per LOD (0.0-1.0).
-            Default: evenly distributed (e.g., [1.0, 0.5, 0.25] for 3 LODs).
+            Default: evenly distributed (e.g., [1.0, 0.67, 0.33] for 3 LODs).
             Values are percentage of LOD0 triangles to KEEP.
+        save: Save each package once its build finishes (default: True)
+        frame_budget_ms: Editor time per frame for commits and saves (1-100, default 8)
+        max_concurrent_reductions: Meshes reduced at once (1-16, default 4)
 
     Example:
         auto_generate_lods(
-            mesh_path="/Game/Meshes/SM_Grass_01",
+            mesh_paths=["/Game/Meshes/SM_Grass_01", "/Game/Meshes/SM_Grass_02"],
             target_lod_count=3,
             reduction_percentages=[1.0, 0.35, 0.1]
         )
     """
-    params = {
-        "mesh_path": mesh_path,
+    params: Dict[str, Any] = {
         "target_lod_count": target_lod_count,
+        "save": save,
     }
+    if mesh_path:
+        params["mesh_path"] = mesh_path
+    if mesh_paths:
+        params["mesh_paths"] = mesh_paths
     if reduction_percentages:
         params["reduction_percentages"] = reduction_percentages
+    if frame_budget_ms is not None:
+        params["frame_budget_ms"] = frame_budget_ms
+    if max_concurrent_reductions is not None:
+        params["max_concurrent_reductions"] = max_concurrent_reductions
 
     return await send_tcp_command("auto_generate_lods", params)
 
 
+@app.tool()
+async def get_lod_job_status(
+    job_id: str,
+    include_meshes: bool = True
+) -> Dict[str, Any]:
+    """
+    Report progress of an auto_generate_lods or set_lod_count job.
+
+    Args:
+        job_id: Id returned by auto_generate_lods or set_lod_count
+        include_meshes: Include per-mesh state, timings and LOD triangle counts (default: True)
+
+    Returns:
+        Dictionary containing:
+        - state: "running" or "completed"
+        - total/queued/reducing/building/succeeded/failed: Mesh counts
+        - elapsed_ms, reduce_ms_total, game_thread_ms_total
+        - meshes: Per-mesh timings (prepare/reduce/commit/build/save) and lods
+          (index, generated, percent_triangles, triangles, vertices, render_triangles)
+
+    Example:
+        get_lod_job_status(job_id="lod_job_1")
+    """
+    return await send_tcp_command("get_lod_job_status", {
+        "job_id": job_id,
+        "include_meshes": include_meshes
+    })
+
+
 # ============================================================================
 # Mesh Properties
 # ============================================================================
@@ -108,7 +108,8 @@ async def duplicate_niagara_system(
 
 @app.tool()
 async def get_niagara_system_metadata(
-    system: str
+    system: str,
+    if_none_match: str = None
 ) -> Dict[str, Any]:
     """
     Get metadata and configuration from a Niagara System.
@@ -118,10 +119,13 @@ async def get_niagara_system_metadata(
 
     Args:
         system: Path or name of the Niagara System
+        if_none_match: Optional etag from a previous response. If the system has not
+                       changed, the reply is just {"success": true, "not_modified": true, "etag": ...}.
 
     Returns:
         Dictionary containing:
         - success: Whether retrieval was successful
+        - etag: Pass back as if_none_match on the next call
         - name: System name
         - path: Full asset path
         - auto_activate: Whether auto-activate is enabled
@@ -134,6 +138,8 @@ async def get_niagara_system_metadata(
         get_niagara_system_metadata(system="NS_FireExplosion")
     """
     params = {"system": system}
+    if if_none_match:
+        params["if_none_match"] = if_none_match
     return await send_tcp_command("get_niagara_system_metadata", params)
 
 
@@ -147,6 +153,10 @@ async def compile_niagara_system(
     Forces recompilation of all emitters and saves the system asset.
     Use this after making changes to ensure they're persisted.
 
+    Editing tools queue their recompile and return without waiting; edits made
+    in quick succession share one compile. This tool (and get_niagara_diagnostics)
+    starts any queued compile immediately and waits for the result.
+
     Args:
         system: Path or name of the Niagara System to compile
 
@@ -1468,6 +1478,8 @@ async def get_module_inputs(
             - full_name: Full qualified name (e.g., "Module.Lifetime")
             - type: Niagara type name (e.g., "NiagaraFloat", "Vector3f", "LinearColor")
             - value: Current value as string
+        - schema_cached: True if the module's input list came from the schema cache
+          (only current values were read)
 
     Example:
         get_module_inputs(
@@ -1604,6 +1616,8 @@ async def get_niagara_diagnostics(
         - success: Whether validation ran successfully
         - system: Name of the system
         - path: Full asset path
+        - compile_status_before: "queued", "compiling" or "up_to_date" when the call
+          arrived; queued/running compiles are finished before validation runs
         - diagnostics: Array of diagnostic results, each with:
             - severity: "Info", "Warning", or "Error"
             - summary: Short description of the issue
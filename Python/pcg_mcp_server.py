@@ -261,24 +261,43 @@ async def spawn_pcg_actor(
 
 @app.tool()
 async def execute_pcg_graph(
-    actor_name: str,
-    force: bool = True
+    actor_name: str = "",
+    force: bool = True,
+    actor_names: list[str] = None,
+    wait_for_completion: bool = True,
+    collect_node_stats: bool = True,
+    timeout_seconds: float = 300.0
 ) -> dict:
-    """Execute/regenerate a PCG Graph on an actor's PCG Component.
+    """Execute/regenerate PCG Graphs on one or more actors' PCG Components.
 
-    Triggers generation on the PCG Component attached to the specified actor.
+    All components are scheduled together so the PCG scheduler runs them concurrently.
+    By default the call returns once every component reports generation complete;
+    long generations continue as a job that is polled automatically.
 
     Args:
         actor_name: Name or label of the actor with PCG Component
         force: If True, force full regeneration even if inputs haven't changed
+        actor_names: Additional actors to generate in the same batch (max 64 in total)
+        wait_for_completion: If False, return as soon as generation is scheduled
+        collect_node_stats: Report per-node timings and point counts (enables graph inspection while generating)
+        timeout_seconds: Components still generating after this are cancelled and reported as failed
 
     Returns:
-        Dict with success status and generation info
+        Dict with success, elapsed_ms, generated/cancelled/failed counts, total output_points and
+        components[] with {actor, graph, state, generation_ms, output_points, nodes[]}; nodes are
+        {node_id, title, executions, execution_ms, prepare_ms, output_points}, slowest first
     """
-    return await send_tcp_command("execute_pcg_graph", {
-        "actor_name": actor_name,
-        "force": force
-    })
+    params = {
+        "force": force,
+        "wait_for_completion": wait_for_completion,
+        "collect_node_stats": collect_node_stats,
+        "timeout_seconds": timeout_seconds
+    }
+    if actor_name:
+        params["actor_name"] = actor_name
+    if actor_names:
+        params["actor_names"] = actor_names
+    return await send_tcp_command("execute_pcg_graph", params)
 
 
 @app.tool()
@@ -1717,7 +1717,8 @@ def register_project_tools(mcp: FastMCP):
                         saves to MCPGameProject/Saved/Screenshots/MCP/ with timestamp.
 
         Returns:
-            Dict with: success, file_path, width, height, message
+            Dict with: success, file_path, sha1 (hex SHA-1 of the written PNG),
+            image_size_bytes, width, height, message
 
         Example:
             capture_viewport_screenshot()
@@ -60,14 +60,17 @@ async def import_sound_file(
 
 
 @app.tool()
-async def get_sound_wave_metadata(sound_wave_path: str) -> Dict[str, Any]:
+async def get_sound_wave_metadata(sound_wave_path: str, analyze: bool = False) -> Dict[str, Any]:
     """
     Get metadata about a sound wave asset.
 
     Returns duration, sample rate, channels, volume, pitch, and streaming info.
+    With analyze=True the imported PCM is also decoded and measured (see
+    analyze_sound_waves for the fields).
 
     Args:
         sound_wave_path: Full path to the sound wave asset (e.g., "/Game/Audio/Sounds/SW_Explosion")
+        analyze: Also add an "analysis" object with levels, loudness, silence and clipping (default: False)
 
     Returns:
         Dictionary containing:
@@ -81,16 +84,56 @@ async def get_sound_wave_metadata(sound_wave_path: str) -> Dict[str, Any]:
         - volume: Base volume multiplier
         - pitch: Base pitch multiplier
         - is_streaming: Whether the sound uses streaming
+        - analysis: Waveform analysis (only with analyze=True)
 
     Example:
-        get_sound_wave_metadata(sound_wave_path="/Game/Audio/Sounds/SW_Explosion")
+        get_sound_wave_metadata(sound_wave_path="/Game/Audio/Sounds/SW_Explosion", analyze=True)
     """
     params = {
-        "sound_wave_path": sound_wave_path
+        "sound_wave_path": sound_wave_path,
+        "analyze": analyze
     }
     return await send_tcp_command("get_sound_wave_metadata", params)
 
 
+@app.tool()
+async def analyze_sound_waves(sound_wave_paths: List[str]) -> Dict[str, Any]:
+    """
+    Decode and measure many sound waves in one call, for batch audio QA.
+
+    Each wave's imported PCM is decoded once and analyzed in parallel with the
+    others. Results are cached against the hash of the imported source data,
+    so repeating a check after unrelated edits is nearly free and a re-import
+    is analyzed again.
+
+    Args:
+        sound_wave_paths: Paths of the sound waves to analyze
+
+    Returns:
+        Dictionary containing:
+        - success: Whether the batch ran
+        - analyzed / failed / cached: Counts over the batch
+        - elapsed_ms: Time spent
+        - results: One entry per path with:
+            - path, success, error (on failure), cached
+            - sample_rate, num_channels, num_frames, duration
+            - peak_dbfs, rms_dbfs: Levels over all channels
+            - integrated_loudness_lufs: ITU-R BS.1770 gated loudness (absent when too short or silent)
+            - clipped_samples: Samples at or above -0.01 dBFS
+            - trim_start_seconds, trim_end_seconds: First/last audio above -60 dBFS
+            - leading_silence_seconds, trailing_silence_seconds
+            - channels: Per-channel peak_dbfs, rms_dbfs, dc_offset and clipped_samples
+            - source_hash: Hash of the imported source data
+
+    Example:
+        analyze_sound_waves(sound_wave_paths=["/Game/Audio/SW_Step1", "/Game/Audio/SW_Step2"])
+    """
+    params = {
+        "sound_wave_paths": sound_wave_paths
+    }
+    return await send_tcp_command("analyze_sound_waves", params)
+
+
 @app.tool()
 async def set_sound_wave_properties(
     sound_wave_path: str,
@@ -595,6 +638,56 @@ async def compile_sound_cue(sound_cue_path: str) -> Dict[str, Any]:
     return await send_tcp_command("compile_sound_cue", params)
 
 
+@app.tool()
+async def batch_edit_sound_cue(
+    sound_cue_path: str,
+    operations: List[Dict[str, Any]]
+) -> Dict[str, Any]:
+    """
+    Apply many node and edge edits to one Sound Cue in a single call.
+
+    The Sound Cue is loaded once, the editor graph is relinked once and the
+    asset is saved once, instead of once per add_sound_cue_node or
+    connect_sound_cue_nodes call. Operations run in order; a failed operation
+    is reported and does not stop the rest.
+
+    Args:
+        sound_cue_path: Path to the Sound Cue
+        operations: List of operations, each with an "op" field:
+            - {"op": "add_node", "node_type": "Random", "ref": "rnd",
+               "sound_wave_path": "..."}  (sound_wave_path for WavePlayer only)
+            - {"op": "connect", "source_node_id": "rnd", "target_node_id": "Output",
+               "target_pin_index": 0}
+            Node IDs may be existing node names or the "ref" of a node added
+            earlier in the same batch.
+
+    Returns:
+        Dictionary containing:
+        - success: Whether the Sound Cue could be edited
+        - applied / failed: Number of operations that succeeded / failed
+        - node_ids: Map of ref to the created node's ID
+        - results: Per-operation index, op, success, node_id and error
+
+    Example:
+        batch_edit_sound_cue(
+            sound_cue_path="/Game/Audio/SoundCues/SC_Footsteps",
+            operations=[
+                {"op": "add_node", "ref": "a", "node_type": "WavePlayer", "sound_wave_path": "/Game/Audio/SW_Step1"},
+                {"op": "add_node", "ref": "b", "node_type": "WavePlayer", "sound_wave_path": "/Game/Audio/SW_Step2"},
+                {"op": "add_node", "ref": "rnd", "node_type": "Random"},
+                {"op": "connect", "source_node_id": "a", "target_node_id": "rnd", "target_pin_index": 0},
+                {"op": "connect", "source_node_id": "b", "target_node_id": "rnd", "target_pin_index": 1},
+                {"op": "connect", "source_node_id": "rnd", "target_node_id": "Output"}
+            ]
+        )
+    """
+    params = {
+        "sound_cue_path": sound_cue_path,
+        "operations": operations
+    }
+    return await send_tcp_command("batch_edit_sound_cue", params)
+
+
 # ============================================================================
 # Sound Class/Mix Operations (Phase 4 - Music System)
 # ============================================================================
@@ -1072,10 +1165,13 @@ async def search_metasound_palette(
 
     Use this tool to discover available MetaSound nodes before adding them.
     Returns the exact namespace, name, and variant needed for add_metasound_node.
+    Results are ranked: name and display-name matches come before category,
+    keyword and description matches.
 
     Args:
-        search_query: Search term to filter nodes (searches name, namespace,
-                     keywords, category). Empty string returns all nodes.
+        search_query: Words to match (searches name, display name, namespace,
+                     keywords, category, description); every word must match.
+                     Empty string returns all nodes.
         max_results: Maximum number of results to return (default: 50)
 
     Returns:
@@ -1110,5 +1206,56 @@ async def search_metasound_palette(
     return await send_tcp_command("search_metasound_palette", params)
 
 
+@app.tool()
+async def batch_edit_metasound(
+    metasound_path: str,
+    operations: List[Dict[str, Any]]
+) -> Dict[str, Any]:
+    """
+    Apply many node, edge and input edits to one MetaSound in a single call.
+
+    All operations go through one document builder; the graph is registered
+    with the frontend once and the asset is saved once, instead of once per
+    add_metasound_node, connect_metasound_nodes or set_metasound_input call.
+    Operations run in order; a failed operation is reported and does not stop
+    the rest.
+
+    Args:
+        metasound_path: Path to the MetaSound
+        operations: List of operations, each with an "op" field:
+            - {"op": "add_node", "ref": "osc", "node_class_name": "Sine",
+               "node_namespace": "UE", "node_variant": "Audio", "pos_x": 0, "pos_y": 0}
+            - {"op": "connect", "source_node_id": "osc", "source_pin_name": "Audio",
+               "target_node_id": "<guid>", "target_pin_name": "Out Mono"}
+            - {"op": "set_input", "node_id": "osc", "input_name": "Frequency", "value": 440}
+            Node IDs may be existing node GUIDs or the "ref" of a node added
+            earlier in the same batch.
+
+    Returns:
+        Dictionary containing:
+        - success: Whether the MetaSound could be edited
+        - applied / failed: Number of operations that succeeded / failed
+        - node_ids: Map of ref to the created node's GUID
+        - results: Per-operation index, op, success, node_id and error
+
+    Example:
+        batch_edit_metasound(
+            metasound_path="/Game/Audio/MetaSounds/MS_Laser",
+            operations=[
+                {"op": "add_node", "ref": "osc", "node_class_name": "Saw", "node_variant": "Audio", "pos_x": 200},
+                {"op": "add_node", "ref": "env", "node_class_name": "AD Envelope", "node_variant": "Audio", "pos_x": 200, "pos_y": 200},
+                {"op": "set_input", "node_id": "osc", "input_name": "Frequency", "value": 880},
+                {"op": "connect", "source_node_id": "env", "source_pin_name": "Out Envelope",
+                 "target_node_id": "osc", "target_pin_name": "Amplitude"}
+            ]
+        )
+    """
+    params = {
+        "metasound_path": metasound_path,
+        "operations": operations
+    }
+    return await send_tcp_command("batch_edit_metasound", params)
+
+
 if __name__ == "__main__":
     app.run()
@@ -203,33 +203,42 @@ async def add_task_to_state(
 
 
 @app.tool()
-async def compile_state_tree(state_tree_path: str) -> Dict[str, Any]:
+async def compile_state_tree(state_tree_path: str, force: bool = False) -> Dict[str, Any]:
     """
     Compile a StateTree for runtime use.
 
     This validates the StateTree structure and prepares it for execution.
     Should be called after making changes to ensure the tree is valid.
+    Edits are not compiled as they are made; call this once when done.
+    If nothing changed since the last successful compile, the compile
+    (and save) is skipped.
 
     Args:
         state_tree_path: Path to the StateTree asset
+        force: Compile even if the tree is unchanged (default: False)
 
     Returns:
         Dictionary containing:
         - success: Whether compilation was successful
         - state_tree_name: Name of the compiled StateTree
+        - skipped: True when the tree was already up to date
+        - compile_ms: Time spent compiling and saving
+        - editor_data_hash: Hash of the editor data the compiled tree matches
         - message: Success/error message
     """
-    params = {"state_tree_path": state_tree_path}
+    params = {"state_tree_path": state_tree_path, "force": force}
     return await send_tcp_command("compile_state_tree", params)
 
 
 @app.tool()
-async def get_state_tree_metadata(state_tree_path: str) -> Dict[str, Any]:
+async def get_state_tree_metadata(state_tree_path: str, if_none_match: str = None) -> Dict[str, Any]:
     """
     Get metadata from a StateTree including its structure, states, tasks, and transitions.
 
     Args:
         state_tree_path: Path to the StateTree asset
+        if_none_match: Optional etag from a previous response. If the StateTree has not
+                       changed, the reply is just {"success": true, "not_modified": true, "etag": ...}.
 
     Returns:
         Dictionary containing:
@@ -250,6 +259,8 @@ async def get_state_tree_metadata(state_tree_path: str) -> Dict[str, Any]:
                 - children: Nested child states
     """
     params = {"state_tree_path": state_tree_path}
+    if if_none_match:
+        params["if_none_match"] = if_none_match
     return await send_tcp_command("get_state_tree_metadata", params)
 
 
@@ -1689,12 +1700,15 @@ async def set_state_selection_weight(
 @app.tool()
 async def batch_add_states(
     state_tree_path: str,
-    states: List[Dict[str, Any]]
+    states: List[Dict[str, Any]],
+    compile: bool = True
 ) -> Dict[str, Any]:
     """
     Add multiple states to a StateTree in a single operation.
 
-    Use this to efficiently create complex state hierarchies.
+    Use this to efficiently create complex state hierarchies. The asset is
+    loaded, saved and compiled once for the whole batch, and a parent may be
+    defined later in the same batch than its children.
 
     Args:
         state_tree_path: Path to the StateTree asset
@@ -1704,16 +1718,23 @@ async def batch_add_states(
             - state_type: Type of state (optional, default: "State")
             - selection_behavior: Child selection behavior (optional)
             - enabled: Whether state is enabled (optional, default: True)
+        compile: Compile the tree once after the batch (default: True)
 
     Returns:
         Dictionary containing:
         - success: Whether batch operation was successful
         - states_added: Number of states successfully added
+        - failed: Skipped states with index, state_name and error
+        - compiled: Whether the tree compiled after the batch
+        - compile_error: Compiler error when compile failed (edits are still saved)
+        - compile_skipped: True when the tree was already up to date
+        - compile_ms: Time spent compiling and saving
         - message: Success/error message
     """
     params = {
         "state_tree_path": state_tree_path,
-        "states": states
+        "states": states,
+        "compile": compile
     }
     return await send_tcp_command("batch_add_states", params)
 
@@ -1721,12 +1742,14 @@ async def batch_add_states(
 @app.tool()
 async def batch_add_transitions(
     state_tree_path: str,
-    transitions: List[Dict[str, Any]]
+    transitions: List[Dict[str, Any]],
+    compile: bool = True
 ) -> Dict[str, Any]:
     """
     Add multiple transitions to a StateTree in a single operation.
 
-    Use this to efficiently set up complex transition networks.
+    Use this to efficiently set up complex transition networks. The asset is
+    loaded, saved and compiled once for the whole batch.
 
     Args:
         state_tree_path: Path to the StateTree asset
@@ -1736,16 +1759,24 @@ async def batch_add_transitions(
             - trigger: Trigger type (optional, default: "OnStateCompleted")
             - transition_type: Transition type (optional, default: "GotoState")
             - priority: Priority level (optional, default: "Normal")
+            - event_tag: Gameplay tag for OnEvent triggers (optional)
+        compile: Compile the tree once after the batch (default: True)
 
     Returns:
         Dictionary containing:
         - success: Whether batch operation was successful
         - transitions_added: Number of transitions successfully added
+        - failed: Skipped transitions with index, source/target names and error
+        - compiled: Whether the tree compiled after the batch
+        - compile_error: Compiler error when compile failed (edits are still saved)
+        - compile_skipped: True when the tree was already up to date
+        - compile_ms: Time spent compiling and saving
         - message: Success/error message
     """
     params = {
         "state_tree_path": state_tree_path,
-        "transitions": transitions
+        "transitions": transitions,
+        "compile": compile
     }
     return await send_tcp_command("batch_add_transitions", params)
 
@@ -58,6 +58,25 @@ class BatchMaterialParamsTests(unittest.TestCase):
 
         asyncio.run(run_test())
 
+    def test_multi_instance_batch_forwards_instance_list_and_maps(self):
+        async def run_test():
+            with patch.object(material_mcp_server, "send_tcp_command", new_callable=AsyncMock) as send:
+                send.return_value = {"success": True}
+                await material_mcp_server.batch_set_material_instances_params(
+                    material_instances=["/Game/Test/MI_A.MI_A", "/Game/Test/MI_B.MI_B"],
+                    scalar_params={"WindStrength": 0.03},
+                    vector_params={"WindDirection": [1.0, 0.0, 0.0, 0.0]},
+                )
+
+            command, params = send.await_args.args
+            self.assertEqual(command, "batch_set_material_instances_params")
+            self.assertEqual(params["material_instances"], ["/Game/Test/MI_A.MI_A", "/Game/Test/MI_B.MI_B"])
+            self.assertEqual(params["scalar_params"], {"WindStrength": 0.03})
+            self.assertEqual(params["vector_params"], {"WindDirection": [1.0, 0.0, 0.0, 0.0]})
+            self.assertNotIn("texture_params", params)
+
+        asyncio.run(run_test())
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -42,6 +42,7 @@ class GPUStatsCaptureTests(unittest.TestCase):
             "get_scene_breakdown",
             "get_rendering_stats",
             "get_mesh_draw_stats",
+            "get_frame_telemetry",
             "start_pie",
             "stop_pie",
         }
@@ -167,6 +168,20 @@ class GPUStatsCaptureTests(unittest.TestCase):
         self.assertFalse(result["visibility"]["detailed_available"])
         send.assert_called_once_with("get_rendering_stats", {"action": "snapshot"})
 
+    def test_frame_telemetry_forwards_window_and_threshold(self):
+        mcp = FakeMCP()
+        editor_tools.register_editor_tools(mcp)
+        tool = mcp.tools["get_frame_telemetry"]
+        with patch.object(runtime_tools, "send_unreal_command") as send:
+            send.return_value = {"success": True, "sample_count": 600}
+            result = tool(None, window_seconds=5.0, hitch_threshold_ms=50.0)
+
+        self.assertEqual(result["sample_count"], 600)
+        send.assert_called_once_with(
+            "get_frame_telemetry",
+            {"window_seconds": 5.0, "hitch_threshold_ms": 50.0, "max_hitches": 20},
+        )
+
     def test_not_ready_capture_retries_before_cleanup(self):
         tool = get_registered_gpu_tool()
         with (
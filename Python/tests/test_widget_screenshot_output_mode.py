@@ -0,0 +1,63 @@
+from pathlib import Path
+import sys
+import unittest
+from unittest.mock import MagicMock, patch
+
+
+PYTHON_ROOT = Path(__file__).resolve().parents[1]
+sys.path.insert(0, str(PYTHON_ROOT))
+
+from utils.widgets import widget_screenshot
+
+
+class CaptureWidgetScreenshotOutputModeTests(unittest.TestCase):
+    def test_base64_mode_keeps_original_params(self):
+        with patch.object(widget_screenshot, "send_unreal_command") as send:
+            send.return_value = {"success": True, "image_base64": "AAAA"}
+            result = widget_screenshot.capture_widget_screenshot_impl(
+                MagicMock(), "WBP_MainMenu"
+            )
+
+        self.assertEqual(result, {"success": True, "image_base64": "AAAA"})
+        send.assert_called_once_with(
+            "capture_widget_screenshot",
+            {"widget_name": "WBP_MainMenu", "width": 800, "height": 600, "format": "png"},
+        )
+
+    def test_file_mode_forwards_output_path(self):
+        with patch.object(widget_screenshot, "send_unreal_command") as send:
+            send.return_value = {"success": True, "file_path": "C:/Shots/hud.png", "sha1": "ab"}
+            widget_screenshot.capture_widget_screenshot_impl(
+                MagicMock(),
+                "WBP_HUD",
+                3840,
+                2160,
+                output_mode="file",
+                output_path="C:/Shots/hud.png",
+            )
+
+        send.assert_called_once_with(
+            "capture_widget_screenshot",
+            {
+                "widget_name": "WBP_HUD",
+                "width": 3840,
+                "height": 2160,
+                "format": "png",
+                "output_mode": "file",
+                "output_path": "C:/Shots/hud.png",
+            },
+        )
+
+    def test_rejects_unknown_output_mode(self):
+        with patch.object(widget_screenshot, "send_unreal_command") as send:
+            result = widget_screenshot.capture_widget_screenshot_impl(
+                MagicMock(), "WBP_HUD", output_mode="mmap"
+            )
+
+        self.assertFalse(result["success"])
+        self.assertIn("output_mode", result["error"])
+        send.assert_not_called()
+
+
+if __name__ == "__main__":
+    unittest.main()
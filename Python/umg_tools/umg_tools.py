@@ -528,7 +528,8 @@ def register_umg_tools(mcp: FastMCP):
         ctx: Context,
         widget_name: str,
         fields: List[str] = None,
-        container_name: str = "CanvasPanel_0"
+        container_name: str = "CanvasPanel_0",
+        if_none_match: str = None
     ) -> Dict[str, Any]:
         """
         Get comprehensive metadata about a Widget Blueprint.
@@ -551,10 +552,13 @@ def register_umg_tools(mcp: FastMCP):
                 - "functions" - Blueprint functions with inputs/outputs
                 - "*" - Return all fields (default)
             container_name: Container name for dimensions field (default: "CanvasPanel_0")
+            if_none_match: Optional etag from a previous response. If the widget has not changed,
+                the reply is just {"success": true, "not_modified": true, "etag": ...}
 
         Returns:
             Dict containing:
                 - success (bool): True if the operation succeeded
+                - etag (str): Pass back as if_none_match on the next call
                 - widget_name (str): Name of the widget blueprint
                 - asset_path (str): Full asset path
                 - parent_class (str): Parent class name
@@ -601,7 +605,7 @@ def register_umg_tools(mcp: FastMCP):
                 fields=["components", "variables", "bindings"]
             )
         """
-        return get_widget_blueprint_metadata_impl(ctx, widget_name, fields, container_name)
+        return get_widget_blueprint_metadata_impl(ctx, widget_name, fields, container_name, if_none_match)
 
     @mcp.tool()
     def capture_widget_screenshot(
@@ -609,7 +613,9 @@ def register_umg_tools(mcp: FastMCP):
         widget_name: str,
         width: int = 800,
         height: int = 600,
-        format: str = "png"
+        format: str = "png",
+        output_mode: str = "base64",
+        output_path: str = ""
     ) -> Dict[str, Any]:
         """
         Capture a screenshot of a UMG Widget Blueprint preview.
@@ -622,11 +628,18 @@ def register_umg_tools(mcp: FastMCP):
             width: Screenshot width in pixels (default: 800, range: 1-8192)
             height: Screenshot height in pixels (default: 600, range: 1-8192)
             format: Image format - "png" (default) or "jpg"
+            output_mode: "base64" (default) returns the image inline; "file" writes it to
+                         disk and returns only file_path + sha1 (no Base64 inflation for
+                         large captures)
+            output_path: Destination file for "file" mode (default: Saved/Screenshots/MCP/)
 
         Returns:
             Dict containing:
                 - success: Whether the screenshot was captured
-                - image_base64: Base64-encoded image data (viewable by AI)
+                - output_mode: "base64" or "file"
+                - image_base64: Base64-encoded image data (viewable by AI; "base64" mode)
+                - file_path: Absolute path of the written image ("file" mode)
+                - sha1: Hex SHA-1 of the written image ("file" mode)
                 - width: Actual image width
                 - height: Actual image height
                 - format: Image format used
@@ -655,8 +668,17 @@ def register_umg_tools(mcp: FastMCP):
                 height=768,
                 format="jpg"
             )
+
+            # Large capture written to disk instead of inlined as Base64
+            result = capture_widget_screenshot(
+                widget_name="WBP_HUD",
+                width=3840,
+                height=2160,
+                output_mode="file"
+            )
+            print(result["file_path"], result["sha1"])
         """
-        return capture_widget_screenshot_impl(ctx, widget_name, width, height, format)
+        return capture_widget_screenshot_impl(ctx, widget_name, width, height, format, output_mode, output_path)
 
     @mcp.tool()
     def create_widget_input_handler(
@@ -14,6 +14,8 @@ logger = logging.getLogger("UnrealMCP")
 UNREAL_HOST = "127.0.0.1"
 UNREAL_PORT = 55557
 DEFAULT_COMMAND_TIMEOUT = 130.0
+DEFAULT_JOB_TIMEOUT = 600.0
+JOB_POLL_INTERVAL = 0.5
 MAX_RESPONSE_BYTES = 4 * 1024 * 1024
 RECV_CHUNK_SIZE = 8192
 
@@ -78,17 +80,66 @@ async def _send_tcp_command_impl(command_type: str, params: Dict[str, Any]) -> D
             pass
 
 
+def get_pending_job_id(response: Any) -> str:
+    """Return the job id when the bridge answered with a job handle instead of a result."""
+    if not isinstance(response, dict):
+        return ""
+    result = response.get("result")
+    if isinstance(result, dict) and result.get("job_pending"):
+        return result.get("job_id", "")
+    return ""
+
+
+def get_finished_job_response(status: Dict[str, Any]) -> Any:
+    """Return the original command response from a get_job_status reply, or None while running."""
+    result = status.get("result") if isinstance(status, dict) else None
+    if not isinstance(result, dict):
+        # Status query itself failed (unknown or evicted job); surface that error
+        return status
+    if result.get("state") == "running":
+        return None
+    if "response" in result:
+        return result["response"]
+    return {"status": "error", "error": f"Job {result.get('job_id')} {result.get('state')} without a result"}
+
+
+async def _wait_for_job(pending: Dict[str, Any], job_id: str, job_timeout: float) -> Dict[str, Any]:
+    loop = asyncio.get_running_loop()
+    deadline = loop.time() + job_timeout
+    while loop.time() < deadline:
+        await asyncio.sleep(JOB_POLL_INTERVAL)
+        status = await asyncio.wait_for(
+            _send_tcp_command_impl("get_job_status", {"job_id": job_id}),
+            timeout=DEFAULT_COMMAND_TIMEOUT,
+        )
+        response = get_finished_job_response(status)
+        if response is not None:
+            return response
+    logger.warning(f"Job {job_id} still running after {job_timeout} seconds; returning its handle")
+    return pending
+
+
 async def send_tcp_command(
     command_type: str,
     params: Dict[str, Any] = None,
     timeout: float = DEFAULT_COMMAND_TIMEOUT,
+    job_timeout: float = DEFAULT_JOB_TIMEOUT,
 ) -> Dict[str, Any]:
-    """Send a command to the Unreal Engine TCP server with a hard timeout."""
+    """Send a command to the Unreal Engine TCP server with a hard timeout.
+
+    Commands that outlive the bridge's inline wait come back as a job handle; those are
+    polled through get_job_status for up to job_timeout seconds and the original response
+    is returned. Pass job_timeout=0 to get the handle back immediately.
+    """
     try:
-        return await asyncio.wait_for(
+        response = await asyncio.wait_for(
             _send_tcp_command_impl(command_type, params or {}),
             timeout=timeout,
         )
+        job_id = get_pending_job_id(response)
+        if not job_id or job_timeout <= 0:
+            return response
+        return await _wait_for_job(response, job_id, job_timeout)
     except asyncio.TimeoutError:
         return {
             "success": False,
@@ -440,7 +440,8 @@ def get_blueprint_metadata(
     graph_name: str = None,
     node_type: str = None,
     event_type: str = None,
-    detail_level: str = None
+    detail_level: str = None,
+    if_none_match: str = None
 ) -> Dict[str, Any]:
     """Implementation for getting comprehensive metadata about a Blueprint.
 
@@ -460,6 +461,7 @@ def get_blueprint_metadata(
                      - "summary": Node IDs and titles only (minimal output)
                      - "flow": Node IDs, titles, and exec pin connections only (DEFAULT)
                      - "full": Everything including all data pin connections and default values
+        if_none_match: Optional etag from a previous response; unchanged Blueprints reply not_modified
 
     Returns:
         Dictionary containing requested metadata fields
@@ -495,6 +497,9 @@ def get_blueprint_metadata(
     if detail_level is not None:
         params["detail_level"] = detail_level
 
+    if if_none_match:
+        params["if_none_match"] = if_none_match
+
     return send_unreal_command("get_blueprint_metadata", params)
 
 
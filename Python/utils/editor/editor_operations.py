@@ -477,7 +477,15 @@ def import_texture(ctx: Context, source_file_path: str, asset_name: str,
                    folder_path: str = "/Game/Textures",
                    compression_settings: str = "Default",
                    srgb: bool = True,
-                   preserve_alpha: bool = True) -> Dict[str, Any]:
+                   preserve_alpha: bool = True,
+                   mip_flood: bool = False,
+                   alpha_threshold: float = None,
+                   preserve_alpha_coverage: bool = False,
+                   atlas_sources: List[str] = None,
+                   atlas_columns: int = 0,
+                   atlas_rows: int = 0,
+                   atlas_width: int = 0,
+                   atlas_height: int = 0) -> Dict[str, Any]:
     """Import a texture (PNG, TGA, TIF, JPEG, EXR, HDR, BMP) from disk into the Unreal project."""
     params = {
         "source_file_path": source_file_path,
@@ -487,5 +495,58 @@ def import_texture(ctx: Context, source_file_path: str, asset_name: str,
         "srgb": srgb,
         "preserve_alpha": preserve_alpha
     }
+    # Processing options are only sent when used so older plugin builds keep working
+    if mip_flood:
+        params["mip_flood"] = True
+    if preserve_alpha_coverage:
+        params["preserve_alpha_coverage"] = True
+    if alpha_threshold is not None:
+        params["alpha_threshold"] = alpha_threshold
+    if atlas_sources:
+        params["atlas_sources"] = atlas_sources
+        for key, value in (("atlas_columns", atlas_columns), ("atlas_rows", atlas_rows),
+                           ("atlas_width", atlas_width), ("atlas_height", atlas_height)):
+            if value:
+                params[key] = value
     logger.info(f"Importing texture '{asset_name}' from '{source_file_path}'")
     return send_unreal_command("import_texture", params)
+
+
+def bulk_import(ctx: Context, files: List[Any],
+                folder_path: str = "",
+                frame_budget_ms: float = 8.0,
+                max_concurrent_reads: int = 4,
+                options: Dict[str, Any] = None) -> Dict[str, Any]:
+    """Queue many mesh/texture/sound files for import; returns a job_id to poll."""
+    params = {
+        "files": files,
+        "frame_budget_ms": frame_budget_ms,
+        "max_concurrent_reads": max_concurrent_reads
+    }
+    if folder_path:
+        params["folder_path"] = folder_path
+    if options:
+        params.update(options)
+    logger.info(f"Queueing bulk import of {len(files)} file(s)")
+    return send_unreal_command("bulk_import", params)
+
+
+def get_bulk_import_status(ctx: Context, job_id: str, include_items: bool = True) -> Dict[str, Any]:
+    """Report progress of a bulk_import job."""
+    params = {"job_id": job_id, "include_items": include_items}
+    return send_unreal_command("get_bulk_import_status", params)
+
+
+def get_job_status(ctx: Context, job_id: str) -> Dict[str, Any]:
+    """Report a job's state and, once finished, the command's original response."""
+    return send_unreal_command("get_job_status", {"job_id": job_id})
+
+
+def cancel_job(ctx: Context, job_id: str) -> Dict[str, Any]:
+    """Request cancellation of a running job."""
+    return send_unreal_command("cancel_job", {"job_id": job_id})
+
+
+def list_jobs(ctx: Context, running_only: bool = False) -> Dict[str, Any]:
+    """List retained jobs, newest first."""
+    return send_unreal_command("list_jobs", {"running_only": running_only})
@@ -55,7 +55,8 @@ def create_material_instance(
 def get_material_metadata(
     ctx: Context,
     material_path: str,
-    fields: List[str] = None
+    fields: List[str] = None,
+    if_none_match: str = None
 ) -> Dict[str, Any]:
     """Implementation for getting material metadata."""
     params = {
@@ -65,6 +66,9 @@ def get_material_metadata(
     if fields is not None:
         params["fields"] = fields
 
+    if if_none_match:
+        params["if_none_match"] = if_none_match
+
     logger.info(f"Getting metadata for material '{material_path}' with fields: {fields}")
     return send_unreal_command("get_material_metadata", params)
 
@@ -8,8 +8,16 @@ import logging
 import os
 import socket
 import json
+import time
 from typing import Dict, Any, Optional
 
+from utils.async_tcp_utils import (
+    DEFAULT_JOB_TIMEOUT,
+    JOB_POLL_INTERVAL,
+    get_finished_job_response,
+    get_pending_job_id,
+)
+
 # Get logger
 logger = logging.getLogger("UnrealMCP")
 
@@ -148,7 +156,33 @@ class UnrealConnection:
             raise
 
     def send_command(self, command: str, params: Dict[str, Any] = None) -> Optional[Dict[str, Any]]:
-        """Send a command to Unreal Engine and get the response."""
+        """Send a command to Unreal Engine and get the response.
+
+        Commands the bridge hands off to a job are polled via get_job_status until they
+        finish, so callers always receive the command's own response.
+        """
+        response = self._send_once(command, params)
+        job_id = get_pending_job_id(response)
+        if job_id:
+            response = self._wait_for_job(response, job_id)
+        return response
+
+    def _wait_for_job(self, pending: Dict[str, Any], job_id: str) -> Dict[str, Any]:
+        """Poll get_job_status until a handed-off command finishes; returns its original response."""
+        deadline = time.monotonic() + DEFAULT_JOB_TIMEOUT
+        while time.monotonic() < deadline:
+            time.sleep(JOB_POLL_INTERVAL)
+            status = self._send_once("get_job_status", {"job_id": job_id})
+            if not status:
+                continue
+            response = get_finished_job_response(status)
+            if response is not None:
+                return response
+        logger.warning(f"Job {job_id} still running after {DEFAULT_JOB_TIMEOUT} seconds; returning its handle")
+        return pending
+
+    def _send_once(self, command: str, params: Dict[str, Any] = None) -> Optional[Dict[str, Any]]:
+        """Send one request over a fresh socket and return the bridge's reply as-is."""
         if self.socket:
             try:
                 self.socket.close()
@@ -445,7 +445,8 @@ def get_widget_blueprint_metadata_impl(
     ctx: Context,
     widget_name: str,
     fields: List[str] = None,
-    container_name: str = "CanvasPanel_0"
+    container_name: str = "CanvasPanel_0",
+    if_none_match: str = None
 ) -> Dict[str, Any]:
     """Implementation for getting comprehensive metadata about a Widget Blueprint.
 
@@ -468,6 +469,7 @@ def get_widget_blueprint_metadata_impl(
             - "functions" - Blueprint functions
             - "*" - Return all fields (default)
         container_name: Container name for dimensions field (default: "CanvasPanel_0")
+        if_none_match: Optional etag from a previous response; unchanged widgets reply not_modified
 
     Returns:
         Dict containing the requested metadata fields
@@ -482,6 +484,9 @@ def get_widget_blueprint_metadata_impl(
     if container_name:
         params["container_name"] = container_name
 
+    if if_none_match:
+        params["if_none_match"] = if_none_match
+
     logger.info(f"Getting widget blueprint metadata for: {widget_name}, fields: {fields}")
     return send_unreal_command("get_widget_blueprint_metadata", params)
 
@@ -17,7 +17,9 @@ def capture_widget_screenshot_impl(
     widget_name: str,
     width: int = 800,
     height: int = 600,
-    format: str = "png"
+    format: str = "png",
+    output_mode: str = "base64",
+    output_path: str = ""
 ) -> Dict[str, Any]:
     """
     Capture a screenshot of a UMG Widget Blueprint preview.
@@ -30,11 +32,17 @@ def capture_widget_screenshot_impl(
         width: Screenshot width in pixels (default: 800, max: 8192)
         height: Screenshot height in pixels (default: 600, max: 8192)
         format: Image format - "png" or "jpg" (default: "png")
+        output_mode: "base64" (default) to return the image inline, or "file" to have
+                     Unreal write it to disk and return only its path and SHA-1
+        output_path: Destination file for "file" mode (default: Saved/Screenshots/MCP/)
 
     Returns:
         Dict containing:
         - success: bool - Whether the screenshot was captured successfully
-        - image_base64: str - Base64-encoded image data (if successful)
+        - output_mode: str - "base64" or "file"
+        - image_base64: str - Base64-encoded image data ("base64" mode)
+        - file_path: str - Absolute path of the written image ("file" mode)
+        - sha1: str - Hex SHA-1 of the written image ("file" mode)
         - width: int - Actual image width
         - height: int - Actual image height
         - format: str - Image format used
@@ -84,14 +92,27 @@ def capture_widget_screenshot_impl(
             "message": f"Failed to capture screenshot: unsupported format '{format}'"
         }
 
+    if output_mode not in ("base64", "file"):
+        return {
+            "success": False,
+            "error": f"Invalid output_mode: {output_mode}. Must be 'base64' or 'file'",
+            "message": f"Failed to capture screenshot: unsupported output_mode '{output_mode}'"
+        }
+
+    params = {
+        "widget_name": widget_name,
+        "width": width,
+        "height": height,
+        "format": format_lower
+    }
+    if output_mode == "file":
+        params["output_mode"] = output_mode
+        if output_path:
+            params["output_path"] = output_path
+
     try:
         # Send command to Unreal Engine
-        response = send_unreal_command("capture_widget_screenshot", {
-            "widget_name": widget_name,
-            "width": width,
-            "height": height,
-            "format": format_lower
-        })
+        response = send_unreal_command("capture_widget_screenshot", params)
 
         # Log result
         if response.get("success"):